@@ -69,11 +69,15 @@
 #include "f2d_float2Double.h"
 #include "can_canRuntime.h"
 #include "sio_serialIO.h"
+#include "dlg_deferredLogging.h"
 #include "cmd_canCommand.h"
 #include "pwm_pwmIODriver.h"
 #include "c2p_canToPWM.h"
 #include "lwip/def.h"
 #include "lwd_lwIpDemo.h"
+#include "umt_udpMulticastTelemetry.h"
+#include "cgw_canGatewayUdp.h"
+#include "lws_lwIPStatistics.h"
 
 /*
  * Defines
@@ -342,6 +346,8 @@ static void help()
     "PWM n f [dc]: PWM output. n: 1 means PA1 at J3, pin 1; 2/4/5 means USR_LED2/4/5 at"
     " PA0/4/7\r\n"
     "ping (a b c d|off): Start pinging IPv4 server a.b.c.d or turn pinging off\r\n"
+    "lwIP [stat|suggest|reset]: Print usage of lwIP heap, pools and Ethernet buffers,"
+    " suggest their sizes or reset the maximum and error counts\r\n"
     "time: Print current time once\r\n"
     "time hour min [sec]: Set current time\r\n";
 
@@ -394,7 +400,7 @@ static void printCurrTime(void)
 {
     char msgTime[9];
     apt_printCurrTime(msgTime, sizeof(msgTime));
-    iprintf("Current time is %s\r\n", msgTime);
+    DLG_LOG("Current time is %s\r\n", msgTime);
 
 } /* printCurrTime */
 
@@ -465,6 +471,15 @@ int32_t bsw_taskUserInit(uint32_t PID ATTRIB_DBG_ONLY)
     /* Initialize the lwIP stack and the applications building on top. */
     lwd_lwIpDemo_init();
 
+    /* The CAN telemetry and the CAN-over-UDP gateway forward the raw CAN frames. They are
+       notified by the CAN stack about all received frames. */
+    if(!can_registerRxFrameListener(umt_onReceiveFrame)
+       ||  !can_registerRxFrameListener(cgw_onReceiveFrame)
+      )
+    {
+        success = false;
+    }
+
     return success? 0: -1;
 
 } /* End of bsw_taskUserInit */
@@ -587,6 +602,9 @@ int32_t bsw_taskUser10ms(uint32_t PID ATTRIB_DBG_ONLY, uint32_t taskParam ATTRIB
         }
     }
 
+    /* Continue printing a requested report of the lwIP memory statistics. */
+    lws_printReport();
+
     /* Look for possible user input through serial interface. */
     static unsigned int DATA_P1(cntIdleLoops_) = 2800;
     char inputMsg[80+1];
@@ -628,7 +646,7 @@ int32_t bsw_taskUser10ms(uint32_t PID ATTRIB_DBG_ONLY, uint32_t taskParam ATTRIB
                 const unsigned int loadTimesTen = bsw_cpuLoad
                                  , load = loadTimesTen/10
                                  , tens = loadTimesTen - load*10;
-                iprintf("Current CPU load %u.%u%%\r\n", load, tens);
+                DLG_LOG("Current CPU load %u.%u%%\r\n", load, tens);
             }
             else if(strcmp(argV[0], "time") == 0)
             {
@@ -710,6 +728,27 @@ int32_t bsw_taskUser10ms(uint32_t PID ATTRIB_DBG_ONLY, uint32_t taskParam ATTRIB
                            );
                 }
             }
+            else if(strcmp(argV[0], "lwIP") == 0)
+            {
+                lws_kindOfReport_t kindOfReport = lws_kindOfRpt_statistics;
+                bool isArgOk = true;
+                if(argC == 2u)
+                {
+                    if(strcmp(argV[1], "suggest") == 0)
+                        kindOfReport = lws_kindOfRpt_suggestion;
+                    else if(strcmp(argV[1], "reset") == 0)
+                        kindOfReport = lws_kindOfRpt_reset;
+                    else
+                        isArgOk = strcmp(argV[1], "stat") == 0;
+                }
+                else
+                    isArgOk = argC == 1u;
+
+                if(!isArgOk)
+                    iprintf("Bad argument for command lwIP. Type `help'\r\n");
+                else if(!lws_requestReport(kindOfReport))
+                    iprintf("Previous lwIP report is still in progress\r\n");
+            }
             else
             {
                 didNotUnderstand = true;
@@ -807,7 +846,7 @@ int32_t bsw_taskUser100ms(uint32_t PID ATTRIB_DBG_ONLY, uint32_t taskParam ATTRI
             }
             else
             {
-                iprintf( "apt: Can't send message %u, ID=0x%X, error %i\r\n"
+                DLG_LOG( "apt: Can't send message %u, ID=0x%X, error %i\r\n"
                        , cntTx_
                        , canId_
                        , (int)errCode
@@ -887,13 +926,13 @@ int32_t bsw_taskUser1000ms(uint32_t PID ATTRIB_DBG_ONLY, uint32_t taskParam ATTR
                                                     )
                   , dutyCycle = tiDuty * f;
 
-        printf( "PWM at input PA2/PA6: %.3f Hz/%.3f ms (%s/%s result), DC: %.1f%%\r\n"
-              , f2d(f)
-              , f2d(1000.0f*tiDuty)
-              , isNewResultPA2? "new": "old"
-              , isNewResultPA6? "new": "old"
-              , f2d(dutyCycle <= 1.0f? 100.0f*dutyCycle: -1.0f)
-              );
+        DLG_LOG( "PWM at input PA2/PA6: %.3f Hz/%.3f ms (%s/%s result), DC: %.1f%%\r\n"
+               , f
+               , 1000.0f*tiDuty
+               , isNewResultPA2? "new": "old"
+               , isNewResultPA6? "new": "old"
+               , dutyCycle <= 1.0f? 100.0f*dutyCycle: -1.0f
+               );
     }
 
     return 0;
@@ -36,6 +36,8 @@
 #include <assert.h>
 #include "typ_types.h"
 #include "cap_canApi.h"
+#include "cdt_canDataTables.h"
+#include "msn_messageSnapshot.h"
 #include "rtos.h"
 #include "bsw_basicSoftware.h"
 #include "pwm_pwmIODriver.h"
@@ -100,27 +102,35 @@ void c2p_mainFunction100ms(void)
           are broadcasted
 #endif
 
-    /* For reading and updating the global CAN API, we need a critical section with the CAN
-       stack task, that packs the messages and sends them out. This is the task, which runs
-       the main function of the (only) CAN dispatcher, cde_dispatcherMain(). */
-#if defined(CAP_MSG_PWM_PWM_IN_1000) || defined(CAP_MSG_PWM_PWM_OUT_1001)
-    uint32_t oldStateTx = rtos_suspendAllTasksByPriority(BSW_PRIO_USER_TASK_10MS);
-#endif
-
+    /* For updating the global CAN API, we need a critical section with the CAN stack task,
+       that packs the messages and sends them out. This is the task, which runs the main
+       function of the (only) CAN dispatcher, cde_dispatcherMain(). */
 #ifdef CAP_MSG_PWM_PWM_IN_1000
+    uint32_t oldStateTx = rtos_suspendAllTasksByPriority(BSW_PRIO_USER_TASK_10MS);
     cap_getSignal_PWM_PWM_in_1000(PA2_J3_pin3_isNew)      = isNewPeriodTime;
     cap_getSignal_PWM_PWM_in_1000(PA2_J3_pin3_periodTime) = PA2_J3_pin3_periodTime;
     cap_getSignal_PWM_PWM_in_1000(PA6_J2_pin1_isNew)      = isNewDutyTime;
     cap_getSignal_PWM_PWM_in_1000(PA6_J2_pin1_dutyTime)   = PA6_J2_pin1_dutyTime;
     cap_getSignal_PWM_PWM_in_1000(PA2_J3_pin3_frequency)  = PA2_J3_pin3_frequency;
     cap_getSignal_PWM_PWM_in_1000(PA2_PA6_dutyCycle)      = PA2_PA6_dutyCycle;
+    rtos_resumeAllTasksByPriority(oldStateTx);
 #endif
+
+    /* The received PWM commands are read from the snapshot of the inbound message. This
+       doesn't require a critical section. A command is applied only once: The channel is
+       controlled only if the message has been received since the previous step and if
+       the command is not inhibited. */
 #ifdef CAP_MSG_PWM_PWM_OUT_1001
+    static unsigned int SBSS_P1(noRxPwmOutLast_) = 0u;
+    cap_PWM_PWM_out_1001_sts_t pwmOut;
+    msn_readSnapshot(&cdt_snapshot_PWM_PWM_out_1001, &pwmOut, sizeof(pwmOut));
+    const bool isNewPwmOut = pwmOut.infoTransmission.noTransmittedMsgs != noRxPwmOutLast_;
+    noRxPwmOutLast_ = pwmOut.infoTransmission.noTransmittedMsgs;
+
 # define GET_PWM_CAN_CMD(chn)                                                               \
-    const bool doCtrl_##chn = !cap_getSignal_PWM_PWM_out_1001(chn##_inhibit);               \
-    cap_getSignal_PWM_PWM_out_1001(chn##_inhibit) = true; /* Acknowlegde input */           \
-    const uint16_t chn##_frequency = cap_getSignal_PWM_PWM_out_1001(chn##_frequency);       \
-    const uint16_t chn##_dutyCycle = cap_getSignal_PWM_PWM_out_1001(chn##_dutyCycle);
+    const bool doCtrl_##chn = isNewPwmOut  &&  !pwmOut.signals.chn##_inhibit;               \
+    const uint16_t chn##_frequency = pwmOut.signals.chn##_frequency;                        \
+    const uint16_t chn##_dutyCycle = pwmOut.signals.chn##_dutyCycle;
 
     GET_PWM_CAN_CMD(LED_2_DS10)
     GET_PWM_CAN_CMD(LED_4_DS11)
@@ -129,10 +139,6 @@ void c2p_mainFunction100ms(void)
     
 #undef GET_PWM_CAN_CMD
 #endif
-    
-#if defined(CAP_MSG_PWM_PWM_IN_1000) || defined(CAP_MSG_PWM_PWM_OUT_1001)
-    rtos_resumeAllTasksByPriority(oldStateTx);
-#endif
 
 #if defined(CAP_MSG_PWM_PWM_OUT_1001)
 # define UPDATE_PWM_CHN(chn)                                                                \
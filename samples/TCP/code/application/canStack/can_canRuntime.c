@@ -36,10 +36,11 @@
  */
 /* Module interface
  *   can_initCanStack
+ *   can_registerRxFrameListener
  *   can_mainFunction_10ms
  * Local functions
  *   onMsgReception
- *   onMsgInTimeout
+ *   onRxTimeout
  *   onInitReceivedMsgs
  *   protectAndSendMsg
  *   onSendRegularMsg
@@ -55,6 +56,7 @@
 
 #include "can_canRuntime.h"
 
+#include <string.h>
 #include <assert.h>
 
 #include "typ_types.h"
@@ -65,6 +67,12 @@
 #include "ede_eventDispatcherEngine.h"
 #include "cst_canStatistics.h"
 #include "cdt_canDataTables.h"
+#include "msn_messageSnapshot.h"
+#include "rts_rxTimeoutSupervision.h"
+#if CAN_USE_TABLE_DRIVEN_PACK_UNPACK == 1
+# include "pku_packUnpack.h"
+# include "csd_canSignalDescriptors.h"
+#endif
 #include "cmd_canCommand.h"
 #include "bsw_canInterface.h"
 
@@ -75,6 +83,9 @@
 /** The index of the dispatcher that serves the 10ms APSW task with CAN related events. */
 #define IDX_DISPATCHER_10MS     0
 
+/** The tick of the dispatcher for the 10ms APSW task in ms. */
+#define TI_TICK_DISPATCHER_10MS 10
+
 /** This macro is a primitive way to define the timeout span for received messages. It maps
     the nominal maximum time span between two reception events onto the time span after
     which the CAN interface should decide on timeout. The latter time span needs to be
@@ -124,12 +135,21 @@ typedef struct hdlCtxDataOutMixed_t
 static ede_handleDispatcherSystem_t SDATA_P1(_hDispatcherSystem) =
                                                         EDE_INVALID_DISPATCHER_SYSTEM_HANDLE;
 
-/** The handler for inbound messages requires local context data for regular and mixed mode
-    messages. Here's an array of context data objects, one for each such message; the entries
-    for regular messages precede those for mixed mode messages. */
-static ede_handleTimer_t BSS_P1(_hTimerInTimeoutAry)[CST_NO_CAN_MSGS_RECEIVED_REGULAR
-                                                     + CST_NO_CAN_MSGS_RECEIVED_MIXED
-                                                    ];
+/** The time of the CAN interface engine in ms. It advances by one tick of the dispatcher
+    in each call of can_mainFunction_10ms() and it is the time base of the timeout
+    supervision of the inbound messages. The value wraps around. */
+static int32_t SBSS_P1(_tiNow) = 0;
+
+/** The contents of the most recent reception of each inbound message. Used to detect the
+    changed signals of the next reception. */
+static uint8_t BSS_P1(_lastRxPayloadAry)[CST_NO_CAN_MSGS_RECEIVED]
+                                        [CDT_MAX_SIZE_OF_RX_PDU];
+
+/** The functions, which are notified about every received CAN frame. */
+static can_fctOnReceiveFrame_t BSS_P1(_rxFrameListenerAry)[CAN_MAX_NO_RX_FRAME_LISTENERS];
+
+/** The number of registered functions in \a _rxFrameListenerAry. */
+static unsigned int SBSS_P1(_noRxFrameListeners) = 0u;
 
 /** The handler for outbound mixed mode messages requires local context data. Here's an array
     of context data objects, one for each such message. */
@@ -171,32 +191,20 @@ static void onMsgReception(const ede_callbackContext_t *pContext)
     assert(pRxFrDesc->pInfoTransmission != NULL);
 
     /* Reset the never received bit in the transmission status. */
+    const bool isFirstReception = (pRxFrDesc->pInfoTransmission->stsTransmission
+                                   & cap_stsTransm_neverReceived
+                                  ) != 0u;
     pRxFrDesc->pInfoTransmission->stsTransmission &= ~cap_stsTransm_neverReceived;
 
-    /* Some transmission pattern have a timeout supervision. Retrigger the timer and clear
+    /* Some transmission pattern have a timeout supervision. Move the deadline and clear
        a possibly set timeout error bit. */
     if(pRxFrDesc->sendMode != CAN_ENUM_SEND_MODE_EVENT)
     {
-        unsigned int idxHandlerCtxData;
-        if(pRxFrDesc->sendMode == CAN_ENUM_SEND_MODE_REGULAR)
-            idxHandlerCtxData = pRxFrDesc->idxHandlerCtxData;
-        else
-        {
-            assert(pRxFrDesc->sendMode == CAN_ENUM_SEND_MODE_MIXED);
-
-            /* Both transmission patterns share the same handler context data. The entries
-               for mode mixed are placed behind those of mode regular. */
-            idxHandlerCtxData = pRxFrDesc->idxHandlerCtxData
-                                + CST_NO_CAN_MSGS_RECEIVED_REGULAR;
-        }
-
-        assert(idxHandlerCtxData < sizeOfAry(_hTimerInTimeoutAry)
-               &&  _hTimerInTimeoutAry[idxHandlerCtxData] != EDE_INVALID_TIMER_HANDLE
-              );
-        ede_retriggerSingleShotTimer( pContext
-                                    , _hTimerInTimeoutAry[idxHandlerCtxData]
-                                    , /* tiNewFromNow */ TIMEOUT(pRxFrDesc->tiCycle)
-                                    );
+        rts_armTimeout( idxRxFr
+                      , /* tiDeadline */ (int32_t)((uint32_t)_tiNow
+                                                   + (uint32_t)TIMEOUT(pRxFrDesc->tiCycle)
+                                                  )
+                      );
 
         /* Reset the timeout error in the message related status word. */
         pRxFrDesc->pInfoTransmission->stsTransmission &= ~cap_stsTransm_errTimeout;
@@ -208,6 +216,18 @@ static void onMsgReception(const ede_callbackContext_t *pContext)
     const uint8_t *msgContents = ede_getEventData(pContext, &sizeOfEvData);
     assert(sizeOfEvData <= 8);
 
+    /* The raw frame is passed to the registered listeners, e.g., IP applications, which
+       forward it. */
+    for(unsigned int u=0u; u<_noRxFrameListeners; ++u)
+    {
+        _rxFrameListenerAry[u]( /* idxBus */ ede_getKindOfEvent(pContext)
+                              , pRxFrDesc->canId
+                              , pRxFrDesc->isExtId
+                              , msgContents
+                              , /* DLC */ sizeOfEvData
+                              );
+    }
+
 /// @todo E2E has not been adopted from the original sample code
 //    /* Run the message specific E2E protection method. By side effect, and only on success,
 //       the data is written into the global API at the same time. (Where nobody will ever
@@ -215,8 +235,31 @@ static void onMsgReception(const ede_callbackContext_t *pContext)
 //    const boolean_t e2eOkay = pRxFrDesc->fctUnpackApiMsgAndValidate(msgContents);
     const bool e2eOkay = true;
 
-    /* Run the message decomposition. The signal data is written into the global API. */
-    pRxFrDesc->fctUnpackApiMsg(msgContents);
+    /* Run the message decomposition. The signal data is written into the global API. The
+       message contents are compared with those of the previous reception. The table
+       driven unpacking decodes only the changed signals. The generated unpack function
+       can only decode the message as a whole; it is skipped if nothing changed and
+       otherwise all signals are reported as changed. On first reception, the stored
+       previous contents are meaningless and all signals are decoded. */
+    assert(pRxFrDesc->size <= sizeof(_lastRxPayloadAry[idxRxFr]));
+#if CAN_USE_TABLE_DRIVEN_PACK_UNPACK == 1
+    assert(csd_rxPduDescAry[idxRxFr].size == pRxFrDesc->size);
+    const uint64_t changedSignals = pku_unpackApiChangedSignals( &csd_rxPduDescAry[idxRxFr]
+                                                               , msgContents
+                                                               , _lastRxPayloadAry[idxRxFr]
+                                                               , isFirstReception
+                                                               );
+#else
+    uint64_t changedSignals = 0u;
+    if(isFirstReception
+       ||  memcmp(msgContents, _lastRxPayloadAry[idxRxFr], pRxFrDesc->size) != 0
+      )
+    {
+        memcpy(_lastRxPayloadAry[idxRxFr], msgContents, pRxFrDesc->size);
+        pRxFrDesc->fctUnpackApiMsg(msgContents);
+        changedSignals = ~0ull;
+    }
+#endif
 
     /* Indicate the E2E validation result to the APSW. */
     if(e2eOkay)
@@ -227,6 +270,7 @@ static void onMsgReception(const ede_callbackContext_t *pContext)
            CAN API has not been updated with new signal values and no reception event must
            be notified. */
         pRxFrDesc->pInfoTransmission->stsTransmission |= cap_stTransm_newDataAvailable;
+        pRxFrDesc->pInfoTransmission->changedSignals |= changedSignals;
         ++ pRxFrDesc->pInfoTransmission->noTransmittedMsgs;
         
         /* This application makes use of a callback in order to be notified about any
@@ -242,25 +286,24 @@ static void onMsgReception(const ede_callbackContext_t *pContext)
         pRxFrDesc->pInfoTransmission->stsTransmission |= cap_stsTransm_errChecksum;
     }
 
+    /* Make the updated message struct available to the APSW tasks on all cores. */
+    msn_publishSnapshot(pRxFrDesc->pSnapshot);
+
 } /* End of onMsgReception */
 
 
 
 /**
- * Timer callback for all inbound messages, which a timeout is defined for. The timer is
- * retriggered on each message reception event and if it eventually fires then it is a
- * timeout event for the related message.
- *   @param pContext
- * The dispatcher context, which the callback is invoked in.
+ * Timeout callback for all inbound messages, which a timeout is defined for. The deadline
+ * is moved on each message reception event and if it eventually elapses then it is a
+ * timeout event for the related message. The callback is invoked from the timeout
+ * supervision in can_mainFunction_10ms().
+ *   @param idxRxFr
+ * The index of the message into the CDE data tables.
  */
-static void onMsgInTimeout(const ede_callbackContext_t *pContext)
+static void onRxTimeout(unsigned int idxRxFr)
 {
-    /* Double-check that this callback is called from an expected context. */
-    assert(ede_getKindOfEvent(pContext) == EDE_EV_TIMER_ELAPSED);
-
-    /* Get the CDE index of the message, which is the index into the CDE data tables at the
-       same time. This has been ensured by the message registration process. */
-    const unsigned int idxRxFr = ede_getIdxExternalEventSource(pContext);
+    assert(idxRxFr < sizeOfAry(cdt_canRxMsgAry));
     const cdt_canMessage_t *const pRxFrDesc = &cdt_canRxMsgAry[idxRxFr];
 
     /* Test: Do some consistency tests. */
@@ -275,14 +318,15 @@ static void onMsgInTimeout(const ede_callbackContext_t *pContext)
 
     /* Set timeout error in message related status word. */
     pRxFrDesc->pInfoTransmission->stsTransmission |= cap_stsTransm_errTimeout;
+    msn_publishSnapshot(pRxFrDesc->pSnapshot);
 
-} /* End of onMsgInTimeout */
+} /* End of onRxTimeout */
 
 
 
 /**
- * The initialization callback for all received messages. Timers are created that implement
- * the timming supervision.
+ * The initialization callback for all received messages. The timing supervision is
+ * started.
  *   @param pContext
  * The dispatcher context, which the callback is invoked in.
  */
@@ -302,37 +346,17 @@ static void onInitReceivedMsgs(const ede_callbackContext_t *pContext)
     const cdt_canMessage_t *const pRxFrDesc = &cdt_canRxMsgAry[idxRxFr];
     assert(pRxFrDesc->pInfoTransmission->stsTransmission == cap_stsTransm_neverReceived);
 
-    /* All but pure event messages get a timeout counter. The handle needs to be accessible
-       since the timer requires retriggering on reception. We use handler context data,
-       which can be implemented by direct array lookup using the information in the
-       auto-coded CDE data tables. */
+    /* All but pure event messages get a timeout supervision. We don't use a dispatcher
+       timer per message; a single sweep over the dense array of deadlines in each tick is
+       much cheaper in RAM and CPU load if there are many inbound messages. */
     if(pRxFrDesc->sendMode != CAN_ENUM_SEND_MODE_EVENT)
     {
-        unsigned int idxHandlerCtxData;
-        if(pRxFrDesc->sendMode == CAN_ENUM_SEND_MODE_REGULAR)
-            idxHandlerCtxData = pRxFrDesc->idxHandlerCtxData;
-        else
-        {
-            assert(pRxFrDesc->sendMode == CAN_ENUM_SEND_MODE_MIXED);
-
-            /* Both transmission patterns share the same handler context data. The entries
-               for mode mixed are placed behind those of mode regular. */
-            idxHandlerCtxData = pRxFrDesc->idxHandlerCtxData
-                                + CST_NO_CAN_MSGS_RECEIVED_REGULAR;
-        }
-
-        assert(idxHandlerCtxData < sizeOfAry(_hTimerInTimeoutAry)
-               &&  _hTimerInTimeoutAry[idxHandlerCtxData] == EDE_INVALID_TIMER_HANDLE
-              );
-        _hTimerInTimeoutAry[idxHandlerCtxData] =
-            ede_createSingleShotTimer( pContext
-                                     , /* tiFromNow */ TIMEOUT(pRxFrDesc->tiCycle)
-                                     , /* callback */ onMsgInTimeout
-                                     , /* killAtDueTime */ false
-                                     );
-        assert(_hTimerInTimeoutAry[idxHandlerCtxData] != EDE_INVALID_TIMER_HANDLE);
-
-    } /* if(Do we require a timeout timer for the given transmission pattern?) */
+        rts_armTimeout( idxRxFr
+                      , /* tiDeadline */ (int32_t)((uint32_t)_tiNow
+                                                   + (uint32_t)TIMEOUT(pRxFrDesc->tiCycle)
+                                                  )
+                      );
+    }
 
 } /* End of onInitReceivedMsgs */
 
@@ -359,7 +383,11 @@ static void protectAndSendMsg(const ede_callbackContext_t * const pContext)
 
     /* Pack the message. */
     uint8_t msgContent[pTxFrDesc->size];
+#if CAN_USE_TABLE_DRIVEN_PACK_UNPACK == 1
+    pku_packApi(&csd_txPduDescAry[idxTxFr], &msgContent[0]);
+#else
     pTxFrDesc->fctPackApiMsg(&msgContent[0]);
+#endif
 
     /* The handle in the CAN driver of the message to send has been stored in the event
        source object at registration time. */
@@ -650,8 +678,9 @@ bool can_initCanStack(void)
 {
     /* Initialize the global data of this module. */
     unsigned int u;
-    for(u=0; u<sizeOfAry(_hTimerInTimeoutAry); ++u)
-        _hTimerInTimeoutAry[u] = EDE_INVALID_TIMER_HANDLE;
+    _tiNow = 0;
+    _noRxFrameListeners = 0u;
+    rts_initRxTimeoutSupervision();
     for(u=0; u<sizeOfAry(_hdlCtxDataOutMixedAry); ++u)
     {
         _hdlCtxDataOutMixedAry[u].hTimerDueCheck = EDE_INVALID_TIMER_HANDLE;
@@ -717,7 +746,7 @@ bool can_initCanStack(void)
     {
         success = ede_createDispatcher( _hDispatcherSystem
                                       , /* idxDispatcher */ IDX_DISPATCHER_10MS
-                                      , /* tiTick */ 10 /* ms */
+                                      , /* tiTick */ TI_TICK_DISPATCHER_10MS
                                       , /* portAry */ &portDispatcher
                                       , /* noPorts */ 1u
                                       , /* mapSdrEvHdlToEdeEvSrcIdx */ handleMap
@@ -776,6 +805,7 @@ bool can_initCanStack(void)
         /* The never received bit is initially set in the transmission status. All other
            status bits are cleared. */
         pRxFrDesc->pInfoTransmission->stsTransmission = cap_stsTransm_neverReceived;
+        msn_publishSnapshot(pRxFrDesc->pSnapshot);
 
         if(success)
         {
@@ -846,6 +876,32 @@ bool can_initCanStack(void)
 } /* End of can_initCanStack */
 
 
+
+/**
+ * Register a function for notification about all received CAN frames. The function is
+ * called from the CAN task for each received frame, before the frame is unpacked into
+ * the global CAN API. It needs to be fast and it must not block.\n
+ *   This function must be called after can_initCanStack() and before the CAN task
+ * starts, i.e., from the initialization of the process, which owns the CAN stack. No race
+ * conditions with the notification are considered.
+ *   @return
+ * Get \a true if the function could be registered or \a false if all
+ * #CAN_MAX_NO_RX_FRAME_LISTENERS places are already in use.
+ *   @param fctOnReceiveFrame
+ * The function to be notified.
+ */
+bool can_registerRxFrameListener(can_fctOnReceiveFrame_t fctOnReceiveFrame)
+{
+    assert(fctOnReceiveFrame != NULL);
+    if(_noRxFrameListeners >= sizeOfAry(_rxFrameListenerAry))
+        return false;
+
+    _rxFrameListenerAry[_noRxFrameListeners++] = fctOnReceiveFrame;
+    return true;
+
+} /* End of can_registerRxFrameListener */
+
+
 /**
  * Step function of the CAN interface. The dispatcher engine of the CAN interface is
  * clocked and, afterwards, the decoded and pre-processed CAN information can be consumed
@@ -855,20 +911,37 @@ bool can_initCanStack(void)
  */
 void can_mainFunction_10ms(void)
 {
-    /* Unassert all "new data available bits" prior to checking for fresh messages arriving
-       in this tick - which will then re-assert the bit for actually received messages.
+    /* Unassert all "new data available bits" and the signal change bits prior to checking
+       for fresh messages arriving in this tick - which will then re-assert the bits for
+       actually received messages.
          Note, unasserting the bits here instead of from the message related callbacks is a
        contradiction with the normal coding paradigm of the CAN stack. We still do this as
        it is significantly cheaper to do it here; we mainly save the RAM for the otherwise
-       required timer objects. */
+       required timer objects.
+         The snapshot of a message needs to be published again if the bits were set.
+       Otherwise, the readers of the snapshot would see the bits of the last reception
+       until the message is received again. */
     for(unsigned int idxMsgRx=0u; idxMsgRx<sizeOfAry(cdt_canRxMsgAry); ++idxMsgRx)
     {
         const cdt_canMessage_t * const pMsgDesc = &cdt_canRxMsgAry[idxMsgRx];
         cap_infoTransmission_t * const pInfoTrns = pMsgDesc->pInfoTransmission;
-        pInfoTrns->stsTransmission &= ~cap_stTransm_newDataAvailable;
+        if((pInfoTrns->stsTransmission & cap_stTransm_newDataAvailable) != 0u
+           ||  pInfoTrns->changedSignals != 0u
+          )
+        {
+            pInfoTrns->stsTransmission &= ~cap_stTransm_newDataAvailable;
+            pInfoTrns->changedSignals = 0u;
+            msn_publishSnapshot(pMsgDesc->pSnapshot);
+        }
     }
 
     /* Call the step function of the CAN interface engine for this task. */
     ede_dispatcherMain(_hDispatcherSystem, IDX_DISPATCHER_10MS);
 
+    /* Check the deadlines of all supervised inbound messages. The check is done after the
+       processing of this tick's reception events and before the time advances, which is
+       the same order as the dispatcher applies to its timers. */
+    rts_checkTimeouts(_tiNow, onRxTimeout);
+    _tiNow = (int32_t)((uint32_t)_tiNow + TI_TICK_DISPATCHER_10MS);
+
 } /* can_mainFunction_10ms */
@@ -53,6 +53,23 @@
 #define CAN_ENUM_SEND_MODE_EVENT cap_enumSendMode_1_event /// Send mode event triggered
 #define CAN_ENUM_SEND_MODE_MIXED cap_enumSendMode_2_cyclicOrEvent /// Send mode event plus cyclic
 
+#ifndef CAN_USE_TABLE_DRIVEN_PACK_UNPACK
+/** The signals of the CAN messages can be packed and unpacked either by the generated,
+    message specific functions from cap_canApi.c or by the table driven functions from
+    pku_packUnpack.c, which operate on the generated descriptor tables from
+    csd_canSignalDescriptors.c. The latter have a much smaller code size for large CAN
+    databases. Set this define to 1 to select the table driven functions. PDUs with
+    multiplexed or floating point signals are still processed by the generated functions
+    in this case.\n
+      The reception comes along with change detection: The APSW is notified about the
+    changed signals in field changedSignals of the transmission status. The table driven
+    unpacking decodes and reports only those signals, which changed since the previous
+    reception of the message. The generated functions can only decode a message as a
+    whole: If its contents didn't change then decoding is skipped and no signal is
+    reported, otherwise all signals are decoded and reported as changed. */
+# define CAN_USE_TABLE_DRIVEN_PACK_UNPACK   0
+#endif
+
 /** The size of the heap memory, which is statically allocated for the CAN interface. The
     value should be set as little as possible; if set too little then the application will
     abort with an assertion. This is safe due to the static, deterministic memory
@@ -64,6 +81,10 @@
     for this define. */
 #define CAN_SIZE_OF_HEAP_FOR_CAN_INTERFACE  8192 /* Byte */
 
+/** The maximum number of functions, which can be registered with
+    can_registerRxFrameListener() for notification about received CAN frames. */
+#define CAN_MAX_NO_RX_FRAME_LISTENERS       4u
+
 /** This value extends the enumeration of CAN related events. It means a bus-off
     notification. */ 
 #define CAN_EV_BUS_OFF                      (CDE_EV_FIRST_CUSTOM_EVENT+1)
@@ -77,6 +98,16 @@
  * Global type definitions
  */
 
+/** The type of a function, which is notified about every received CAN frame, see
+    can_registerRxFrameListener(). The function is called from the CAN task with the bus
+    index, the CAN ID, the kind of ID, the \a DLC payload bytes and the DLC. */
+typedef void (*can_fctOnReceiveFrame_t)( unsigned int idxBus
+                                       , unsigned int canId
+                                       , bool isExtId
+                                       , const uint8_t payload[]
+                                       , unsigned int DLC
+                                       );
+
 
 /*
  * Global data declarations
@@ -106,6 +137,9 @@ extern volatile unsigned long can_noEvTxSendBufFull;
 /* Initialization of the CAN stack. */
 bool can_initCanStack(void);
 
+/** Register a function for notification about all received CAN frames. */
+bool can_registerRxFrameListener(can_fctOnReceiveFrame_t fctOnReceiveFrame);
+
 /** Step function of CAN runtime code. */
 void can_mainFunction_10ms(void);
 
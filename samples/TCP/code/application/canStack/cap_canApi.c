@@ -96,6 +96,7 @@ cap_canBus_PWM_t cap_canBus_PWM =
             .stsTransmission = cap_stsTransm_okay,
             .noTransmittedMsgs = 0,
             .isEvent = false,
+            .changedSignals = 0,
         },
     },
 
@@ -124,6 +125,7 @@ cap_canBus_PWM_t cap_canBus_PWM =
             .stsTransmission = cap_stsTransm_neverReceived,
             .noTransmittedMsgs = 0,
             .isEvent = false,
+            .changedSignals = 0,
         },
     },
 
@@ -151,6 +153,7 @@ cap_canBus_PT_t cap_canBus_PT =
             .stsTransmission = cap_stsTransm_neverReceived,
             .noTransmittedMsgs = 0,
             .isEvent = false,
+            .changedSignals = 0,
         },
     },
 
@@ -170,6 +173,7 @@ cap_canBus_PT_t cap_canBus_PT =
             .stsTransmission = cap_stsTransm_neverReceived,
             .noTransmittedMsgs = 0,
             .isEvent = false,
+            .changedSignals = 0,
         },
     },
 
@@ -192,6 +196,7 @@ cap_canBus_PT_t cap_canBus_PT =
             .stsTransmission = cap_stsTransm_neverReceived,
             .noTransmittedMsgs = 0,
             .isEvent = false,
+            .changedSignals = 0,
         },
     },
 
@@ -212,6 +217,7 @@ cap_canBus_PT_t cap_canBus_PT =
             .stsTransmission = cap_stsTransm_okay,
             .noTransmittedMsgs = 0,
             .isEvent = false,
+            .changedSignals = 0,
         },
     },
 
@@ -233,6 +239,7 @@ cap_canBus_PT_t cap_canBus_PT =
             .stsTransmission = cap_stsTransm_okay,
             .noTransmittedMsgs = 0,
             .isEvent = false,
+            .changedSignals = 0,
         },
     },
 
@@ -254,6 +261,7 @@ cap_canBus_PT_t cap_canBus_PT =
             .stsTransmission = cap_stsTransm_okay,
             .noTransmittedMsgs = 0,
             .isEvent = false,
+            .changedSignals = 0,
         },
     },
 
@@ -102,6 +102,66 @@
 /** The size in Byte of message PWM_out (1001, 0x3e9) on bus PWM. */
 #define CAP_PWM_PWM_OUT_1001_DLC	8
 
+/** The bit in cap_infoTransmission_t.changedSignals, which indicates
+    a change of signal LED_2_DS10_inhibit of message PWM_out (1001, 0x3e9)
+    on bus PWM. */
+#define CAP_PWM_1001_LED_2_DS10_inhibit_CHANGED	(1ull<<0)
+
+/** The bit in cap_infoTransmission_t.changedSignals, which indicates
+    a change of signal LED_4_DS11_inhibit of message PWM_out (1001, 0x3e9)
+    on bus PWM. */
+#define CAP_PWM_1001_LED_4_DS11_inhibit_CHANGED	(1ull<<1)
+
+/** The bit in cap_infoTransmission_t.changedSignals, which indicates
+    a change of signal LED_5_DS5_inhibit of message PWM_out (1001, 0x3e9)
+    on bus PWM. */
+#define CAP_PWM_1001_LED_5_DS5_inhibit_CHANGED	(1ull<<2)
+
+/** The bit in cap_infoTransmission_t.changedSignals, which indicates
+    a change of signal PA1_J3_pin1_inhibit of message PWM_out (1001, 0x3e9)
+    on bus PWM. */
+#define CAP_PWM_1001_PA1_J3_pin1_inhibit_CHANGED	(1ull<<3)
+
+/** The bit in cap_infoTransmission_t.changedSignals, which indicates
+    a change of signal LED_2_DS10_frequency of message PWM_out (1001, 0x3e9)
+    on bus PWM. */
+#define CAP_PWM_1001_LED_2_DS10_frequency_CHANGED	(1ull<<4)
+
+/** The bit in cap_infoTransmission_t.changedSignals, which indicates
+    a change of signal LED_4_DS11_frequency of message PWM_out (1001, 0x3e9)
+    on bus PWM. */
+#define CAP_PWM_1001_LED_4_DS11_frequency_CHANGED	(1ull<<5)
+
+/** The bit in cap_infoTransmission_t.changedSignals, which indicates
+    a change of signal LED_5_DS5_frequency of message PWM_out (1001, 0x3e9)
+    on bus PWM. */
+#define CAP_PWM_1001_LED_5_DS5_frequency_CHANGED	(1ull<<6)
+
+/** The bit in cap_infoTransmission_t.changedSignals, which indicates
+    a change of signal PA1_J3_pin1_frequency of message PWM_out (1001, 0x3e9)
+    on bus PWM. */
+#define CAP_PWM_1001_PA1_J3_pin1_frequency_CHANGED	(1ull<<7)
+
+/** The bit in cap_infoTransmission_t.changedSignals, which indicates
+    a change of signal LED_2_DS10_dutyCycle of message PWM_out (1001, 0x3e9)
+    on bus PWM. */
+#define CAP_PWM_1001_LED_2_DS10_dutyCycle_CHANGED	(1ull<<8)
+
+/** The bit in cap_infoTransmission_t.changedSignals, which indicates
+    a change of signal LED_4_DS11_dutyCycle of message PWM_out (1001, 0x3e9)
+    on bus PWM. */
+#define CAP_PWM_1001_LED_4_DS11_dutyCycle_CHANGED	(1ull<<9)
+
+/** The bit in cap_infoTransmission_t.changedSignals, which indicates
+    a change of signal LED_5_DS5_dutyCycle of message PWM_out (1001, 0x3e9)
+    on bus PWM. */
+#define CAP_PWM_1001_LED_5_DS5_dutyCycle_CHANGED	(1ull<<10)
+
+/** The bit in cap_infoTransmission_t.changedSignals, which indicates
+    a change of signal PA1_J3_pin1_dutyCycle of message PWM_out (1001, 0x3e9)
+    on bus PWM. */
+#define CAP_PWM_1001_PA1_J3_pin1_dutyCycle_CHANGED	(1ull<<11)
+
 /** This macro can be used to control the compilation of code, which depends on the
     presence of the particular message StateEcu01 (1024, 0x400)
     on bus PT in the message catalog. */
@@ -129,6 +189,21 @@
 /** The size in Byte of message StateEcu01 (1024, 0x400) on bus PT. */
 #define CAP_PT_STATEECU01_1024_DLC	4
 
+/** The bit in cap_infoTransmission_t.changedSignals, which indicates
+    a change of signal checksum of message StateEcu01 (1024, 0x400)
+    on bus PT. */
+#define CAP_PT_1024_checksum_CHANGED	(1ull<<0)
+
+/** The bit in cap_infoTransmission_t.changedSignals, which indicates
+    a change of signal speedOfRotation of message StateEcu01 (1024, 0x400)
+    on bus PT. */
+#define CAP_PT_1024_speedOfRotation_CHANGED	(1ull<<1)
+
+/** The bit in cap_infoTransmission_t.changedSignals, which indicates
+    a change of signal sequenceCounter of message StateEcu01 (1024, 0x400)
+    on bus PT. */
+#define CAP_PT_1024_sequenceCounter_CHANGED	(1ull<<2)
+
 /** The size in Bit of checksum signal of message StateEcu01 (1024, 0x400)
     on bus PT. */
 #define CAP_PT_STATEECU01_1024_CHECKSUM_LENGTH	8
@@ -184,6 +259,16 @@
 /** The size in Byte of message StateEcu02 (1040, 0x410) on bus PT. */
 #define CAP_PT_STATEECU02_1040_DLC	4
 
+/** The bit in cap_infoTransmission_t.changedSignals, which indicates
+    a change of signal sequenceCounter of message StateEcu02 (1040, 0x410)
+    on bus PT. */
+#define CAP_PT_1040_sequenceCounter_CHANGED	(1ull<<0)
+
+/** The bit in cap_infoTransmission_t.changedSignals, which indicates
+    a change of signal torque of message StateEcu02 (1040, 0x410)
+    on bus PT. */
+#define CAP_PT_1040_torque_CHANGED	(1ull<<1)
+
 /** The size in Bit of checksum signal of message StateEcu02 (1040, 0x410)
     on bus PT. */
 #define CAP_PT_STATEECU02_1040_CHECKSUM_LENGTH	8
@@ -239,6 +324,36 @@
 /** The size in Byte of message UserLimits (2032, 0x7f0) on bus PT. */
 #define CAP_PT_USERLIMITS_2032_DLC	8
 
+/** The bit in cap_infoTransmission_t.changedSignals, which indicates
+    a change of signal sequenceCounter of message UserLimits (2032, 0x7f0)
+    on bus PT. */
+#define CAP_PT_2032_sequenceCounter_CHANGED	(1ull<<0)
+
+/** The bit in cap_infoTransmission_t.changedSignals, which indicates
+    a change of signal minSpeedOfRotation of message UserLimits (2032, 0x7f0)
+    on bus PT. */
+#define CAP_PT_2032_minSpeedOfRotation_CHANGED	(1ull<<1)
+
+/** The bit in cap_infoTransmission_t.changedSignals, which indicates
+    a change of signal maxSpeedOfRotation of message UserLimits (2032, 0x7f0)
+    on bus PT. */
+#define CAP_PT_2032_maxSpeedOfRotation_CHANGED	(1ull<<2)
+
+/** The bit in cap_infoTransmission_t.changedSignals, which indicates
+    a change of signal checksum of message UserLimits (2032, 0x7f0)
+    on bus PT. */
+#define CAP_PT_2032_checksum_CHANGED	(1ull<<3)
+
+/** The bit in cap_infoTransmission_t.changedSignals, which indicates
+    a change of signal minPower of message UserLimits (2032, 0x7f0)
+    on bus PT. */
+#define CAP_PT_2032_minPower_CHANGED	(1ull<<4)
+
+/** The bit in cap_infoTransmission_t.changedSignals, which indicates
+    a change of signal maxPower of message UserLimits (2032, 0x7f0)
+    on bus PT. */
+#define CAP_PT_2032_maxPower_CHANGED	(1ull<<5)
+
 /** The size in Bit of checksum signal of message UserLimits (2032, 0x7f0)
     on bus PT. */
 #define CAP_PT_USERLIMITS_2032_CHECKSUM_LENGTH	8
@@ -1248,6 +1363,22 @@ typedef struct cap_infoTransmission_t
         whether new information arrived. */
     boolean_t isEvent;
 
+    /** For inbound frames: One bit for each received signal of the frame, which is set
+        by the interface engine if the value of the signal changed with a reception
+        event. The bit masks to test a particular signal are the #define's
+        CAP_<bus>_<id>_<signal>_CHANGED.\n
+          Like bit cap_stTransm_newDataAvailable, the bits are reset by the interface
+        engine at the beginning of each tick. The APSW step function sees the bit of a
+        signal in and only in the very tick, in which the signal changed. Several
+        receptions within one tick accumulate their changes.\n
+          A frame, whose contents didn't change at all, still counts as reception event
+        but sets no bit. The first reception of a frame sets the bits of all signals. If
+        the interface engine detects changes only for the frame contents as a whole then
+        all bits are set on each reception event, which changed any bit of the frame.\n
+          A frame with more than 64 signals uses bit 63 for its 64th and all later
+        signals. */
+    uint64_t changedSignals;
+
 } cap_infoTransmission_t;
 
 
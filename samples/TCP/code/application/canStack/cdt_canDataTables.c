@@ -30,6 +30,7 @@
  */
 
 #include <stdio.h>
+#include <stddef.h>
 #include <stdlib.h>
 #include <string.h>
 #include <assert.h>
@@ -60,6 +61,58 @@
  * Data definitions
  */
 
+/** The buffers of the snapshot of received message PWM_out (1001, 0x3e9)
+    on bus PWM. */
+static cap_PWM_PWM_out_1001_sts_t UNCACHED_P1(_snapshotBufAry_PWM_PWM_out_1001)[2];
+
+/** The double-buffered snapshot of received message PWM_out (1001, 0x3e9)
+    on bus PWM. */
+msn_snapshot_t UNCACHED_P1(cdt_snapshot_PWM_PWM_out_1001) =
+    { .seq = 0u
+    , .sizeOfMsg = sizeof(cap_PWM_PWM_out_1001_sts_t)
+    , .pMsg = &cap_getMsgSts_PWM_PWM_out_1001()
+    , .bufAry = { &_snapshotBufAry_PWM_PWM_out_1001[0], &_snapshotBufAry_PWM_PWM_out_1001[1] }
+    };
+
+/** The buffers of the snapshot of received message StateEcu01 (1024, 0x400)
+    on bus PT. */
+static cap_PT_StateEcu01_1024_sts_t UNCACHED_P1(_snapshotBufAry_PT_StateEcu01_1024)[2];
+
+/** The double-buffered snapshot of received message StateEcu01 (1024, 0x400)
+    on bus PT. */
+msn_snapshot_t UNCACHED_P1(cdt_snapshot_PT_StateEcu01_1024) =
+    { .seq = 0u
+    , .sizeOfMsg = sizeof(cap_PT_StateEcu01_1024_sts_t)
+    , .pMsg = &cap_getMsgSts_PT_StateEcu01_1024()
+    , .bufAry = { &_snapshotBufAry_PT_StateEcu01_1024[0], &_snapshotBufAry_PT_StateEcu01_1024[1] }
+    };
+
+/** The buffers of the snapshot of received message StateEcu02 (1040, 0x410)
+    on bus PT. */
+static cap_PT_StateEcu02_1040_sts_t UNCACHED_P1(_snapshotBufAry_PT_StateEcu02_1040)[2];
+
+/** The double-buffered snapshot of received message StateEcu02 (1040, 0x410)
+    on bus PT. */
+msn_snapshot_t UNCACHED_P1(cdt_snapshot_PT_StateEcu02_1040) =
+    { .seq = 0u
+    , .sizeOfMsg = sizeof(cap_PT_StateEcu02_1040_sts_t)
+    , .pMsg = &cap_getMsgSts_PT_StateEcu02_1040()
+    , .bufAry = { &_snapshotBufAry_PT_StateEcu02_1040[0], &_snapshotBufAry_PT_StateEcu02_1040[1] }
+    };
+
+/** The buffers of the snapshot of received message UserLimits (2032, 0x7f0)
+    on bus PT. */
+static cap_PT_UserLimits_2032_sts_t UNCACHED_P1(_snapshotBufAry_PT_UserLimits_2032)[2];
+
+/** The double-buffered snapshot of received message UserLimits (2032, 0x7f0)
+    on bus PT. */
+msn_snapshot_t UNCACHED_P1(cdt_snapshot_PT_UserLimits_2032) =
+    { .seq = 0u
+    , .sizeOfMsg = sizeof(cap_PT_UserLimits_2032_sts_t)
+    , .pMsg = &cap_getMsgSts_PT_UserLimits_2032()
+    , .bufAry = { &_snapshotBufAry_PT_UserLimits_2032[0], &_snapshotBufAry_PT_UserLimits_2032[1] }
+    };
+
 /** A global table with the description of all CAN messages which are received by the device.
     The description of the messages is as detailed as required for implementation of their
     send/receive behavior in the callbacks of the event dispatchers. */
@@ -76,8 +129,12 @@ const cdt_canMessage_t cdt_canRxMsgAry[CST_NO_CAN_MSGS_RECEIVED] =
         , .sendMode = cap_enumSendMode_1_event
         , .idxHandlerCtxData = 0
         , .pInfoTransmission = &cap_getMsgSts_PWM_PWM_out_1001().infoTransmission
+        , .offsetOfInfoTransmission = offsetof(cap_PWM_PWM_out_1001_sts_t, infoTransmission)
         , .tiCycle = 10
         , .tiMinDistance = 20
+        , .pSnapshot = &cdt_snapshot_PWM_PWM_out_1001
+        , .idxFirstSignal = 0
+        , .noSignals = 12
         },
     [1] =
         { .name = "StateEcu01"
@@ -90,8 +147,12 @@ const cdt_canMessage_t cdt_canRxMsgAry[CST_NO_CAN_MSGS_RECEIVED] =
         , .sendMode = cap_enumSendMode_0_cyclic
         , .idxHandlerCtxData = 0
         , .pInfoTransmission = &cap_getMsgSts_PT_StateEcu01_1024().infoTransmission
+        , .offsetOfInfoTransmission = offsetof(cap_PT_StateEcu01_1024_sts_t, infoTransmission)
         , .tiCycle = 10
         , .tiMinDistance = 20
+        , .pSnapshot = &cdt_snapshot_PT_StateEcu01_1024
+        , .idxFirstSignal = 12
+        , .noSignals = 3
         },
     [2] =
         { .name = "StateEcu02"
@@ -104,8 +165,12 @@ const cdt_canMessage_t cdt_canRxMsgAry[CST_NO_CAN_MSGS_RECEIVED] =
         , .sendMode = cap_enumSendMode_0_cyclic
         , .idxHandlerCtxData = 1
         , .pInfoTransmission = &cap_getMsgSts_PT_StateEcu02_1040().infoTransmission
+        , .offsetOfInfoTransmission = offsetof(cap_PT_StateEcu02_1040_sts_t, infoTransmission)
         , .tiCycle = 25
         , .tiMinDistance = 20
+        , .pSnapshot = &cdt_snapshot_PT_StateEcu02_1040
+        , .idxFirstSignal = 15
+        , .noSignals = 2
         },
     [3] =
         { .name = "UserLimits"
@@ -118,8 +183,12 @@ const cdt_canMessage_t cdt_canRxMsgAry[CST_NO_CAN_MSGS_RECEIVED] =
         , .sendMode = cap_enumSendMode_1_event
         , .idxHandlerCtxData = 1
         , .pInfoTransmission = &cap_getMsgSts_PT_UserLimits_2032().infoTransmission
+        , .offsetOfInfoTransmission = offsetof(cap_PT_UserLimits_2032_sts_t, infoTransmission)
         , .tiCycle = 10
         , .tiMinDistance = 65
+        , .pSnapshot = &cdt_snapshot_PT_UserLimits_2032
+        , .idxFirstSignal = 17
+        , .noSignals = 6
         },
 }; /* cdt_canRxMsgAry */
 
@@ -139,8 +208,12 @@ const cdt_canMessage_t cdt_canTxMsgAry[CST_NO_CAN_MSGS_SENT] =
         , .sendMode = cap_enumSendMode_0_cyclic
         , .idxHandlerCtxData = 0
         , .pInfoTransmission = &cap_getMsgSts_PWM_PWM_in_1000().infoTransmission
+        , .offsetOfInfoTransmission = offsetof(cap_PWM_PWM_in_1000_sts_t, infoTransmission)
         , .tiCycle = 100
         , .tiMinDistance = 20
+        , .pSnapshot = NULL
+        , .idxFirstSignal = 23
+        , .noSignals = 6
         },
     [1] =
         { .name = "InfoPowerDisplay"
@@ -153,8 +226,12 @@ const cdt_canMessage_t cdt_canTxMsgAry[CST_NO_CAN_MSGS_SENT] =
         , .sendMode = cap_enumSendMode_0_cyclic
         , .idxHandlerCtxData = 1
         , .pInfoTransmission = &cap_getMsgSts_PT_InfoPowerDisplay_1536().infoTransmission
+        , .offsetOfInfoTransmission = offsetof(cap_PT_InfoPowerDisplay_1536_sts_t, infoTransmission)
         , .tiCycle = 30
         , .tiMinDistance = 20
+        , .pSnapshot = NULL
+        , .idxFirstSignal = 29
+        , .noSignals = 4
         },
     [2] =
         { .name = "StatusPowerDisplay"
@@ -167,8 +244,12 @@ const cdt_canMessage_t cdt_canTxMsgAry[CST_NO_CAN_MSGS_SENT] =
         , .sendMode = cap_enumSendMode_2_cyclicOrEvent
         , .idxHandlerCtxData = 0
         , .pInfoTransmission = &cap_getMsgSts_PT_StatusPowerDisplay_1537().infoTransmission
+        , .offsetOfInfoTransmission = offsetof(cap_PT_StatusPowerDisplay_1537_sts_t, infoTransmission)
         , .tiCycle = 1000
         , .tiMinDistance = 50
+        , .pSnapshot = NULL
+        , .idxFirstSignal = 33
+        , .noSignals = 5
         },
     [3] =
         { .name = "LimitsPowerDisplay"
@@ -181,8 +262,12 @@ const cdt_canMessage_t cdt_canTxMsgAry[CST_NO_CAN_MSGS_SENT] =
         , .sendMode = cap_enumSendMode_1_event
         , .idxHandlerCtxData = 0
         , .pInfoTransmission = &cap_getMsgSts_PT_LimitsPowerDisplay_1538().infoTransmission
+        , .offsetOfInfoTransmission = offsetof(cap_PT_LimitsPowerDisplay_1538_sts_t, infoTransmission)
         , .tiCycle = 10
         , .tiMinDistance = 20
+        , .pSnapshot = NULL
+        , .idxFirstSignal = 38
+        , .noSignals = 5
         },
 }; /* cdt_canTxMsgAry */
 
@@ -211,6 +296,11 @@ const cdt_canSignal_t cdt_canSignalAry[CST_NO_SENT_AND_RECEIVED_CAN_SIGNALS] =
         , .min = 0.0
         , .max = 1.0
         , .unit = ""
+        , .fieldType = cdt_fieldType_boolean_t
+        , .offsetOfField = offsetof(cap_PWM_PWM_out_1001_sts_t, signals.LED_2_DS10_inhibit)
+        , .factor = 1.0f
+        , .offset = 0.0f
+        , .length = 1
         },
     [1] =
         { .name = "LED_4_DS11_inhibit"
@@ -221,6 +311,11 @@ const cdt_canSignal_t cdt_canSignalAry[CST_NO_SENT_AND_RECEIVED_CAN_SIGNALS] =
         , .min = 0.0
         , .max = 1.0
         , .unit = ""
+        , .fieldType = cdt_fieldType_boolean_t
+        , .offsetOfField = offsetof(cap_PWM_PWM_out_1001_sts_t, signals.LED_4_DS11_inhibit)
+        , .factor = 1.0f
+        , .offset = 0.0f
+        , .length = 1
         },
     [2] =
         { .name = "LED_5_DS5_inhibit"
@@ -231,6 +326,11 @@ const cdt_canSignal_t cdt_canSignalAry[CST_NO_SENT_AND_RECEIVED_CAN_SIGNALS] =
         , .min = 0.0
         , .max = 1.0
         , .unit = ""
+        , .fieldType = cdt_fieldType_boolean_t
+        , .offsetOfField = offsetof(cap_PWM_PWM_out_1001_sts_t, signals.LED_5_DS5_inhibit)
+        , .factor = 1.0f
+        , .offset = 0.0f
+        , .length = 1
         },
     [3] =
         { .name = "PA1_J3_pin1_inhibit"
@@ -241,6 +341,11 @@ const cdt_canSignal_t cdt_canSignalAry[CST_NO_SENT_AND_RECEIVED_CAN_SIGNALS] =
         , .min = 0.0
         , .max = 1.0
         , .unit = ""
+        , .fieldType = cdt_fieldType_boolean_t
+        , .offsetOfField = offsetof(cap_PWM_PWM_out_1001_sts_t, signals.PA1_J3_pin1_inhibit)
+        , .factor = 1.0f
+        , .offset = 0.0f
+        , .length = 1
         },
     [4] =
         { .name = "LED_2_DS10_frequency"
@@ -251,6 +356,11 @@ const cdt_canSignal_t cdt_canSignalAry[CST_NO_SENT_AND_RECEIVED_CAN_SIGNALS] =
         , .min = 2.0
         , .max = 1000.0
         , .unit = "Hz"
+        , .fieldType = cdt_fieldType_uint16_t
+        , .offsetOfField = offsetof(cap_PWM_PWM_out_1001_sts_t, signals.LED_2_DS10_frequency)
+        , .factor = 0.97752f
+        , .offset = 0.0f
+        , .length = 10
         },
     [5] =
         { .name = "LED_4_DS11_frequency"
@@ -261,6 +371,11 @@ const cdt_canSignal_t cdt_canSignalAry[CST_NO_SENT_AND_RECEIVED_CAN_SIGNALS] =
         , .min = 2.0
         , .max = 1000.0
         , .unit = "Hz"
+        , .fieldType = cdt_fieldType_uint16_t
+        , .offsetOfField = offsetof(cap_PWM_PWM_out_1001_sts_t, signals.LED_4_DS11_frequency)
+        , .factor = 0.97752f
+        , .offset = 0.0f
+        , .length = 10
         },
     [6] =
         { .name = "LED_5_DS5_frequency"
@@ -271,6 +386,11 @@ const cdt_canSignal_t cdt_canSignalAry[CST_NO_SENT_AND_RECEIVED_CAN_SIGNALS] =
         , .min = 2.0
         , .max = 1000.0
         , .unit = "Hz"
+        , .fieldType = cdt_fieldType_uint16_t
+        , .offsetOfField = offsetof(cap_PWM_PWM_out_1001_sts_t, signals.LED_5_DS5_frequency)
+        , .factor = 0.97752f
+        , .offset = 0.0f
+        , .length = 10
         },
     [7] =
         { .name = "PA1_J3_pin1_frequency"
@@ -281,6 +401,11 @@ const cdt_canSignal_t cdt_canSignalAry[CST_NO_SENT_AND_RECEIVED_CAN_SIGNALS] =
         , .min = 2.0
         , .max = 10000.0
         , .unit = "Hz"
+        , .fieldType = cdt_fieldType_uint16_t
+        , .offsetOfField = offsetof(cap_PWM_PWM_out_1001_sts_t, signals.PA1_J3_pin1_frequency)
+        , .factor = 9.7752f
+        , .offset = 0.0f
+        , .length = 10
         },
     [8] =
         { .name = "LED_2_DS10_dutyCycle"
@@ -291,6 +416,11 @@ const cdt_canSignal_t cdt_canSignalAry[CST_NO_SENT_AND_RECEIVED_CAN_SIGNALS] =
         , .min = 0.0
         , .max = 0.0
         , .unit = "%"
+        , .fieldType = cdt_fieldType_uint8_t
+        , .offsetOfField = offsetof(cap_PWM_PWM_out_1001_sts_t, signals.LED_2_DS10_dutyCycle)
+        , .factor = 3.2259f
+        , .offset = 0.0f
+        , .length = 5
         },
     [9] =
         { .name = "LED_4_DS11_dutyCycle"
@@ -301,6 +431,11 @@ const cdt_canSignal_t cdt_canSignalAry[CST_NO_SENT_AND_RECEIVED_CAN_SIGNALS] =
         , .min = 0.0
         , .max = 0.0
         , .unit = "%"
+        , .fieldType = cdt_fieldType_uint8_t
+        , .offsetOfField = offsetof(cap_PWM_PWM_out_1001_sts_t, signals.LED_4_DS11_dutyCycle)
+        , .factor = 3.2259f
+        , .offset = 0.0f
+        , .length = 5
         },
     [10] =
         { .name = "LED_5_DS5_dutyCycle"
@@ -311,6 +446,11 @@ const cdt_canSignal_t cdt_canSignalAry[CST_NO_SENT_AND_RECEIVED_CAN_SIGNALS] =
         , .min = 0.0
         , .max = 0.0
         , .unit = "%"
+        , .fieldType = cdt_fieldType_uint8_t
+        , .offsetOfField = offsetof(cap_PWM_PWM_out_1001_sts_t, signals.LED_5_DS5_dutyCycle)
+        , .factor = 3.2259f
+        , .offset = 0.0f
+        , .length = 5
         },
     [11] =
         { .name = "PA1_J3_pin1_dutyCycle"
@@ -321,6 +461,11 @@ const cdt_canSignal_t cdt_canSignalAry[CST_NO_SENT_AND_RECEIVED_CAN_SIGNALS] =
         , .min = 0.0
         , .max = 0.0
         , .unit = "%"
+        , .fieldType = cdt_fieldType_uint8_t
+        , .offsetOfField = offsetof(cap_PWM_PWM_out_1001_sts_t, signals.PA1_J3_pin1_dutyCycle)
+        , .factor = 3.2259f
+        , .offset = 0.0f
+        , .length = 5
         },
     [12] =
         { .name = "checksum"
@@ -331,6 +476,11 @@ const cdt_canSignal_t cdt_canSignalAry[CST_NO_SENT_AND_RECEIVED_CAN_SIGNALS] =
         , .min = 0.0
         , .max = 255.0
         , .unit = ""
+        , .fieldType = cdt_fieldType_uint8_t
+        , .offsetOfField = offsetof(cap_PT_StateEcu01_1024_sts_t, signals.checksum)
+        , .factor = 1.0f
+        , .offset = 0.0f
+        , .length = 8
         },
     [13] =
         { .name = "speedOfRotation"
@@ -341,6 +491,11 @@ const cdt_canSignal_t cdt_canSignalAry[CST_NO_SENT_AND_RECEIVED_CAN_SIGNALS] =
         , .min = 0.0
         , .max = 6500.0
         , .unit = "rpm"
+        , .fieldType = cdt_fieldType_uint16_t
+        , .offsetOfField = offsetof(cap_PT_StateEcu01_1024_sts_t, signals.speedOfRotation)
+        , .factor = 0.1f
+        , .offset = 0.0f
+        , .length = 16
         },
     [14] =
         { .name = "sequenceCounter"
@@ -351,6 +506,11 @@ const cdt_canSignal_t cdt_canSignalAry[CST_NO_SENT_AND_RECEIVED_CAN_SIGNALS] =
         , .min = 0.0
         , .max = 14.0
         , .unit = ""
+        , .fieldType = cdt_fieldType_uint8_t
+        , .offsetOfField = offsetof(cap_PT_StateEcu01_1024_sts_t, signals.sequenceCounter)
+        , .factor = 1.0f
+        , .offset = 0.0f
+        , .length = 4
         },
     [15] =
         { .name = "sequenceCounter"
@@ -361,6 +521,11 @@ const cdt_canSignal_t cdt_canSignalAry[CST_NO_SENT_AND_RECEIVED_CAN_SIGNALS] =
         , .min = 1.0
         , .max = 15.0
         , .unit = ""
+        , .fieldType = cdt_fieldType_uint8_t
+        , .offsetOfField = offsetof(cap_PT_StateEcu02_1040_sts_t, signals.sequenceCounter)
+        , .factor = 1.0f
+        , .offset = 0.0f
+        , .length = 4
         },
     [16] =
         { .name = "torque"
@@ -371,6 +536,11 @@ const cdt_canSignal_t cdt_canSignalAry[CST_NO_SENT_AND_RECEIVED_CAN_SIGNALS] =
         , .min = -500.0
         , .max = 500.0
         , .unit = "Nm"
+        , .fieldType = cdt_fieldType_int16_t
+        , .offsetOfField = offsetof(cap_PT_StateEcu02_1040_sts_t, signals.torque)
+        , .factor = 0.5f
+        , .offset = 0.0f
+        , .length = 11
         },
     [17] =
         { .name = "sequenceCounter"
@@ -381,6 +551,11 @@ const cdt_canSignal_t cdt_canSignalAry[CST_NO_SENT_AND_RECEIVED_CAN_SIGNALS] =
         , .min = 1.0
         , .max = 14.0
         , .unit = ""
+        , .fieldType = cdt_fieldType_uint8_t
+        , .offsetOfField = offsetof(cap_PT_UserLimits_2032_sts_t, signals.sequenceCounter)
+        , .factor = 1.0f
+        , .offset = 0.0f
+        , .length = 4
         },
     [18] =
         { .name = "minSpeedOfRotation"
@@ -391,6 +566,11 @@ const cdt_canSignal_t cdt_canSignalAry[CST_NO_SENT_AND_RECEIVED_CAN_SIGNALS] =
         , .min = 0.0
         , .max = 6500.0
         , .unit = "rpm"
+        , .fieldType = cdt_fieldType_uint16_t
+        , .offsetOfField = offsetof(cap_PT_UserLimits_2032_sts_t, signals.minSpeedOfRotation)
+        , .factor = 1.6f
+        , .offset = 0.0f
+        , .length = 12
         },
     [19] =
         { .name = "maxSpeedOfRotation"
@@ -401,6 +581,11 @@ const cdt_canSignal_t cdt_canSignalAry[CST_NO_SENT_AND_RECEIVED_CAN_SIGNALS] =
         , .min = 0.0
         , .max = 6500.0
         , .unit = "rpm"
+        , .fieldType = cdt_fieldType_uint16_t
+        , .offsetOfField = offsetof(cap_PT_UserLimits_2032_sts_t, signals.maxSpeedOfRotation)
+        , .factor = 1.6f
+        , .offset = 0.0f
+        , .length = 12
         },
     [20] =
         { .name = "checksum"
@@ -411,6 +596,11 @@ const cdt_canSignal_t cdt_canSignalAry[CST_NO_SENT_AND_RECEIVED_CAN_SIGNALS] =
         , .min = 0.0
         , .max = 255.0
         , .unit = ""
+        , .fieldType = cdt_fieldType_uint8_t
+        , .offsetOfField = offsetof(cap_PT_UserLimits_2032_sts_t, signals.checksum)
+        , .factor = 1.0f
+        , .offset = 0.0f
+        , .length = 8
         },
     [21] =
         { .name = "minPower"
@@ -421,6 +611,11 @@ const cdt_canSignal_t cdt_canSignalAry[CST_NO_SENT_AND_RECEIVED_CAN_SIGNALS] =
         , .min = -10.0
         , .max = 240.0
         , .unit = "KW"
+        , .fieldType = cdt_fieldType_uint16_t
+        , .offsetOfField = offsetof(cap_PT_UserLimits_2032_sts_t, signals.minPower)
+        , .factor = 0.5f
+        , .offset = -10.0f
+        , .length = 9
         },
     [22] =
         { .name = "maxPower"
@@ -431,6 +626,11 @@ const cdt_canSignal_t cdt_canSignalAry[CST_NO_SENT_AND_RECEIVED_CAN_SIGNALS] =
         , .min = -10.0
         , .max = 240.0
         , .unit = "KW"
+        , .fieldType = cdt_fieldType_uint16_t
+        , .offsetOfField = offsetof(cap_PT_UserLimits_2032_sts_t, signals.maxPower)
+        , .factor = 0.5f
+        , .offset = -10.0f
+        , .length = 9
         },
 
     [23] =
@@ -442,6 +642,11 @@ const cdt_canSignal_t cdt_canSignalAry[CST_NO_SENT_AND_RECEIVED_CAN_SIGNALS] =
         , .min = 0.0
         , .max = 511.98437551
         , .unit = "ms"
+        , .fieldType = cdt_fieldType_uint16_t
+        , .offsetOfField = offsetof(cap_PWM_PWM_in_1000_sts_t, signals.PA2_J3_pin3_periodTime)
+        , .factor = 0.015625f
+        , .offset = 0.0f
+        , .length = 15
         },
     [24] =
         { .name = "PA2_J3_pin3_isNew"
@@ -452,6 +657,11 @@ const cdt_canSignal_t cdt_canSignalAry[CST_NO_SENT_AND_RECEIVED_CAN_SIGNALS] =
         , .min = 0.0
         , .max = 0.0
         , .unit = ""
+        , .fieldType = cdt_fieldType_boolean_t
+        , .offsetOfField = offsetof(cap_PWM_PWM_in_1000_sts_t, signals.PA2_J3_pin3_isNew)
+        , .factor = 1.0f
+        , .offset = 0.0f
+        , .length = 1
         },
     [25] =
         { .name = "PA6_J2_pin1_isNew"
@@ -462,6 +672,11 @@ const cdt_canSignal_t cdt_canSignalAry[CST_NO_SENT_AND_RECEIVED_CAN_SIGNALS] =
         , .min = 0.0
         , .max = 0.0
         , .unit = ""
+        , .fieldType = cdt_fieldType_boolean_t
+        , .offsetOfField = offsetof(cap_PWM_PWM_in_1000_sts_t, signals.PA6_J2_pin1_isNew)
+        , .factor = 1.0f
+        , .offset = 0.0f
+        , .length = 1
         },
     [26] =
         { .name = "PA6_J2_pin1_dutyTime"
@@ -472,6 +687,11 @@ const cdt_canSignal_t cdt_canSignalAry[CST_NO_SENT_AND_RECEIVED_CAN_SIGNALS] =
         , .min = 0.0
         , .max = 511.984375
         , .unit = "ms"
+        , .fieldType = cdt_fieldType_uint16_t
+        , .offsetOfField = offsetof(cap_PWM_PWM_in_1000_sts_t, signals.PA6_J2_pin1_dutyTime)
+        , .factor = 0.015625f
+        , .offset = 0.0f
+        , .length = 15
         },
     [27] =
         { .name = "PA2_PA6_dutyCycle"
@@ -482,6 +702,11 @@ const cdt_canSignal_t cdt_canSignalAry[CST_NO_SENT_AND_RECEIVED_CAN_SIGNALS] =
         , .min = 0.0
         , .max = 100.0
         , .unit = "%"
+        , .fieldType = cdt_fieldType_uint16_t
+        , .offsetOfField = offsetof(cap_PWM_PWM_in_1000_sts_t, signals.PA2_PA6_dutyCycle)
+        , .factor = 0.00390625f
+        , .offset = 0.0f
+        , .length = 15
         },
     [28] =
         { .name = "PA2_J3_pin3_frequency"
@@ -492,6 +717,11 @@ const cdt_canSignal_t cdt_canSignalAry[CST_NO_SENT_AND_RECEIVED_CAN_SIGNALS] =
         , .min = 0.0
         , .max = 8191.75
         , .unit = "Hz"
+        , .fieldType = cdt_fieldType_uint16_t
+        , .offsetOfField = offsetof(cap_PWM_PWM_in_1000_sts_t, signals.PA2_J3_pin3_frequency)
+        , .factor = 0.25f
+        , .offset = 0.0f
+        , .length = 15
         },
     [29] =
         { .name = "checksum"
@@ -502,6 +732,11 @@ const cdt_canSignal_t cdt_canSignalAry[CST_NO_SENT_AND_RECEIVED_CAN_SIGNALS] =
         , .min = 0.0
         , .max = 255.0
         , .unit = ""
+        , .fieldType = cdt_fieldType_uint8_t
+        , .offsetOfField = offsetof(cap_PT_InfoPowerDisplay_1536_sts_t, signals.checksum)
+        , .factor = 1.0f
+        , .offset = 0.0f
+        , .length = 8
         },
     [30] =
         { .name = "sequenceCounter"
@@ -512,6 +747,11 @@ const cdt_canSignal_t cdt_canSignalAry[CST_NO_SENT_AND_RECEIVED_CAN_SIGNALS] =
         , .min = 0.0
         , .max = 14.0
         , .unit = ""
+        , .fieldType = cdt_fieldType_uint8_t
+        , .offsetOfField = offsetof(cap_PT_InfoPowerDisplay_1536_sts_t, signals.sequenceCounter)
+        , .factor = 1.0f
+        , .offset = 0.0f
+        , .length = 4
         },
     [31] =
         { .name = "power"
@@ -522,6 +762,11 @@ const cdt_canSignal_t cdt_canSignalAry[CST_NO_SENT_AND_RECEIVED_CAN_SIGNALS] =
         , .min = -500000.0
         , .max = 500000.0
         , .unit = "W"
+        , .fieldType = cdt_fieldType_uint16_t
+        , .offsetOfField = offsetof(cap_PT_InfoPowerDisplay_1536_sts_t, signals.power)
+        , .factor = 32.0f
+        , .offset = -500000.0f
+        , .length = 15
         },
     [32] =
         { .name = "state"
@@ -532,6 +777,11 @@ const cdt_canSignal_t cdt_canSignalAry[CST_NO_SENT_AND_RECEIVED_CAN_SIGNALS] =
         , .min = 0.0
         , .max = 2.0
         , .unit = ""
+        , .fieldType = cdt_fieldType_uint8_t
+        , .offsetOfField = offsetof(cap_PT_InfoPowerDisplay_1536_sts_t, signals.state)
+        , .factor = 1.0f
+        , .offset = 0.0f
+        , .length = 3
         },
     [33] =
         { .name = "noDlcErrors"
@@ -542,6 +792,11 @@ const cdt_canSignal_t cdt_canSignalAry[CST_NO_SENT_AND_RECEIVED_CAN_SIGNALS] =
         , .min = 0.0
         , .max = 2047.0
         , .unit = ""
+        , .fieldType = cdt_fieldType_uint16_t
+        , .offsetOfField = offsetof(cap_PT_StatusPowerDisplay_1537_sts_t, signals.noDlcErrors)
+        , .factor = 1.0f
+        , .offset = 0.0f
+        , .length = 11
         },
     [34] =
         { .name = "noCheckSumErrors"
@@ -552,6 +807,11 @@ const cdt_canSignal_t cdt_canSignalAry[CST_NO_SENT_AND_RECEIVED_CAN_SIGNALS] =
         , .min = 0.0
         , .max = 2047.0
         , .unit = ""
+        , .fieldType = cdt_fieldType_uint16_t
+        , .offsetOfField = offsetof(cap_PT_StatusPowerDisplay_1537_sts_t, signals.noCheckSumErrors)
+        , .factor = 1.0f
+        , .offset = 0.0f
+        , .length = 11
         },
     [35] =
         { .name = "noSqcErrors"
@@ -562,6 +822,11 @@ const cdt_canSignal_t cdt_canSignalAry[CST_NO_SENT_AND_RECEIVED_CAN_SIGNALS] =
         , .min = 0.0
         , .max = 2047.0
         , .unit = ""
+        , .fieldType = cdt_fieldType_uint16_t
+        , .offsetOfField = offsetof(cap_PT_StatusPowerDisplay_1537_sts_t, signals.noSqcErrors)
+        , .factor = 1.0f
+        , .offset = 0.0f
+        , .length = 11
         },
     [36] =
         { .name = "sequenceCounter"
@@ -572,6 +837,11 @@ const cdt_canSignal_t cdt_canSignalAry[CST_NO_SENT_AND_RECEIVED_CAN_SIGNALS] =
         , .min = 1.0
         , .max = 126.0
         , .unit = ""
+        , .fieldType = cdt_fieldType_uint8_t
+        , .offsetOfField = offsetof(cap_PT_StatusPowerDisplay_1537_sts_t, signals.sequenceCounter)
+        , .factor = 1.0f
+        , .offset = 0.0f
+        , .length = 7
         },
     [37] =
         { .name = "checksum"
@@ -582,6 +852,11 @@ const cdt_canSignal_t cdt_canSignalAry[CST_NO_SENT_AND_RECEIVED_CAN_SIGNALS] =
         , .min = 0.0
         , .max = 255.0
         , .unit = ""
+        , .fieldType = cdt_fieldType_uint8_t
+        , .offsetOfField = offsetof(cap_PT_StatusPowerDisplay_1537_sts_t, signals.checksum)
+        , .factor = 1.0f
+        , .offset = 0.0f
+        , .length = 8
         },
     [38] =
         { .name = "sequenceCounter"
@@ -592,6 +867,11 @@ const cdt_canSignal_t cdt_canSignalAry[CST_NO_SENT_AND_RECEIVED_CAN_SIGNALS] =
         , .min = 1.0
         , .max = 6.0
         , .unit = ""
+        , .fieldType = cdt_fieldType_uint8_t
+        , .offsetOfField = offsetof(cap_PT_LimitsPowerDisplay_1538_sts_t, signals.sequenceCounter)
+        , .factor = 1.0f
+        , .offset = 0.0f
+        , .length = 3
         },
     [39] =
         { .name = "belowMinSpeedOfRotation"
@@ -602,6 +882,11 @@ const cdt_canSignal_t cdt_canSignalAry[CST_NO_SENT_AND_RECEIVED_CAN_SIGNALS] =
         , .min = 0.0
         , .max = 1.0
         , .unit = ""
+        , .fieldType = cdt_fieldType_boolean_t
+        , .offsetOfField = offsetof(cap_PT_LimitsPowerDisplay_1538_sts_t, signals.belowMinSpeedOfRotation)
+        , .factor = 1.0f
+        , .offset = 0.0f
+        , .length = 1
         },
     [40] =
         { .name = "aboveMaxSpeedOfRotation"
@@ -612,6 +897,11 @@ const cdt_canSignal_t cdt_canSignalAry[CST_NO_SENT_AND_RECEIVED_CAN_SIGNALS] =
         , .min = 0.0
         , .max = 1.0
         , .unit = ""
+        , .fieldType = cdt_fieldType_boolean_t
+        , .offsetOfField = offsetof(cap_PT_LimitsPowerDisplay_1538_sts_t, signals.aboveMaxSpeedOfRotation)
+        , .factor = 1.0f
+        , .offset = 0.0f
+        , .length = 1
         },
     [41] =
         { .name = "belowMinPower"
@@ -622,6 +912,11 @@ const cdt_canSignal_t cdt_canSignalAry[CST_NO_SENT_AND_RECEIVED_CAN_SIGNALS] =
         , .min = 0.0
         , .max = 1.0
         , .unit = ""
+        , .fieldType = cdt_fieldType_boolean_t
+        , .offsetOfField = offsetof(cap_PT_LimitsPowerDisplay_1538_sts_t, signals.belowMinPower)
+        , .factor = 1.0f
+        , .offset = 0.0f
+        , .length = 1
         },
     [42] =
         { .name = "aboveMaxPower"
@@ -632,6 +927,11 @@ const cdt_canSignal_t cdt_canSignalAry[CST_NO_SENT_AND_RECEIVED_CAN_SIGNALS] =
         , .min = 0.0
         , .max = 1.0
         , .unit = ""
+        , .fieldType = cdt_fieldType_boolean_t
+        , .offsetOfField = offsetof(cap_PT_LimitsPowerDisplay_1538_sts_t, signals.aboveMaxPower)
+        , .factor = 1.0f
+        , .offset = 0.0f
+        , .length = 1
         },
 }; /* cdt_canSignalAry */
 
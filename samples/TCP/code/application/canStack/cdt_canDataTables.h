@@ -34,17 +34,43 @@
 #include "typ_types.h"
 #include "cap_canApi.h"
 #include "cst_canStatistics.h"
+#include "msn_messageSnapshot.h"
 
 
 /*
  * Defines
  */
 
+/** The size in Byte of the largest received PDU. A buffer of this size can hold the
+    contents of any received PDU. */
+#define CDT_MAX_SIZE_OF_RX_PDU  (sizeof(cdt_rxPduBuf_t))
+
 
 /*
  * Type definitions
  */
 
+/** The type of the field in the message struct of the global CAN API, which holds the
+    value of a signal. The field is found at cdt_canSignal_t::offsetOfField in the struct,
+    which is stored in the snapshot of the message. Signed integer types imply sign
+    extension of the signal value. */
+typedef enum cdt_fieldType_t
+{
+    cdt_fieldType_boolean_t,
+    cdt_fieldType_uint8_t,
+    cdt_fieldType_int8_t,
+    cdt_fieldType_uint16_t,
+    cdt_fieldType_int16_t,
+    cdt_fieldType_uint32_t,
+    cdt_fieldType_int32_t,
+    cdt_fieldType_uint64_t,
+    cdt_fieldType_int64_t,
+    cdt_fieldType_float32_t,
+    cdt_fieldType_float64_t,
+
+} cdt_fieldType_t;
+
+
 /** The decription of a CAN message as required for implementation of its send/receive
     behavior in the callbacks of the event dispatchers. */
 typedef struct cdt_canMessage_t
@@ -83,12 +109,29 @@ typedef struct cdt_canMessage_t
     /** The pointer to the transmission info of the given message in the global CAN API. */
     cap_infoTransmission_t *pInfoTransmission;
 
+    /** The byte offset of the transmission info in the message struct. Use it to access
+        the transmission info in a copy of the struct, which has been read from \a
+        pSnapshot. */
+    unsigned int offsetOfInfoTransmission;
+
     /** The nominal cycle time in ms if the message is not purely event triggered. */
     unsigned int tiCycle;
 
     /** The minimum distance of reception events if the message is event triggered. */
     unsigned int tiMinDistance;
 
+    /** The double-buffered snapshot of the message struct in the global CAN API or NULL
+        for outbound messages. The snapshot gives lock-free access to the received signals
+        from any task on any core. */
+    msn_snapshot_t *pSnapshot;
+
+    /** The signals of the message form a contiguous range in cdt_canSignalAry. This is
+        the index of the first one. */
+    unsigned int idxFirstSignal;
+
+    /** The number of signals of the message in cdt_canSignalAry, see \a idxFirstSignal. */
+    unsigned int noSignals;
+
 } cdt_canMessage_t;
 
 
@@ -123,9 +166,48 @@ typedef struct cdt_canSignal_t
     /** The unit of the signal value. */
     const char *unit;
 
+    /** The type of the field, which holds the signal value in the message struct. */
+    cdt_fieldType_t fieldType;
+
+    /** The byte offset of the field, which holds the signal value, in the message struct.
+        Use it to access the signal in a copy of the struct, which has been read from the
+        snapshot of the message, see cdt_canMessage_t::pSnapshot. */
+    unsigned int offsetOfField;
+
+    /** The scaling factor of the signal. The physical value is the binary value, i.e.
+        the value of the field in the message struct, times \a factor plus \a offset. */
+    float factor;
+
+    /** The offset of the scaling of the signal. */
+    float offset;
+
+    /** The length of the signal in Bit. */
+    unsigned int length;
+
 } cdt_canSignal_t;
 
 
+/** A buffer, which is large enough to hold a copy of the message struct of any received
+    message. Can be used to read a snapshot, see field \a pSnapshot of cdt_canMessage_t. */
+typedef union cdt_rxMsgSnapshotBuf_t
+{
+    cap_PWM_PWM_out_1001_sts_t PWM_PWM_out_1001;
+    cap_PT_StateEcu01_1024_sts_t PT_StateEcu01_1024;
+    cap_PT_StateEcu02_1040_sts_t PT_StateEcu02_1040;
+    cap_PT_UserLimits_2032_sts_t PT_UserLimits_2032;
+} cdt_rxMsgSnapshotBuf_t;
+
+
+/** A buffer, which is large enough to hold the contents of any received PDU. */
+typedef union cdt_rxPduBuf_t
+{
+    uint8_t PWM_PWM_out_1001[8];
+    uint8_t PT_StateEcu01_1024[4];
+    uint8_t PT_StateEcu02_1040[4];
+    uint8_t PT_UserLimits_2032[8];
+} cdt_rxPduBuf_t;
+
+
 
 /*
  * Data declarations
@@ -146,6 +228,26 @@ extern const cdt_canMessage_t cdt_canTxMsgAry[CST_NO_CAN_MSGS_SENT];
     reception and sending. */
 extern const cdt_canSignal_t cdt_canSignalAry[CST_NO_SENT_AND_RECEIVED_CAN_SIGNALS];
 
+/** The double-buffered snapshot of received message PWM_out (1001, 0x3e9)
+    on bus PWM. Read it with msn_readSnapshot() into a struct of type
+    cap_PWM_PWM_out_1001_sts_t. */
+extern msn_snapshot_t cdt_snapshot_PWM_PWM_out_1001;
+
+/** The double-buffered snapshot of received message StateEcu01 (1024, 0x400)
+    on bus PT. Read it with msn_readSnapshot() into a struct of type
+    cap_PT_StateEcu01_1024_sts_t. */
+extern msn_snapshot_t cdt_snapshot_PT_StateEcu01_1024;
+
+/** The double-buffered snapshot of received message StateEcu02 (1040, 0x410)
+    on bus PT. Read it with msn_readSnapshot() into a struct of type
+    cap_PT_StateEcu02_1040_sts_t. */
+extern msn_snapshot_t cdt_snapshot_PT_StateEcu02_1040;
+
+/** The double-buffered snapshot of received message UserLimits (2032, 0x7f0)
+    on bus PT. Read it with msn_readSnapshot() into a struct of type
+    cap_PT_UserLimits_2032_sts_t. */
+extern msn_snapshot_t cdt_snapshot_PT_UserLimits_2032;
+
 
 /*
  * Function declarations
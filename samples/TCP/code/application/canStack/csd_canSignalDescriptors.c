@@ -0,0 +1,495 @@
+/**
+ * @file csd_canSignalDescriptors.c
+ * 
+ * This module contains the signal descriptor tables for the table driven pack and unpack
+ * functions of module pku_packUnpack.c. There's one compact descriptor for each signal,
+ * which holds position, length, byte order and scaling of the signal and the location of
+ * the signal value in the global CAN API. The PDU descriptors have the same order as the
+ * message tables in cdt_canDataTables.c. A PDU with multiplexed or floating point signals
+ * has no signal descriptors; the table driven functions use the generated pack and unpack
+ * functions for it.
+ *
+ * This file has been created with comFramework - codeGenerator version 1.11.3,
+ * see http://sourceforge.net/projects/comframe/
+ *
+ * Copyright (C) 2015-2024 Peter Vranken (mailto:Peter_Vranken@Yahoo.de)
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Include files
+ */
+
+#include <stddef.h>
+
+#include "typ_types.h"
+#include "cap_canApi.h"
+#include "pku_packUnpack.h"
+#include "cst_canStatistics.h"
+#include "csd_canSignalDescriptors.h"
+
+
+/*
+ * Defines
+ */
+
+
+/*
+ * Local type definitions
+ */
+
+
+/*
+ * Local prototypes
+ */
+
+
+/*
+ * Data definitions
+ */
+
+/** The descriptors of the signals of all sent and received CAN messages, which are handled
+    by the table driven functions. The signals of a PDU form a contiguous range, which is
+    referenced by the PDU descriptor. */
+const pku_signalDesc_t csd_signalDescAry[] =
+{
+    /* Signals of PDU PWM_out (1001, 0x3e9) on bus PWM. */
+    { .factor = 1.0f
+    , .offset = 0.0f
+    , .offsetOfField = offsetof(cap_PWM_PWM_out_1001_t, LED_2_DS10_inhibit)
+    , .startBit = 0
+    , .length = 1
+    , .isMotorola = false
+    , .fieldType = pku_fieldType_boolean_t
+    },
+    { .factor = 1.0f
+    , .offset = 0.0f
+    , .offsetOfField = offsetof(cap_PWM_PWM_out_1001_t, LED_4_DS11_inhibit)
+    , .startBit = 1
+    , .length = 1
+    , .isMotorola = false
+    , .fieldType = pku_fieldType_boolean_t
+    },
+    { .factor = 1.0f
+    , .offset = 0.0f
+    , .offsetOfField = offsetof(cap_PWM_PWM_out_1001_t, LED_5_DS5_inhibit)
+    , .startBit = 2
+    , .length = 1
+    , .isMotorola = false
+    , .fieldType = pku_fieldType_boolean_t
+    },
+    { .factor = 1.0f
+    , .offset = 0.0f
+    , .offsetOfField = offsetof(cap_PWM_PWM_out_1001_t, PA1_J3_pin1_inhibit)
+    , .startBit = 3
+    , .length = 1
+    , .isMotorola = false
+    , .fieldType = pku_fieldType_boolean_t
+    },
+    { .factor = 0.97752f
+    , .offset = 0.0f
+    , .offsetOfField = offsetof(cap_PWM_PWM_out_1001_t, LED_2_DS10_frequency)
+    , .startBit = 4
+    , .length = 10
+    , .isMotorola = false
+    , .fieldType = pku_fieldType_uint16_t
+    },
+    { .factor = 0.97752f
+    , .offset = 0.0f
+    , .offsetOfField = offsetof(cap_PWM_PWM_out_1001_t, LED_4_DS11_frequency)
+    , .startBit = 14
+    , .length = 10
+    , .isMotorola = false
+    , .fieldType = pku_fieldType_uint16_t
+    },
+    { .factor = 0.97752f
+    , .offset = 0.0f
+    , .offsetOfField = offsetof(cap_PWM_PWM_out_1001_t, LED_5_DS5_frequency)
+    , .startBit = 24
+    , .length = 10
+    , .isMotorola = false
+    , .fieldType = pku_fieldType_uint16_t
+    },
+    { .factor = 9.7752f
+    , .offset = 0.0f
+    , .offsetOfField = offsetof(cap_PWM_PWM_out_1001_t, PA1_J3_pin1_frequency)
+    , .startBit = 34
+    , .length = 10
+    , .isMotorola = false
+    , .fieldType = pku_fieldType_uint16_t
+    },
+    { .factor = 3.2259f
+    , .offset = 0.0f
+    , .offsetOfField = offsetof(cap_PWM_PWM_out_1001_t, LED_2_DS10_dutyCycle)
+    , .startBit = 44
+    , .length = 5
+    , .isMotorola = false
+    , .fieldType = pku_fieldType_uint8_t
+    },
+    { .factor = 3.2259f
+    , .offset = 0.0f
+    , .offsetOfField = offsetof(cap_PWM_PWM_out_1001_t, LED_4_DS11_dutyCycle)
+    , .startBit = 49
+    , .length = 5
+    , .isMotorola = false
+    , .fieldType = pku_fieldType_uint8_t
+    },
+    { .factor = 3.2259f
+    , .offset = 0.0f
+    , .offsetOfField = offsetof(cap_PWM_PWM_out_1001_t, LED_5_DS5_dutyCycle)
+    , .startBit = 54
+    , .length = 5
+    , .isMotorola = false
+    , .fieldType = pku_fieldType_uint8_t
+    },
+    { .factor = 3.2259f
+    , .offset = 0.0f
+    , .offsetOfField = offsetof(cap_PWM_PWM_out_1001_t, PA1_J3_pin1_dutyCycle)
+    , .startBit = 59
+    , .length = 5
+    , .isMotorola = false
+    , .fieldType = pku_fieldType_uint8_t
+    },
+
+    /* Signals of PDU StateEcu01 (1024, 0x400) on bus PT. */
+    { .factor = 1.0f
+    , .offset = 0.0f
+    , .offsetOfField = offsetof(cap_PT_StateEcu01_1024_t, checksum)
+    , .startBit = 7
+    , .length = 8
+    , .isMotorola = true
+    , .fieldType = pku_fieldType_uint8_t
+    },
+    { .factor = 0.1f
+    , .offset = 0.0f
+    , .offsetOfField = offsetof(cap_PT_StateEcu01_1024_t, speedOfRotation)
+    , .startBit = 11
+    , .length = 16
+    , .isMotorola = true
+    , .fieldType = pku_fieldType_uint16_t
+    },
+    { .factor = 1.0f
+    , .offset = 0.0f
+    , .offsetOfField = offsetof(cap_PT_StateEcu01_1024_t, sequenceCounter)
+    , .startBit = 12
+    , .length = 4
+    , .isMotorola = false
+    , .fieldType = pku_fieldType_uint8_t
+    },
+
+    /* Signals of PDU StateEcu02 (1040, 0x410) on bus PT. */
+    { .factor = 1.0f
+    , .offset = 0.0f
+    , .offsetOfField = offsetof(cap_PT_StateEcu02_1040_t, sequenceCounter)
+    , .startBit = 8
+    , .length = 4
+    , .isMotorola = false
+    , .fieldType = pku_fieldType_uint8_t
+    },
+    { .factor = 0.5f
+    , .offset = 0.0f
+    , .offsetOfField = offsetof(cap_PT_StateEcu02_1040_t, torque)
+    , .startBit = 22
+    , .length = 11
+    , .isMotorola = true
+    , .fieldType = pku_fieldType_int16_t
+    },
+
+    /* Signals of PDU UserLimits (2032, 0x7f0) on bus PT. */
+    { .factor = 1.0f
+    , .offset = 0.0f
+    , .offsetOfField = offsetof(cap_PT_UserLimits_2032_t, sequenceCounter)
+    , .startBit = 2
+    , .length = 4
+    , .isMotorola = false
+    , .fieldType = pku_fieldType_uint8_t
+    },
+    { .factor = 1.6f
+    , .offset = 0.0f
+    , .offsetOfField = offsetof(cap_PT_UserLimits_2032_t, minSpeedOfRotation)
+    , .startBit = 6
+    , .length = 12
+    , .isMotorola = false
+    , .fieldType = pku_fieldType_uint16_t
+    },
+    { .factor = 1.6f
+    , .offset = 0.0f
+    , .offsetOfField = offsetof(cap_PT_UserLimits_2032_t, maxSpeedOfRotation)
+    , .startBit = 18
+    , .length = 12
+    , .isMotorola = false
+    , .fieldType = pku_fieldType_uint16_t
+    },
+    { .factor = 1.0f
+    , .offset = 0.0f
+    , .offsetOfField = offsetof(cap_PT_UserLimits_2032_t, checksum)
+    , .startBit = 39
+    , .length = 8
+    , .isMotorola = true
+    , .fieldType = pku_fieldType_uint8_t
+    },
+    { .factor = 0.5f
+    , .offset = -10.0f
+    , .offsetOfField = offsetof(cap_PT_UserLimits_2032_t, minPower)
+    , .startBit = 47
+    , .length = 9
+    , .isMotorola = true
+    , .fieldType = pku_fieldType_uint16_t
+    },
+    { .factor = 0.5f
+    , .offset = -10.0f
+    , .offsetOfField = offsetof(cap_PT_UserLimits_2032_t, maxPower)
+    , .startBit = 53
+    , .length = 9
+    , .isMotorola = true
+    , .fieldType = pku_fieldType_uint16_t
+    },
+
+    /* Signals of PDU PWM_in (1000, 0x3e8) on bus PWM. */
+    { .factor = 0.015625f
+    , .offset = 0.0f
+    , .offsetOfField = offsetof(cap_PWM_PWM_in_1000_t, PA2_J3_pin3_periodTime)
+    , .startBit = 6
+    , .length = 15
+    , .isMotorola = true
+    , .fieldType = pku_fieldType_uint16_t
+    },
+    { .factor = 1.0f
+    , .offset = 0.0f
+    , .offsetOfField = offsetof(cap_PWM_PWM_in_1000_t, PA2_J3_pin3_isNew)
+    , .startBit = 7
+    , .length = 1
+    , .isMotorola = false
+    , .fieldType = pku_fieldType_boolean_t
+    },
+    { .factor = 1.0f
+    , .offset = 0.0f
+    , .offsetOfField = offsetof(cap_PWM_PWM_in_1000_t, PA6_J2_pin1_isNew)
+    , .startBit = 16
+    , .length = 1
+    , .isMotorola = true
+    , .fieldType = pku_fieldType_boolean_t
+    },
+    { .factor = 0.015625f
+    , .offset = 0.0f
+    , .offsetOfField = offsetof(cap_PWM_PWM_in_1000_t, PA6_J2_pin1_dutyTime)
+    , .startBit = 17
+    , .length = 15
+    , .isMotorola = false
+    , .fieldType = pku_fieldType_uint16_t
+    },
+    { .factor = 0.00390625f
+    , .offset = 0.0f
+    , .offsetOfField = offsetof(cap_PWM_PWM_in_1000_t, PA2_PA6_dutyCycle)
+    , .startBit = 39
+    , .length = 15
+    , .isMotorola = true
+    , .fieldType = pku_fieldType_uint16_t
+    },
+    { .factor = 0.25f
+    , .offset = 0.0f
+    , .offsetOfField = offsetof(cap_PWM_PWM_in_1000_t, PA2_J3_pin3_frequency)
+    , .startBit = 40
+    , .length = 15
+    , .isMotorola = true
+    , .fieldType = pku_fieldType_uint16_t
+    },
+
+    /* Signals of PDU InfoPowerDisplay (1536, 0x600) on bus PT. */
+    { .factor = 1.0f
+    , .offset = 0.0f
+    , .offsetOfField = offsetof(cap_PT_InfoPowerDisplay_1536_t, checksum)
+    , .startBit = 0
+    , .length = 8
+    , .isMotorola = false
+    , .fieldType = pku_fieldType_uint8_t
+    },
+    { .factor = 1.0f
+    , .offset = 0.0f
+    , .offsetOfField = offsetof(cap_PT_InfoPowerDisplay_1536_t, sequenceCounter)
+    , .startBit = 8
+    , .length = 4
+    , .isMotorola = false
+    , .fieldType = pku_fieldType_uint8_t
+    },
+    { .factor = 32.0f
+    , .offset = -500000.0f
+    , .offsetOfField = offsetof(cap_PT_InfoPowerDisplay_1536_t, power)
+    , .startBit = 13
+    , .length = 15
+    , .isMotorola = false
+    , .fieldType = pku_fieldType_uint16_t
+    },
+    { .factor = 1.0f
+    , .offset = 0.0f
+    , .offsetOfField = offsetof(cap_PT_InfoPowerDisplay_1536_t, state)
+    , .startBit = 33
+    , .length = 3
+    , .isMotorola = true
+    , .fieldType = pku_fieldType_uint8_t
+    },
+
+    /* Signals of PDU StatusPowerDisplay (1537, 0x601) on bus PT. */
+    { .factor = 1.0f
+    , .offset = 0.0f
+    , .offsetOfField = offsetof(cap_PT_StatusPowerDisplay_1537_t, noDlcErrors)
+    , .startBit = 0
+    , .length = 11
+    , .isMotorola = false
+    , .fieldType = pku_fieldType_uint16_t
+    },
+    { .factor = 1.0f
+    , .offset = 0.0f
+    , .offsetOfField = offsetof(cap_PT_StatusPowerDisplay_1537_t, noCheckSumErrors)
+    , .startBit = 11
+    , .length = 11
+    , .isMotorola = false
+    , .fieldType = pku_fieldType_uint16_t
+    },
+    { .factor = 1.0f
+    , .offset = 0.0f
+    , .offsetOfField = offsetof(cap_PT_StatusPowerDisplay_1537_t, noSqcErrors)
+    , .startBit = 22
+    , .length = 11
+    , .isMotorola = false
+    , .fieldType = pku_fieldType_uint16_t
+    },
+    { .factor = 1.0f
+    , .offset = 0.0f
+    , .offsetOfField = offsetof(cap_PT_StatusPowerDisplay_1537_t, sequenceCounter)
+    , .startBit = 39
+    , .length = 7
+    , .isMotorola = true
+    , .fieldType = pku_fieldType_uint8_t
+    },
+    { .factor = 1.0f
+    , .offset = 0.0f
+    , .offsetOfField = offsetof(cap_PT_StatusPowerDisplay_1537_t, checksum)
+    , .startBit = 47
+    , .length = 8
+    , .isMotorola = true
+    , .fieldType = pku_fieldType_uint8_t
+    },
+
+    /* Signals of PDU LimitsPowerDisplay (1538, 0x602) on bus PT. */
+    { .factor = 1.0f
+    , .offset = 0.0f
+    , .offsetOfField = offsetof(cap_PT_LimitsPowerDisplay_1538_t, sequenceCounter)
+    , .startBit = 0
+    , .length = 3
+    , .isMotorola = false
+    , .fieldType = pku_fieldType_uint8_t
+    },
+    { .factor = 1.0f
+    , .offset = 0.0f
+    , .offsetOfField = offsetof(cap_PT_LimitsPowerDisplay_1538_t, belowMinSpeedOfRotation)
+    , .startBit = 3
+    , .length = 1
+    , .isMotorola = false
+    , .fieldType = pku_fieldType_boolean_t
+    },
+    { .factor = 1.0f
+    , .offset = 0.0f
+    , .offsetOfField = offsetof(cap_PT_LimitsPowerDisplay_1538_t, aboveMaxSpeedOfRotation)
+    , .startBit = 4
+    , .length = 1
+    , .isMotorola = false
+    , .fieldType = pku_fieldType_boolean_t
+    },
+    { .factor = 1.0f
+    , .offset = 0.0f
+    , .offsetOfField = offsetof(cap_PT_LimitsPowerDisplay_1538_t, belowMinPower)
+    , .startBit = 5
+    , .length = 1
+    , .isMotorola = false
+    , .fieldType = pku_fieldType_boolean_t
+    },
+    { .factor = 1.0f
+    , .offset = 0.0f
+    , .offsetOfField = offsetof(cap_PT_LimitsPowerDisplay_1538_t, aboveMaxPower)
+    , .startBit = 6
+    , .length = 1
+    , .isMotorola = false
+    , .fieldType = pku_fieldType_boolean_t
+    },
+
+}; /* csd_signalDescAry */
+
+/** The descriptors of all received PDUs. The order of entries is the same as in
+    cdt_canRxMsgAry. */
+const pku_pduDesc_t csd_rxPduDescAry[CST_NO_CAN_MSGS_RECEIVED] =
+{
+    [0] =
+        { .size = 8
+        , .signalAry = &csd_signalDescAry[0]
+        , .noSignals = 12
+        , .pApiMsg = &cap_getMsg_PWM_PWM_out_1001()
+        },
+    [1] =
+        { .size = 4
+        , .signalAry = &csd_signalDescAry[12]
+        , .noSignals = 3
+        , .pApiMsg = &cap_getMsg_PT_StateEcu01_1024()
+        },
+    [2] =
+        { .size = 4
+        , .signalAry = &csd_signalDescAry[15]
+        , .noSignals = 2
+        , .pApiMsg = &cap_getMsg_PT_StateEcu02_1040()
+        },
+    [3] =
+        { .size = 8
+        , .signalAry = &csd_signalDescAry[17]
+        , .noSignals = 6
+        , .pApiMsg = &cap_getMsg_PT_UserLimits_2032()
+        },
+}; /* csd_rxPduDescAry */
+
+/** The descriptors of all sent PDUs. The order of entries is the same as in
+    cdt_canTxMsgAry. */
+const pku_pduDesc_t csd_txPduDescAry[CST_NO_CAN_MSGS_SENT] =
+{
+    [0] =
+        { .size = 8
+        , .signalAry = &csd_signalDescAry[23]
+        , .noSignals = 6
+        , .pApiMsg = &cap_getMsg_PWM_PWM_in_1000()
+        },
+    [1] =
+        { .size = 6
+        , .signalAry = &csd_signalDescAry[29]
+        , .noSignals = 4
+        , .pApiMsg = &cap_getMsg_PT_InfoPowerDisplay_1536()
+        },
+    [2] =
+        { .size = 6
+        , .signalAry = &csd_signalDescAry[33]
+        , .noSignals = 5
+        , .pApiMsg = &cap_getMsg_PT_StatusPowerDisplay_1537()
+        },
+    [3] =
+        { .size = 1
+        , .signalAry = &csd_signalDescAry[38]
+        , .noSignals = 5
+        , .pApiMsg = &cap_getMsg_PT_LimitsPowerDisplay_1538()
+        },
+}; /* csd_txPduDescAry */
+
+
+
+/*
+ * Function implementation
+ */
+
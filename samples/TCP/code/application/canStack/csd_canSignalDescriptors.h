@@ -0,0 +1,79 @@
+#ifndef CSD_CANSIGNALDESCRIPTORS_DEFINED
+#define CSD_CANSIGNALDESCRIPTORS_DEFINED
+/**
+ * @file csd_canSignalDescriptors.h
+ * 
+ * This module contains the signal descriptor tables for the table driven pack and unpack
+ * functions of module pku_packUnpack.c. There's one compact descriptor for each signal,
+ * which holds position, length, byte order and scaling of the signal and the location of
+ * the signal value in the global CAN API. The PDU descriptors have the same order as the
+ * message tables in cdt_canDataTables.c. A PDU with multiplexed or floating point signals
+ * has no signal descriptors; the table driven functions use the generated pack and unpack
+ * functions for it.
+ *
+ * This file has been created with comFramework - codeGenerator version 1.11.3,
+ * see http://sourceforge.net/projects/comframe/
+ *
+ * Copyright (C) 2015-2024 Peter Vranken (mailto:Peter_Vranken@Yahoo.de)
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Include files
+ */
+
+#include "typ_types.h"
+#include "pku_packUnpack.h"
+#include "cst_canStatistics.h"
+
+
+/*
+ * Defines
+ */
+
+
+/*
+ * Type definitions
+ */
+
+
+/*
+ * Data declarations
+ */
+
+/** The descriptors of the signals of all sent and received CAN messages, which are handled
+    by the table driven functions. The signals of a PDU form a contiguous range, which is
+    referenced by the PDU descriptor. */
+extern const pku_signalDesc_t csd_signalDescAry[];
+
+/** The descriptors of all received PDUs. The order of entries is the same as in
+    cdt_canRxMsgAry. */
+extern const pku_pduDesc_t csd_rxPduDescAry[CST_NO_CAN_MSGS_RECEIVED];
+
+/** The descriptors of all sent PDUs. The order of entries is the same as in
+    cdt_canTxMsgAry. */
+extern const pku_pduDesc_t csd_txPduDescAry[CST_NO_CAN_MSGS_SENT];
+
+
+/*
+ * Function declarations
+ */
+
+
+/*
+ * Inline function definitions
+ */
+
+#endif // !defined(CSD_CANSIGNALDESCRIPTORS_DEFINED)
@@ -35,6 +35,12 @@ call codeGenerator ^
   --output-file-name cap_canApi.c ^
     --template-file-name cap_canApi.c.stg ^
     --template-name canApiDef ^
+  --output-file-name csd_canSignalDescriptors.h ^
+    --template-file-name csd_canSignalDescriptors.c.stg ^
+    --template-name signalDescriptors_h ^
+  --output-file-name csd_canSignalDescriptors.c ^
+    --template-file-name csd_canSignalDescriptors.c.stg ^
+    --template-name signalDescriptors_c ^
   --output-file-name codeGenerationReport.adoc ^
     --template-file-name templates/codeGenerationReport.adoc.stg ^
     --template-name asciidocReport ^
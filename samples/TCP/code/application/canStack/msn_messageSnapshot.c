@@ -0,0 +1,147 @@
+/**
+ * @file msn_messageSnapshot.c
+ * Lock-free, double-buffered snapshots of the message structs of the global CAN API.\n
+ *   The CAN interface engine writes the received signal values into the global CAN API.
+ * An APSW task, which doesn't run in the same task as the engine, can't directly read the
+ * API: It could see a partially updated message struct. So far, this required a critical
+ * section with the engine's task or an argument about task priorities. A snapshot offers
+ * an alternative: After each update of a message struct, the engine publishes a copy of
+ * the struct and any task on any core can read a consistent copy at any time. The writer
+ * never blocks and a reader doesn't need any lock.\n
+ *   The implementation is a sequence counter with two buffers. The writer increments the
+ * counter, which redirects the readers to the second buffer, updates the first buffer,
+ * increments the counter again, which redirects the readers back to the first buffer, and
+ * finally updates the second buffer. A reader copies the buffer, which is selected by the
+ * counter, and checks the counter afterwards. If the counter changed meanwhile then the
+ * copy can be inconsistent and it is repeated. The reader needs to repeat only if the copy
+ * overlaps with a publication, which is normally a rare event, and the number of
+ * repetitions is bounded if the writer doesn't publish more often than once per copy time
+ * of the reader.
+ *
+ * Copyright (C) 2026 Peter Vranken (mailto:Peter_Vranken@Yahoo.de)
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+/* Module interface
+ *   msn_publishSnapshot
+ *   msn_readSnapshot
+ * Local functions
+ */
+
+/*
+ * Include files
+ */
+
+#include "msn_messageSnapshot.h"
+
+#include <string.h>
+#include <assert.h>
+
+#include "typ_types.h"
+#include "std_decoratedStorage.h"
+
+
+/*
+ * Defines
+ */
+
+
+/*
+ * Local type definitions
+ */
+
+
+/*
+ * Local prototypes
+ */
+
+
+/*
+ * Data definitions
+ */
+
+
+/*
+ * Function implementation
+ */
+
+/**
+ * Publish the current contents of the message struct of the global CAN API. After return,
+ * all readers will get the new contents.
+ *   @param pSnapshot
+ * The snapshot by reference.
+ *   @remark
+ * The function must be called by a single writer only, which is the owner of the message
+ * struct in the global CAN API. Normally, this is the CAN interface engine, after it
+ * updated the message struct on reception or timeout of the message.
+ */
+void msn_publishSnapshot(msn_snapshot_t *pSnapshot)
+{
+    const uint32_t seq = pSnapshot->seq;
+    assert((seq & 0x1u) == 0u);
+
+    /* Redirect the readers to the second buffer and update the first one. The memory
+       barriers ensure that the cores' write operations complete in the intended order. */
+    pSnapshot->seq = seq + 1u;
+    std_fullMemoryBarrier();
+    memcpy(pSnapshot->bufAry[0], pSnapshot->pMsg, pSnapshot->sizeOfMsg);
+    std_fullMemoryBarrier();
+
+    /* Redirect the readers to the updated first buffer and update the second one. */
+    pSnapshot->seq = seq + 2u;
+    std_fullMemoryBarrier();
+    memcpy(pSnapshot->bufAry[1], pSnapshot->pMsg, pSnapshot->sizeOfMsg);
+    std_fullMemoryBarrier();
+
+} /* End of msn_publishSnapshot */
+
+
+
+/**
+ * Read a consistent copy of the most recently published message struct.
+ *   @return
+ * Get the number of publications so far, see msn_getNoPublications(). The caller can
+ * compare the value with the result of a previous call in order to find out whether the
+ * copy is new.
+ *   @param pSnapshot
+ * The snapshot by reference.
+ *   @param pMsg
+ * The copy of the message struct is written into this struct, which has the type of the
+ * message struct of the global CAN API.
+ *   @param sizeOfMsg
+ * The size of *\a pMsg in Byte. Used for consistency checking only.
+ *   @remark
+ * The function can be called from any task on any core. It doesn't block. If it is
+ * preempted by a publication then it repeats the copy operation.
+ */
+uint32_t msn_readSnapshot( const msn_snapshot_t *pSnapshot
+                         , void *pMsg
+                         , unsigned int sizeOfMsg ATTRIB_DBG_ONLY
+                         )
+{
+    assert(sizeOfMsg == pSnapshot->sizeOfMsg);
+
+    uint32_t seq;
+    do
+    {
+        seq = pSnapshot->seq;
+        std_fullMemoryBarrier();
+        memcpy(pMsg, pSnapshot->bufAry[seq & 0x1u], pSnapshot->sizeOfMsg);
+        std_fullMemoryBarrier();
+    }
+    while(pSnapshot->seq != seq);
+
+    return seq >> 1;
+
+} /* End of msn_readSnapshot */
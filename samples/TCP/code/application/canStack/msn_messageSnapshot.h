@@ -0,0 +1,96 @@
+#ifndef MSN_MESSAGESNAPSHOT_INCLUDED
+#define MSN_MESSAGESNAPSHOT_INCLUDED
+/**
+ * @file msn_messageSnapshot.h
+ * Definition of global interface of module msn_messageSnapshot.c
+ *
+ * Copyright (C) 2026 Peter Vranken (mailto:Peter_Vranken@Yahoo.de)
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Include files
+ */
+
+#include "typ_types.h"
+
+
+/*
+ * Defines
+ */
+
+
+/*
+ * Global type definitions
+ */
+
+/** A double-buffered snapshot of a message struct of the global CAN API. The snapshot is
+    written by a single writer, the CAN interface engine, and it can be read at any time by
+    any number of readers in any task on any core.\n
+      The snapshot needs to be placed in uncached memory if readers on other cores are
+    supposed to use it. */
+typedef struct msn_snapshot_t
+{
+    /** The sequence counter. It is incremented twice per publication of a new message
+        struct. Bit 0 selects the buffer, which the readers use. */
+    volatile uint32_t seq;
+
+    /** The size of the message struct in Byte. */
+    uint32_t sizeOfMsg;
+
+    /** The message struct in the global CAN API, which is published by the writer. */
+    const void *pMsg;
+
+    /** The two buffers for the copies of the message struct. Each of them has the size of
+        \a sizeOfMsg Byte. */
+    void *bufAry[2];
+
+} msn_snapshot_t;
+
+
+/*
+ * Global data declarations
+ */
+
+
+/*
+ * Global prototypes
+ */
+
+/** Publish the current contents of the message struct of the global CAN API. */
+void msn_publishSnapshot(msn_snapshot_t *pSnapshot);
+
+/** Read a consistent copy of the most recently published message struct. */
+uint32_t msn_readSnapshot(const msn_snapshot_t *pSnapshot, void *pMsg, unsigned int sizeOfMsg);
+
+
+/*
+ * Global inline functions
+ */
+
+/**
+ * Get the number of publications of a snapshot so far. Can be used by a reader to find
+ * out if there's a new message struct available, without reading it.
+ *   @return
+ * Get the number of publications. The value wraps around at 2^31.
+ *   @param pSnapshot
+ * The snapshot by reference.
+ */
+static inline uint32_t msn_getNoPublications(const msn_snapshot_t *pSnapshot)
+{
+    return pSnapshot->seq >> 1;
+}
+
+#endif  /* MSN_MESSAGESNAPSHOT_INCLUDED */
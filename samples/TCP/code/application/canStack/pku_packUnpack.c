@@ -0,0 +1,648 @@
+/**
+ * @file pku_packUnpack.c
+ * Table driven pack and unpack functions for CAN PDUs. This module is an alternative to
+ * the generated, message specific functions cap_pack_<bus>_<pdu> and
+ * cap_unpack_<bus>_<pdu> from cap_canApi.c.\n
+ *   The generated functions handle each signal with a dedicated sequence of byte-wise
+ * shift and mask operations. This is fast for a single message but the code size grows
+ * linearly with the number of signals in the CAN database, which leads to poor
+ * instruction cache behavior on the e200z4 for large databases. The functions here use a
+ * single, compact loop over a constant descriptor table instead, see
+ * csd_canSignalDescriptors.c, which is generated from the same CAN database.\n
+ *   The PDU contents are loaded into an array of 64 Bit words, once in big endian and once
+ * in little endian byte order. A signal can then be extracted with at most two word
+ * accesses, a shift and a mask, regardless of its length and byte alignment. Intel signals
+ * are taken from the little endian words and Motorola signals from the big endian words.
+ * The PDU size can be up to 64 Byte, which supports CAN FD frames. Multiplexed and
+ * floating point signals are not supported. The descriptor of a PDU with such signals
+ * refers to the generated functions, which are then used instead, see pku_pduDesc_t.\n
+ *   The functions produce the same results as the generated functions: Unused bits of a
+ * packed PDU are set to one and signed signals are sign extended when unpacked. There's one
+ * difference: For inbound PDUs, the descriptor table contains only the signals, which are
+ * received by our node. These are the signals, which the generated unpack function
+ * decodes. However, the generated pack function of an inbound PDU - which is normally not
+ * used at all - would pack the other signals, too, while the table driven function sets
+ * their bits to one.
+ *
+ * Copyright (C) 2026 Peter Vranken (mailto:Peter_Vranken@Yahoo.de)
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+/* Module interface
+ *   pku_unpack
+ *   pku_unpackChangedSignals
+ *   pku_pack
+ *   pku_getPhysicalValue
+ *   pku_getBinaryValue
+ * Local functions
+ *   isSignedField
+ *   loadWords
+ *   storeWords
+ *   extractIntel
+ *   extractMotorola
+ *   insertIntel
+ *   insertMotorola
+ *   readField
+ *   writeField
+ *   extractSignal
+ */
+
+/*
+ * Include files
+ */
+
+#include "pku_packUnpack.h"
+
+#include <string.h>
+#include <assert.h>
+
+#include "typ_types.h"
+
+
+/*
+ * Defines
+ */
+
+/** Byte swap of a 64 Bit word. */
+#define BSWAP64(w)  (__builtin_bswap64(w))
+
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+/** Conversion of a 64 Bit word, which had been read from memory, into big endian order. */
+# define BE64(w)    (w)
+/** Conversion of a 64 Bit word, which had been read from memory, into little endian order. */
+# define LE64(w)    BSWAP64(w)
+#else
+# define BE64(w)    BSWAP64(w)
+# define LE64(w)    (w)
+#endif
+
+
+/*
+ * Local type definitions
+ */
+
+
+/*
+ * Local prototypes
+ */
+
+
+/*
+ * Data definitions
+ */
+
+
+/*
+ * Function implementation
+ */
+
+/**
+ * Check if the field of a signal in the API struct has a signed integer type.
+ *   @return
+ * Get \a true if the signal value requires sign extension.
+ *   @param pSignalDesc
+ * The description of the signal.
+ */
+static inline bool isSignedField(const pku_signalDesc_t *pSignalDesc)
+{
+    switch(pSignalDesc->fieldType)
+    {
+    case pku_fieldType_int8_t:
+    case pku_fieldType_int16_t:
+    case pku_fieldType_int32_t:
+    case pku_fieldType_int64_t:
+        return true;
+    default:
+        return false;
+    }
+} /* End of isSignedField */
+
+
+
+/**
+ * Load the PDU contents into an array of 64 Bit words, both in big and in little endian
+ * byte order. The bytes of an incomplete last word are taken as zero.
+ *   @param wBEAry
+ * The big endian words are written into this array. Word i holds the bytes 8*i ..
+ * 8*i+7, with byte 8*i as most significant byte.
+ *   @param wLEAry
+ * The little endian words are written into this array. Word i holds the bytes 8*i ..
+ * 8*i+7, with byte 8*i as least significant byte.
+ *   @param m
+ * The PDU contents.
+ *   @param size
+ * The number of bytes in \a m.
+ */
+static inline void loadWords( uint64_t wBEAry[PKU_MAX_NO_WORDS]
+                            , uint64_t wLEAry[PKU_MAX_NO_WORDS]
+                            , const uint8_t m[]
+                            , unsigned int size
+                            )
+{
+    const unsigned int noFullWords = size/8u;
+    unsigned int idxWord;
+    for(idxWord=0; idxWord<noFullWords; ++idxWord)
+    {
+        uint64_t w;
+        memcpy(&w, &m[8u*idxWord], sizeof(w));
+        wBEAry[idxWord] = BE64(w);
+        wLEAry[idxWord] = LE64(w);
+    }
+
+    const unsigned int noBytesLastWord = size%8u;
+    if(noBytesLastWord > 0u)
+    {
+        uint8_t lastWordAry[8] = {[0] = 0u};
+        memcpy(&lastWordAry[0], &m[8u*idxWord], noBytesLastWord);
+
+        uint64_t w;
+        memcpy(&w, &lastWordAry[0], sizeof(w));
+        wBEAry[idxWord] = BE64(w);
+        wLEAry[idxWord] = LE64(w);
+    }
+} /* End of loadWords */
+
+
+
+/**
+ * Store an array of big endian 64 Bit words as PDU contents.
+ *   @param m
+ * The PDU contents are written into this byte array.
+ *   @param wBEAry
+ * The big endian words. See loadWords() for details.
+ *   @param size
+ * The number of bytes to write into \a m.
+ */
+static inline void storeWords( uint8_t m[]
+                             , const uint64_t wBEAry[PKU_MAX_NO_WORDS]
+                             , unsigned int size
+                             )
+{
+    const unsigned int noFullWords = size/8u;
+    unsigned int idxWord;
+    for(idxWord=0; idxWord<noFullWords; ++idxWord)
+    {
+        const uint64_t w = BE64(wBEAry[idxWord]);
+        memcpy(&m[8u*idxWord], &w, sizeof(w));
+    }
+
+    const unsigned int noBytesLastWord = size%8u;
+    if(noBytesLastWord > 0u)
+    {
+        uint8_t lastWordAry[8];
+        const uint64_t w = BE64(wBEAry[idxWord]);
+        memcpy(&lastWordAry[0], &w, sizeof(w));
+        memcpy(&m[8u*idxWord], &lastWordAry[0], noBytesLastWord);
+    }
+} /* End of storeWords */
+
+
+
+/**
+ * Extract the binary value of an Intel signal.
+ *   @return
+ * Get the signal value, right aligned but not yet masked or sign extended.
+ *   @param wLEAry
+ * The PDU contents as little endian words.
+ *   @param pSignalDesc
+ * The description of the signal.
+ */
+static inline uint64_t extractIntel( const uint64_t wLEAry[PKU_MAX_NO_WORDS]
+                                   , const pku_signalDesc_t *pSignalDesc
+                                   )
+{
+    /* For Intel signals, the start bit is the LSB. The little endian words have a linear
+       bit numbering, which is identical to the DBC notation. */
+    const unsigned int idxWord = pSignalDesc->startBit / 64u
+                     , shift = pSignalDesc->startBit % 64u;
+    uint64_t bin = wLEAry[idxWord] >> shift;
+    if(shift + pSignalDesc->length > 64u)
+        bin |= wLEAry[idxWord+1u] << (64u-shift);
+
+    return bin;
+
+} /* End of extractIntel */
+
+
+
+/**
+ * Extract the binary value of a Motorola signal.
+ *   @return
+ * Get the signal value, right aligned but not yet masked or sign extended.
+ *   @param wBEAry
+ * The PDU contents as big endian words.
+ *   @param pSignalDesc
+ * The description of the signal.
+ */
+static inline uint64_t extractMotorola( const uint64_t wBEAry[PKU_MAX_NO_WORDS]
+                                      , const pku_signalDesc_t *pSignalDesc
+                                      )
+{
+    /* For Motorola signals, the start bit is the MSB in the DBC's sawtooth notation. We
+       convert it into a linear bit index, which counts from the MSB of byte 0 onwards. In
+       this notation, the signal occupies a contiguous range of bits in the big endian
+       words. */
+    const unsigned int startBit = pSignalDesc->startBit
+                     , idxMSB = (startBit & ~7u) + 7u - (startBit & 7u)
+                     , idxLSB = idxMSB + pSignalDesc->length - 1u
+                     , idxWord = idxLSB / 64u
+                     , shift = 63u - idxLSB % 64u;
+    uint64_t bin = wBEAry[idxWord] >> shift;
+    if(idxMSB / 64u != idxWord)
+    {
+        assert(idxWord > 0u  &&  shift > 0u);
+        bin |= wBEAry[idxWord-1u] << (64u-shift);
+    }
+
+    return bin;
+
+} /* End of extractMotorola */
+
+
+
+/**
+ * Insert the binary value of an Intel signal into the PDU.
+ *   @param wLEAry
+ * The PDU contents as little endian words.
+ *   @param pSignalDesc
+ * The description of the signal.
+ *   @param bin
+ * The binary signal value, already masked to the length of the signal.
+ *   @param mask
+ * The right aligned mask of the signal bits.
+ */
+static inline void insertIntel( uint64_t wLEAry[PKU_MAX_NO_WORDS]
+                              , const pku_signalDesc_t *pSignalDesc
+                              , uint64_t bin
+                              , uint64_t mask
+                              )
+{
+    const unsigned int idxWord = pSignalDesc->startBit / 64u
+                     , shift = pSignalDesc->startBit % 64u;
+    wLEAry[idxWord] = (wLEAry[idxWord] & ~(mask << shift)) | (bin << shift);
+    if(shift + pSignalDesc->length > 64u)
+    {
+        const unsigned int shiftHi = 64u - shift;
+        wLEAry[idxWord+1u] = (wLEAry[idxWord+1u] & ~(mask >> shiftHi)) | (bin >> shiftHi);
+    }
+} /* End of insertIntel */
+
+
+
+/**
+ * Insert the binary value of a Motorola signal into the PDU.
+ *   @param wBEAry
+ * The PDU contents as big endian words.
+ *   @param pSignalDesc
+ * The description of the signal.
+ *   @param bin
+ * The binary signal value, already masked to the length of the signal.
+ *   @param mask
+ * The right aligned mask of the signal bits.
+ */
+static inline void insertMotorola( uint64_t wBEAry[PKU_MAX_NO_WORDS]
+                                 , const pku_signalDesc_t *pSignalDesc
+                                 , uint64_t bin
+                                 , uint64_t mask
+                                 )
+{
+    const unsigned int startBit = pSignalDesc->startBit
+                     , idxMSB = (startBit & ~7u) + 7u - (startBit & 7u)
+                     , idxLSB = idxMSB + pSignalDesc->length - 1u
+                     , idxWord = idxLSB / 64u
+                     , shift = 63u - idxLSB % 64u;
+    wBEAry[idxWord] = (wBEAry[idxWord] & ~(mask << shift)) | (bin << shift);
+    if(idxMSB / 64u != idxWord)
+    {
+        assert(idxWord > 0u  &&  shift > 0u);
+        const unsigned int shiftHi = 64u - shift;
+        wBEAry[idxWord-1u] = (wBEAry[idxWord-1u] & ~(mask >> shiftHi)) | (bin >> shiftHi);
+    }
+} /* End of insertMotorola */
+
+
+
+/**
+ * Read the binary value of a signal from its field in a message struct.
+ *   @return
+ * Get the value as 64 Bit word. Signed values are sign extended.
+ *   @param pSignalDesc
+ * The description of the signal.
+ *   @param pMsgStruct
+ * The message struct.
+ */
+static inline uint64_t readField( const pku_signalDesc_t *pSignalDesc
+                                , const void *pMsgStruct
+                                )
+{
+    const void * const pField = (const uint8_t*)pMsgStruct + pSignalDesc->offsetOfField;
+    switch(pSignalDesc->fieldType)
+    {
+    case pku_fieldType_boolean_t: return (uint64_t)*(const boolean_t*)pField;
+    case pku_fieldType_uint8_t: return (uint64_t)*(const uint8_t*)pField;
+    case pku_fieldType_int8_t: return (uint64_t)(int64_t)*(const int8_t*)pField;
+    case pku_fieldType_uint16_t: return (uint64_t)*(const uint16_t*)pField;
+    case pku_fieldType_int16_t: return (uint64_t)(int64_t)*(const int16_t*)pField;
+    case pku_fieldType_uint32_t: return (uint64_t)*(const uint32_t*)pField;
+    case pku_fieldType_int32_t: return (uint64_t)(int64_t)*(const int32_t*)pField;
+    case pku_fieldType_uint64_t: return *(const uint64_t*)pField;
+    case pku_fieldType_int64_t: return (uint64_t)*(const int64_t*)pField;
+    default: assert(false); return 0u;
+    }
+} /* End of readField */
+
+
+
+/**
+ * Write the binary value of a signal into its field in a message struct.
+ *   @param pSignalDesc
+ * The description of the signal.
+ *   @param pMsgStruct
+ * The message struct.
+ *   @param bin
+ * The binary signal value, masked and - for signed types - sign extended.
+ */
+static inline void writeField( const pku_signalDesc_t *pSignalDesc
+                             , void *pMsgStruct
+                             , uint64_t bin
+                             )
+{
+    void * const pField = (uint8_t*)pMsgStruct + pSignalDesc->offsetOfField;
+    switch(pSignalDesc->fieldType)
+    {
+    case pku_fieldType_boolean_t: *(boolean_t*)pField = (boolean_t)bin; break;
+    case pku_fieldType_uint8_t: *(uint8_t*)pField = (uint8_t)bin; break;
+    case pku_fieldType_int8_t: *(int8_t*)pField = (int8_t)bin; break;
+    case pku_fieldType_uint16_t: *(uint16_t*)pField = (uint16_t)bin; break;
+    case pku_fieldType_int16_t: *(int16_t*)pField = (int16_t)bin; break;
+    case pku_fieldType_uint32_t: *(uint32_t*)pField = (uint32_t)bin; break;
+    case pku_fieldType_int32_t: *(int32_t*)pField = (int32_t)bin; break;
+    case pku_fieldType_uint64_t: *(uint64_t*)pField = bin; break;
+    case pku_fieldType_int64_t: *(int64_t*)pField = (int64_t)bin; break;
+    default: assert(false);
+    }
+} /* End of writeField */
+
+
+
+/**
+ * Extract the binary value of a signal from the PDU contents.
+ *   @return
+ * Get the signal value, right aligned. The bits above the signal are masked or, for
+ * signed types, filled with the sign bit.
+ *   @param wBEAry
+ * The PDU contents as big endian words.
+ *   @param wLEAry
+ * The PDU contents as little endian words.
+ *   @param pSignalDesc
+ * The description of the signal.
+ *   @param isSignExtended
+ * If \a true then signed signals are sign extended, otherwise all signals are only masked.
+ */
+static inline uint64_t extractSignal( const uint64_t wBEAry[PKU_MAX_NO_WORDS]
+                                    , const uint64_t wLEAry[PKU_MAX_NO_WORDS]
+                                    , const pku_signalDesc_t *pSignalDesc
+                                    , bool isSignExtended
+                                    )
+{
+    const unsigned int length = pSignalDesc->length;
+    assert(length >= 1u  &&  length <= 64u);
+
+    uint64_t bin = pSignalDesc->isMotorola? extractMotorola(wBEAry, pSignalDesc)
+                                          : extractIntel(wLEAry, pSignalDesc);
+
+    /* Mask the signal bits. For signed types, the sign bit of the signal is propagated
+       into all upper bits. Here, we make use of the arithmetic shift right of signed
+       integers, which is implementation defined but provided by GCC. */
+    if(length < 64u)
+    {
+        const unsigned int shiftLeft = 64u - length;
+        if(isSignExtended  &&  isSignedField(pSignalDesc))
+            bin = (uint64_t)((int64_t)(bin << shiftLeft) >> shiftLeft);
+        else
+            bin &= ~0ull >> shiftLeft;
+    }
+
+    return bin;
+
+} /* End of extractSignal */
+
+
+
+/**
+ * Unpack all signals of a PDU from its binary contents into a message struct.
+ *   @param pPduDesc
+ * The description of the PDU. It needs to have signal descriptors, see pku_pduDesc_t.
+ *   @param pMsgStruct
+ * The unpacked signal values are written into this message struct. Its type is the
+ * message struct cap_<bus>_<pdu>_<id>_t from the CAN API, which the descriptor table has
+ * been generated for.
+ *   @param m
+ * The PDU contents. pPduDesc->size bytes are read.
+ */
+void pku_unpack(const pku_pduDesc_t *pPduDesc, void *pMsgStruct, const uint8_t m[])
+{
+    assert(pPduDesc->size <= PKU_MAX_PDU_SIZE  &&  pPduDesc->signalAry != NULL);
+
+    uint64_t wBEAry[PKU_MAX_NO_WORDS]
+           , wLEAry[PKU_MAX_NO_WORDS];
+    loadWords(wBEAry, wLEAry, m, pPduDesc->size);
+
+    const pku_signalDesc_t *pSignalDesc = &pPduDesc->signalAry[0];
+    for(unsigned int u=0; u<pPduDesc->noSignals; ++u, ++pSignalDesc)
+    {
+        writeField( pSignalDesc
+                  , pMsgStruct
+                  , extractSignal(wBEAry, wLEAry, pSignalDesc, /* isSignExtended */ true)
+                  );
+    }
+} /* End of pku_unpack */
+
+
+
+/**
+ * Unpack only those signals of a PDU, whose value changed since the previous reception of
+ * the PDU.\n
+ *   The new PDU contents are compared with the contents of the previous reception by
+ * XOR. If there's no difference at all then the function returns immediately; the message
+ * struct is not touched. Otherwise, only those signals are unpacked, whose bit range in
+ * the PDU overlaps with at least one changed bit.
+ *   @return
+ * Get the set of changed signals. Bit i is set if the signal i of the PDU, i.e.,
+ * pPduDesc->signalAry[i], has been unpacked. Bit 63 stands for signal 63 and all later
+ * signals of a PDU with more than 64 signals. Get 0 if the PDU contents didn't change.
+ *   @param pPduDesc
+ * The description of the PDU. It needs to have signal descriptors, see pku_pduDesc_t.
+ *   @param pMsgStruct
+ * The changed signal values are written into this message struct. See pku_unpack().
+ *   @param m
+ * The new PDU contents. pPduDesc->size bytes are read.
+ *   @param mLast
+ * The PDU contents of the previous reception. pPduDesc->size bytes are read. The array is
+ * updated with the contents of \a m.
+ *   @param isUnpackAll
+ * If \a true then all signals are unpacked and reported as changed, regardless of \a
+ * mLast. This is used on the first reception of the PDU, when \a mLast is not yet valid and
+ * the message struct still holds the initial values.
+ */
+uint64_t pku_unpackChangedSignals( const pku_pduDesc_t *pPduDesc
+                                 , void *pMsgStruct
+                                 , const uint8_t m[]
+                                 , uint8_t mLast[]
+                                 , bool isUnpackAll
+                                 )
+{
+    const unsigned int size = pPduDesc->size;
+    assert(size <= PKU_MAX_PDU_SIZE  &&  pPduDesc->signalAry != NULL);
+
+    uint64_t wBEAry[PKU_MAX_NO_WORDS]
+           , wLEAry[PKU_MAX_NO_WORDS]
+           , xBEAry[PKU_MAX_NO_WORDS]
+           , xLEAry[PKU_MAX_NO_WORDS];
+    loadWords(wBEAry, wLEAry, m, size);
+    loadWords(xBEAry, xLEAry, mLast, size);
+
+    /* The XOR of old and new contents has a bit set for each changed bit. */
+    const unsigned int noWords = (size+7u)/8u;
+    uint64_t anyChange = 0u;
+    for(unsigned int idxWord=0; idxWord<noWords; ++idxWord)
+    {
+        xBEAry[idxWord] ^= wBEAry[idxWord];
+        xLEAry[idxWord] ^= wLEAry[idxWord];
+        anyChange |= xBEAry[idxWord];
+    }
+    if(anyChange == 0u  &&  !isUnpackAll)
+        return 0u;
+
+    memcpy(mLast, m, size);
+
+    uint64_t changedSignals = 0u;
+    const pku_signalDesc_t *pSignalDesc = &pPduDesc->signalAry[0];
+    for(unsigned int u=0; u<pPduDesc->noSignals; ++u, ++pSignalDesc)
+    {
+        /* The XOR words are decoded like normal PDU contents. The signal changed if any
+           of its bits is set. */
+        if(isUnpackAll
+           ||  extractSignal(xBEAry, xLEAry, pSignalDesc, /* isSignExtended */ false) != 0u
+          )
+        {
+            writeField( pSignalDesc
+                      , pMsgStruct
+                      , extractSignal(wBEAry, wLEAry, pSignalDesc, /* isSignExtended */ true)
+                      );
+            changedSignals |= 1ull << (u < 63u? u: 63u);
+        }
+    }
+
+    return changedSignals;
+
+} /* End of pku_unpackChangedSignals */
+
+
+
+/**
+ * Pack all signals of a PDU from a message struct into the binary contents.
+ *   @param pPduDesc
+ * The description of the PDU. It needs to have signal descriptors, see pku_pduDesc_t.
+ *   @param m
+ * The PDU contents are written into this byte array. pPduDesc->size bytes are written.
+ * Unused bits are set to one.
+ *   @param pMsgStruct
+ * The signal values are read from this message struct. Its type is the message struct
+ * cap_<bus>_<pdu>_<id>_t from the CAN API, which the descriptor table has been generated
+ * for.
+ */
+void pku_pack(const pku_pduDesc_t *pPduDesc, uint8_t m[], const void *pMsgStruct)
+{
+    assert(pPduDesc->size <= PKU_MAX_PDU_SIZE  &&  pPduDesc->signalAry != NULL);
+
+    /* All unused bits of the PDU will be ones. We start with an all ones word array and
+       clear and set the bits of the signals. */
+    const unsigned int noWords = (pPduDesc->size + 7u) / 8u;
+    uint64_t wAry[PKU_MAX_NO_WORDS];
+    for(unsigned int idxWord=0; idxWord<noWords; ++idxWord)
+        wAry[idxWord] = ~0ull;
+
+    /* Intel and Motorola signals need to be inserted into the words of different byte
+       order. We make two passes: The Intel signals are inserted first, while the word
+       array is in little endian order. Then the array is byte swapped and the Motorola
+       signals are inserted into the big endian words. The all ones initialization is
+       invariant under byte swapping. */
+    for(unsigned int pass=0; pass<2u; ++pass)
+    {
+        const bool isMotorolaPass = pass > 0u;
+        if(isMotorolaPass)
+        {
+            for(unsigned int idxWord=0; idxWord<noWords; ++idxWord)
+                wAry[idxWord] = BSWAP64(wAry[idxWord]);
+        }
+
+        const pku_signalDesc_t *pSignalDesc = &pPduDesc->signalAry[0];
+        for(unsigned int u=0; u<pPduDesc->noSignals; ++u, ++pSignalDesc)
+        {
+            if((bool)pSignalDesc->isMotorola != isMotorolaPass)
+                continue;
+
+            const unsigned int length = pSignalDesc->length;
+            assert(length >= 1u  &&  length <= 64u);
+            const uint64_t mask = ~0ull >> (64u - length)
+                         , bin = readField(pSignalDesc, pMsgStruct) & mask;
+
+            if(isMotorolaPass)
+                insertMotorola(wAry, pSignalDesc, bin, mask);
+            else
+                insertIntel(wAry, pSignalDesc, bin, mask);
+        }
+    } /* for(Intel and Motorola pass) */
+
+    storeWords(m, wAry, pPduDesc->size);
+
+} /* End of pku_pack */
+
+
+
+/**
+ * Get the physical value of a signal from the message struct.
+ *   @return
+ * Get the binary value of the signal, scaled with factor and offset from the descriptor.
+ *   @param pSignalDesc
+ * The description of the signal.
+ *   @param pMsgStruct
+ * The message struct, which holds the binary signal value.
+ */
+float pku_getPhysicalValue(const pku_signalDesc_t *pSignalDesc, const void *pMsgStruct)
+{
+    const uint64_t bin = readField(pSignalDesc, pMsgStruct);
+    const float binF = isSignedField(pSignalDesc)? (float)(int64_t)bin: (float)bin;
+    return binF * pSignalDesc->factor + pSignalDesc->offset;
+
+} /* End of pku_getPhysicalValue */
+
+
+
+/**
+ * Get the binary value of a signal from the message struct.
+ *   @return
+ * Get the binary value of the signal as 64 Bit word. The value of a signed signal is sign
+ * extended.
+ *   @param pSignalDesc
+ * The description of the signal.
+ *   @param pMsgStruct
+ * The message struct, which holds the binary signal value.
+ */
+uint64_t pku_getBinaryValue(const pku_signalDesc_t *pSignalDesc, const void *pMsgStruct)
+{
+    return readField(pSignalDesc, pMsgStruct);
+
+} /* End of pku_getBinaryValue */
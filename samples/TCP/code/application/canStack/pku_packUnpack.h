@@ -0,0 +1,240 @@
+#ifndef PKU_PACKUNPACK_INCLUDED
+#define PKU_PACKUNPACK_INCLUDED
+/**
+ * @file pku_packUnpack.h
+ * Definition of global interface of module pku_packUnpack.c
+ *
+ * Copyright (C) 2026 Peter Vranken (mailto:Peter_Vranken@Yahoo.de)
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Include files
+ */
+
+#include <string.h>
+
+#include "typ_types.h"
+
+
+/*
+ * Defines
+ */
+
+/** The maximum size of a PDU in Byte, which can be handled by the pack and unpack
+    functions. 64 Byte is the largest payload of a CAN FD frame. */
+#define PKU_MAX_PDU_SIZE        64u
+
+/** The PDU is internally processed as an array of 64 Bit words. This is the number of
+    words required for the largest PDU. */
+#define PKU_MAX_NO_WORDS        ((PKU_MAX_PDU_SIZE+7u)/8u)
+
+
+/*
+ * Global type definitions
+ */
+
+/** The C type of the field in the API struct, which holds the binary value of a signal.
+    The names of the enumerated values are chosen such that the code generator can form
+    them from the type name of the signal.\n
+      Floating point signals are not supported by the table driven engine; the code
+    generator doesn't emit signal descriptors for a PDU with such a signal, see
+    pku_pduDesc_t. */
+typedef enum pku_fieldType_t
+{
+    pku_fieldType_boolean_t,
+    pku_fieldType_uint8_t,
+    pku_fieldType_int8_t,
+    pku_fieldType_uint16_t,
+    pku_fieldType_int16_t,
+    pku_fieldType_uint32_t,
+    pku_fieldType_int32_t,
+    pku_fieldType_uint64_t,
+    pku_fieldType_int64_t,
+
+} pku_fieldType_t;
+
+
+/** The description of a single signal as required for packing and unpacking it. The
+    struct is kept compact, there's one such descriptor for each signal in the CAN
+    database. */
+typedef struct pku_signalDesc_t
+{
+    /** The scaling factor of the signal. The physical value is binary value times \a
+        factor plus \a offset. */
+    float factor;
+
+    /** The offset of the scaling of the signal. */
+    float offset;
+
+    /** The byte offset of the signal's field in the message struct of the global CAN
+        API. */
+    uint16_t offsetOfField;
+
+    /** The start bit of the signal in the notation of the CAN database file. This is the
+        LSB for Intel and the MSB for Motorola signals. Range is 0..8*#PKU_MAX_PDU_SIZE-1. */
+    uint16_t startBit;
+
+    /** The length of the signal in Bit, 1..64. */
+    uint8_t length;
+
+    /** The byte order: \a true for Motorola (big endian) and \a false for Intel (little
+        endian) signals. */
+    uint8_t isMotorola;
+
+    /** The type of the signal's field in the API struct, one out of enumeration
+        pku_fieldType_t. Signed types imply sign extension of the signal value. */
+    uint8_t fieldType;
+
+} pku_signalDesc_t;
+
+
+/** The description of a PDU as required for packing and unpacking its signals.\n
+      A PDU with multiplexed or floating point signals can't be described by signal
+    descriptors. The code generator emits a descriptor with \a signalAry set to NULL for
+    such a PDU and the functions pku_unpackApi(), pku_unpackApiChangedSignals() and
+    pku_packApi() delegate to the generated functions \a fctUnpackApi and \a fctPackApi
+    instead. */
+typedef struct pku_pduDesc_t
+{
+    /** The size of the PDU in Byte, 0..#PKU_MAX_PDU_SIZE. */
+    unsigned int size;
+
+    /** The number of signals in the PDU. */
+    unsigned int noSignals;
+
+    /** The descriptors of the \a noSignals signals of the PDU or NULL if the PDU is
+        handled by the generated functions. */
+    const pku_signalDesc_t *signalAry;
+
+    /** The message struct in the global CAN API, which holds the signal values of the PDU.
+        Used by pku_packApi() and pku_unpackApi(). */
+    void *pApiMsg;
+
+    /** Only if \a signalAry is NULL: The generated function, which unpacks the PDU into
+        the global CAN API. NULL for outbound PDUs. */
+    void (*fctUnpackApi)(const uint8_t m[]);
+
+    /** Only if \a signalAry is NULL: The generated function, which packs the PDU from the
+        global CAN API. NULL for inbound PDUs. */
+    void (*fctPackApi)(uint8_t m[]);
+
+} pku_pduDesc_t;
+
+
+/*
+ * Global data declarations
+ */
+
+
+/*
+ * Global prototypes
+ */
+
+/** Unpack all signals of a PDU from its binary contents into a message struct. */
+void pku_unpack(const pku_pduDesc_t *pPduDesc, void *pMsgStruct, const uint8_t m[]);
+
+/** Unpack only the signals of a PDU, whose value changed since the previous reception. */
+uint64_t pku_unpackChangedSignals( const pku_pduDesc_t *pPduDesc
+                                 , void *pMsgStruct
+                                 , const uint8_t m[]
+                                 , uint8_t mLast[]
+                                 , bool isUnpackAll
+                                 );
+
+/** Pack all signals of a PDU from a message struct into the binary contents. */
+void pku_pack(const pku_pduDesc_t *pPduDesc, uint8_t m[], const void *pMsgStruct);
+
+/** Get the physical value of a signal from the message struct. */
+float pku_getPhysicalValue(const pku_signalDesc_t *pSignalDesc, const void *pMsgStruct);
+
+/** Get the binary value of a signal from the message struct. */
+uint64_t pku_getBinaryValue(const pku_signalDesc_t *pSignalDesc, const void *pMsgStruct);
+
+
+/*
+ * Global inline functions
+ */
+
+/**
+ * Unpack all signals of a PDU from its binary contents into the related message struct of
+ * the global CAN API. This is the table driven counterpart of the generated functions
+ * cap_unpackApi_<bus>_<pdu>.
+ *   @param pPduDesc
+ * The description of the PDU.
+ *   @param m
+ * The PDU contents. pPduDesc->size bytes are read.
+ */
+static inline void pku_unpackApi(const pku_pduDesc_t *pPduDesc, const uint8_t m[])
+{
+    if(pPduDesc->signalAry != NULL)
+        pku_unpack(pPduDesc, pPduDesc->pApiMsg, m);
+    else
+        pPduDesc->fctUnpackApi(m);
+}
+
+
+/**
+ * Unpack the changed signals of a PDU from its binary contents into the related message
+ * struct of the global CAN API. See pku_unpackChangedSignals() for details.
+ *   @return
+ * Get the set of changed signals, one bit per signal of the PDU. For a PDU without signal
+ * descriptors, get either all bits set or 0 if the PDU contents didn't change.
+ *   @param pPduDesc
+ * The description of the PDU.
+ *   @param m
+ * The new PDU contents. pPduDesc->size bytes are read.
+ *   @param mLast
+ * The PDU contents of the previous reception. Updated with \a m.
+ *   @param isUnpackAll
+ * Unpack all signals regardless of \a mLast.
+ */
+static inline uint64_t pku_unpackApiChangedSignals( const pku_pduDesc_t *pPduDesc
+                                                  , const uint8_t m[]
+                                                  , uint8_t mLast[]
+                                                  , bool isUnpackAll
+                                                  )
+{
+    if(pPduDesc->signalAry != NULL)
+        return pku_unpackChangedSignals(pPduDesc, pPduDesc->pApiMsg, m, mLast, isUnpackAll);
+
+    /* Without signal descriptors, we can only tell whether the PDU contents changed at
+       all. If so, the generated function unpacks all signals. */
+    if(!isUnpackAll  &&  memcmp(mLast, m, pPduDesc->size) == 0)
+        return 0u;
+    memcpy(mLast, m, pPduDesc->size);
+    pPduDesc->fctUnpackApi(m);
+    return ~0ull;
+}
+
+
+/**
+ * Pack all signals of a PDU from the related message struct of the global CAN API into the
+ * binary contents. This is the table driven counterpart of the generated functions
+ * cap_packApi_<bus>_<pdu>.
+ *   @param pPduDesc
+ * The description of the PDU.
+ *   @param m
+ * The PDU contents are written into this byte array. pPduDesc->size bytes are written.
+ */
+static inline void pku_packApi(const pku_pduDesc_t *pPduDesc, uint8_t m[])
+{
+    if(pPduDesc->signalAry != NULL)
+        pku_pack(pPduDesc, m, pPduDesc->pApiMsg);
+    else
+        pPduDesc->fctPackApi(m);
+}
+
+#endif  /* PKU_PACKUNPACK_INCLUDED */
@@ -0,0 +1,149 @@
+/**
+ * @file rts_rxTimeoutSupervision.c
+ * Timeout supervision of inbound CAN messages.\n
+ *   The supervision doesn't use a dispatcher timer per message. Instead, the deadline of
+ * each supervised message is kept in a dense array, which is checked in a single sweep per
+ * tick of the CAN interface engine. The reception of a message just overwrites its
+ * deadline. The sweep has two passes: The first pass is a branch free loop over all
+ * deadlines, which only finds out if any deadline elapsed. The compiler can vectorize or
+ * at least unroll this loop. Only if there's an elapsed deadline, which is the rare case,
+ * the second pass locates the message and notifies the timeout.\n
+ *   The timing behavior is identical to a single shot timer of the event dispatcher: A
+ * deadline is elapsed if the current time is equal to or later than the deadline. An
+ * elapsed deadline is notified once and then disarmed; it is not notified again until the
+ * supervision has been restarted with rts_armTimeout().
+ *
+ * Copyright (C) 2026 Peter Vranken (mailto:Peter_Vranken@Yahoo.de)
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+/* Module interface
+ *   rts_initRxTimeoutSupervision
+ *   rts_checkTimeouts
+ * Local functions
+ *   isElapsed
+ */
+
+/*
+ * Include files
+ */
+
+#include "rts_rxTimeoutSupervision.h"
+
+#include <string.h>
+#include <assert.h>
+
+#include "typ_types.h"
+
+
+/*
+ * Defines
+ */
+
+
+/*
+ * Local type definitions
+ */
+
+
+/*
+ * Local prototypes
+ */
+
+
+/*
+ * Data definitions
+ */
+
+/** The deadline of each supervised inbound message. */
+int32_t BSS_P1(rts_tiDeadlineAry)[CST_NO_CAN_MSGS_RECEIVED];
+
+/** For each inbound message, whether its deadline is currently supervised. */
+uint8_t BSS_P1(rts_isArmedAry)[CST_NO_CAN_MSGS_RECEIVED];
+
+
+/*
+ * Function implementation
+ */
+
+/**
+ * Check if a deadline is elapsed. The time is cyclic; we use a signed comparison as
+ * simplest implementation of a cyclically defined less or equal operation.
+ *   @return
+ * Get 1 if the message is supervised and its deadline elapsed, 0 otherwise.
+ *   @param idxRxFr
+ * The index of the inbound message.
+ *   @param tiNow
+ * The current time.
+ */
+static inline unsigned int isElapsed(unsigned int idxRxFr, int32_t tiNow)
+{
+    const int32_t tiOverdue = (int32_t)((uint32_t)tiNow - (uint32_t)rts_tiDeadlineAry[idxRxFr]);
+    return (unsigned int)rts_isArmedAry[idxRxFr] & (unsigned int)(tiOverdue >= 0);
+
+} /* End of isElapsed */
+
+
+
+/**
+ * Initialize the module. All timeouts are disarmed.
+ */
+void rts_initRxTimeoutSupervision(void)
+{
+    memset(&rts_isArmedAry[0], 0, sizeof(rts_isArmedAry));
+    memset(&rts_tiDeadlineAry[0], 0, sizeof(rts_tiDeadlineAry));
+
+} /* End of rts_initRxTimeoutSupervision */
+
+
+
+/**
+ * Check all deadlines and notify the timeouts. To be called once per tick of the CAN
+ * interface engine.
+ *   @return
+ * Get the number of notified timeouts.
+ *   @param tiNow
+ * The current time. Any unit and time base can be used but it needs to be the same for
+ * all calls of rts_armTimeout(). The time may wrap around but the time span between
+ * arming a timeout and its deadline needs to be less than half the range of the data type.
+ *   @param onTimeout
+ * The callback, which is invoked for each message, whose deadline elapsed. The timeout of
+ * the message is disarmed before the callback is invoked. The callback may re-arm it.
+ */
+unsigned int rts_checkTimeouts(int32_t tiNow, rts_onTimeout_t onTimeout)
+{
+    /* First pass: Find out if there's any elapsed deadline at all. */
+    unsigned int isAnyElapsed = 0u;
+    for(unsigned int idxRxFr=0u; idxRxFr<CST_NO_CAN_MSGS_RECEIVED; ++idxRxFr)
+        isAnyElapsed |= isElapsed(idxRxFr, tiNow);
+
+    if(isAnyElapsed == 0u)
+        return 0u;
+
+    /* Second pass: Locate and notify the elapsed deadlines. */
+    unsigned int noTimeouts = 0u;
+    for(unsigned int idxRxFr=0u; idxRxFr<CST_NO_CAN_MSGS_RECEIVED; ++idxRxFr)
+    {
+        if(isElapsed(idxRxFr, tiNow) != 0u)
+        {
+            rts_isArmedAry[idxRxFr] = 0u;
+            onTimeout(idxRxFr);
+            ++ noTimeouts;
+        }
+    }
+
+    assert(noTimeouts > 0u);
+    return noTimeouts;
+
+} /* End of rts_checkTimeouts */
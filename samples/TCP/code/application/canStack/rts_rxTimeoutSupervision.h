@@ -0,0 +1,89 @@
+#ifndef RTS_RXTIMEOUTSUPERVISION_INCLUDED
+#define RTS_RXTIMEOUTSUPERVISION_INCLUDED
+/**
+ * @file rts_rxTimeoutSupervision.h
+ * Definition of global interface of module rts_rxTimeoutSupervision.c
+ *
+ * Copyright (C) 2026 Peter Vranken (mailto:Peter_Vranken@Yahoo.de)
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Include files
+ */
+
+#include "typ_types.h"
+#include "cst_canStatistics.h"
+
+
+/*
+ * Defines
+ */
+
+
+/*
+ * Global type definitions
+ */
+
+/** The notification about a timeout. The callback is invoked from rts_checkTimeouts().
+      @param idxRxFr The index of the inbound message in table cdt_canRxMsgAry. */
+typedef void (*rts_onTimeout_t)(unsigned int idxRxFr);
+
+
+/*
+ * Global data declarations
+ */
+
+/** The deadline of each supervised inbound message. The index is the same as into table
+    cdt_canRxMsgAry. Only entries, which are armed in \a rts_isArmedAry, are meaningful.
+    Use rts_armTimeout() to write an entry. */
+extern int32_t rts_tiDeadlineAry[CST_NO_CAN_MSGS_RECEIVED];
+
+/** For each inbound message, whether its deadline is currently supervised. */
+extern uint8_t rts_isArmedAry[CST_NO_CAN_MSGS_RECEIVED];
+
+
+/*
+ * Global prototypes
+ */
+
+/** Initialize the module. All timeouts are disarmed. */
+void rts_initRxTimeoutSupervision(void);
+
+/** Check all deadlines and notify the timeouts. */
+unsigned int rts_checkTimeouts(int32_t tiNow, rts_onTimeout_t onTimeout);
+
+
+/*
+ * Global inline functions
+ */
+
+/**
+ * Start or restart the timeout supervision of an inbound message. This is normally done
+ * on each reception of the message.
+ *   @param idxRxFr
+ * The index of the inbound message in table cdt_canRxMsgAry.
+ *   @param tiDeadline
+ * The absolute time, at which the timeout will be recognized if the supervision is not
+ * restarted before. The unit and the time base are the same as for the argument \a tiNow
+ * of rts_checkTimeouts().
+ */
+static inline void rts_armTimeout(unsigned int idxRxFr, int32_t tiDeadline)
+{
+    rts_tiDeadlineAry[idxRxFr] = tiDeadline;
+    rts_isArmedAry[idxRxFr] = 1u;
+}
+
+#endif  /* RTS_RXTIMEOUTSUPERVISION_INCLUDED */
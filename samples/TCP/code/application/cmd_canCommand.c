@@ -26,6 +26,9 @@
  *   parseCanId
  *   searchSignalToListenTo
  *   parseCanSignal
+ *   strcmpNoCase
+ *   hashSignalName
+ *   createSignalNameIndex
  *   compareCanId
  *   identifySignalInDb
  *   parseCanSignalInDb
@@ -46,6 +49,7 @@
 
 #include "typ_types.h"
 #include "f2d_float2Double.h"
+#include "dlg_deferredLogging.h"
 #include "cdt_canDataTables.h"
 #include "cmd_canCommand.h"
 #include "cdr_canDriverAPI.h"
@@ -55,9 +59,14 @@
  * Defines
  */
  
-/** Unfortunately, our C library doesn't support case insensitive string compare. Here's a
-    preliminary work around. */
-#define stricmp(a,b)    (strcmp(a,b))
+/** The number of entries of the hash table, which indexes the signals in the CAN database
+    by name. The table is at most half full, which keeps the probe sequences short. */
+#define SIZE_OF_SIGNAL_NAME_INDEX   (2u*CST_NO_SENT_AND_RECEIVED_CAN_SIGNALS + 1u)
+
+/* The hash table stores the signal index plus one in a 16 Bit word. */
+_Static_assert( CST_NO_SENT_AND_RECEIVED_CAN_SIGNALS < UINT16_MAX
+              , "Too many signals in the CAN database for the signal name index"
+              );
  
 
 /*
@@ -84,6 +93,15 @@ cmd_listenerSigDesc_t DATA_P1(cmd_listenerSignalAry)[CMD_MAX_NO_SIGNALS_TO_LISTE
 /** Listener: Time at which an element is added to its list of signals to listen to. */
 static unsigned int DATA_P1(_tiListenerAdd) = 0;
 
+/** The hash table, which indexes the signals in the CAN database by case insensitive name.
+    Open addressing with linear probing is used. An entry holds the index of a signal in
+    table \a cdt_canSignalAry plus one, or zero if it is unused. Signals with same name, e.g.
+    an Rx and a Tx signal or signals from different messages, are all in the table. */
+static uint16_t BSS_P1(_signalNameIndexAry)[SIZE_OF_SIGNAL_NAME_INDEX];
+
+/** The index \a _signalNameIndexAry is created on first use. */
+static bool SBSS_P1(_isSignalNameIndexCreated) = false;
+
 
 /*
  * Function implementation
@@ -147,13 +165,13 @@ void cmd_onReceiveMessage(unsigned int idxRxFr)
                 assert(idxRxFr < sizeOfAry(cdt_canRxMsgAry));
                 const cdt_canMessage_t * const pMsg = &cdt_canRxMsgAry[idxRxFr];
 
-                printf( "Message %s (%lu), signal %s: %f %s\r\n"
-                      , pMsg->name
-                      , pMsg->canId
-                      , pSig->name
-                      , f2d(pSig->getter())
-                      , pSig->unit
-                      );
+                DLG_LOG( "Message %s (%lu), signal %s: %f %s\r\n"
+                       , pMsg->name
+                       , pMsg->canId
+                       , pSig->name
+                       , pSig->getter()
+                       , pSig->unit
+                       );
             }
 
         } /* End if(List entry contains a signal?) */
@@ -341,6 +359,84 @@ static bool parseCanSignal( const char * * const pSignalName
             
             
             
+/**
+ * Case insensitive string compare. Our C library doesn't support it.
+ *   @return
+ * Get zero if both strings are equal, ignoring the case of the characters, or non zero
+ * otherwise. In the latter case, the sign of the result tells, which string is lexically
+ * less.
+ *   @param a
+ * The first string to compare.
+ *   @param b
+ * The second string to compare.
+ */
+static int strcmpNoCase(const char *a, const char *b)
+{
+    int diff;
+    do
+    {
+        diff = tolower((unsigned char)*a) - tolower((unsigned char)*b);
+    }
+    while(diff == 0  &&  *a++ != '\0'  &&  *b++ != '\0');
+
+    return diff;
+
+} /* End of strcmpNoCase */
+
+
+
+/**
+ * Helper of identifySignalInDb(): Compute the case insensitive hash code of a signal name.
+ * The FNV-1a algorithm is applied to the lower case characters.
+ *   @return
+ * Get the hash code as index into \a _signalNameIndexAry.
+ *   @param signalName
+ * The name of the signal.
+ */
+static unsigned int hashSignalName(const char *signalName)
+{
+    uint32_t hash = 2166136261u;
+    char c;
+    while((c = *signalName++) != '\0')
+    {
+        hash ^= (uint32_t)tolower((unsigned char)c);
+        hash *= 16777619u;
+    }
+
+    return hash % SIZE_OF_SIGNAL_NAME_INDEX;
+
+} /* End of hashSignalName */
+
+
+
+/**
+ * Helper of identifySignalInDb(): Fill the hash table \a _signalNameIndexAry with all
+ * signals from the CAN database.
+ */
+static void createSignalNameIndex(void)
+{
+    memset(&_signalNameIndexAry[0], 0, sizeof(_signalNameIndexAry));
+
+    unsigned int idxSig;
+    for(idxSig=0; idxSig<CST_NO_SENT_AND_RECEIVED_CAN_SIGNALS; ++idxSig)
+    {
+        /* Look for the next free entry, starting at the hash code. There is at least one
+           since the table is larger than the number of signals. */
+        unsigned int idxEntry = hashSignalName(cdt_canSignalAry[idxSig].name);
+        while(_signalNameIndexAry[idxEntry] != 0u)
+        {
+            if(++idxEntry >= SIZE_OF_SIGNAL_NAME_INDEX)
+                idxEntry = 0u;
+        }
+        _signalNameIndexAry[idxEntry] = (uint16_t)(idxSig + 1u);
+    }
+
+    _isSignalNameIndexCreated = true;
+
+} /* End of createSignalNameIndex */
+
+
+
 /**
  * Helper of identifySignalInDb(): Compare if the CAN ID of a signal in the CAN DB matches
  * the user specification.
@@ -405,25 +501,36 @@ static unsigned int identifySignalInDb( unsigned int canId
 {
     const bool doCompareCanId = canId != UINT_MAX;
     
-    /* This is just sample code. We don't spent effort on optimized search/hash algorithms.
-       Just iterate all signals in the global database and compare. */
+    if(!_isSignalNameIndexCreated)
+        createSignalNameIndex();
+
+    /* Look up the name in the hash table. All signals of same name have the same hash code
+       and they are all found in the probe sequence, which starts at the hash code and ends
+       at the next unused entry. The direction and the optional CAN ID decide, which of
+       them match. */
     unsigned int noMatches = 0
                , idxSignalInGlobalTable = UINT_MAX
-               , idxSig;
-    for(idxSig=0; idxSig<CST_NO_SENT_AND_RECEIVED_CAN_SIGNALS; ++idxSig)
+               , idxEntry = hashSignalName(signalName);
+    while(_signalNameIndexAry[idxEntry] != 0u)
     {
+        const unsigned int idxSig = _signalNameIndexAry[idxEntry] - 1u;
+        assert(idxSig < CST_NO_SENT_AND_RECEIVED_CAN_SIGNALS);
         const cdt_canSignal_t *pSig = &cdt_canSignalAry[idxSig];
         
         if(pSig->isReceived == isReceived
            && (!doCompareCanId || compareCanId(canId, isExtId, pSig, isReceived))
-           &&  stricmp(signalName, pSig->name) == 0
+           &&  strcmpNoCase(signalName, pSig->name) == 0
           )
         {
             /* Match! */
             ++ noMatches;
             idxSignalInGlobalTable = idxSig;
         }
-    } /* End for(All known signals) */
+
+        if(++idxEntry >= SIZE_OF_SIGNAL_NAME_INDEX)
+            idxEntry = 0u;
+
+    } /* End while(All signals in the probe sequence) */
                 
     if(noMatches == 1)
     {
@@ -686,16 +793,16 @@ static void setSignalValue(unsigned int idxSignalInCanDb, float value)
 
     float oldValue = pSignal->getter();
     pSignal->setter(value);
-    printf( "Signal %s (%s, %lu) has been changed from %f %s to new %svalue %f %s\r\n"
-          , pSignal->name
-          , pMsg->name
-          , pMsg->canId
-          , f2d(oldValue)
-          , pSignal->unit
-          , needSaturation? "(saturated) ": ""
-          , f2d(value)
-          , pSignal->unit
-          );
+    DLG_LOG( "Signal %s (%s, %lu) has been changed from %f %s to new %svalue %f %s\r\n"
+           , pSignal->name
+           , pMsg->name
+           , pMsg->canId
+           , oldValue
+           , pSignal->unit
+           , needSaturation? "(saturated) ": ""
+           , value
+           , pSignal->unit
+           );
     
     /* Trigger sending of event messages. For ordinary regular messages, the statement is
        harm- and useless. */
@@ -725,7 +832,9 @@ bool cmd_parseCanCommand(unsigned int argC, const char *argV[])
 
     const char *cmd = argV[0];
     bool isCmdListen;
-    if((isCmdListen=stricmp(cmd, "listen") == 0)  ||  stricmp(cmd, "unlisten") == 0)
+    if((isCmdListen=strcmpNoCase(cmd, "listen") == 0)
+       ||  strcmpNoCase(cmd, "unlisten") == 0
+      )
     {
         unsigned int idxSignalInCanDb = parseCanSignalInDb(argC, argV, /* isReceived */ true);
         if(idxSignalInCanDb < sizeOfAry(cdt_canSignalAry))
@@ -739,7 +848,7 @@ bool cmd_parseCanCommand(unsigned int argC, const char *argV[])
         /* Command "listen" or "unlisten" has been consumed. */
         return true;
     }
-    else if(stricmp(cmd, "clearlisten") == 0)
+    else if(strcmpNoCase(cmd, "clearlisten") == 0)
     {
         /* "clearlisten" has no arguments. */
         if(checkNoArgs(cmd, argC-1, 0, 0))
@@ -754,7 +863,7 @@ bool cmd_parseCanCommand(unsigned int argC, const char *argV[])
         /* Command "clearlisten" has been consumed. */
         return true;
     }
-    else if(stricmp(cmd, "set") == 0)
+    else if(strcmpNoCase(cmd, "set") == 0)
     {
         /* "set" has 2..3 arguments to specify a signal and the value of it. */
         if(checkNoArgs(cmd, argC-1, 2, 3))
@@ -775,7 +884,7 @@ bool cmd_parseCanCommand(unsigned int argC, const char *argV[])
         /* Command "set" has been consumed. */
         return true;
     }
-    else if(stricmp(cmd, "tx") == 0)
+    else if(strcmpNoCase(cmd, "tx") == 0)
     {
         /* "tx" has 1..9 arguments to specify a CAN ID and up to eight payload bytes. */
         if(checkNoArgs(cmd, argC-1, 1, 9))
@@ -30,8 +30,11 @@
  *   ats_initAccessTimeService
  *   ats_mainFunction
  * Local functions
+ *   getCharOfResponse
  *   getMatchOfCaptureGrpAsNum
  *   extractTimeInfo
+ *   beginParsing
+ *   endParsing
  *   getIdxOfConnection
  *   closeConnection
  *   write
@@ -58,8 +61,10 @@
 #include "typ_types.h"
 #include "lwip/tcp.h"
 #include "lwip/priv/tcp_priv.h"
+#include "lwip/pbuf.h"
 #include "stm_systemTimer.h"
 #include "apt_applicationTask.h"
+#include "dlg_deferredLogging.h"
 
 #include "re_regExpMatcher.h"
 #include "ats_regExpWorldClockAPI.inc"
@@ -85,6 +90,17 @@ _Static_assert( RE_REQUIRE_COMPILER == 0  &&  RE_REQUIRE_MATCHER == 1
 /** The time delta in hours between GMT and the requested time zone. */
 #define DELTA_T_GMT_TO_TIME_ZONE    2
 
+/** The HTTP response is parsed while its segments arrive. The captured groups refer to the
+    response; copies of the part of the response, which they can still refer to, are held
+    in the lwIP heap until parsing is done. Parsing is concluded with the data received so
+    far, once the response exceeds this length. */
+#define MAX_LEN_HTTP_RESPONSE       4096u
+
+/** The size in Byte of the thread memory of the streaming regular expression matcher. It
+    suffices for 30 simultaneous threads, see re_getSizeOfThreadMem(). Parsing the time
+    server response requires about 10. */
+#define SIZE_OF_THREAD_MEM          11264u
+
 /*
  * Local type definitions
  */
@@ -109,6 +125,24 @@ struct tcpConn_t
     /** The total number of characters received via this connection. The counter is not
         saturated and wraps at its implementation maximum. */
     unsigned int noCharsRx;
+
+    /** The streaming regular expression matcher, which parses the HTTP response while its
+        segments arrive. */
+    struct re_matcher_t matcher;
+
+    /** The parsing of the HTTP response has begun and the result is not evaluated yet. */
+    bool isParsing;
+
+    /** The chain of copies of the received pbufs, which are held while parsing. Only the
+        part of the response from the first character on, which is still referenced by the
+        captured groups of the matcher, is held. NULL if nothing is held. */
+    struct pbuf *pPBufRx;
+
+    /** The index of the first character of \a pPBufRx in the HTTP response. */
+    unsigned int idxCPBufRx;
+
+    /** The time spent in parsing the HTTP response in units of the system timer. */
+    uint32_t tiParsing;
 };
 
 
@@ -124,6 +158,10 @@ struct tcpConn_t
 /** A particular connection object is used for communication with global time server. */
 static struct tcpConn_t DATA_P1(_tcpConn);
 
+/** The memory of the streaming regular expression matcher. */
+static uint16_t BSS_P1(_threadMem)[SIZE_OF_THREAD_MEM/sizeof(uint16_t)];
+static struct re_matcherCGrpStackElement_t BSS_P1(_cGrpStack)[20];
+
 /** Number of fully successful synchronization events with time server. A positive HTTP
     response was received and could be evaluated. */
 unsigned int DATA_P1(ats_noSyncWithTimeServer) = 0u;
@@ -137,6 +175,26 @@ unsigned int DATA_P1(ats_noSyncWithHTTPHeader) = 0u;
  * Function implementation
  */
 
+/**
+ * Get a character of the HTTP response from the held copies of the received pbufs.
+ *   @return
+ * Get the character.
+ *   @param pConn
+ * The connection object by reference.
+ *   @param idxC
+ * The index of the character in the HTTP response. The matcher must have reported it as
+ * still being referenced, see field \a stream.idxCFirstReferenced of the matcher.
+ */
+static char getCharOfResponse(const struct tcpConn_t * const pConn, unsigned int idxC)
+{
+    assert(pConn->pPBufRx != NULL  &&  idxC >= pConn->idxCPBufRx
+           &&  idxC - pConn->idxCPBufRx < pConn->pPBufRx->tot_len
+          );
+    return (char)pbuf_get_at(pConn->pPBufRx, (u16_t)(idxC - pConn->idxCPBufRx));
+
+} /* getCharOfResponse */
+
+
 /**
  * Get the first and only match of a capture group and interpret the captured text as
  * unsigned decimal integer number with 1..9 digits. (These constraints are checked by
@@ -144,35 +202,35 @@ unsigned int DATA_P1(ats_noSyncWithHTTPHeader) = 0u;
  *   @return
  * Get the result as a signed integer. (Signed has been decided despite of the result never
  * being negative since this data type fits better to the further data flow.)
- *   @param pMatcher
- * The regular expression matcher, which has successfully matched the input, is
- * passed in by reference. It contains the capture group results.
- *   @param inputStream
- * The capture group result has been stored as reference into the original input character
- * string, so we need this string to fetch the data.
+ *   @param pConn
+ * The connection object by reference. Its regular expression matcher has successfully
+ * matched the input and contains the capture group results. The capture group result has
+ * been stored as offset into the received input, so we need the held copies of the
+ * received pbufs to fetch the data.
  *   @param idxCGrp
  * The capture group by zero based index.
  */
-static signed int getMatchOfCaptureGrpAsNum( struct re_matcher_t *pMatcher
-                                           , const char * const inputStream
+static signed int getMatchOfCaptureGrpAsNum( struct tcpConn_t * const pConn
                                            , unsigned int idxCGrp
                                            )
 {
     unsigned int idx1stChar, idxEnd;
-    const bool success ATTRIB_DBG_ONLY =
-            re_getMatchOfCaptureGrp(pMatcher, &idx1stChar, &idxEnd, idxCGrp, /*idxMatch*/ 0u);
+    const bool success ATTRIB_DBG_ONLY = re_getMatchOfCaptureGrp( &pConn->matcher
+                                                                , &idx1stChar
+                                                                , &idxEnd
+                                                                , idxCGrp
+                                                                , /*idxMatch*/ 0u
+                                                                );
     assert(success);
 
-    /* We must not use atoi as we don't have a zero terminated C string. */
-    const char *pC = &inputStream[idx1stChar];
-    const char * const pEnd = &inputStream[idxEnd];
-    assert(pC < pEnd  &&  pEnd - pC <= 9);
+    /* The captured characters can be spread across the segments of the response. */
+    assert(idx1stChar < idxEnd  &&  idxEnd - idx1stChar <= 9u);
     signed int i = 0;
-    while(pC < pEnd)
+    for(unsigned int idxC=idx1stChar; idxC<idxEnd; ++idxC)
     {
-        assert(isdigit((int)*pC));
-        i = i*10 + (int)(*pC) - '0';
-        ++ pC;
+        const char c = getCharOfResponse(pConn, idxC);
+        assert(isdigit((int)c));
+        i = i*10 + (int)c - '0';
     }
 
     return i;
@@ -191,128 +249,95 @@ static signed int getMatchOfCaptureGrpAsNum( struct re_matcher_t *pMatcher
  * If the function returns \a true then the current minutes are returned by reference.
  *   @param pSec
  * If the function returns \a true then the current seconds are returned by reference.
- *   @param httpResponse
- * The character string with the HTTP response from the time server.
- *   @param lenHttpResponse
- * \a httpResponse is not a zero terminated C string. Instead, the length of the input is
- * provided as number of characters.
+ *   @param pConn
+ * The connection object by reference. Its streaming regular expression matcher has been
+ * fed with all received segments of the HTTP response but it has not been completed yet,
+ * see re_matchEnd(). The captured groups are fetched from the held copies of the received
+ * segments.
  */
 static bool extractTimeInfo( signed int * const pHour
                            , signed int * const pMin
                            , signed int * const pSec
-                           , const char * const httpResponse
-                           , unsigned int lenHttpResponse
+                           , struct tcpConn_t * const pConn
                            )
 {
     /* For simplicity, we use a regular expression for picking the time info. This is most
-       simple but not really a professional way of doing:
-         The regular expression needs to see all text. For fragmented IP data, it means
-       that a reliable solution would require a buffering concept, which concatenates all
-       received segments until the regular expression matcher is satisfied. Such
-       concatenation code may require much expensive RAM and a significant portion of
-       code. Particularly the first drawback is normally not acceptable for embedded
-       programming.
-         Moreover, we query the time at a time server but our regular expression evaluates
-       the time information of the HTTP header. This could likely be done with any HTTP
-       service. Of course, it is not difficult to extend the regular expression to pick the
-       true time information from the response but, by experience, only the HTTP header is
-       always in the first received segment. If we want to see the entire response then we
-       would have to solve the first issue...
-         Using a "normal" parser, which checks the input character by character and which
-       can release all seen data, would not suffer from these problems and would be the
-       better solution for a tiny embedded system. */
-
-    /* The caller of the regular expression matcher needs to pre-configure the matcher
-       object with respect to the memory configuration. The other fields don't care.
-         The memory configuration for the matcher depends significantly on the actual
-       regular expression. We can tailor it rather tightly as we use the matcher only for a
-       single, pre-defined, known expression. */
-    struct re_matcherStackElement_t matcherPathElementAry[30];
-    struct re_matcherCGrpStackElement_t matcherCGrpStack[20];
-    struct re_matcher_t matcher =
-    {
-        /* The needed size of the memory for path alternatives depends on both, the
-           regular expression and the input stream to match against it. It is hard to
-           predict and the value, we see here is arbitrarily chosen. On an embedded
-           target, this can become a critical optimization. */
-        .matcherPathStack = matcherPathElementAry,
-        .maxNoPathElements = sizeOfAry(matcherPathElementAry),
-
-        /* The needed size of the memory for capture groups is most often predictable
-           for a given regular expression. For most use-cases (if not used inside the
-           body of unbounded loops), it barely depends on the input stream. The memory
-           should suffice for the number of groups used in the regular expression. */
-        .cGrpStack = matcherCGrpStack,
-        .maxNoCapturedGrps = sizeOfAry(matcherCGrpStack),
-    };
-    const bool patternMatches = re_match( &matcher
-                                        , &ats_reHttpHdrTime
-                                        , httpResponse
-                                        , lenHttpResponse
-                                        );
-    assert(patternMatches == (matcher.err == re_errMatch_success));
+       simple but not really a professional way of doing. A "normal" parser, which checks
+       the input character by character, would need less code and less RAM.
+         The regular expression matcher is fed with the segments as they arrive, see
+       onLwIPSegmentReceived(); it doesn't need a buffer, which concatenates all received
+       segments. However, the captured groups refer to the received input, so we need to
+       hold copies of the pbufs from the first referenced character on until we get here.
+       (This is why the length of the response is limited, see #MAX_LEN_HTTP_RESPONSE.)
+         The time information of the HTTP header is always in the first segment. The true
+       time information of the time service is in the JSON body; it is found even if the
+       body arrives in later segments. */
+    struct re_matcher_t * const pMatcher = &pConn->matcher;
+    const bool patternMatches = re_matchEnd(pMatcher);
+    assert(patternMatches == (pMatcher->err == re_errMatch_success));
+    assert(!patternMatches  ||  pConn->pPBufRx != NULL);
     if(patternMatches)
     {
-        const bool isHttp200Ok = re_getNoMatchesCaptureGrp(&matcher, /*idxCGrp*/ 12) == 1u;
+        const bool isHttp200Ok = re_getNoMatchesCaptureGrp(pMatcher, /*idxCGrp*/ 12) == 1u;
 
         /* We know our regular expression, so if it matches, then the match result
            structure is an invariant. If this assertion fires then, most likely, the regular
            expression has changed and the evaluating code down here needs according
            maintenance. */
-        assert(re_getNoMatchesCaptureGrp(&matcher, /*idxCGrp*/ 0) == 1u
-               &&  re_getNoMatchesCaptureGrp(&matcher, /*idxCGrp*/ 1) == 1u
-               &&  re_getNoMatchesCaptureGrp(&matcher, /*idxCGrp*/ 2) == 1u
-               &&  re_getNoMatchesCaptureGrp(&matcher, /*idxCGrp*/ 3) == 1u
-               &&  re_getNoMatchesCaptureGrp(&matcher, /*idxCGrp*/ 4) == 1u
-               &&  re_getNoMatchesCaptureGrp(&matcher, /*idxCGrp*/ 5) == 1u
-               &&  re_getNoMatchesCaptureGrp(&matcher, /*idxCGrp*/ 6) == 1u
-               &&  re_getNoMatchesCaptureGrp(&matcher, /*idxCGrp*/ 7) == 1u
-               &&  re_getNoMatchesCaptureGrp(&matcher, /*idxCGrp*/ 8) == 1u
-               &&  re_getNoMatchesCaptureGrp(&matcher, /*idxCGrp*/ 9) == 1u
-               &&  re_getNoMatchesCaptureGrp(&matcher, /*idxCGrp*/ 10) == 1u
-               &&  re_getNoMatchesCaptureGrp(&matcher, /*idxCGrp*/ 11) == 1u
+        assert(re_getNoMatchesCaptureGrp(pMatcher, /*idxCGrp*/ 0) == 1u
+               &&  re_getNoMatchesCaptureGrp(pMatcher, /*idxCGrp*/ 1) == 1u
+               &&  re_getNoMatchesCaptureGrp(pMatcher, /*idxCGrp*/ 2) == 1u
+               &&  re_getNoMatchesCaptureGrp(pMatcher, /*idxCGrp*/ 3) == 1u
+               &&  re_getNoMatchesCaptureGrp(pMatcher, /*idxCGrp*/ 4) == 1u
+               &&  re_getNoMatchesCaptureGrp(pMatcher, /*idxCGrp*/ 5) == 1u
+               &&  re_getNoMatchesCaptureGrp(pMatcher, /*idxCGrp*/ 6) == 1u
+               &&  re_getNoMatchesCaptureGrp(pMatcher, /*idxCGrp*/ 7) == 1u
+               &&  re_getNoMatchesCaptureGrp(pMatcher, /*idxCGrp*/ 8) == 1u
+               &&  re_getNoMatchesCaptureGrp(pMatcher, /*idxCGrp*/ 9) == 1u
+               &&  re_getNoMatchesCaptureGrp(pMatcher, /*idxCGrp*/ 10) == 1u
+               &&  re_getNoMatchesCaptureGrp(pMatcher, /*idxCGrp*/ 11) == 1u
 
                /* The following groups do match for a positive HTTP response only. */
-               &&  re_getNoMatchesCaptureGrp(&matcher, /*idxCGrp*/ 12) == (isHttp200Ok? 1u: 0u)
-               &&  re_getNoMatchesCaptureGrp(&matcher, /*idxCGrp*/ 13) == (isHttp200Ok? 1u: 0u)
-               &&  re_getNoMatchesCaptureGrp(&matcher, /*idxCGrp*/ 14) == (isHttp200Ok? 1u: 0u)
-               &&  re_getNoMatchesCaptureGrp(&matcher, /*idxCGrp*/ 15) == (isHttp200Ok? 1u: 0u)
-               &&  re_getNoMatchesCaptureGrp(&matcher, /*idxCGrp*/ 16) == (isHttp200Ok? 1u: 0u)
+               &&  re_getNoMatchesCaptureGrp(pMatcher, /*idxCGrp*/ 12) == (isHttp200Ok? 1u: 0u)
+               &&  re_getNoMatchesCaptureGrp(pMatcher, /*idxCGrp*/ 13) == (isHttp200Ok? 1u: 0u)
+               &&  re_getNoMatchesCaptureGrp(pMatcher, /*idxCGrp*/ 14) == (isHttp200Ok? 1u: 0u)
+               &&  re_getNoMatchesCaptureGrp(pMatcher, /*idxCGrp*/ 15) == (isHttp200Ok? 1u: 0u)
+               &&  re_getNoMatchesCaptureGrp(pMatcher, /*idxCGrp*/ 16) == (isHttp200Ok? 1u: 0u)
               );
 
         if(isHttp200Ok)
         {
             /* Request succeeded, we can extract the time from the time service response. */
-            *pHour = getMatchOfCaptureGrpAsNum(&matcher, httpResponse, /*idxCGrp*/ 15u);
-            *pMin  = getMatchOfCaptureGrpAsNum(&matcher, httpResponse, /*idxCGrp*/ 16u);
+            *pHour = getMatchOfCaptureGrpAsNum(pConn, /*idxCGrp*/ 15u);
+            *pMin  = getMatchOfCaptureGrpAsNum(pConn, /*idxCGrp*/ 16u);
 
             /* There's no explicit second information in the positive response but we can
                take it from the HTTP header. */
-            *pSec  = getMatchOfCaptureGrpAsNum(&matcher, httpResponse, /*idxCGrp*/ 11u);
+            *pSec  = getMatchOfCaptureGrpAsNum(pConn, /*idxCGrp*/ 11u);
 
             ++ ats_noSyncWithTimeServer;
 
-            iprintf( "Got time info: %02u:%02u, %u.%u.%u\r\n"
+            DLG_LOG( "Got time info: %02u:%02u, %u.%u.%u\r\n"
                    , *pHour
                    , *pMin
-                   , getMatchOfCaptureGrpAsNum(&matcher, httpResponse, /*idxCGrp*/ 14u)
-                   , getMatchOfCaptureGrpAsNum(&matcher, httpResponse, /*idxCGrp*/ 13u)
-                   , getMatchOfCaptureGrpAsNum(&matcher, httpResponse, /*idxCGrp*/ 12u)
+                   , getMatchOfCaptureGrpAsNum(pConn, /*idxCGrp*/ 14u)
+                   , getMatchOfCaptureGrpAsNum(pConn, /*idxCGrp*/ 13u)
+                   , getMatchOfCaptureGrpAsNum(pConn, /*idxCGrp*/ 12u)
                    );
         }
         else
         {
             /* Request failed, but we can extract the time from the HTTP header.
                Unfortunately, this always is the GMT. */
-            *pHour = getMatchOfCaptureGrpAsNum(&matcher, httpResponse, /*idxCGrp*/ 9u);
-            *pMin  = getMatchOfCaptureGrpAsNum(&matcher, httpResponse, /*idxCGrp*/ 10u);
-            *pSec  = getMatchOfCaptureGrpAsNum(&matcher, httpResponse, /*idxCGrp*/ 11u);
+            *pHour = getMatchOfCaptureGrpAsNum(pConn, /*idxCGrp*/ 9u);
+            *pMin  = getMatchOfCaptureGrpAsNum(pConn, /*idxCGrp*/ 10u);
+            *pSec  = getMatchOfCaptureGrpAsNum(pConn, /*idxCGrp*/ 11u);
 
             ++ ats_noSyncWithHTTPHeader;
 
             /* The month is returned as name. */
             unsigned int idx1st, idxEnd;
-            const bool success ATTRIB_DBG_ONLY = re_getMatchOfCaptureGrp( &matcher
+            const bool success ATTRIB_DBG_ONLY = re_getMatchOfCaptureGrp( pMatcher
                                                                         , &idx1st
                                                                         , &idxEnd
                                                                         , /*idxCGrp*/ 6u
@@ -320,13 +345,15 @@ static bool extractTimeInfo( signed int * const pHour
                                                                         );
             assert(success &&  idxEnd == idx1st+3u);
 
-            iprintf( "Got time info: %02u:%02u:%02u GMT, %u. %c%c%c %u\r\n"
+            DLG_LOG( "Got time info: %02u:%02u:%02u GMT, %u. %c%c%c %u\r\n"
                    , *pHour
                    , *pMin
                    , *pSec
-                   , getMatchOfCaptureGrpAsNum(&matcher, httpResponse, /*idxCGrp*/ 5u)
-                   , httpResponse[idx1st], httpResponse[idx1st+1u], httpResponse[idx1st+2u]
-                   , getMatchOfCaptureGrpAsNum(&matcher, httpResponse, /*idxCGrp*/ 7u)
+                   , getMatchOfCaptureGrpAsNum(pConn, /*idxCGrp*/ 5u)
+                   , getCharOfResponse(pConn, idx1st)
+                   , getCharOfResponse(pConn, idx1st+1u)
+                   , getCharOfResponse(pConn, idx1st+2u)
+                   , getMatchOfCaptureGrpAsNum(pConn, /*idxCGrp*/ 7u)
                    );
 
             /* The time information is GMT. We can correct it but all the code to correct
@@ -350,6 +377,90 @@ static bool extractTimeInfo( signed int * const pHour
 } /* extractTimeInfo */
 
 
+/**
+ * Prepare the parsing of the HTTP response of the time server for a new connection.
+ *   @param pConn
+ * The connection object by reference.
+ */
+static void beginParsing(struct tcpConn_t * const pConn)
+{
+    /* The caller of the regular expression matcher needs to pre-configure the matcher
+       object with respect to the memory configuration. The other fields don't care.
+         The memory configuration for the matcher depends significantly on the actual
+       regular expression. We can tailor it rather tightly as we use the matcher only for a
+       single, pre-defined, known expression. */
+    pConn->matcher = (struct re_matcher_t)
+    {
+        /* The captured groups are the same for all threads of the lockstep matcher. The
+           memory should suffice for the number of groups used in the regular
+           expression. */
+        .cGrpStack = _cGrpStack,
+        .maxNoCapturedGrps = sizeOfAry(_cGrpStack),
+
+        /* The memory of the lockstep matcher doesn't depend on the length of the input
+           but only on the regular expression. */
+        .threadMem = _threadMem,
+        .sizeOfThreadMem = sizeof(_threadMem),
+    };
+    re_matchBegin(&pConn->matcher, &ats_reHttpHdrTime);
+    pConn->isParsing = true;
+    pConn->pPBufRx = NULL;
+    pConn->idxCPBufRx = 0u;
+    pConn->tiParsing = 0u;
+
+} /* beginParsing */
+
+
+/**
+ * Complete the parsing of the HTTP response of the time server, adjust the clock of the
+ * application if the response contained the time and release the held segments of the
+ * response.
+ *   @param pConn
+ * The connection object by reference. Nothing is done if parsing is not in progress.
+ */
+static void endParsing(struct tcpConn_t * const pConn)
+{
+    if(!pConn->isParsing)
+        return;
+
+    uint32_t ti = stm_getSystemTime(/*idxStmTimer*/ 0u);
+    signed int h, m, s;
+    const bool parsingDone = extractTimeInfo(&h, &m, &s, pConn);
+    pConn->tiParsing += stm_getSystemTime(/*idxStmTimer*/ 0u) - ti;
+    if(parsingDone)
+    {
+        apt_setCurrentTime(h, m, s);
+
+        /* If this is the first success the we initiate regular time display to make
+           the success apparent. However, don't persist on it; if the user has switched
+           the display off again, then we shuld not annoy him. */
+        static bool DATA_P1(isFirstSuccess_) = true;
+        if(isFirstSuccess_ && !apt_isEnabledRegularTimeDisplay())
+            apt_enableRegularTimeDisplay(/*enable*/ true, /*tiCycleInS*/ 10u);
+        isFirstSuccess_ = false;
+    }
+    else
+    {
+        DLG_LOG("CAUTION: Failed to parse HTTP response from time server."
+                " This can point to a maintenance problem of the sample code:"
+                " Does the regular expression still suits for the HTTP response?\r\n"
+               );
+    }
+    _Static_assert(STM_TIMER_0_CLK == 80000000u, "Bad scaling of time designation");
+    DLG_LOG( "Decoding the HTTP response took %lu ns\r\n"
+           , (unsigned long)((pConn->tiParsing*25u)/2u)
+           );
+
+    if(pConn->pPBufRx != NULL)
+    {
+        pbuf_free(pConn->pPBufRx);
+        pConn->pPBufRx = NULL;
+    }
+    pConn->isParsing = false;
+
+} /* endParsing */
+
+
 /**
  * When a TCP connection is closed, update our connection object accordingly, so that
  * memory can be reused for a new TCP connection.
@@ -362,6 +473,14 @@ static void closeConnection(struct tcpConn_t * const pConn)
     pConn->stConn = stConn_closed;
     pConn->pPcb = NULL;
 
+    /* An incomplete response is discarded. */
+    if(pConn->pPBufRx != NULL)
+    {
+        pbuf_free(pConn->pPBufRx);
+        pConn->pPBufRx = NULL;
+    }
+    pConn->isParsing = false;
+
 } /* closeConnection */
 
 
@@ -419,7 +538,7 @@ static bool write( struct tcpConn_t * const pConn
 
         if(err != ERR_OK)
         {
-            iprintf( "Error %i when writing %u characters into TCP connection %p. Connection"
+            DLG_LOG( "Error %i when writing %u characters into TCP connection %p. Connection"
                      " is aborted\r\n"
                    , (int)err
                    , noChars
@@ -460,7 +579,7 @@ static void onLwIPError(void *arg, err_t err)
     struct tcpConn_t * const pConn = (struct tcpConn_t *)arg;
     if(pConn->stConn == stConn_connecting)
     {
-        iprintf( "onLwIPError: Connection %p: Error %i received. The remote end has rejected"
+        DLG_LOG( "onLwIPError: Connection %p: Error %i received. The remote end has rejected"
                  " the new connection\r\n"
                , pConn->pPcb
                , (int)err
@@ -468,7 +587,7 @@ static void onLwIPError(void *arg, err_t err)
     }
     else
     {
-        iprintf( "onLwIPError: Connection %p: Error %i received. Connection is closed\r\n"
+        DLG_LOG( "onLwIPError: Connection %p: Error %i received. Connection is closed\r\n"
                , pConn->pPcb
                , (int)err
                );
@@ -494,7 +613,7 @@ static err_t onLwIPConnected(void *arg, struct tcp_pcb *pPcb, err_t err)
     if(err == ERR_OK)
     {
         pConn->stConn = stConn_established;
-        iprintf( "onLwIPConnected: Connection %p: Connection established with port %hu of"
+        DLG_LOG( "onLwIPConnected: Connection %p: Connection established with port %hu of"
                  " global time server\r\n"
                , pPcb
                , pPcb->remote_port
@@ -518,7 +637,7 @@ static err_t onLwIPConnected(void *arg, struct tcp_pcb *pPcb, err_t err)
     }
     else
     {
-        iprintf( "onLwIPConnected: Connection %p: Error %i received when trying to"
+        DLG_LOG( "onLwIPConnected: Connection %p: Error %i received when trying to"
                  " connect. New connection is aborted\r\n"
                , pPcb
                , (int)err
@@ -557,7 +676,7 @@ static err_t onLwIPSegmentReceived( void *arg
     if(err == ERR_OK  &&  pPBuf != NULL)
     {
         pConn->noCharsRx += (unsigned)pPBuf->tot_len;
-        iprintf( "onLwIPSegmentReceived: Connection %p:%hu: %hu Byte have been received\r\n"
+        DLG_LOG( "onLwIPSegmentReceived: Connection %p:%hu: %hu Byte have been received\r\n"
                , pPcb
                , pPcb->remote_port
                , pPBuf->tot_len
@@ -594,63 +713,128 @@ static err_t onLwIPSegmentReceived( void *arg
            been consumed. */
         tcp_recved(pPcb, pPBuf->tot_len);
 
-        /* Free the pbuf. */
-        pbuf_free(pPBuf);
-
-        /* Close the connection as soon as parsing of data indicates that all expected
-           content has been got. */
-        uint32_t ti = stm_getSystemTime(/*idxStmTimer*/ 0u);
-        signed int h, m, s;
-        const bool parsingDone = extractTimeInfo(&h, &m, &s, pPBuf->payload, pPBuf->len);
-        ti = stm_getSystemTime(/*idxStmTimer*/ 0u) - ti;
-        if(parsingDone)
+        /* The segment is fed into the regular expression matcher. The received pbufs are
+           the buffers of the Rx ring of the Ethernet driver, which has only
+           ETH_ENET0_RING0_NO_RXBD of them. Holding these would stall the reception of
+           all connections, therefore, the received pbuf is released at once. The captured
+           groups refer to the input; the matcher tells, from which character on it is
+           still referenced. The held copies of earlier segments are released up to this
+           character and only the referenced part of the segment is copied into the lwIP
+           heap. */
+        if(pConn->isParsing)
         {
-            apt_setCurrentTime(h, m, s);
-
-            /* If this is the first success the we initiate regular time display to make
-               the success apparent. However, don't persist on it; if the user has switched
-               the display off again, then we shuld not annoy him. */
-            static bool DATA_P1(isFirstSuccess_) = true;
-            if(isFirstSuccess_ && !apt_isEnabledRegularTimeDisplay())
-                apt_enableRegularTimeDisplay(/*enable*/ true, /*tiCycleInS*/ 10u);
-            isFirstSuccess_ = false;
+            const unsigned int idxCSegment = pConn->matcher.stream.idxC;
+            uint32_t ti = stm_getSystemTime(/*idxStmTimer*/ 0u);
+            bool isUndecided = true;
+            for(const struct pbuf *pQ=pPBuf; pQ!=NULL && isUndecided; pQ=pQ->next)
+                isUndecided = re_matchFeed(&pConn->matcher, pQ->payload, pQ->len);
+            pConn->tiParsing += stm_getSystemTime(/*idxStmTimer*/ 0u) - ti;
+
+            /* Release the held copies, which are no longer referenced. */
+            const unsigned int idxCFirstReferenced =
+                                            pConn->matcher.stream.idxCFirstReferenced
+                             , idxCEnd = pConn->matcher.stream.idxC;
+            if(pConn->pPBufRx != NULL  &&  idxCFirstReferenced > pConn->idxCPBufRx)
+            {
+                unsigned int noChars = idxCFirstReferenced - pConn->idxCPBufRx;
+                if(noChars > pConn->pPBufRx->tot_len)
+                    noChars = pConn->pPBufRx->tot_len;
+                pConn->pPBufRx = pbuf_free_header(pConn->pPBufRx, (u16_t)noChars);
+                pConn->idxCPBufRx += noChars;
+            }
+
+            /* Copy the referenced part of the segment. The held copies are contiguous;
+               if some are left then the entire segment is referenced. */
+            const unsigned int idxCFrom = idxCFirstReferenced > idxCSegment
+                                          ? idxCFirstReferenced
+                                          : idxCSegment;
+            bool isOutOfMemory = false;
+            if(idxCEnd > idxCFrom)
+            {
+                struct pbuf * const pPBufCopy = pbuf_alloc( PBUF_RAW
+                                                          , (u16_t)(idxCEnd - idxCFrom)
+                                                          , PBUF_RAM
+                                                          );
+                if(pPBufCopy != NULL)
+                {
+                    pbuf_copy_partial( pPBuf
+                                     , pPBufCopy->payload
+                                     , pPBufCopy->len
+                                     , (u16_t)(idxCFrom - idxCSegment)
+                                     );
+                    if(pConn->pPBufRx == NULL)
+                    {
+                        pConn->pPBufRx = pPBufCopy;
+                        pConn->idxCPBufRx = idxCFrom;
+                    }
+                    else
+                    {
+                        assert(pConn->idxCPBufRx + pConn->pPBufRx->tot_len == idxCFrom);
+                        pbuf_cat(pConn->pPBufRx, pPBufCopy);
+                    }
+                }
+                else
+                    isOutOfMemory = true;
+            }
+            pbuf_free(pPBuf);
+
+            if(isOutOfMemory)
+            {
+                /* The segment is lost and the response can't be parsed any more. */
+                DLG_LOG( "onLwIPSegmentReceived: Connection %p: Out of memory, HTTP"
+                         " response is discarded. Connection is closed\r\n"
+                       , pPcb
+                       );
+                if(pConn->pPBufRx != NULL)
+                {
+                    pbuf_free(pConn->pPBufRx);
+                    pConn->pPBufRx = NULL;
+                }
+                pConn->isParsing = false;
+                tcp_close(pPcb);
+                pConn->stConn = stConn_closing;
+            }
+
+            /* Parsing is done if further input can't change the result. If the response
+               doesn't contain the time information of the time service, then this is
+               only known at its end, which we don't see as the server keeps the
+               connection alive. We limit the length of the parsed response. */
+            else if(!isUndecided  ||  idxCEnd >= MAX_LEN_HTTP_RESPONSE)
+            {
+                endParsing(pConn);
+                DLG_LOG( "onLwIPSegmentReceived: Connection %p: GET response consumed."
+                         " Connection is closed\r\n"
+                       , pPcb
+                       );
+                tcp_close(pPcb);
+                pConn->stConn = stConn_closing;
+            }
         }
         else
         {
-            iprintf("CAUTION: Failed to parse HTTP response from time server."
-                    " This can point to a maintenance problem of the sample code:"
-                    " Does the regular expression still suits for the HTTP response?\r\n"
-                   );
+            /* Free the pbuf. */
+            pbuf_free(pPBuf);
         }
-        _Static_assert(STM_TIMER_0_CLK == 80000000u, "Bad scaling of time designation");
-        iprintf("Decoding the HTTP response took %lu ns\r\n", (ti*25u)/2u);
-
-        /* See extractTimeInfo(): Our simple way to pick the time from the HTTP
-           response would benefit from getting more received segments. If they first
-           segment doesn't help then others would help any more, neither. We can close
-           the connection regardless whether or not we got the desired information. */
-        iprintf( "onLwIPSegmentReceived: Connection %p: GET response consumed."
-                 " Connection is closed\r\n"
-               , pPcb
-               );
-        tcp_close(pPcb);
 
         /* err remains ERR_OK. */
     }
     else if(pPBuf == NULL)
     {
-        iprintf( "onLwIPSegmentReceived: Connection %p has been closed by remote"
+        DLG_LOG( "onLwIPSegmentReceived: Connection %p has been closed by remote"
                  " peer, error %i\r\n"
                , pPcb
                , (int)err
                );
+
+        /* The end of the response is known. */
+        endParsing(pConn);
         closeConnection(pConn);
 
         err = ERR_OK;
     }
     else
     {
-        iprintf( "onLwIPSegmentReceived: Connection %p: Error %i received. Connection"
+        DLG_LOG( "onLwIPSegmentReceived: Connection %p: Error %i received. Connection"
                  " is aborted\r\n"
                , pPcb
                , (int)err
@@ -689,9 +873,13 @@ static err_t onLwIPConnectionIdle(void *arg, struct tcp_pcb *pPcb)
     if(pConn->stConn == stConn_established)
     {
         assert(pPcb != NULL);
-        iprintf( "onLwIPConnectionIdle: Connection %p: Is idle and will be closed now\r\n"
+        DLG_LOG( "onLwIPConnectionIdle: Connection %p: Is idle and will be closed now\r\n"
                , pPcb
                );
+
+        /* The server keeps the connection alive. Parsing needs to be completed with what
+           we have got so far. */
+        endParsing(pConn);
         tcp_close(pPcb);
         pConn->stConn = stConn_closing;
 
@@ -700,7 +888,7 @@ static err_t onLwIPConnectionIdle(void *arg, struct tcp_pcb *pPcb)
     else
     {
         assert(pConn->stConn == stConn_closing);
-        iprintf( "onLwIPConnectionIdle: Connection %p: Is idle and has been closed. Waiting"
+        DLG_LOG( "onLwIPConnectionIdle: Connection %p: Is idle and has been closed. Waiting"
                  " for remote acknowledge took too long, connection is aborted now\r\n"
                , pPcb
                );
@@ -731,7 +919,7 @@ static err_t onLwIPSent(void *arg, struct tcp_pcb *pPcb, u16_t len)
     if(pConn->stConn != stConn_closed)
     {
         pConn->noCharsTx += (unsigned)len;
-        iprintf( "onLwIPSent: Connection %p: %hu Byte of data have been sent\r\n"
+        DLG_LOG( "onLwIPSent: Connection %p: %hu Byte of data have been sent\r\n"
                , pPcb
                , len
                );
@@ -764,6 +952,7 @@ static bool openConnection(void)
     {
         pConn->stConn = stConn_connecting;
         pConn->pPcb = pPcb;
+        beginParsing(pConn);
 
         /* The needed callbacks are installed for the intended connection. */
 
@@ -821,6 +1010,8 @@ void ats_initAccessTimeService(void)
     pConn->noCharsRx = 0u;
     pConn->stConn = stConn_closed;
     pConn->pPcb = NULL;
+    pConn->isParsing = false;
+    pConn->pPBufRx = NULL;
 
 } /* ats_initAccessTimeService */
 
@@ -889,7 +1080,7 @@ void ats_mainFunction(void)
                function; the lwIP state machine with its callbacks will directly drive all
                further activities like reception of response segments from the time server
                and their evaluation - till closure of now opened connection. */
-            iprintf("ats_mainFunction: Try to open a connection with global time service\r\n");
+            DLG_LOG("ats_mainFunction: Try to open a connection with global time service\r\n");
             const bool success = openConnection();
             if(success)
             {
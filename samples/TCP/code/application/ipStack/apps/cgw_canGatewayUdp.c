@@ -0,0 +1,767 @@
+/**
+ * @file cgw_canGatewayUdp.c
+ * CAN-over-UDP gateway: The CAN buses of the board are tunneled to a remote peer, e.g., a
+ * Linux test bench, in both directions. The protocol is the one of the open source tool
+ * cannelloni (https://github.com/mguentner/cannelloni), version 2, so that the gateway
+ * can be connected to a SocketCAN interface with cannelloni or with the host tool
+ * cgw_hostPeer.c_. Try, with vcan0 as local stand-in for the CAN bus:\n
+ *   ./cgw_hostPeer.exe 192.168.1.200 vcan0\n
+ *   candump vcan0\n
+ *   Each bus is tunneled through its own UDP port, see #CGW_UDP_PORT_BUS_0. The peer is
+ * not configured; the gateway replies to the address and port of the most recently
+ * received datagram of the given bus. CAN frames are not forwarded as long as no
+ * datagram has been received from a peer; the peer may send an empty datagram for
+ * registration.\n
+ *   CAN to UDP: The frames are received in the CAN task and queued in a lock-free single
+ * producer, single consumer ring buffer per bus. The IP task fetches them in each of its
+ * clock ticks and collects them in a datagram per bus. A datagram is sent when it is full
+ * or when its first frame has reached the age #CGW_TI_FLUSH_IN_MS. This way, many frames
+ * share a datagram at high bus load and the latency is still bounded at low bus load. The
+ * frames are encoded directly into the pbuf, which is eventually sent.\n
+ *   UDP to CAN: The frames of a received datagram are checked against the routing table
+ * and queued for the queued sending service of the CAN driver. The queue is flushed
+ * immediately and, if the CAN driver was busy, in the next clock ticks.\n
+ *   The routing table is derived from the DBC files: The data tables cdt_canRxMsgAry and
+ * cdt_canTxMsgAry are generated from them. All received frames are forwarded to UDP; these
+ * are the frames, which the CAN driver's mailboxes are configured for. Frames from UDP are
+ * not put on the bus if their CAN ID is either sent by this node, the same ID from two
+ * senders would corrupt the bus, or received by this node, the self-reception of the CAN
+ * device would echo them back to the peer.
+ *
+ * Copyright (C) 2026 Peter Vranken (mailto:Peter_Vranken@Yahoo.de)
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+/* Module interface
+ *   cgw_initCanGatewayUdp
+ *   cgw_onReceiveFrame
+ *   cgw_mainFunction
+ * Local functions
+ *   getRoutingKey
+ *   addToRoutingTable
+ *   isRoutedToCan
+ *   sendDatagram
+ *   appendFrame
+ *   flushTxQueue
+ *   onUdpReception
+ */
+
+/*
+ * Include files
+ */
+
+#include "cgw_canGatewayUdp.h"
+
+#include <assert.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "typ_types.h"
+#include "lwip/udp.h"
+#include "lwip/pbuf.h"
+#include "lwip/sys.h"
+#include "cdr_canDriverAPI.h"
+#include "cst_canStatistics.h"
+#include "cdt_canDataTables.h"
+#include "std_decoratedStorage.h"
+
+/*
+ * Defines
+ */
+
+/** The datagrams have the format of cannelloni, version 2. All numbers are in network
+    byte order. A datagram consists of a header and a sequence of frame records:\n
+      Header:\n
+        - 1 Byte: The version, #CGW_CANNELLONI_VERSION\n
+        - 1 Byte: The operation code, only #CGW_OP_CODE_DATA is supported\n
+        - 1 Byte: The sequence number of the datagram; wraps around\n
+        - 2 Byte: The number of frame records in the datagram\n
+      Frame record:\n
+        - 4 Byte: The CAN ID with the SocketCAN flags #CGW_CAN_EFF_FLAG etc.\n
+        - 1 Byte: The DLC, 0..8. Bit #CGW_CANFD_FRAME is set for CAN FD frames, which
+          have another flag byte here\n
+        - DLC Byte: The payload. Not present for RTR frames */
+#define CGW_CANNELLONI_VERSION      2u
+
+/** The operation code of a datagram, which carries CAN frames. */
+#define CGW_OP_CODE_DATA            0u
+
+/** The size of the header of a datagram in Byte. */
+#define CGW_SIZE_OF_HEADER          5u
+
+/** The size of a frame record without payload in Byte. */
+#define CGW_SIZE_OF_FRAME_HEADER    5u
+
+/** The flags in the CAN ID field of a frame record, as defined by SocketCAN: Extended
+    frame, remote transmission request and error frame. */
+#define CGW_CAN_EFF_FLAG            0x80000000u
+#define CGW_CAN_RTR_FLAG            0x40000000u
+#define CGW_CAN_ERR_FLAG            0x20000000u
+
+/** The flag in the length field of a frame record, which indicates a CAN FD frame. */
+#define CGW_CANFD_FRAME             0x80u
+
+/** The maximum size of a datagram, which fits into an Ethernet frame without IP
+    fragmentation. (MTU minus IP and UDP header.) */
+#define CGW_MAX_SIZE_OF_DATAGRAM    (1500u - 20u - 8u)
+
+/** A received datagram, whose sequence number is at most this distance before the
+    expected one, is considered a duplicate or a datagram, which has been overtaken by a
+    later one. It is dropped. A larger distance backwards is rather a restart of the peer
+    and the sequence numbers are resynchronized. */
+#define CGW_MAX_DIST_LATE_DATAGRAM  16
+
+/** The maximum number of entries in the routing table. */
+#define CGW_MAX_NO_ROUTING_ENTRIES  (CST_NO_CAN_MSGS_RECEIVED + CST_NO_CAN_MSGS_SENT)
+
+_Static_assert( CGW_NO_CAN_BUSES > 0u
+                &&  CGW_NO_CAN_BUSES <= (unsigned int)cdr_canDev_noCANDevicesEnabled
+              , "Gateway configured for more CAN buses than the CAN driver serves"
+              );
+
+_Static_assert( CGW_SIZE_OF_RX_QUEUE > 0u
+                &&  (CGW_SIZE_OF_RX_QUEUE & (CGW_SIZE_OF_RX_QUEUE-1u)) == 0u
+                &&  CGW_SIZE_OF_TX_QUEUE > 0u
+                &&  (CGW_SIZE_OF_TX_QUEUE & (CGW_SIZE_OF_TX_QUEUE-1u)) == 0u
+              , "Size of frame queues needs to be a power of two"
+              );
+
+
+/*
+ * Local type definitions
+ */
+
+/** A CAN frame, as queued for forwarding to or from UDP. */
+typedef struct frame_t
+{
+    /** The CAN ID. Bit #CGW_CAN_EFF_FLAG is set for an extended ID. */
+    uint32_t canId;
+
+    /** The number of payload bytes. */
+    uint8_t DLC;
+
+    /** The payload. */
+    uint8_t payload[8];
+
+} frame_t;
+
+
+/** The state of the gateway of a single CAN bus. */
+typedef struct busGateway_t
+{
+    /** The lwIP protocol control block of the UDP port of the bus. */
+    struct udp_pcb *pPcb;
+
+    /** The address of the peer. Valid only if \a isPeerKnown is set. */
+    ip_addr_t peerAddr;
+
+    /** The UDP port of the peer. Valid only if \a isPeerKnown is set. */
+    u16_t peerPort;
+
+    /** Whether a datagram has been received, which told the address of the peer. */
+    bool isPeerKnown;
+
+    /** The currently filled datagram or NULL if no frame is pending. */
+    struct pbuf *pDatagram;
+
+    /** The number of bytes filled into \a pDatagram. */
+    unsigned int sizeOfDatagram;
+
+    /** The number of frame records in \a pDatagram. */
+    unsigned int noFramesInDatagram;
+
+    /** The time, when the first frame has been put into \a pDatagram, in ms. */
+    uint32_t tiOpenDatagram;
+
+    /** The sequence number of the next sent datagram. */
+    uint8_t seqNoTx;
+
+    /** The expected sequence number of the next received datagram. */
+    uint8_t seqNoRx;
+
+    /** The queue of frames received from UDP, which are waiting for sending on the bus.
+        The queue is accessed by the IP task only. */
+    frame_t txQueueAry[CGW_SIZE_OF_TX_QUEUE];
+
+    /** The free running write index into \a txQueueAry. */
+    unsigned int idxWrTxQueue;
+
+    /** The free running read index into \a txQueueAry. */
+    unsigned int idxRdTxQueue;
+
+    /** Some counters for debugging. */
+    struct
+    {
+        /** Frames forwarded from CAN to UDP. */
+        unsigned long noFramesToUdp;
+
+        /** Frames from CAN, which were dropped because no peer is known yet. */
+        unsigned long noFramesNoPeer;
+
+        /** Datagrams, which couldn't be allocated or sent. */
+        unsigned long noErrUdpTx;
+
+        /** Frames forwarded from UDP to CAN. */
+        unsigned long noFramesToCan;
+
+        /** Frames from UDP, which were rejected by the routing table or which have an
+            unsupported format, like CAN FD or RTR. */
+        unsigned long noFramesRejected;
+
+        /** Frames from UDP, which were dropped because of a full queue or an error of the
+            CAN driver. */
+        unsigned long noFramesDroppedCan;
+
+        /** Datagrams from UDP, which were lost according to their sequence number. */
+        unsigned long noDatagramsLost;
+
+        /** Datagrams from UDP, which were dropped because they came twice or late, i.e.,
+            after a datagram with a later sequence number. */
+        unsigned long noDatagramsLate;
+
+        /** Datagrams from UDP, which were malformed. */
+        unsigned long noDatagramsBad;
+
+    } stat;
+
+} busGateway_t;
+
+
+/** The queue of frames received from the CAN bus, not yet forwarded to UDP. It is a
+    lock-free ring buffer with a single producer, the CAN task, and a single consumer, the
+    IP task. */
+typedef struct rxQueue_t
+{
+    /** The queued frames. */
+    frame_t frameAry[CGW_SIZE_OF_RX_QUEUE];
+
+    /** The free running write index into \a frameAry. Only written by the producer. */
+    volatile uint32_t idxWr;
+
+    /** The free running read index into \a frameAry. Only written by the consumer. */
+    volatile uint32_t idxRd;
+
+    /** The number of frames, which were lost due to a queue overflow. Only written by the
+        producer. */
+    volatile unsigned long noFramesLost;
+
+} rxQueue_t;
+
+
+/*
+ * Local prototypes
+ */
+
+
+/*
+ * Data definitions
+ */
+
+/** The state of the gateways of all buses. */
+static busGateway_t BSS_P1(_busGatewayAry)[CGW_NO_CAN_BUSES];
+
+/** The routing table: The sorted keys of all frames, which must not be forwarded from UDP
+    to CAN. See getRoutingKey() for the key. */
+static uint64_t BSS_P1(_blockedFrameAry)[CGW_MAX_NO_ROUTING_ENTRIES];
+
+/** The number of entries in \a _blockedFrameAry. */
+static unsigned int SBSS_P1(_noBlockedFrames) = 0u;
+
+/** The queues of frames received from CAN, one per bus. */
+static rxQueue_t BSS_P1(_rxQueueAry)[CGW_NO_CAN_BUSES];
+
+/** The gateway is operational after successful initialization. The producer doesn't queue
+    frames before. */
+static volatile bool SBSS_P1(_isInitialized) = false;
+
+
+/*
+ * Function implementation
+ */
+
+/**
+ * Get the key of a frame in the routing table.
+ *   @return
+ * Get the key. The key orders the frames by bus and then by ID.
+ *   @param idxBus
+ * The index of the bus.
+ *   @param canId
+ * The CAN ID. Bit #CGW_CAN_EFF_FLAG is set for an extended ID.
+ */
+static inline uint64_t getRoutingKey(unsigned int idxBus, uint32_t canId)
+{
+    return ((uint64_t)idxBus << 32) | canId;
+}
+
+
+/**
+ * Add a frame to the routing table. The table is kept sorted.
+ *   @param pMsg
+ * The description of the frame in the generated data tables. Frames of buses, which are
+ * not tunneled, are ignored.
+ */
+static void addToRoutingTable(const cdt_canMessage_t *pMsg)
+{
+    if(pMsg->idxCanBus >= CGW_NO_CAN_BUSES)
+        return;
+
+    assert(_noBlockedFrames < sizeOfAry(_blockedFrameAry));
+    const uint64_t key = getRoutingKey( pMsg->idxCanBus
+                                      , (uint32_t)pMsg->canId
+                                        | (pMsg->isExtId? CGW_CAN_EFF_FLAG: 0u)
+                                      );
+    unsigned int idx = _noBlockedFrames;
+    while(idx > 0u  &&  _blockedFrameAry[idx-1u] > key)
+    {
+        _blockedFrameAry[idx] = _blockedFrameAry[idx-1u];
+        -- idx;
+    }
+    _blockedFrameAry[idx] = key;
+    ++ _noBlockedFrames;
+
+} /* addToRoutingTable */
+
+
+/**
+ * Look up the routing table for a frame received from UDP.
+ *   @return
+ * Get \a true if the frame may be put on the bus.
+ *   @param idxBus
+ * The index of the bus.
+ *   @param canId
+ * The CAN ID. Bit #CGW_CAN_EFF_FLAG is set for an extended ID.
+ */
+static bool isRoutedToCan(unsigned int idxBus, uint32_t canId)
+{
+    const uint64_t key = getRoutingKey(idxBus, canId);
+    unsigned int idxL = 0u
+               , idxR = _noBlockedFrames;
+    while(idxL < idxR)
+    {
+        const unsigned int idxM = (idxL + idxR) / 2u;
+        if(_blockedFrameAry[idxM] < key)
+            idxL = idxM + 1u;
+        else
+            idxR = idxM;
+    }
+    return idxL >= _noBlockedFrames  ||  _blockedFrameAry[idxL] != key;
+
+} /* isRoutedToCan */
+
+
+/**
+ * Send the currently filled datagram of a bus to the peer.
+ *   @param pBus
+ * The gateway of the bus. \a pDatagram must not be NULL.
+ */
+static void sendDatagram(busGateway_t *pBus)
+{
+    struct pbuf * const pPBuf = pBus->pDatagram;
+    assert(pPBuf != NULL  &&  pBus->isPeerKnown);
+
+    /* The number of frames is patched into the header. */
+    uint8_t * const pHeader = (uint8_t*)pPBuf->payload;
+    pHeader[3] = (uint8_t)(pBus->noFramesInDatagram >> 8);
+    pHeader[4] = (uint8_t)pBus->noFramesInDatagram;
+
+    /* The pbuf had been allocated with maximum size. It is shrunk in place. */
+    pbuf_realloc(pPBuf, (u16_t)pBus->sizeOfDatagram);
+    if(udp_sendto(pBus->pPcb, pPBuf, &pBus->peerAddr, pBus->peerPort) != ERR_OK)
+        ++ pBus->stat.noErrUdpTx;
+    else
+        pBus->stat.noFramesToUdp += pBus->noFramesInDatagram;
+
+    /* lwIP has taken its own reference to the pbuf if it is still needed for transmission. */
+    pbuf_free(pPBuf);
+    pBus->pDatagram = NULL;
+
+} /* sendDatagram */
+
+
+/**
+ * Append a frame received from CAN to the currently filled datagram of its bus. If the
+ * datagram is full then it is sent and a new one is begun.
+ *   @param pBus
+ * The gateway of the bus.
+ *   @param pFrame
+ * The frame.
+ *   @param tiNow
+ * The current time in ms.
+ */
+static void appendFrame(busGateway_t *pBus, const frame_t *pFrame, uint32_t tiNow)
+{
+    if(!pBus->isPeerKnown)
+    {
+        ++ pBus->stat.noFramesNoPeer;
+        return;
+    }
+
+    const unsigned int sizeOfRecord = CGW_SIZE_OF_FRAME_HEADER + pFrame->DLC;
+    if(pBus->pDatagram != NULL
+       &&  pBus->sizeOfDatagram + sizeOfRecord > CGW_MAX_SIZE_OF_DATAGRAM
+      )
+    {
+        sendDatagram(pBus);
+    }
+
+    if(pBus->pDatagram == NULL)
+    {
+        pBus->pDatagram = pbuf_alloc(PBUF_TRANSPORT, CGW_MAX_SIZE_OF_DATAGRAM, PBUF_RAM);
+        if(pBus->pDatagram == NULL)
+        {
+            ++ pBus->stat.noErrUdpTx;
+            return;
+        }
+        assert(pBus->pDatagram->len == pBus->pDatagram->tot_len);
+
+        uint8_t * const pHeader = (uint8_t*)pBus->pDatagram->payload;
+        pHeader[0] = CGW_CANNELLONI_VERSION;
+        pHeader[1] = CGW_OP_CODE_DATA;
+        pHeader[2] = pBus->seqNoTx++;
+        pBus->sizeOfDatagram = CGW_SIZE_OF_HEADER;
+        pBus->noFramesInDatagram = 0u;
+        pBus->tiOpenDatagram = tiNow;
+    }
+
+    uint8_t *pWr = (uint8_t*)pBus->pDatagram->payload + pBus->sizeOfDatagram;
+    *pWr++ = (uint8_t)(pFrame->canId >> 24);
+    *pWr++ = (uint8_t)(pFrame->canId >> 16);
+    *pWr++ = (uint8_t)(pFrame->canId >> 8);
+    *pWr++ = (uint8_t)pFrame->canId;
+    *pWr++ = pFrame->DLC;
+    memcpy(pWr, pFrame->payload, pFrame->DLC);
+    pBus->sizeOfDatagram += sizeOfRecord;
+    ++ pBus->noFramesInDatagram;
+
+} /* appendFrame */
+
+
+/**
+ * Submit the frames received from UDP to the queued sending service of the CAN driver,
+ * as long as it accepts them.
+ *   @param idxBus
+ * The index of the bus.
+ */
+static void flushTxQueue(unsigned int idxBus)
+{
+    busGateway_t * const pBus = &_busGatewayAry[idxBus];
+    while(pBus->idxRdTxQueue != pBus->idxWrTxQueue)
+    {
+        const frame_t * const pFrame =
+                        &pBus->txQueueAry[pBus->idxRdTxQueue % CGW_SIZE_OF_TX_QUEUE];
+        const cdr_errorAPI_t errCode =
+                    cdr_sendMessageQueued( idxBus
+                                         , /* isExtId */ (pFrame->canId & CGW_CAN_EFF_FLAG)
+                                                         != 0u
+                                         , /* canId */ pFrame->canId & ~CGW_CAN_EFF_FLAG
+                                         , /* DLC */ pFrame->DLC
+                                         , pFrame->payload
+                                         );
+        if(errCode == cdr_errApi_txMailboxBusy)
+            break;
+        else if(errCode == cdr_errApi_noError)
+            ++ pBus->stat.noFramesToCan;
+        else
+            ++ pBus->stat.noFramesDroppedCan;
+
+        ++ pBus->idxRdTxQueue;
+    }
+} /* flushTxQueue */
+
+
+/**
+ * Callback from lwIP: A datagram has been received on the UDP port of a bus.
+ *   @param arg
+ * The index of the bus.
+ *   @param pPcb
+ * The protocol control block of the port. Not used.
+ *   @param pPBuf
+ * The received datagram. The callback is responsible for freeing it.
+ *   @param pAddr
+ * The address of the sender.
+ *   @param port
+ * The port of the sender.
+ */
+static void onUdpReception( void *arg
+                          , struct udp_pcb *pPcb ATTRIB_UNUSED
+                          , struct pbuf *pPBuf
+                          , const ip_addr_t *pAddr
+                          , u16_t port
+                          )
+{
+    const unsigned int idxBus = (unsigned int)(uintptr_t)arg;
+    assert(idxBus < CGW_NO_CAN_BUSES);
+    busGateway_t * const pBus = &_busGatewayAry[idxBus];
+
+    /* Received datagrams are normally contained in a single pbuf. Only otherwise, the
+       contents are copied. */
+    static uint8_t BSS_P1(buf_)[CGW_MAX_SIZE_OF_DATAGRAM];
+    const uint8_t *pRd;
+    const unsigned int sizeOfDatagram = pPBuf->tot_len;
+    if(pPBuf->len == pPBuf->tot_len)
+        pRd = (const uint8_t*)pPBuf->payload;
+    else if(sizeOfDatagram <= sizeof(buf_))
+    {
+        pbuf_copy_partial(pPBuf, buf_, (u16_t)sizeOfDatagram, /* offset */ 0u);
+        pRd = buf_;
+    }
+    else
+    {
+        ++ pBus->stat.noDatagramsBad;
+        pbuf_free(pPBuf);
+        return;
+    }
+    const uint8_t * const pEnd = pRd + sizeOfDatagram;
+
+    if(sizeOfDatagram < CGW_SIZE_OF_HEADER
+       ||  pRd[0] != CGW_CANNELLONI_VERSION
+       ||  pRd[1] != CGW_OP_CODE_DATA
+      )
+    {
+        ++ pBus->stat.noDatagramsBad;
+        pbuf_free(pPBuf);
+        return;
+    }
+
+    /* The distance of the sequence number to the expected one tells lost datagrams. A
+       slightly negative distance means a duplicate or a datagram, which has been
+       overtaken by a later one. Its frames would reach the bus twice or out of order and
+       it is dropped; it has already been counted as lost when the later one came. A new
+       peer or a far negative distance, a restart of the peer, resynchronizes. */
+    const bool isSamePeer = pBus->isPeerKnown
+                            &&  ip_addr_eq(&pBus->peerAddr, pAddr)
+                            &&  pBus->peerPort == port;
+    const int distSeqNo = (int)(int8_t)(uint8_t)(pRd[2] - pBus->seqNoRx);
+    if(isSamePeer  &&  distSeqNo < 0  &&  distSeqNo >= -CGW_MAX_DIST_LATE_DATAGRAM)
+    {
+        ++ pBus->stat.noDatagramsLate;
+        pbuf_free(pPBuf);
+        return;
+    }
+    else if(isSamePeer  &&  distSeqNo > 0)
+        pBus->stat.noDatagramsLost += (unsigned long)distSeqNo;
+
+    /* The sender of the latest datagram becomes the peer. */
+    ip_addr_copy(pBus->peerAddr, *pAddr);
+    pBus->peerPort = port;
+    pBus->isPeerKnown = true;
+    pBus->seqNoRx = (uint8_t)(pRd[2] + 1u);
+
+    const unsigned int noFrames = ((unsigned int)pRd[3] << 8) | pRd[4];
+    pRd += CGW_SIZE_OF_HEADER;
+    for(unsigned int u=0u; u<noFrames; ++u)
+    {
+        if(pEnd - pRd < (ptrdiff_t)CGW_SIZE_OF_FRAME_HEADER)
+        {
+            ++ pBus->stat.noDatagramsBad;
+            break;
+        }
+        const uint32_t canId = ((uint32_t)pRd[0] << 24) | ((uint32_t)pRd[1] << 16)
+                               | ((uint32_t)pRd[2] << 8) | pRd[3];
+        const unsigned int len = pRd[4];
+        pRd += CGW_SIZE_OF_FRAME_HEADER;
+
+        /* The size of the record is determined first, so that unsupported frames can be
+           skipped. CAN FD frames have an additional flag byte and RTR frames have no
+           payload. */
+        const bool isFD = (len & CGW_CANFD_FRAME) != 0u;
+        const unsigned int DLC = len & ~CGW_CANFD_FRAME
+                         , sizeOfPayload = (canId & CGW_CAN_RTR_FLAG) != 0u
+                                           ? 0u
+                                           : DLC + (isFD? 1u: 0u);
+        if(pEnd - pRd < (ptrdiff_t)sizeOfPayload)
+        {
+            ++ pBus->stat.noDatagramsBad;
+            break;
+        }
+
+        const uint32_t maxCanId = (canId & CGW_CAN_EFF_FLAG) != 0u? 0x1FFFFFFFu: 0x7FFu;
+        if(isFD
+           ||  (canId & (CGW_CAN_RTR_FLAG | CGW_CAN_ERR_FLAG)) != 0u
+           ||  (canId & ~CGW_CAN_EFF_FLAG) > maxCanId
+           ||  DLC > 8u
+           ||  !isRoutedToCan(idxBus, canId)
+          )
+        {
+            ++ pBus->stat.noFramesRejected;
+        }
+        else if(pBus->idxWrTxQueue - pBus->idxRdTxQueue >= CGW_SIZE_OF_TX_QUEUE)
+            ++ pBus->stat.noFramesDroppedCan;
+        else
+        {
+            frame_t * const pFrame =
+                            &pBus->txQueueAry[pBus->idxWrTxQueue % CGW_SIZE_OF_TX_QUEUE];
+            pFrame->canId = canId;
+            pFrame->DLC = (uint8_t)DLC;
+            memcpy(pFrame->payload, pRd, DLC);
+            ++ pBus->idxWrTxQueue;
+        }
+        pRd += sizeOfPayload;
+
+    } /* for(All frame records in the datagram) */
+
+    pbuf_free(pPBuf);
+
+    /* Try sending the frames without waiting for the next clock tick. */
+    flushTxQueue(idxBus);
+
+} /* onUdpReception */
+
+
+
+/**
+ * The initialization function of the CAN-over-UDP gateway. It needs to be called once
+ * at system startup, after lwIP initialization and before the CAN task starts queueing
+ * frames.
+ *   @return
+ * Get \a true if the UDP ports of all buses could be opened. Otherwise, all later calls
+ * of cgw_onReceiveFrame() and cgw_mainFunction() are ignored.
+ */
+bool cgw_initCanGatewayUdp(void)
+{
+    /* The routing table is built from the data tables, which are generated from the DBC
+       files. */
+    _noBlockedFrames = 0u;
+    for(unsigned int u=0u; u<CST_NO_CAN_MSGS_RECEIVED; ++u)
+        addToRoutingTable(&cdt_canRxMsgAry[u]);
+    for(unsigned int u=0u; u<CST_NO_CAN_MSGS_SENT; ++u)
+        addToRoutingTable(&cdt_canTxMsgAry[u]);
+
+    for(unsigned int idxBus=0u; idxBus<CGW_NO_CAN_BUSES; ++idxBus)
+    {
+        busGateway_t * const pBus = &_busGatewayAry[idxBus];
+        memset(pBus, 0, sizeof(*pBus));
+
+        pBus->pPcb = udp_new_ip_type(IPADDR_TYPE_V4);
+        if(pBus->pPcb == NULL
+           ||  udp_bind(pBus->pPcb, IP4_ADDR_ANY, (u16_t)(CGW_UDP_PORT_BUS_0 + idxBus))
+               != ERR_OK
+          )
+        {
+            /* Undo the successful part of the initialization. */
+            for(unsigned int u=0u; u<=idxBus; ++u)
+            {
+                if(_busGatewayAry[u].pPcb != NULL)
+                {
+                    udp_remove(_busGatewayAry[u].pPcb);
+                    _busGatewayAry[u].pPcb = NULL;
+                }
+            }
+            return false;
+        }
+        udp_recv(pBus->pPcb, onUdpReception, /* arg */ (void*)(uintptr_t)idxBus);
+    }
+
+    /* The producer must not see the gateway before it is completely set up. */
+    std_fullMemoryBarrier();
+    _isInitialized = true;
+
+    return true;
+
+} /* cgw_initCanGatewayUdp */
+
+
+
+/**
+ * Queue a received CAN frame for forwarding to the UDP peer. The function is called by the
+ * CAN task for every received frame. It is the single producer of the Rx queues; it must
+ * not be called from different contexts.\n
+ *   The function doesn't block and has a constant, small execution time. If the queue of
+ * the bus is full then the frame is dropped and counted as lost.
+ *   @param idxBus
+ * The zero based index of the bus, which the frame has been received on. Frames of buses,
+ * which are not tunneled, are ignored.
+ *   @param canId
+ * The CAN ID of the frame.
+ *   @param isExtId
+ * \a true if \a canId is an extended ID.
+ *   @param payload
+ * The \a DLC bytes of the frame contents.
+ *   @param DLC
+ * The number of payload bytes, 0..8.
+ */
+void cgw_onReceiveFrame( unsigned int idxBus
+                       , unsigned int canId
+                       , bool isExtId
+                       , const uint8_t payload[]
+                       , unsigned int DLC
+                       )
+{
+    if(!_isInitialized  ||  idxBus >= CGW_NO_CAN_BUSES)
+        return;
+
+    assert(DLC <= 8u);
+    rxQueue_t * const pQueue = &_rxQueueAry[idxBus];
+    const uint32_t idxWr = pQueue->idxWr;
+    if(idxWr - pQueue->idxRd >= CGW_SIZE_OF_RX_QUEUE)
+    {
+        ++ pQueue->noFramesLost;
+        return;
+    }
+
+    frame_t * const pFrame = &pQueue->frameAry[idxWr % CGW_SIZE_OF_RX_QUEUE];
+    pFrame->canId = (uint32_t)canId | (isExtId? CGW_CAN_EFF_FLAG: 0u);
+    pFrame->DLC = (uint8_t)DLC;
+    memcpy(pFrame->payload, payload, DLC);
+
+    /* The frame contents need to be complete in memory before the consumer can see the
+       moved write index. */
+    std_fullMemoryBarrier();
+    pQueue->idxWr = idxWr + 1u;
+
+} /* cgw_onReceiveFrame */
+
+
+
+/**
+ * The step function of the CAN-over-UDP gateway. It needs to be called regularly from the
+ * IP task, in every clock tick. The frames received from CAN since the previous call are
+ * collected into datagrams and the due datagrams are sent. Frames from UDP, which the CAN
+ * driver couldn't accept so far, are submitted again.
+ */
+void cgw_mainFunction(void)
+{
+    if(!_isInitialized)
+        return;
+
+    const uint32_t tiNow = sys_now();
+    for(unsigned int idxBus=0u; idxBus<CGW_NO_CAN_BUSES; ++idxBus)
+    {
+        busGateway_t * const pBus = &_busGatewayAry[idxBus];
+        rxQueue_t * const pQueue = &_rxQueueAry[idxBus];
+        const uint32_t idxRd = pQueue->idxRd
+                     , idxWr = pQueue->idxWr;
+
+        /* The frame contents need to be read only after the write index. */
+        std_fullMemoryBarrier();
+
+        assert(idxWr - idxRd <= CGW_SIZE_OF_RX_QUEUE);
+        for(uint32_t idx=idxRd; idx!=idxWr; ++idx)
+            appendFrame(pBus, &pQueue->frameAry[idx % CGW_SIZE_OF_RX_QUEUE], tiNow);
+
+        /* The frame contents need to be completely read before the producer can
+           overwrite them. */
+        std_fullMemoryBarrier();
+        pQueue->idxRd = idxWr;
+
+        if(pBus->pDatagram != NULL
+           &&  (uint32_t)(tiNow - pBus->tiOpenDatagram) >= CGW_TI_FLUSH_IN_MS
+          )
+        {
+            sendDatagram(pBus);
+        }
+
+        flushTxQueue(idxBus);
+    }
+} /* cgw_mainFunction */
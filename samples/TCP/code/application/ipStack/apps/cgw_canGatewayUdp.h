@@ -0,0 +1,100 @@
+#ifndef CGW_CANGATEWAYUDP_INCLUDED
+#define CGW_CANGATEWAYUDP_INCLUDED
+/**
+ * @file cgw_canGatewayUdp.h
+ * Definition of global interface of module cgw_canGatewayUdp.c
+ *
+ * Copyright (C) 2026 Peter Vranken (mailto:Peter_Vranken@Yahoo.de)
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Include files
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "typ_types.h"
+
+/*
+ * Defines
+ */
+
+/** The number of CAN buses, which are tunneled by the gateway. These are the buses with
+    zero based index 0..(#CGW_NO_CAN_BUSES-1). Each bus has its own UDP port, see
+    #CGW_UDP_PORT_BUS_0, and its own queues. The number must not exceed the number of CAN
+    devices enabled in the CAN driver; this sample uses a single one. The MPC5748G has
+    up to eight. */
+#define CGW_NO_CAN_BUSES                1u
+
+/** The UDP port of the gateway for the first CAN bus. The port of bus i is
+    #CGW_UDP_PORT_BUS_0 + i. The same port is used locally and at the peer. 20000 is the
+    default port of cannelloni. */
+#define CGW_UDP_PORT_BUS_0              20000u
+
+/** Frames received from CAN are collected in a datagram until it is full or until the
+    first collected frame has this age in ms. The resolution is the 10ms clock tick of the
+    IP task. A larger value yields fewer, fuller datagrams at the cost of latency. */
+#define CGW_TI_FLUSH_IN_MS              10u
+
+/** The number of CAN frames received from a bus, which can be buffered between two clock
+    ticks of the IP task. Each bus has its own queue so that the capacity doesn't depend
+    on the number of buses or on the load of the other buses. At 1 Mbit/s, a bus carries
+    up to about 80 frames with eight Byte of payload per 10ms tick. A queue takes 16 Byte
+    of RAM per frame. Needs to be a power of two. */
+#define CGW_SIZE_OF_RX_QUEUE            128u
+
+/** The number of frames received from Ethernet, which can be buffered per bus if the
+    queued sending service of the CAN driver is temporarily busy. Needs to be a power of
+    two. */
+#define CGW_SIZE_OF_TX_QUEUE            64u
+
+
+/*
+ * Global type definitions
+ */
+
+
+/*
+ * Global data declarations
+ */
+
+
+/*
+ * Global prototypes
+ */
+
+/** The initialization function of the CAN-over-UDP gateway. */
+bool cgw_initCanGatewayUdp(void);
+
+/** Queue a received CAN frame for forwarding to the UDP peer. */
+void cgw_onReceiveFrame( unsigned int idxBus
+                       , unsigned int canId
+                       , bool isExtId
+                       , const uint8_t payload[]
+                       , unsigned int DLC
+                       );
+
+/** The step function of the CAN-over-UDP gateway. */
+void cgw_mainFunction(void);
+
+
+/*
+ * Global inline functions
+ */
+
+
+#endif  /* CGW_CANGATEWAYUDP_INCLUDED */
@@ -7,9 +7,17 @@
  * application if only the TCP port number differs.
  *   Try: telnet 192.168.1.200 1234\n
  *   You can try several shell windows all using the telnet command. Up to
- * #CLG_MAX_NO_TCP_CONNECTIONS clients can be served at a time.
+ * #CLG_MAX_NO_TCP_CONNECTIONS clients can be served at a time.\n
+ *   The service has a second, binary mode, which is offered at port
+ * #CLG_TCP_PORT_CAN_LOGGER_BINARY. It streams all signals of all received CAN messages
+ * in a compact binary format, which is suitable for logging at high data rates. The
+ * stream begins with a schema, which describes the signals, and continues with a batch of
+ * records in every cycle of the logger, in which at least one CAN message has been
+ * received. The format is specified below, see #CLG_BIN_MAGIC. The host tool
+ * clg_decodeBinaryStream.c_ turns the stream into CSV. Try:\n
+ *   nc 192.168.1.200 1235 | ./clg_decodeBinaryStream.exe > canLog.csv
  *
- * Copyright (C) 2023-2024 Peter Vranken (mailto:Peter_Vranken@Yahoo.de)
+ * Copyright (C) 2023-2026 Peter Vranken (mailto:Peter_Vranken@Yahoo.de)
  *
  * This program is free software: you can redistribute it and/or modify it
  * under the terms of the GNU Lesser General Public License as published by the
@@ -39,6 +47,14 @@
  *   onLwIPSent
  *   onLwIPAcceptConnection
  *   reportCANRxSignals
+ *   getSizeOfBinaryValue
+ *   putU8
+ *   putU16
+ *   putU32
+ *   putString
+ *   writeBinarySchema
+ *   streamCANRxSignalsBinary
+ *   startListener
  */
 
 /*
@@ -51,14 +67,19 @@
 #include <stdio.h>
 #include <string.h>
 #include <ctype.h>
+#include <limits.h>
 
 #include "typ_types.h"
 #include "lwip/tcp.h"
 #include "cmd_canCommand.h"
 #include "cap_canApi.h"
-#include "f2d_float2Double.h"
+#include "f2s_float2String.h"
 #include "cdt_canDataTables.h"
+#include "msn_messageSnapshot.h"
 #include "del_delay.h"
+#include "cst_canStatistics.h"
+#include "lwip/sys.h"
+#include "dlg_deferredLogging.h"
 
 /*
  * Defines
@@ -69,10 +90,76 @@
    setting #DBG_FEEDBACK_ONSENT_DATA to 1. */
 #define DBG_FEEDBACK_ON_SENT_DATA   1
 
+/** The binary stream, see #CLG_TCP_PORT_CAN_LOGGER_BINARY. All numbers are transmitted in
+    network byte order, floating point numbers as IEEE 754 single precision. A string is
+    transmitted as a length byte followed by the characters without terminating zero.\n
+      The stream begins with the schema:\n
+    - The four characters #CLG_BIN_MAGIC, which identify the stream and its version\n
+    - uint16: The number N of described signals\n
+    - N schema entries, each:\n
+      - uint16: The index of the signal; the signal records refer to the signal with it\n
+      - uint32: The CAN ID of the message, which contains the signal. Bit 31 is set for
+        an extended 29 Bit ID\n
+      - uint8: The type of the binary value, see enumeration cdt_fieldType_t. It implies
+        the number of bytes of the value in the signal records, 1, 2, 4 or 8\n
+      - uint8: The length of the signal in Bit\n
+      - float: Scaling factor\n
+      - float: Scaling offset; the physical value is the binary value times the factor
+        plus the offset\n
+      - string: The name of the message\n
+      - string: The name of the signal\n
+      - string: The unit of the signal\n
+    The schema is followed by the batches of signal records, each:\n
+    - uint8: The tag #CLG_BIN_TAG_BATCH\n
+    - uint16: The number M of records in the batch\n
+    - uint16: The sequence number of the batch. It is incremented by one from batch to
+      batch (with wrap around). A gap indicates batches, which had to be dropped since the
+      receiver couldn't consume the data fast enough\n
+    - uint32: The time of the batch in ms. The time wraps around\n
+    - M records, each:\n
+      - uint16: The index of the signal, see schema\n
+      - The binary signal value; signed values are sign extended to the size of the
+        type, see schema. Floating point values are transmitted as IEEE 754 number of
+        the size of the type */
+#define CLG_BIN_MAGIC               "CLG1"
+
+/** The tag, which precedes a batch of records in the binary stream. */
+#define CLG_BIN_TAG_BATCH           0xB5u
+
+/** The size of the header of a batch in the binary stream. */
+#define CLG_BIN_SIZE_OF_BATCH_HDR   9u
+
+/** Names and units are truncated to this length in the schema of the binary stream. */
+#define CLG_BIN_MAX_LEN_OF_STRING   63u
+
+/** The maximum size of a single schema entry in the binary stream. */
+#define CLG_BIN_MAX_SIZE_OF_SCHEMA_ENTRY (16u + 3u*(1u+CLG_BIN_MAX_LEN_OF_STRING))
+
+/** The maximum size of a batch in the binary stream; all signals appear in one batch. */
+#define CLG_BIN_MAX_SIZE_OF_BATCH   (CLG_BIN_SIZE_OF_BATCH_HDR                              \
+                                     + CST_NO_SENT_AND_RECEIVED_CAN_SIGNALS * (2u+8u)       \
+                                    )
+
+/* A batch is written only if it fits into the free space of the TCP send buffer. A batch,
+   which can be larger than the entire buffer, would be dropped every time when the bus
+   load is high. Too many signals for a single batch would require splitting it. */
+_Static_assert( CLG_BIN_MAX_SIZE_OF_BATCH <= TCP_SND_BUF
+                &&  CLG_BIN_MAX_SIZE_OF_SCHEMA_ENTRY <= TCP_SND_BUF
+              , "Binary batch or schema entry can exceed the TCP send buffer"
+              );
+
 /*
  * Local type definitions
  */
 
+/** The output formats of the CAN logger service. */
+typedef enum clg_streamMode_t
+{
+    clg_streamMode_text,    /// Human readable text for telnet.
+    clg_streamMode_binary,  /// Binary stream, see #CLG_BIN_MAGIC.
+
+} clg_streamMode_t;
+
 /** The data object keeping all runtime information needed to handle a single connection
     with the CAN logger service. */
 struct tcpConn_t
@@ -80,6 +167,9 @@ struct tcpConn_t
     /** The lwIP connection state. */
     enum stConn_t {stConn_closed, stConn_established, stConn_closing} stConn;
 
+    /** The format of the output, text for telnet or binary stream. */
+    clg_streamMode_t streamMode;
+
     /** A copy of the pointer to the lwIP connection object. This field is actually
         redundant but allows a nicer API of the main method write. */
     struct tcp_pcb *pPcb;
@@ -99,6 +189,28 @@ struct tcpConn_t
     /** The total number of characters received via this connection. The counter is not
         saturated and wraps at its implementation maximum. */
     unsigned int noCharsRx;
+
+    /** For each received message: The number of receptions at the time of the last report
+        of its signals. The listened signals of a message are reported again if the number
+        of receptions changed. */
+    unsigned int noRxAtLastReportAry[CST_NO_CAN_MSGS_RECEIVED];
+
+    /** Binary stream only: The progress of writing the schema. Zero if the magic has not
+        been written yet, otherwise one more than the index of the next signal in
+        cdt_canSignalAry to consider for the schema. The schema is complete if the index
+        reaches the end of the table. */
+    unsigned int idxSigSchema;
+
+    /** Binary stream only: For each received message: The number of receptions at the
+        time of the last batch of records. */
+    unsigned int noRxAtLastBatchAry[CST_NO_CAN_MSGS_RECEIVED];
+
+    /** Binary stream only: The sequence number of the next batch of records. */
+    uint16_t seqNoBatch;
+
+    /** Binary stream only: The number of batches, which couldn't be sent due to lack of
+        bandwidth. The counter is saturated at its implementation maximum. */
+    unsigned int noBatchesLost;
 };
 
 
@@ -254,7 +366,7 @@ static bool write( struct tcpConn_t * const pConn
 
         if(err != ERR_OK)
         {
-            iprintf( "Error %i when writing %u characters into TCP connection %i. Connection"
+            DLG_LOG( "Error %i when writing %u characters into TCP connection %i. Connection"
                      " is aborted\r\n"
                    , (int)err
                    , noChars
@@ -293,7 +405,7 @@ static void onLwIPError(void *arg, err_t err)
        when getting this notification. */
 
     struct tcpConn_t * const pConn = (struct tcpConn_t *)arg;
-    iprintf( "onLwIPError: Connection %i: Error %i received. Connection is closed\r\n"
+    DLG_LOG( "onLwIPError: Connection %i: Error %i received. Connection is closed\r\n"
            , (int)getIdxOfConnection(pConn)
            , (int)err
            );
@@ -354,12 +466,20 @@ static err_t onLwIPSegmentReceived( void *arg
         const char *payload = pPBuf->payload;
 
         pConn->noCharsRx += (unsigned)pPBuf->tot_len;
-        iprintf( "onLwIPSegmentReceived: Connection %u:%hu: %hu Byte have been received\r\n"
+        DLG_LOG( "onLwIPSegmentReceived: Connection %u:%hu: %hu Byte have been received\r\n"
                , idxConn
                , pPcb->remote_port
                , pPBuf->tot_len
                );
 
+        /* The binary stream doesn't take any input and it must not be disturbed by
+           echoed characters. The input is ignored. */
+        if(pConn->streamMode == clg_streamMode_binary)
+        {
+            pbuf_free(pPBuf);
+            return ERR_OK;
+        }
+
         /* We check the received data for a hint to quit the connection. Basically, this
            requires a stream implementation as we must not make any assumption in which
            portions the text input typed in telnet will arrive here. By experience, telnet
@@ -384,7 +504,7 @@ static err_t onLwIPSegmentReceived( void *arg
         if(doClose)
         {
             /* We received the demand from the peer to stop sending data. */
-            iprintf( "onLwIPSegmentReceived: Connection %u:%hu: Connection is closed"
+            DLG_LOG( "onLwIPSegmentReceived: Connection %u:%hu: Connection is closed"
                      " on demand of peer\r\n"
                    , idxConn
                    , pPcb->remote_port
@@ -465,19 +585,36 @@ static err_t onLwIPSegmentReceived( void *arg
     }
     else if(pPBuf == NULL)
     {
-        iprintf( "onLwIPSegmentReceived: Connection %u:%hu: has been closed by remote"
+        DLG_LOG( "onLwIPSegmentReceived: Connection %u:%hu: has been closed by remote"
                  " peer, error %i\r\n"
                , idxConn
                , pPcb->remote_port
                , (int)err
                );
+
+        /* Our connection object is released now but the PCB is not: lwIP keeps it until
+           our FIN has been acknowledged and it may still report an error, e.g., a reset
+           from the peer. Formerly, the PCB remained attached and unclosed, a later reset
+           invoked onLwIPError() with the already released connection object and the
+           assertion in closeConnection() fired. Therefore, all callbacks are detached
+           before our side of the connection is closed, too. */
+        tcp_arg(pPcb, NULL);
+        tcp_err(pPcb, NULL);
+        tcp_recv(pPcb, NULL);
+        tcp_sent(pPcb, NULL);
+        tcp_poll(pPcb, NULL, /*interval*/ 0u);
         closeConnection(pConn);
 
+        /* tcp_close() returns ERR_OK even for lack of memory; lwIP then sends the FIN
+           later from its timer. We can ignore the return code, like in the close on
+           demand of the peer. */
+        const err_t rc ATTRIB_DBG_ONLY = tcp_close(pPcb);
+        assert(rc == ERR_OK);
         err = ERR_OK;
     }
     else
     {
-        iprintf( "onLwIPSegmentReceived: Connection %u:%hu: Error %i received. Connection"
+        DLG_LOG( "onLwIPSegmentReceived: Connection %u:%hu: Error %i received. Connection"
                  " is aborted\r\n"
                , idxConn
                , pPcb->remote_port
@@ -518,7 +655,7 @@ static err_t onLwIPConnectionIdle(void *arg, struct tcp_pcb *pPcb)
     if(pConn->stConn == stConn_established)
     {
         assert(pPcb != NULL);
-        iprintf( "onLwIPConnectionIdle: Connection %u:%hu: Is idle and will be closed now\r\n"
+        DLG_LOG( "onLwIPConnectionIdle: Connection %u:%hu: Is idle and will be closed now\r\n"
                , idxConn
                , pPcb->remote_port
                );
@@ -530,7 +667,7 @@ static err_t onLwIPConnectionIdle(void *arg, struct tcp_pcb *pPcb)
     else
     {
         assert(pConn->stConn == stConn_closing);
-        iprintf( "onLwIPConnectionIdle: Connection %u:%hu: Is idle and has been closed."
+        DLG_LOG( "onLwIPConnectionIdle: Connection %u:%hu: Is idle and has been closed."
                  " Waiting for peer's acknowledge took too long, connection is aborted now\r\n"
                , idxConn
                , pPcb->remote_port
@@ -581,7 +718,8 @@ static err_t onLwIPSent(void *arg, struct tcp_pcb *pPcb ATTRIB_DBG_ONLY, u16_t l
 /**
  * This is the callback function that is called when a connection has been accepted.
  *   @param arg
- * The argument of the callbacks of the listen connection. Not used.
+ * The argument of the callbacks of the listen connection. It conveys the output format
+ * of the new connection, see enumeration clg_streamMode_t.
  *   @param pPcb
  * The protocol control block by reference. Effectively, lwIP's representation of the
  * TCP connection.
@@ -589,14 +727,14 @@ static err_t onLwIPSent(void *arg, struct tcp_pcb *pPcb ATTRIB_DBG_ONLY, u16_t l
  * An error report. It is unclear, which errors are possible under which conditions and
  * what to do.
  */
-static err_t onLwIPAcceptConnection( void *arg ATTRIB_DBG_ONLY
+static err_t onLwIPAcceptConnection( void *arg
                                    , struct tcp_pcb *pPcb
                                    , err_t err
                                    )
 {
-    /* For testing purpose only, we had defined an argument for the listen connection,
-       which is now reporting a new connection. */
-    assert((unsigned)arg == 999u);
+    /* The argument of the listen connection tells the requested output format. */
+    const clg_streamMode_t streamMode = (clg_streamMode_t)(uintptr_t)arg;
+    assert(streamMode == clg_streamMode_text  ||  streamMode == clg_streamMode_binary);
 
     if(err == ERR_OK)
     {
@@ -606,9 +744,21 @@ static err_t onLwIPAcceptConnection( void *arg ATTRIB_DBG_ONLY
             /* We accept the new connection. */
             assert(pConn->stConn == stConn_closed  &&  pConn->pPcb == NULL);
             pConn->stConn = stConn_established;
+            pConn->streamMode = streamMode;
             pConn->pPcb = pPcb;
             pConn->noCharsTxLost = 0u;
             pConn->noCharsRx = 0u;
+            memset( &pConn->noRxAtLastReportAry[0]
+                  , 0
+                  , sizeof(pConn->noRxAtLastReportAry)
+                  );
+            pConn->idxSigSchema = 0u;
+            memset( &pConn->noRxAtLastBatchAry[0]
+                  , 0
+                  , sizeof(pConn->noRxAtLastBatchAry)
+                  );
+            pConn->seqNoBatch = 0u;
+            pConn->noBatchesLost = 0u;
 #if DBG_FEEDBACK_ON_SENT_DATA == 1
             pConn->noCharsTx = 0u;
 #endif
@@ -642,7 +792,20 @@ static err_t onLwIPAcceptConnection( void *arg ATTRIB_DBG_ONLY
 
             ++ _noTcpConn;
 
-            iprintf( "onLwIPAcceptConnection: Connection %i: %p:%hu\r\n"
+            if(streamMode == clg_streamMode_binary)
+            {
+                DLG_LOG( "onLwIPAcceptConnection: Connection %i: %p:%hu, binary stream\r\n"
+                       , (int)getIdxOfConnection(pConn)
+                       , pPcb
+                       , pPcb->remote_port
+                       );
+
+                /* The stream begins with the schema. It is written from the step function,
+                   as far as the send buffer permits. */
+                return ERR_OK;
+            }
+
+            DLG_LOG( "onLwIPAcceptConnection: Connection %i: %p:%hu\r\n"
                      "Type Ctrl-C to quit the connection.\r\n"
                    , (int)getIdxOfConnection(pConn)
                    , pPcb
@@ -666,7 +829,7 @@ static err_t onLwIPAcceptConnection( void *arg ATTRIB_DBG_ONLY
                connection is rejected. */
             tcp_arg(pPcb, /*arg*/ NULL);
 
-            iprintf( "onLwIPAcceptConnection: Connection %p:%hu is rejected. No free"
+            DLG_LOG( "onLwIPAcceptConnection: Connection %p:%hu is rejected. No free"
                      " handle any more\r\n"
                    , pPcb
                    , pPcb->remote_port
@@ -682,7 +845,7 @@ static err_t onLwIPAcceptConnection( void *arg ATTRIB_DBG_ONLY
            rejected. */
         tcp_arg(pPcb, /*arg*/ NULL);
 
-        iprintf( "onLwIPAcceptConnection: Connection %p:%hu has been notified with"
+        DLG_LOG( "onLwIPAcceptConnection: Connection %p:%hu has been notified with"
                  " error %i. The new connection is rejected\r\n"
                , pPcb
                , pPcb->remote_port
@@ -694,6 +857,39 @@ static err_t onLwIPAcceptConnection( void *arg ATTRIB_DBG_ONLY
 
 
 
+/**
+ * Get the physical value of a signal from a copy of its message struct.
+ *   @return
+ * Get the value, the field value in the struct, scaled by factor and offset.
+ *   @param pSig
+ * The signal by reference.
+ *   @param pMsgSts
+ * The copy of the message struct, as read from the snapshot of the message.
+ */
+static float getPhysicalValue(const cdt_canSignal_t * const pSig, const void * const pMsgSts)
+{
+    const uint8_t * const pField = (const uint8_t*)pMsgSts + pSig->offsetOfField;
+    float value;
+    switch(pSig->fieldType)
+    {
+    case cdt_fieldType_boolean_t: value = (float)*(const boolean_t*)pField; break;
+    case cdt_fieldType_uint8_t: value = (float)*(const uint8_t*)pField; break;
+    case cdt_fieldType_int8_t: value = (float)*(const int8_t*)pField; break;
+    case cdt_fieldType_uint16_t: value = (float)*(const uint16_t*)pField; break;
+    case cdt_fieldType_int16_t: value = (float)*(const int16_t*)pField; break;
+    case cdt_fieldType_uint32_t: value = (float)*(const uint32_t*)pField; break;
+    case cdt_fieldType_int32_t: value = (float)*(const int32_t*)pField; break;
+    case cdt_fieldType_uint64_t: value = (float)*(const uint64_t*)pField; break;
+    case cdt_fieldType_int64_t: value = (float)*(const int64_t*)pField; break;
+    case cdt_fieldType_float32_t: value = *(const float32_t*)pField; break;
+    default: assert(pSig->fieldType == cdt_fieldType_float64_t);
+             value = (float)*(const float64_t*)pField;
+    }
+    return value * pSig->factor + pSig->offset;
+
+} /* getPhysicalValue */
+
+
 /**
  * Core operation of CAN listener: Display the signals, which we are currently listening to.
  *   @param pConn
@@ -703,75 +899,103 @@ static err_t onLwIPAcceptConnection( void *arg ATTRIB_DBG_ONLY
 static void reportCANRxSignals(struct tcpConn_t * const pConn)
 {
     /* This function, executed in the lwIP task, shares information with the 10 ms
-       application task. This is the synchronization concept:
-         The lwIP task has a higher priority than the application task and can preempt it.
-       However, this will normally not happen for timer events and this particular function
-       is run only when the lwIP task has been woken up by a timer event. The timer events of
-       both competing tasks always become due at the same point in time and, due to its
-       higher priority, the lwIP task will always execute before the application task.
-       Preemption by timer event can occur only if the application task would execute too
-       long, beyond the next due time. This function reads information, which is written
-       solely by the application task. So even in the exceptional case of a preemption, no
-       harm could arise. */
+       application task, which runs the CAN interface engine. The signals are read from the
+       double-buffered snapshots of the received messages, which are published by the
+       engine. This yields a consistent copy of a message, regardless of task priorities or
+       cores, and no critical section is required. */
 
-    unsigned int noSigsReported = 0u;
+    /* Count the signals to listen to. Signals of sent messages are counted, too, but they
+       are never reported. */
     unsigned int noListenSigs = 0u;
     for( unsigned int idxSigInList=0
        ; idxSigInList<sizeOfAry(cmd_listenerSignalAry)
        ; ++idxSigInList
        )
     {
-        const cmd_listenerSigDesc_t const *pSigInList = &cmd_listenerSignalAry[idxSigInList];
-        if(pSigInList->idxSignal < sizeOfAry(cdt_canSignalAry))
-        {
-            /* Access the descriptor of the currently checked signal. */
-            const cdt_canSignal_t * const pSig = &cdt_canSignalAry[pSigInList->idxSignal];
+        if(cmd_listenerSignalAry[idxSigInList].idxSignal < sizeOfAry(cdt_canSignalAry))
+            ++ noListenSigs;
+    }
 
-            /* Access the descriptor of the received message. */
-            assert(pSig->idxMsg < sizeOfAry(cdt_canRxMsgAry));
-            const cdt_canMessage_t * const pMsg = &cdt_canRxMsgAry[pSig->idxMsg];
+    /* Check the received messages and report the signals of all those, which have been
+       received since the last report. The number of receptions is tracked per message,
+       so that all listened signals of a message are reported on the same reception. */
+    unsigned int noSigsReported = 0u;
+    for( unsigned int idxMsg=0u
+       ; noListenSigs>0u  &&  idxMsg<sizeOfAry(cdt_canRxMsgAry)
+       ; ++idxMsg
+       )
+    {
+        const cdt_canMessage_t * const pMsg = &cdt_canRxMsgAry[idxMsg];
+        bool isMsgRead = false;
+        for( unsigned int idxSigInList=0
+           ; idxSigInList<sizeOfAry(cmd_listenerSignalAry)
+           ; ++idxSigInList
+           )
+        {
+            const unsigned int idxSig = cmd_listenerSignalAry[idxSigInList].idxSignal;
+            if(idxSig >= sizeOfAry(cdt_canSignalAry))
+                continue;
 
-            /* Access the transmission status of the message the signal belongs to. */
-            const cap_stsTransmission_t stsRx = pMsg->pInfoTransmission->stsTransmission;
+            /* Access the descriptor of the currently checked signal. */
+            const cdt_canSignal_t * const pSig = &cdt_canSignalAry[idxSig];
+            if(!pSig->isReceived  ||  pSig->idxMsg != idxMsg)
+                continue;
+
+            /* Get a consistent copy of the message the signal belongs to, once for all of
+               its signals. The transmission info tells, whether the message has been
+               received since the last report. */
+            static cdt_rxMsgSnapshotBuf_t SBSS_P1(msgCopy_);
+            if(!isMsgRead)
+            {
+                assert(pMsg->pSnapshot != NULL);
+                msn_readSnapshot(pMsg->pSnapshot, &msgCopy_, pMsg->pSnapshot->sizeOfMsg);
+                isMsgRead = true;
+
+                const cap_infoTransmission_t * const pInfoTransmission =
+                    (const cap_infoTransmission_t*)((const uint8_t*)&msgCopy_
+                                                    + pMsg->offsetOfInfoTransmission
+                                                   );
+                const unsigned int noRx = pInfoTransmission->noTransmittedMsgs;
+                if(noRx == pConn->noRxAtLastReportAry[idxMsg])
+                    break;
+                pConn->noRxAtLastReportAry[idxMsg] = noRx;
+            }
 
-            /* Check if this signal belongs to a just received message. */
-            if(pSig->isReceived &&  (stsRx & cap_stTransm_newDataAvailable) != 0u)
+            /* Signal belongs to just received message, report new signal value. */
+            const float value = getPhysicalValue(pSig, &msgCopy_);
+            static char DATA_P1(msg_)[100];
+            char valueStr[F2S_SIZE_OF_BUF_SHORTEST];
+            f2s_formatShortest(valueStr, sizeof valueStr, value);
+            const int noCharsMsg = snprintf( msg_
+                                           , sizeof msg_
+                                           , "Message %s (%lu), signal %s: %s %s\r\n"
+                                           , pMsg->name
+                                           , pMsg->canId
+                                           , pSig->name
+                                           , valueStr
+                                           , pSig->unit
+                                           );
+            if(noCharsMsg > 0)
             {
-                /* Signal belongs to just received message, report new signal value. */
-                static char DATA_P1(msg_)[100];
-                const int noCharsMsg = snprintf( msg_
-                                               , sizeof msg_
-                                               , "Message %s (%lu), signal %s: %f %s\r\n"
-                                               , pMsg->name
-                                               , pMsg->canId
-                                               , pSig->name
-                                               , f2d(pSig->getter())
-                                               , pSig->unit
-                                               );
-                if(noCharsMsg > 0)
-                {
-                    uint16_t noChars = sizeof msg_ - 1u;
-                    if(noCharsMsg < (int)noChars)
-                        noChars = (uint16_t)noCharsMsg;
-                    else
-                        assert(false);
-
-                    /* Writing the information into the stream can have closing the
-                       connection as side effect. This is not reported here but inside the
-                       wrapper function write. */
-                    write(pConn, msg_, noChars, /* isMsgConst */ false, /* flush */ false);
-                }
+                uint16_t noChars = sizeof msg_ - 1u;
+                if(noCharsMsg < (int)noChars)
+                    noChars = (uint16_t)noCharsMsg;
                 else
                     assert(false);
 
-                ++ noSigsReported;
+                /* Writing the information into the stream can have closing the
+                   connection as side effect. This is not reported here but inside the
+                   wrapper function write. */
+                write(pConn, msg_, noChars, /* isMsgConst */ false, /* flush */ false);
             }
+            else
+                assert(false);
 
-            ++ noListenSigs;
+            ++ noSigsReported;
 
-        } /* if(List entry contains a signal?) */
+        } /* for(Check all entries in listener's internal list) */
 
-    } /* for(Check all entries in listener's internal list) */
+    } /* for(All received messages) */
 
     static uint16_t SBSS_P1(tiHint_) = 0;
     if(noSigsReported > 0u)
@@ -823,38 +1047,325 @@ static void reportCANRxSignals(struct tcpConn_t * const pConn)
 
 
 
+/**
+ * Get the number of bytes of a binary signal value in the binary stream.
+ *   @return
+ * Get the size in Byte, 1, 2, 4 or 8.
+ *   @param fieldType
+ * The type of the signal's field in the API struct.
+ */
+static unsigned int getSizeOfBinaryValue(cdt_fieldType_t fieldType)
+{
+    switch(fieldType)
+    {
+    case cdt_fieldType_boolean_t:
+    case cdt_fieldType_uint8_t:
+    case cdt_fieldType_int8_t: return 1u;
+    case cdt_fieldType_uint16_t:
+    case cdt_fieldType_int16_t: return 2u;
+    case cdt_fieldType_uint32_t:
+    case cdt_fieldType_int32_t:
+    case cdt_fieldType_float32_t: return 4u;
+    default: assert(fieldType == cdt_fieldType_uint64_t  ||  fieldType == cdt_fieldType_int64_t
+                    ||  fieldType == cdt_fieldType_float64_t
+                   );
+             return 8u;
+    }
+} /* getSizeOfBinaryValue */
+
+
+/**
+ * Get the binary value of a signal from a copy of its message struct.
+ *   @return
+ * Get the value of the field in the struct. Signed values are sign extended to 64 Bit.
+ * Floating point values are returned as their IEEE 754 bit pattern.
+ *   @param pSig
+ * The signal by reference.
+ *   @param pMsgSts
+ * The copy of the message struct, as read from the snapshot of the message.
+ */
+static uint64_t getBinaryValue(const cdt_canSignal_t * const pSig, const void * const pMsgSts)
+{
+    const uint8_t * const pField = (const uint8_t*)pMsgSts + pSig->offsetOfField;
+    switch(pSig->fieldType)
+    {
+    case cdt_fieldType_boolean_t: return (uint64_t)*(const boolean_t*)pField;
+    case cdt_fieldType_uint8_t: return (uint64_t)*(const uint8_t*)pField;
+    case cdt_fieldType_int8_t: return (uint64_t)(int64_t)*(const int8_t*)pField;
+    case cdt_fieldType_uint16_t: return (uint64_t)*(const uint16_t*)pField;
+    case cdt_fieldType_int16_t: return (uint64_t)(int64_t)*(const int16_t*)pField;
+    case cdt_fieldType_uint32_t: return (uint64_t)*(const uint32_t*)pField;
+    case cdt_fieldType_int32_t: return (uint64_t)(int64_t)*(const int32_t*)pField;
+    case cdt_fieldType_uint64_t: return *(const uint64_t*)pField;
+    case cdt_fieldType_int64_t: return (uint64_t)*(const int64_t*)pField;
+    case cdt_fieldType_float32_t:
+    {
+        uint32_t bin;
+        _Static_assert(sizeof(bin) == sizeof(float32_t), "Bad float size");
+        memcpy(&bin, pField, sizeof(bin));
+        return bin;
+    }
+    default:
+    {
+        assert(pSig->fieldType == cdt_fieldType_float64_t);
+        uint64_t bin;
+        _Static_assert(sizeof(bin) == sizeof(float64_t), "Bad double size");
+        memcpy(&bin, pField, sizeof(bin));
+        return bin;
+    }
+    }
+} /* getBinaryValue */
 
 
 /**
- * The initialization function of the CAN logger service.
+ * Serialization helper: Append a byte to a buffer.
  *   @return
- * Get \a true if the service could be started. \a false will mostly be returned because of
- * a lack of memory in the lwIP heap.
+ * Get the pointer behind the appended byte.
+ *   @param pWr
+ * The buffer position to write to.
+ *   @param b
+ * The byte.
  */
-bool clg_initCanLoggerTcp(void)
+static inline uint8_t *putU8(uint8_t *pWr, unsigned int b)
 {
-    _noTcpConn = 0u;
+    *pWr++ = (uint8_t)b;
+    return pWr;
+}
 
-    struct tcpConn_t *pConn = &_tcpConnAry[0];
-    for(unsigned int idxConn=0; idxConn<sizeOfAry(_tcpConnAry); ++idxConn)
+
+/**
+ * Serialization helper: Append a 16 Bit word in network byte order to a buffer.
+ *   @return
+ * Get the pointer behind the appended bytes.
+ *   @param pWr
+ * The buffer position to write to.
+ *   @param w
+ * The word.
+ */
+static inline uint8_t *putU16(uint8_t *pWr, unsigned int w)
+{
+    *pWr++ = (uint8_t)(w >> 8);
+    *pWr++ = (uint8_t)w;
+    return pWr;
+}
+
+
+/**
+ * Serialization helper: Append a 32 Bit word in network byte order to a buffer.
+ *   @return
+ * Get the pointer behind the appended bytes.
+ *   @param pWr
+ * The buffer position to write to.
+ *   @param w
+ * The word.
+ */
+static inline uint8_t *putU32(uint8_t *pWr, uint32_t w)
+{
+    pWr = putU16(pWr, (unsigned int)(w >> 16));
+    return putU16(pWr, (unsigned int)(w & 0xFFFFu));
+}
+
+
+/**
+ * Serialization helper: Append a string, length byte and characters, to a buffer. The
+ * string is truncated to #CLG_BIN_MAX_LEN_OF_STRING characters.
+ *   @return
+ * Get the pointer behind the appended bytes.
+ *   @param pWr
+ * The buffer position to write to.
+ *   @param str
+ * The string. NULL is written as empty string.
+ */
+static uint8_t *putString(uint8_t *pWr, const char *str)
+{
+    size_t len = str != NULL? strlen(str): 0u;
+    if(len > CLG_BIN_MAX_LEN_OF_STRING)
+        len = CLG_BIN_MAX_LEN_OF_STRING;
+    pWr = putU8(pWr, (unsigned int)len);
+    memcpy(pWr, str, len);
+    return pWr + len;
+
+} /* putString */
+
+
+/**
+ * Binary stream: Write the schema into the stream, as far as the send buffer permits.
+ * Each call continues where the previous call stopped, until the schema is complete.
+ *   @return
+ * Get \a true if the schema is complete and the signal records can be streamed.
+ *   @param pConn
+ * The TCP connection by reference.
+ */
+static bool writeBinarySchema(struct tcpConn_t * const pConn)
+{
+    if(pConn->idxSigSchema > sizeOfAry(cdt_canSignalAry))
+        return true;
+
+    static uint8_t BSS_P1(buf_)[CLG_BIN_MAX_SIZE_OF_SCHEMA_ENTRY];
+    bool isWritten = false;
+
+    /* The schema begins with magic and number of signals. */
+    if(pConn->idxSigSchema == 0u)
     {
-        pConn->stConn = stConn_closed;
-        pConn->pPcb = NULL;
-        pConn->noCharsTxLost = 0u;
-#if DBG_FEEDBACK_ON_SENT_DATA == 1
-        pConn->noCharsTx = 0u;
-#endif
-        pConn->noCharsRx = 0u;
+        unsigned int noSigs = 0u;
+        for(unsigned int idxSig=0u; idxSig<sizeOfAry(cdt_canSignalAry); ++idxSig)
+        {
+            if(cdt_canSignalAry[idxSig].isReceived)
+                ++ noSigs;
+        }
 
-        ++ pConn;
+        uint8_t *pWr = &buf_[0];
+        memcpy(pWr, CLG_BIN_MAGIC, sizeof(CLG_BIN_MAGIC)-1u);
+        pWr = putU16(pWr + sizeof(CLG_BIN_MAGIC)-1u, noSigs);
+        const unsigned int noBytes = (unsigned int)(pWr - &buf_[0]);
+        if(noBytes > tcp_sndbuf(pConn->pPcb))
+            return false;
+        if(!write(pConn, (const char*)buf_, noBytes, /*isMsgConst*/ false, /*flush*/ false))
+            return false;
+        isWritten = true;
+        pConn->idxSigSchema = 1u;
     }
 
+    while(pConn->idxSigSchema <= sizeOfAry(cdt_canSignalAry))
+    {
+        const unsigned int idxSig = pConn->idxSigSchema - 1u;
+        const cdt_canSignal_t * const pSig = &cdt_canSignalAry[idxSig];
+        if(pSig->isReceived)
+        {
+            assert(pSig->idxMsg < sizeOfAry(cdt_canRxMsgAry));
+            const cdt_canMessage_t * const pMsg = &cdt_canRxMsgAry[pSig->idxMsg];
+            uint32_t factor, offset;
+            _Static_assert(sizeof(factor) == sizeof(pSig->factor), "Bad float size");
+            memcpy(&factor, &pSig->factor, sizeof(factor));
+            memcpy(&offset, &pSig->offset, sizeof(offset));
+
+            uint8_t *pWr = &buf_[0];
+            pWr = putU16(pWr, idxSig);
+            pWr = putU32( pWr
+                        , (uint32_t)pMsg->canId | (pMsg->isExtId? 0x80000000u: 0u)
+                        );
+            pWr = putU8(pWr, (unsigned int)pSig->fieldType);
+            pWr = putU8(pWr, pSig->length);
+            pWr = putU32(pWr, factor);
+            pWr = putU32(pWr, offset);
+            pWr = putString(pWr, pMsg->name);
+            pWr = putString(pWr, pSig->name);
+            pWr = putString(pWr, pSig->unit);
+            const unsigned int noBytes = (unsigned int)(pWr - &buf_[0]);
+            assert(noBytes <= sizeof(buf_));
+
+            /* Try again in the next cycle if the entry doesn't fit. */
+            if(noBytes > tcp_sndbuf(pConn->pPcb))
+                break;
+            if(!write(pConn, (const char*)buf_, noBytes, /*isMsgConst*/ false, /*flush*/ false))
+                return false;
+            isWritten = true;
+        }
+        ++ pConn->idxSigSchema;
+    }
+
+    if(isWritten)
+        write(pConn, "", 0u, /* isMsgConst */ true, /* flush */ true);
+
+    return false;
+
+} /* writeBinarySchema */
+
+
+/**
+ * Core operation of the binary stream: Write a batch of records of all signals of all
+ * CAN messages, which have been received since the previous batch. If the batch doesn't
+ * fit into the send buffer then it is dropped and the gap in the sequence numbers of the
+ * batches will tell the receiver.
+ *   @param pConn
+ * The TCP connection by reference, which the batch is written into.
+ */
+static void streamCANRxSignalsBinary(struct tcpConn_t * const pConn)
+{
+    /* The stream begins with the schema. */
+    if(!writeBinarySchema(pConn))
+        return;
+
+    static uint8_t BSS_P1(batch_)[CLG_BIN_MAX_SIZE_OF_BATCH];
+    uint8_t *pWr = &batch_[CLG_BIN_SIZE_OF_BATCH_HDR];
+    unsigned int noRecords = 0u;
+
+    for(unsigned int idxMsg=0u; idxMsg<sizeOfAry(cdt_canRxMsgAry); ++idxMsg)
+    {
+        /* Get a consistent copy of the message, see reportCANRxSignals(). */
+        const cdt_canMessage_t * const pMsg = &cdt_canRxMsgAry[idxMsg];
+        assert(pMsg->pSnapshot != NULL);
+        static cdt_rxMsgSnapshotBuf_t SBSS_P1(msgCopy_);
+        msn_readSnapshot(pMsg->pSnapshot, &msgCopy_, pMsg->pSnapshot->sizeOfMsg);
+        const cap_infoTransmission_t * const pInfoTransmission =
+            (const cap_infoTransmission_t*)((const uint8_t*)&msgCopy_
+                                            + pMsg->offsetOfInfoTransmission
+                                           );
+        const unsigned int noRx = pInfoTransmission->noTransmittedMsgs;
+        if(noRx == pConn->noRxAtLastBatchAry[idxMsg])
+            continue;
+        pConn->noRxAtLastBatchAry[idxMsg] = noRx;
+
+        /* The signals of a PDU are a contiguous range in the table of all signals. */
+        assert(pMsg->idxFirstSignal + pMsg->noSignals <= sizeOfAry(cdt_canSignalAry));
+        for( unsigned int idxSig=pMsg->idxFirstSignal
+           ; idxSig<pMsg->idxFirstSignal+pMsg->noSignals
+           ; ++idxSig
+           )
+        {
+            const cdt_canSignal_t * const pSig = &cdt_canSignalAry[idxSig];
+            assert(pSig->isReceived  &&  pSig->idxMsg == idxMsg);
+            const uint64_t bin = getBinaryValue(pSig, &msgCopy_);
+            const unsigned int sizeOfValue = getSizeOfBinaryValue(pSig->fieldType);
+            assert(pWr + 2u + sizeOfValue <= &batch_[sizeof(batch_)]);
+            pWr = putU16(pWr, idxSig);
+            for(unsigned int idxByte=sizeOfValue; idxByte>0u; --idxByte)
+                pWr = putU8(pWr, (unsigned int)(bin >> (8u*(idxByte-1u))) & 0xFFu);
+            ++ noRecords;
+        }
+    } /* for(All received messages) */
+
+    if(noRecords == 0u)
+        return;
+
+    /* Complete the batch by its header. */
+    const unsigned int noBytes = (unsigned int)(pWr - &batch_[0]);
+    uint8_t *pHdr = &batch_[0];
+    pHdr = putU8(pHdr, CLG_BIN_TAG_BATCH);
+    pHdr = putU16(pHdr, noRecords);
+    pHdr = putU16(pHdr, pConn->seqNoBatch++);
+    pHdr = putU32(pHdr, sys_now());
+    assert(pHdr == &batch_[CLG_BIN_SIZE_OF_BATCH_HDR]);
+
+    if(noBytes <= tcp_sndbuf(pConn->pPcb))
+        write(pConn, (const char*)batch_, noBytes, /*isMsgConst*/ false, /*flush*/ true);
+    else if(pConn->noBatchesLost < UINT_MAX)
+        ++ pConn->noBatchesLost;
+
+} /* streamCANRxSignalsBinary */
+
+
+
+
+
+/**
+ * Start listening for connections with the CAN logger service at a given port.
+ *   @return
+ * Get \a true if the listener could be started. \a false will mostly be returned because
+ * of a lack of memory in the lwIP heap.
+ *   @param port
+ * The TCP port to listen at.
+ *   @param streamMode
+ * The output format of the connections accepted at \a port.
+ */
+static bool startListener(uint16_t port, clg_streamMode_t streamMode)
+{
     /* Create a new TCP PCB. The listen object lives forever in the heap. */
     struct tcp_pcb *pPcb = tcp_new();
     if(pPcb != NULL)
     {
         /* Bind the PCB to the specified TCP port. */
-        tcp_bind(pPcb, IP_ADDR_ANY, CLG_TCP_PORT_CAN_LOGGER);
+        tcp_bind(pPcb, IP_ADDR_ANY, port);
 
         /* Change TCP state to LISTEN. */
         struct tcp_pcb * const pPcbListen =
@@ -862,11 +1373,9 @@ bool clg_initCanLoggerTcp(void)
         if(pPcbListen != NULL)
             pPcb = pPcbListen;
 
-#ifdef DEBUG
-        /* We set the callback argument for the listen connection. This is just a test to
-           demonstrate the way the API works. We don't actually need this argument. */
-        tcp_arg(pPcb, /*arg*/ (void*)999);
-#endif
+        /* The callback argument of the listen connection tells the output format to the
+           accept callback. */
+        tcp_arg(pPcb, /*arg*/ (void*)(uintptr_t)streamMode);
 
         /* Set up onLwIPAcceptConnection() function to be called when a new connection
            arrives. */
@@ -877,6 +1386,37 @@ bool clg_initCanLoggerTcp(void)
     else
         return false;
 
+} /* startListener */
+
+
+/**
+ * The initialization function of the CAN logger service.
+ *   @return
+ * Get \a true if the service could be started. \a false will mostly be returned because of
+ * a lack of memory in the lwIP heap.
+ */
+bool clg_initCanLoggerTcp(void)
+{
+    _noTcpConn = 0u;
+
+    struct tcpConn_t *pConn = &_tcpConnAry[0];
+    for(unsigned int idxConn=0; idxConn<sizeOfAry(_tcpConnAry); ++idxConn)
+    {
+        pConn->stConn = stConn_closed;
+        pConn->pPcb = NULL;
+        pConn->noCharsTxLost = 0u;
+#if DBG_FEEDBACK_ON_SENT_DATA == 1
+        pConn->noCharsTx = 0u;
+#endif
+        pConn->noCharsRx = 0u;
+
+        ++ pConn;
+    }
+
+    /* The text and the binary service share the connection objects. */
+    return startListener(CLG_TCP_PORT_CAN_LOGGER, clg_streamMode_text)
+           &&  startListener(CLG_TCP_PORT_CAN_LOGGER_BINARY, clg_streamMode_binary);
+
 } /* clg_initCanLoggerTcp */
 
 
@@ -906,7 +1446,10 @@ void clg_mainFunction(void)
         {
             /* Inspect, which signals of interest have been received in the meantime and
                write new signal values into the TCP stream. */
-            reportCANRxSignals(pConn);
+            if(pConn->streamMode == clg_streamMode_binary)
+                streamCANRxSignalsBinary(pConn);
+            else
+                reportCANRxSignals(pConn);
 
         } /* if(Visited connection is open?) */
 
@@ -4,7 +4,7 @@
  * @file clg_canLoggerOnTCP.h
  * Definition of global interface of module clg_canLoggerOnTCP.c
  *
- * Copyright (C) 2023 Peter Vranken (mailto:Peter_Vranken@Yahoo.de)
+ * Copyright (C) 2023-2026 Peter Vranken (mailto:Peter_Vranken@Yahoo.de)
  *
  * This program is free software: you can redistribute it and/or modify it
  * under the terms of the GNU Lesser General Public License as published by the
@@ -34,8 +34,11 @@
     telnet. */
 #define CLG_TCP_PORT_CAN_LOGGER     1234u
 
+/** The binary mode of the CAN logger service is listening on this TCP port. */
+#define CLG_TCP_PORT_CAN_LOGGER_BINARY  1235u
+
 /** The maximum number of TCP/IP connections, which can be established with this service in
-    parallel. */
+    parallel. Text and binary connections are counted together. */
 #define CLG_MAX_NO_TCP_CONNECTIONS  3u
 
 
@@ -1,15 +1,33 @@
 /**
  * @file http_demoHttpServer.c
- * This is the simple HTTP server example from the lwIP manual. However, the manual is not
- * up-to-date any more and the API of lwIP has changed meanwhile. In this file, the code
- * from the manual has been migrated to the up-to--date API of lwIP 2.2.\n
- *   Try: curl http://192.168.1.200/get --output -\n
- * or directly use your browser.\n
- *   Please note that the implementation is for demonstration purposes only. In particular,
- * the error handling has not been elaborated; assertions have been used for unlikely yet
- * possible errors, where runtime error handling would be required. See comments below.
+ * A small HTTP/1.1 server, which serves a diagnostics dashboard of the DEVKIT-MPC5748G to
+ * a few clients at a time. The server originates from the simple HTTP server example from
+ * the lwIP manual but has been grown to a server for continuous use:\n
+ *   - All static responses, i.e., status line, header fields and body, are precomputed at
+ * compile time and located in flash ROM as contiguous blobs. The Content-Length header
+ * field of each blob is checked at compile time\n
+ *   - The static responses are sent without copying: lwIP chains the ROM blobs by
+ * reference to the segments' header pbufs and the Ethernet driver gathers them from
+ * flash, see LWIP_NETIF_TX_SINGLE_PBUF in lwipopts.h\n
+ *   - The only dynamic resource, the status object /status.json, is rendered into a
+ * per-connection buffer and copied by lwIP, TCP_WRITE_FLAG_COPY. The buffer can be reused
+ * as soon as lwIP has taken its contents\n
+ *   - Connections are persistent (HTTP/1.1 keep-alive) and pipelined requests are served
+ * in order. Each connection has a small queue of responses to send\n
+ *   - Requests are parsed byte-wise by a state machine, which doesn't require the request
+ * to be contained in a single pbuf or TCP segment. Received data is acknowledged to the
+ * peer only when it has been consumed, so that a client, which pipelines more requests
+ * than we can serve, is stopped by TCP flow control\n
+ *   - The send window is refilled from the sent callback, i.e., responses can be larger
+ * than the TCP send buffer\n
+ *   - Idle connections are closed after #HTTP_KEEP_ALIVE_TIMEOUT_MS. Connections in excess
+ * of #HTTP_MAX_NO_CONNECTIONS are rejected\n
+ *   Try: curl -v http://192.168.1.200/status.json http://192.168.1.200/status.json\n
+ * or point your browser to http://192.168.1.200/.\n
+ *   Only methods GET and HEAD are supported. Request bodies are not supported; a request
+ * with another method is answered with status 501 and the connection is closed.
  *
- * Copyright (C) 2023-2024 Peter Vranken (mailto:Peter_Vranken@Yahoo.de)
+ * Copyright (C) 2023-2026 Peter Vranken (mailto:Peter_Vranken@Yahoo.de)
  *
  * This program is free software: you can redistribute it and/or modify it
  * under the terms of the GNU Lesser General Public License as published by the
@@ -25,7 +43,25 @@
  * along with this program. If not, see <http://www.gnu.org/licenses/>.
  */
 /* Module interface
+ *   http_init
  * Local functions
+ *   findUnusedConnection
+ *   getIdxOfConnection
+ *   closeConnection
+ *   resetParser
+ *   appendToLine
+ *   findResponse
+ *   parseChar
+ *   renderStatus
+ *   enqueueResponse
+ *   flush
+ *   tryClose
+ *   serveConnection
+ *   http_err
+ *   http_recv
+ *   http_poll
+ *   http_sent
+ *   http_accept
  */
 
 /*
@@ -35,247 +71,1090 @@
 #include "http_demoHttpServer.h"
 
 #include <assert.h>
+#include <stddef.h>
 #include <stdio.h>
 #include <string.h>
+#include <ctype.h>
 
 #include "typ_types.h"
 #include "lwip/tcp.h"
-#include "stm_systemTimer.h"
+#include "lwip/sys.h"
+#include "lwip_lwIPMainFunction.h"
 #include "apt_applicationTask.h"
 #include "ats_accessTimeServer.h"
+#include "dlg_deferredLogging.h"
 
 /*
  * Defines
  */
 
+/** The TCP port, the server listens at. */
+#define HTTP_TCP_PORT                   80u
+
+/** The maximum number of responses, which can be queued for a connection. If a client
+    pipelines more requests then the further requests are parsed only after the oldest
+    response has been sent. */
+#define HTTP_MAX_NO_QUEUED_RESPONSES    4u
+
+/** The size of the buffer, which holds a line of the request while being parsed. Longer
+    lines are truncated; a truncated path will not be found. */
+#define HTTP_SIZE_OF_LINE_BUF           40u
+
+/** The size of the per-connection buffer for rendering the dynamic response. */
+#define HTTP_SIZE_OF_DYNAMIC_BUF        512u
+
+/** The space reserved at the beginning of the dynamic buffer for the response header. The
+    body is rendered behind this area and the header is placed right in front of the body,
+    such that header and body form a contiguous byte sequence. */
+#define HTTP_MAX_SIZE_OF_DYNAMIC_HEADER 128u
+
+/** The time span in ms without any traffic, after which an idle, persistent connection is
+    closed by the server. */
+#define HTTP_KEEP_ALIVE_TIMEOUT_MS      15000u
+
+/** If a connection doesn't make any progress for this time span in ms, e.g., because the
+    client doesn't read the response, then it is aborted. */
+#define HTTP_STALL_TIMEOUT_MS           30000u
+
+/** The interval of the lwIP poll callback in units of 500ms. */
+#define HTTP_POLL_INTERVAL              2u
+
+/** Stringize the value of a macro. */
+#define VAL2STR(s)                      ARG2STR_(s)
+#define ARG2STR_(s)                     #s
+
+/** The common part of all response headers. */
+#define RESPONSE_HEADER(status, contentType, lenBody)                                       \
+            "HTTP/1.1 " status "\r\n"                                                       \
+            "Server: DEVKIT-MPC5748G\r\n"                                                   \
+            "Content-Type: " contentType "\r\n"                                             \
+            "Content-Length: " VAL2STR(lenBody) "\r\n"
+
+/** A complete, precomputed response of a persistent connection. */
+#define RESPONSE(status, contentType, lenBody, body)                                        \
+            RESPONSE_HEADER(status, contentType, lenBody)                                   \
+            "\r\n"                                                                          \
+            body
+
+/** A complete, precomputed response, after which the server closes the connection. */
+#define RESPONSE_CLOSE(status, contentType, lenBody, body)                                  \
+            RESPONSE_HEADER(status, contentType, lenBody)                                   \
+            "Connection: close\r\n"                                                         \
+            "\r\n"                                                                          \
+            body
+
+/** Initializer expression of a struct response_t from a precomputed response. */
+#define RESPONSE_DESC(blob, lenBody, isLast)                                                \
+            { .pData = (blob)                                                               \
+            , .sizeOfResponse = sizeof(blob) - 1u                                           \
+            , .sizeOfHeader = sizeof(blob) - 1u - (lenBody)                                 \
+            , .isLastResponse = (isLast)                                                    \
+            }
+
+/** Compile time check of the Content-Length of a precomputed response. */
+#define CHECK_CONTENT_LENGTH(body, lenBody)                                                 \
+            _Static_assert( sizeof(body) - 1u == (lenBody)                                  \
+                          , "Content-Length doesn't match the body " #body                  \
+                          )
+
+/** The body of the dashboard page. It periodically fetches the status object and displays
+    all of its members in a table. */
+#define BODY_DASHBOARD                                                                      \
+            "<!DOCTYPE html><html><head><meta charset='utf-8'>"                             \
+            "<title>DEVKIT-MPC5748G</title>"                                                \
+            "<style>body{font-family:sans-serif}td{padding:2px 12px}</style>"               \
+            "</head><body><h3>DEVKIT-MPC5748G diagnostics</h3>"                             \
+            "<table id='t'></table><p id='e'></p>"                                          \
+            "<script>"                                                                      \
+            "function u(){fetch('/status.json').then(r=>r.json()).then(s=>{"                \
+            "let h='';for(const k in s)h+='<tr><td>'+k+'</td><td>'+s[k]+'</td></tr>';"      \
+            "document.getElementById('t').innerHTML=h;"                                     \
+            "document.getElementById('e').textContent='';"                                  \
+            "}).catch(x=>{document.getElementById('e').textContent='Board not reachable';});}" \
+            "u();setInterval(u,2000);"                                                      \
+            "</script></body></html>"
+#define LEN_BODY_DASHBOARD          581
+
+#define BODY_NOT_FOUND              "Not found\r\n"
+#define LEN_BODY_NOT_FOUND          11
+
+#define BODY_BAD_REQUEST            "Bad request\r\n"
+#define LEN_BODY_BAD_REQUEST        13
+
+#define BODY_NOT_IMPLEMENTED        "Not implemented\r\n"
+#define LEN_BODY_NOT_IMPLEMENTED    17
+
+#define BODY_VERSION_NOT_SUPPORTED  "HTTP version not supported\r\n"
+#define LEN_BODY_VERSION_NOT_SUPPORTED 28
+
 
 /*
  * Local type definitions
  */
 
+/** A response to a request. */
+struct response_t
+{
+    /** The response, status line, header and body, as contiguous byte sequence. NULL for
+        the dynamically rendered response. */
+    const char *pData;
+
+    /** The number of bytes of the entire response. */
+    uint16_t sizeOfResponse;
+
+    /** The number of bytes of status line and header, including the empty line. This is
+        the response to a HEAD request. */
+    uint16_t sizeOfHeader;
+
+    /** If \a true then the connection is closed after sending the response. */
+    bool isLastResponse;
+};
+
+/** An entry of the table of served resources. */
+struct route_t
+{
+    /** The path of the resource, as found in the request line. */
+    const char *path;
+
+    /** The response by reference. */
+    const struct response_t *pResponse;
+};
+
+/** The states of the request parser. */
+typedef enum stParser_t
+{
+    stParser_method,    /// Reading the method token of the request line.
+    stParser_path,      /// Reading the request target.
+    stParser_version,   /// Reading the protocol version.
+    stParser_header,    /// Reading the header fields up to the empty line.
+    stParser_discard,   /// The last response has been queued, further input is ignored.
+
+} stParser_t;
+
+/** The request methods distinguished by the server. */
+typedef enum method_t {method_get, method_head, method_other} method_t;
+
+/** A chunk of data in the send queue of a connection. */
+struct txChunk_t
+{
+    /** The next byte to hand over to lwIP. */
+    const char *pData;
+
+    /** The number of bytes, which have not yet been handed over to lwIP. */
+    uint16_t noBytes;
+
+    /** The chunk is the response in the dynamic buffer of the connection. */
+    bool isDynBuf;
+};
+
+/** The data object keeping all runtime information needed to handle a single connection
+    with the HTTP server. */
+struct httpConn_t
+{
+    /** The lwIP connection state. */
+    enum stConn_t {stConn_closed, stConn_established} stConn;
+
+    /** The lwIP connection object. */
+    struct tcp_pcb *pPcb;
+
+    /** The time of the last progress, received data or acknowledged data, in ms. */
+    uint32_t tiLastActivity;
+
+    /** The received data, which has not been consumed yet. */
+    struct pbuf *pPBufRx;
+
+    /** The number of bytes already consumed from the first pbuf in \a pPBufRx. */
+    uint16_t offsRx;
+
+    /** The peer has closed its sending direction. */
+    bool isPeerClosed;
+
+    /** The state of the request parser. */
+    stParser_t stParser;
+
+    /** The parsed request is complete and awaits queuing of its response. */
+    bool isRequestComplete;
+
+    /** The request method. */
+    method_t method;
+
+    /** The version of the request is HTTP/1.1 (or a later HTTP/1.x). */
+    bool isHttp11;
+
+    /** The client requested to close the connection after the response. */
+    bool isCloseRequested;
+
+    /** The response to the request, determined while parsing it. */
+    const struct response_t *pResponse;
+
+    /** The number of characters in \a lineBuf. */
+    uint8_t lenLine;
+
+    /** The currently parsed line of the request, or the currently parsed token of the
+        request line, respectively. Header lines are stored in lower case. */
+    char lineBuf[HTTP_SIZE_OF_LINE_BUF];
+
+    /** The queue of responses to send, ring buffer. */
+    struct txChunk_t txQueueAry[HTTP_MAX_NO_QUEUED_RESPONSES];
+
+    /** The index of the oldest queued chunk in \a txQueueAry. */
+    uint8_t idxTxQueueHead;
+
+    /** The number of chunks in \a txQueueAry. */
+    uint8_t noTxChunks;
+
+    /** The total number of bytes ever queued for sending. The counter wraps around. */
+    uint32_t noBytesQueued;
+
+    /** The total number of bytes acknowledged by the peer. The counter wraps around. */
+    uint32_t noBytesAcked;
+
+    /** The dynamic buffer contains a response, which has not been handed over to lwIP
+        completely yet. */
+    bool isDynBufInUse;
+
+    /** The buffer for rendering the dynamic response. */
+    char dynBuf[HTTP_SIZE_OF_DYNAMIC_BUF];
+};
+
 
 /*
  * Local prototypes
  */
 
+static void http_err(void *arg, err_t err);
+static err_t http_recv(void *arg, struct tcp_pcb *pPcb, struct pbuf *pPBuf, err_t err);
+static err_t http_poll(void *arg, struct tcp_pcb *pPcb);
+static err_t http_sent(void *arg, struct tcp_pcb *pPcb, u16_t len);
+
 
 /*
  * Data definitions
  */
 
+/** The dashboard page. */
+static const char RODATA(_responseDashboard)[] =
+    RESPONSE("200 OK", "text/html; charset=utf-8", LEN_BODY_DASHBOARD, BODY_DASHBOARD);
+static const struct response_t RODATA(_respDescDashboard) =
+    RESPONSE_DESC(_responseDashboard, LEN_BODY_DASHBOARD, false);
+CHECK_CONTENT_LENGTH(BODY_DASHBOARD, LEN_BODY_DASHBOARD);
+
+/** The response to an unknown path. */
+static const char RODATA(_responseNotFound)[] =
+    RESPONSE("404 Not Found", "text/plain", LEN_BODY_NOT_FOUND, BODY_NOT_FOUND);
+static const struct response_t RODATA(_respDescNotFound) =
+    RESPONSE_DESC(_responseNotFound, LEN_BODY_NOT_FOUND, false);
+CHECK_CONTENT_LENGTH(BODY_NOT_FOUND, LEN_BODY_NOT_FOUND);
+
+/** The response to a malformed request. */
+static const char RODATA(_responseBadRequest)[] =
+    RESPONSE_CLOSE("400 Bad Request", "text/plain", LEN_BODY_BAD_REQUEST, BODY_BAD_REQUEST);
+static const struct response_t RODATA(_respDescBadRequest) =
+    RESPONSE_DESC(_responseBadRequest, LEN_BODY_BAD_REQUEST, true);
+CHECK_CONTENT_LENGTH(BODY_BAD_REQUEST, LEN_BODY_BAD_REQUEST);
+
+/** The response to a request with unsupported method. The connection is closed, since we
+    can't tell whether the request has a body. */
+static const char RODATA(_responseNotImplemented)[] =
+    RESPONSE_CLOSE( "501 Not Implemented"
+                  , "text/plain"
+                  , LEN_BODY_NOT_IMPLEMENTED
+                  , BODY_NOT_IMPLEMENTED
+                  );
+static const struct response_t RODATA(_respDescNotImplemented) =
+    RESPONSE_DESC(_responseNotImplemented, LEN_BODY_NOT_IMPLEMENTED, true);
+CHECK_CONTENT_LENGTH(BODY_NOT_IMPLEMENTED, LEN_BODY_NOT_IMPLEMENTED);
+
+/** The response to a request of a protocol version other than HTTP/1.x. */
+static const char RODATA(_responseVersionNotSupported)[] =
+    RESPONSE_CLOSE( "505 HTTP Version Not Supported"
+                  , "text/plain"
+                  , LEN_BODY_VERSION_NOT_SUPPORTED
+                  , BODY_VERSION_NOT_SUPPORTED
+                  );
+static const struct response_t RODATA(_respDescVersionNotSupported) =
+    RESPONSE_DESC(_responseVersionNotSupported, LEN_BODY_VERSION_NOT_SUPPORTED, true);
+CHECK_CONTENT_LENGTH(BODY_VERSION_NOT_SUPPORTED, LEN_BODY_VERSION_NOT_SUPPORTED);
+
+/** The dynamic response, the status object. It is rendered on demand. */
+static const struct response_t RODATA(_respDescStatus) =
+    { .pData = NULL, .sizeOfResponse = 0u, .sizeOfHeader = 0u, .isLastResponse = false };
+
+/** The table of served resources. */
+static const struct route_t RODATA(_routeAry)[] =
+{
+    { .path = "/", .pResponse = &_respDescDashboard, },
+    { .path = "/index.html", .pResponse = &_respDescDashboard, },
+    { .path = "/status.json", .pResponse = &_respDescStatus, },
+};
+
+/** An array of all currently served TCP connections. */
+static struct httpConn_t DATA_P1(_httpConnAry)[HTTP_MAX_NO_CONNECTIONS];
+
+/** The number of currently open TCP connections. */
+static unsigned int SBSS_P1(_noHttpConn) = 0u;
+
+/** The number of accepted connections. */
+static unsigned int SBSS_P1(_noConnAccepted) = 0u;
+
+/** The number of connections rejected because of lack of resources. */
+static unsigned int SBSS_P1(_noConnRejected) = 0u;
+
+/** The number of answered requests. */
+static unsigned int SBSS_P1(_noRequests) = 0u;
+
 
 /*
  * Function implementation
  */
 
-/* This is the data for the actual web page. */
-static const char RODATA(htmlPage0)[] =
-    "HTTP/1.0 200 OK\r\n"
-    "Content-type: text/html\r\n"
-    "\r\n"
-    "<html>"
-      "<head>"
-        "<title>Hello from DEVKIT-MPC5748G</title>"
-        "<meta http-equiv=\"refresh\" content=\"10\">" /* Reload page every X s. */
-      "</head>"
-      "<body>"
-        "This is a small test page brought to you by DEVKIT-MPC5748G";
-static const char RODATA(htmlPage1)[] =
-        " at %s (%u)<p>"
-        "No. successful accesses of time service:\t%u<p>"
-        "No. failing accesses of time service:\t%u<p>";
-static const char RODATA(htmlPage2)[] =
-      "</body>"
-    "</html>";
-
-static void http_err(void *arg ATTRIB_UNUSED, err_t err)
+/**
+ * Helper: Find a free connection slot in \a _httpConnAry.
+ *   @return
+ * Get NULL or a slot in \a _httpConnAry, which is currently unused and can be used for a
+ * new connection.
+ */
+static struct httpConn_t *findUnusedConnection(void)
 {
-    iprintf( "http_err: Connection %p: Error %i received\r\n"
-           , arg
-           , (signed)err
-           );
-} /* http_err */
+    struct httpConn_t *pConn = &_httpConnAry[0];
+    for(unsigned int idxConn=0; idxConn<sizeOfAry(_httpConnAry); ++idxConn)
+    {
+        if(pConn->stConn == stConn_closed)
+        {
+            assert(_noHttpConn < HTTP_MAX_NO_CONNECTIONS);
+            return pConn;
+        }
+
+        ++ pConn;
+    }
+    assert(_noHttpConn == HTTP_MAX_NO_CONNECTIONS);
+    return NULL;
+
+} /* findUnusedConnection */
+
+
+/**
+ * Helper: Get the zero based index of a connection among all connections. Used only for
+ * console feedback.
+ *   @return
+ * Get the index in the range 0..(#HTTP_MAX_NO_CONNECTIONS-1).
+ *   @param pConn
+ * The connection object by reference.
+ */
+static inline unsigned int getIdxOfConnection(const struct httpConn_t * const pConn)
+{
+    return (unsigned int)(pConn - &_httpConnAry[0]);
+}
+
+
+/**
+ * When a TCP connection is closed, update our connection object accordingly, so that
+ * memory can be reused for a new TCP connection. Received but unconsumed data is released.
+ *   @param pConn
+ * The connection object by reference. After return, the pointer must no longer be used.
+ */
+static void closeConnection(struct httpConn_t * const pConn)
+{
+    assert(pConn->stConn != stConn_closed);
+    if(pConn->pPBufRx != NULL)
+    {
+        pbuf_free(pConn->pPBufRx);
+        pConn->pPBufRx = NULL;
+    }
+    pConn->stConn = stConn_closed;
+    pConn->pPcb = NULL;
+    -- _noHttpConn;
+    assert(_noHttpConn < HTTP_MAX_NO_CONNECTIONS);
 
+} /* closeConnection */
 
-/* This is the callback function that is called when a TCP segment has arrived in the
-   connection. */
-static err_t http_recv( void *arg ATTRIB_UNUSED
-                      , struct tcp_pcb *pcb
-                      , struct pbuf *p
-                      , err_t err ATTRIB_UNUSED
-                      )
+
+/**
+ * Prepare the parser of a connection for the next request.
+ *   @param pConn
+ * The connection object by reference.
+ */
+static void resetParser(struct httpConn_t * const pConn)
+{
+    pConn->stParser = stParser_method;
+    pConn->isRequestComplete = false;
+    pConn->method = method_other;
+    pConn->isHttp11 = false;
+    pConn->isCloseRequested = false;
+    pConn->pResponse = NULL;
+    pConn->lenLine = 0u;
+
+} /* resetParser */
+
+
+/**
+ * Append a character to the line buffer of a connection. The line is silently truncated if
+ * the buffer is full.
+ *   @param pConn
+ * The connection object by reference.
+ *   @param c
+ * The character.
+ */
+static inline void appendToLine(struct httpConn_t * const pConn, char c)
 {
-    assert(arg == (const void*)pcb);
+    if(pConn->lenLine < sizeof(pConn->lineBuf)-1u)
+        pConn->lineBuf[pConn->lenLine++] = c;
+}
+
 
-    /* If we got a NULL pbuf in p, the remote end has closed the connection. */
-    if(p != NULL)
+/**
+ * Look up the response to a requested path.
+ *   @return
+ * Get the response by reference. The 404 response is returned for an unknown path.
+ *   @param path
+ * The requested path as zero terminated string.
+ */
+static const struct response_t *findResponse(const char * const path)
+{
+    for(unsigned int idxRoute=0u; idxRoute<sizeOfAry(_routeAry); ++idxRoute)
     {
-        /* For acknowledge: Indicate to protocol stack that all received characters have
-           been consumed. */
-        tcp_recved(pcb, p->tot_len);
+        if(strcmp(path, _routeAry[idxRoute].path) == 0)
+            return _routeAry[idxRoute].pResponse;
+    }
+    return &_respDescNotFound;
+
+} /* findResponse */
+
+
+/**
+ * The request parser: Process the next received character.
+ *   @return
+ * Get \a true if the character completes a request. The response to the request has been
+ * determined and is found in the connection object.
+ *   @param pConn
+ * The connection object by reference.
+ *   @param c
+ * The received character.
+ */
+static bool parseChar(struct httpConn_t * const pConn, char c)
+{
+    switch(pConn->stParser)
+    {
+    case stParser_method:
+        if(c == ' ')
+        {
+            pConn->lineBuf[pConn->lenLine] = '\0';
+            if(strcmp(pConn->lineBuf, "GET") == 0)
+                pConn->method = method_get;
+            else if(strcmp(pConn->lineBuf, "HEAD") == 0)
+                pConn->method = method_head;
+            else
+                pConn->method = method_other;
+            pConn->lenLine = 0u;
+            pConn->stParser = stParser_path;
+        }
+        else if(c == '\r'  ||  c == '\n')
+        {
+            /* Empty lines preceding a request are ignored (RFC 7230, 3.5). A line break
+               inside the method token is a malformed request. */
+            if(pConn->lenLine > 0u)
+            {
+                pConn->pResponse = &_respDescBadRequest;
+                return true;
+            }
+        }
+        else
+            appendToLine(pConn, c);
+        break;
+
+    case stParser_path:
+        if(c == ' ')
+        {
+            pConn->lineBuf[pConn->lenLine] = '\0';
+            pConn->pResponse = findResponse(pConn->lineBuf);
+            pConn->lenLine = 0u;
+            pConn->stParser = stParser_version;
+        }
+        else if(c == '\r'  ||  c == '\n')
+        {
+            /* HTTP/0.9 style request without version. */
+            pConn->pResponse = &_respDescBadRequest;
+            return true;
+        }
+        else
+            appendToLine(pConn, c);
+        break;
+
+    case stParser_version:
+        if(c == '\n')
+        {
+            pConn->lineBuf[pConn->lenLine] = '\0';
+            if(strncmp(pConn->lineBuf, "HTTP/1.", 7u) == 0)
+            {
+                pConn->isHttp11 = strcmp(pConn->lineBuf, "HTTP/1.0") != 0;
+
+                /* HTTP/1.0 connections are not persistent. (We don't support the
+                   keep-alive extension of HTTP/1.0.) */
+                if(!pConn->isHttp11)
+                    pConn->isCloseRequested = true;
+            }
+            else if(strncmp(pConn->lineBuf, "HTTP/", 5u) == 0)
+                pConn->pResponse = &_respDescVersionNotSupported;
+            else
+                pConn->pResponse = &_respDescBadRequest;
 
-        /* The payload pointer in the pbuf contains the data in the TCP segment. */
-        const char * const rq = p->payload;
+            if(pConn->method == method_other  &&  !pConn->pResponse->isLastResponse)
+                pConn->pResponse = &_respDescNotImplemented;
+
+            pConn->lenLine = 0u;
+            pConn->stParser = stParser_header;
+        }
+        else if(c != '\r')
+            appendToLine(pConn, c);
+        break;
 
-        /* Check if the request was an HTTP "GET /\r\n". */
-        if(rq[0] == 'G'  &&  rq[1] == 'E'  &&  rq[2] == 'T'
-           && rq[3] == ' '  &&  rq[4] == '/'
-          )
+    case stParser_header:
+        if(c == '\n')
         {
-            char cmdBuf[128];
-            const uint16_t noCharsCopied = pbuf_copy_partial( p
-                                                            , cmdBuf
-                                                            , sizeof(cmdBuf)-1u
-                                                            , /*offsetInPBuf*/ 5u
-                                                            );
-            assert(noCharsCopied < sizeof(cmdBuf));
-            cmdBuf[noCharsCopied] = '\0';
-            iprintf("http_recv: HTTP request: %s\r\n", cmdBuf);
-
-            /* Send the web page to the remote host. A zero in the last argument of
-               tcp_write means that the data should not be copied into internal buffers.
-                 Note, placing the assertion "tcp_sndbuf(pcb) >= noChars" is wrong and just
-               meant for demonstrative purpose. If we can't currently send then we would
-               need to wait for a while and continue when some pbuf have been released.
-               This requires a more sophisticated state machine as we want to show here. */
-            iprintf("http_recv: Max sendable characters: %u\r\n", (unsigned)tcp_sndbuf(pcb));
-            uint16_t noChars = sizeof(htmlPage0);
-            assert(tcp_sndbuf(pcb) >= noChars);
-            err_t rc ATTRIB_DBG_ONLY = tcp_write( pcb
-                                                , htmlPage0
-                                                , noChars
-                                                , /*apiFlags*/ 0
-                                                );
-            assert(rc == ERR_OK);
-            unsigned int noTotalChars = noChars;
-
-            char msgTime[9];
-            apt_printCurrTime(msgTime, sizeof(msgTime));
-            char response[sizeof(htmlPage1)+30];
-            static unsigned int SBSS_P1(cnt_) = 0u;
-            snprintf( response
-                    , sizeof(response)
-                    , htmlPage1
-                    , msgTime
-                    , ++cnt_ 
-                    , ats_noSyncWithTimeServer
-                    , ats_noSyncWithHTTPHeader
-                    );
-            noChars = strlen(response);
-            assert(tcp_sndbuf(pcb) >= noChars);
-            rc = tcp_write( pcb
-                          , response
-                          , noChars
-                          , /*apiFlags*/ TCP_WRITE_FLAG_COPY
+            /* The empty line terminates the request. */
+            if(pConn->lenLine == 0u)
+                return true;
+
+            /* The only header field of interest is "Connection: close". */
+            pConn->lineBuf[pConn->lenLine] = '\0';
+            if(strncmp(pConn->lineBuf, "connection:", 11u) == 0
+               &&  strstr(&pConn->lineBuf[11], "close") != NULL
+              )
+            {
+                pConn->isCloseRequested = true;
+            }
+            pConn->lenLine = 0u;
+        }
+        else if(c != '\r')
+            appendToLine(pConn, (char)tolower((unsigned char)c));
+        break;
+
+    case stParser_discard:
+    default:
+        break;
+    }
+
+    return false;
+
+} /* parseChar */
+
+
+/**
+ * Render the status object, the dynamic response, into the dynamic buffer of a
+ * connection.
+ *   @return
+ * Get the response as contiguous byte sequence, header and body, by reference. It is
+ * located in \a pConn->dynBuf.
+ *   @param pConn
+ * The connection object by reference.
+ *   @param pSizeOfResponse
+ * The number of bytes of the response is returned by reference.
+ *   @param pSizeOfHeader
+ * The number of bytes of the header of the response is returned by reference.
+ */
+static const char *renderStatus( struct httpConn_t * const pConn
+                               , uint16_t * const pSizeOfResponse
+                               , uint16_t * const pSizeOfHeader
+                               )
+{
+    char msgTime[9];
+    apt_printCurrTime(msgTime, sizeof(msgTime));
+
+    char * const pBody = &pConn->dynBuf[HTTP_MAX_SIZE_OF_DYNAMIC_HEADER];
+    const unsigned int maxLenBody = sizeof(pConn->dynBuf) - HTTP_MAX_SIZE_OF_DYNAMIC_HEADER;
+    int lenBody = snprintf( pBody
+                          , maxLenBody
+                          , "{\"time\":\"%s\""
+                            ",\"noTimeSyncsWithTimeServer\":%u"
+                            ",\"noTimeSyncsWithHTTPHeader\":%u"
+                            ",\"noEthRxPolls\":%u"
+                            ",\"noEthRxFrames\":%u"
+                            ",\"maxNoEthRxFramesPerPoll\":%u"
+                            ",\"noEthRxBudgetExhausted\":%u"
+                            ",\"noEthRxTxCongested\":%u"
+                            ",\"noHttpConnections\":%u"
+                            ",\"noHttpConnectionsAccepted\":%u"
+                            ",\"noHttpConnectionsRejected\":%u"
+                            ",\"noHttpRequests\":%u"
+                            "}\r\n"
+                          , msgTime
+                          , ats_noSyncWithTimeServer
+                          , ats_noSyncWithHTTPHeader
+                          , lwip_noEthRxPolls
+                          , lwip_noEthRxFrames
+                          , lwip_maxNoEthRxFramesPerPoll
+                          , lwip_noEthRxBudgetExhausted
+                          , lwip_noEthRxTxCongested
+                          , _noHttpConn
+                          , _noConnAccepted
+                          , _noConnRejected
+                          , _noRequests
                           );
-            assert(rc == ERR_OK);
-            noTotalChars += noChars;
-
-            noChars = sizeof(htmlPage2);
-            assert(tcp_sndbuf(pcb) >= noChars);
-            tcp_write( pcb
-                     , htmlPage2
-                     , noChars
-                     , /*apiFlags*/ 0
-                     );
-            assert(rc == ERR_OK);
-            noTotalChars += noChars;
-
-            iprintf("http_recv: Sent %u Byte\r\n", noTotalChars);
+    assert(lenBody > 0  &&  (unsigned)lenBody < maxLenBody);
+    if(lenBody < 0)
+        lenBody = 0;
+    else if((unsigned)lenBody >= maxLenBody)
+        lenBody = (int)maxLenBody - 1;
+
+    char header[HTTP_MAX_SIZE_OF_DYNAMIC_HEADER+1u];
+    int lenHeader = snprintf( header
+                            , sizeof(header)
+                            , RESPONSE_HEADER("200 OK", "application/json", %u)
+                              "Cache-Control: no-store\r\n"
+                              "\r\n"
+                            , (unsigned)lenBody
+                            );
+    assert(lenHeader > 0  &&  (unsigned)lenHeader <= HTTP_MAX_SIZE_OF_DYNAMIC_HEADER);
+    if(lenHeader < 0)
+        lenHeader = 0;
+    else if((unsigned)lenHeader > HTTP_MAX_SIZE_OF_DYNAMIC_HEADER)
+        lenHeader = HTTP_MAX_SIZE_OF_DYNAMIC_HEADER;
+
+    char * const pResponse = pBody - lenHeader;
+    memcpy(pResponse, header, (unsigned)lenHeader);
+    *pSizeOfResponse = (uint16_t)(lenHeader + lenBody);
+    *pSizeOfHeader = (uint16_t)lenHeader;
+    return pResponse;
+
+} /* renderStatus */
+
+
+/**
+ * Queue the response to the completely parsed request.
+ *   @return
+ * Get \a true if the response could be queued. Get \a false if the queue is full or if
+ * the dynamic buffer is still occupied by the previous response, which lwIP has not
+ * copied completely yet; the request remains pending and the function needs to be called
+ * again later.
+ *   @param pConn
+ * The connection object by reference.
+ */
+static bool enqueueResponse(struct httpConn_t * const pConn)
+{
+    assert(pConn->isRequestComplete  &&  pConn->pResponse != NULL);
+
+    const struct response_t * const pResp = pConn->pResponse;
+    if(pConn->noTxChunks >= HTTP_MAX_NO_QUEUED_RESPONSES
+       ||  (pResp->pData == NULL  &&  pConn->isDynBufInUse)
+      )
+    {
+        return false;
+    }
+
+    const char *pData;
+    uint16_t sizeOfResponse
+           , sizeOfHeader;
+    if(pResp->pData != NULL)
+    {
+        pData = pResp->pData;
+        sizeOfResponse = pResp->sizeOfResponse;
+        sizeOfHeader = pResp->sizeOfHeader;
+    }
+    else
+        pData = renderStatus(pConn, &sizeOfResponse, &sizeOfHeader);
+
+    const uint16_t noBytes = pConn->method == method_head? sizeOfHeader: sizeOfResponse;
+    const unsigned int idxTail = (pConn->idxTxQueueHead + pConn->noTxChunks)
+                                 % HTTP_MAX_NO_QUEUED_RESPONSES;
+    pConn->txQueueAry[idxTail].pData = pData;
+    pConn->txQueueAry[idxTail].noBytes = noBytes;
+    pConn->txQueueAry[idxTail].isDynBuf = pResp->pData == NULL;
+    ++ pConn->noTxChunks;
+    pConn->noBytesQueued += noBytes;
+    if(pResp->pData == NULL)
+        pConn->isDynBufInUse = true;
+    ++ _noRequests;
+
+    const bool isLastResponse = pResp->isLastResponse  ||  pConn->isCloseRequested;
+    resetParser(pConn);
+    if(isLastResponse)
+        pConn->stParser = stParser_discard;
+
+    return true;
+
+} /* enqueueResponse */
+
+
+/**
+ * Hand the queued responses over to lwIP as far as the send buffer permits and initiate
+ * the transmission. The precomputed responses in ROM are passed by reference; they are
+ * constant and lwIP may refer to them until they are acknowledged. Only the response in
+ * the dynamic buffer is copied by lwIP; this buffer is no longer referenced once it has
+ * been written completely.
+ *   @return
+ * Get \a false if the connection had to be aborted because of an lwIP error. The
+ * connection object must no longer be used.
+ *   @param pConn
+ * The connection object by reference.
+ */
+static bool flush(struct httpConn_t * const pConn)
+{
+    bool isWritten = false;
+    err_t err = ERR_OK;
+    while(pConn->noTxChunks > 0u)
+    {
+        struct txChunk_t * const pChunk = &pConn->txQueueAry[pConn->idxTxQueueHead];
+        const uint16_t sizeOfSndBuf = (uint16_t)tcp_sndbuf(pConn->pPcb);
+        if(sizeOfSndBuf == 0u)
+            break;
+
+        const uint16_t noBytes = pChunk->noBytes <= sizeOfSndBuf? pChunk->noBytes
+                                                                 : sizeOfSndBuf;
+        const uint8_t apiFlags = (uint8_t)((noBytes < pChunk->noBytes
+                                            ||  pConn->noTxChunks > 1u
+                                            ? TCP_WRITE_FLAG_MORE
+                                            : 0u
+                                           )
+                                           | (pChunk->isDynBuf? TCP_WRITE_FLAG_COPY: 0u)
+                                          );
+        err = tcp_write(pConn->pPcb, pChunk->pData, noBytes, apiFlags);
+        if(err == ERR_MEM)
+        {
+            /* Out of pbufs or segments. We will retry on acknowledge or poll. */
+            err = ERR_OK;
+            break;
         }
+        else if(err != ERR_OK)
+            break;
 
-        /* Free the pbuf. */
-        pbuf_free(p);
+        isWritten = true;
+        pChunk->pData += noBytes;
+        pChunk->noBytes -= noBytes;
+        if(pChunk->noBytes == 0u)
+        {
+            if(pChunk->isDynBuf)
+                pConn->isDynBufInUse = false;
+            pConn->idxTxQueueHead = (pConn->idxTxQueueHead + 1u)
+                                    % HTTP_MAX_NO_QUEUED_RESPONSES;
+            -- pConn->noTxChunks;
+        }
     }
 
-    return ERR_OK;
+    if(err == ERR_OK  &&  isWritten)
+        err = tcp_output(pConn->pPcb);
 
-} /* http_recv */
+    if(err != ERR_OK)
+    {
+        DLG_LOG( "http: Error %i when writing into connection %u. Connection is aborted\r\n"
+               , (int)err
+               , getIdxOfConnection(pConn)
+               );
+
+        /* tcp_abort() invokes http_err(), which releases the connection object. */
+        tcp_abort(pConn->pPcb);
+        return false;
+    }
+
+    return true;
+
+} /* flush */
 
 
-/* This is the callback function that is called when no data has been transmitted in a
-   connection for a significant while. */
-static err_t http_idle(void *arg ATTRIB_UNUSED, struct tcp_pcb *pcb)
+/**
+ * Close a connection if no further request is going to be served and everything sent has
+ * been acknowledged by the peer.
+ *   @return
+ * Get \a true if the connection has been closed. The connection object must no longer be
+ * used.
+ *   @param pConn
+ * The connection object by reference.
+ */
+static bool tryClose(struct httpConn_t * const pConn)
 {
-    assert(arg == (const void*)pcb);
+    const bool isNoMoreRequest = pConn->stParser == stParser_discard
+                                 ||  (pConn->isPeerClosed
+                                      &&  pConn->pPBufRx == NULL
+                                      &&  !pConn->isRequestComplete
+                                     );
+    if(!isNoMoreRequest
+       ||  pConn->noTxChunks > 0u
+       ||  pConn->noBytesAcked != pConn->noBytesQueued
+      )
+    {
+        return false;
+    }
 
-    iprintf( "http_idle: Connection %p:%hu: Is idle and will be closed now\r\n"
-           , pcb
-           , pcb->remote_port
-           );
+    struct tcp_pcb * const pPcb = pConn->pPcb;
+    tcp_arg(pPcb, NULL);
+    tcp_recv(pPcb, NULL);
+    tcp_sent(pPcb, NULL);
+    tcp_poll(pPcb, NULL, 0u);
+    tcp_err(pPcb, NULL);
+    if(tcp_close(pPcb) != ERR_OK)
+    {
+        /* Out of memory; re-install the callbacks and retry on next poll. */
+        tcp_arg(pPcb, pConn);
+        tcp_recv(pPcb, http_recv);
+        tcp_sent(pPcb, http_sent);
+        tcp_poll(pPcb, http_poll, HTTP_POLL_INTERVAL);
+        tcp_err(pPcb, http_err);
+        return false;
+    }
 
-    /* Close the connection. */
-    const err_t rc ATTRIB_DBG_ONLY = tcp_close(pcb);
-    assert(rc == ERR_OK);
+    closeConnection(pConn);
+    return true;
 
-    return ERR_OK;
+} /* tryClose */
+
+
+/**
+ * Do all pending work of a connection: Parse the received data, queue the responses, send
+ * them and close the connection when done. Parsing stalls if the response queue is full;
+ * unparsed data is then not acknowledged to the peer, which throttles it.
+ *   @return
+ * Get \a false if the connection has been aborted. The callback needs to return ERR_ABRT
+ * to lwIP.
+ *   @param pConn
+ * The connection object by reference.
+ */
+static bool serveConnection(struct httpConn_t * const pConn)
+{
+    unsigned int noBytesConsumed = 0u;
+    while(true)
+    {
+        if(pConn->isRequestComplete  &&  !enqueueResponse(pConn))
+            break;
+
+        struct pbuf * const pPBuf = pConn->pPBufRx;
+        if(pPBuf == NULL)
+            break;
+
+        if(pConn->offsRx < pPBuf->len)
+        {
+            const char c = ((const char*)pPBuf->payload)[pConn->offsRx++];
+            ++ noBytesConsumed;
+            if(parseChar(pConn, c))
+                pConn->isRequestComplete = true;
+        }
+        else
+        {
+            /* The first pbuf of the chain is consumed, release it. */
+            pConn->pPBufRx = pbuf_free_header(pPBuf, pPBuf->len);
+            pConn->offsRx = 0u;
+        }
+    }
+
+    if(noBytesConsumed > 0u)
+        tcp_recved(pConn->pPcb, (u16_t)noBytesConsumed);
+
+    if(!flush(pConn))
+        return false;
 
-} /* http_idle */
+    tryClose(pConn);
+    return true;
 
+} /* serveConnection */
 
-/* This is the callback function that is called when some response bytes have been
-   transmitted. */
-static err_t http_sent(void *arg ATTRIB_UNUSED, struct tcp_pcb *pcb, u16_t len)
+
+/**
+ * lwIP error callback. It is called after a received connection reset or after a
+ * connection abort. lwIP has already deleted the PCB and we release the connection object.
+ *   @param arg
+ * The connection object by reference.
+ *   @param err
+ * The error code, which made the connection end.
+ */
+static void http_err(void *arg, err_t err)
 {
-    assert(arg == (const void*)pcb);
-    iprintf( "http_sent: Connection %p:%hu: %u Byte of response have been sent\r\n"
-           , pcb
-           , pcb->remote_port
-           , len
+    struct httpConn_t * const pConn = (struct httpConn_t *)arg;
+    DLG_LOG( "http_err: Connection %u: Error %i received. Connection is closed\r\n"
+           , getIdxOfConnection(pConn)
+           , (int)err
            );
+    closeConnection(pConn);
 
-    /* Close the connection. */
-    const err_t rc ATTRIB_DBG_ONLY = tcp_close(pcb);
-    assert(rc == ERR_OK);
+} /* http_err */
 
-    return ERR_OK;
+
+/**
+ * lwIP callback, which is called when a TCP segment has arrived in the connection.
+ *   @return
+ * Get ERR_OK or ERR_ABRT if the connection has been aborted.
+ *   @param arg
+ * The connection object by reference.
+ *   @param pPcb
+ * The lwIP connection object.
+ *   @param pPBuf
+ * The received data or NULL if the remote end has closed the connection.
+ *   @param err
+ * An error code. Only ERR_OK is expected.
+ */
+static err_t http_recv(void *arg, struct tcp_pcb *pPcb, struct pbuf *pPBuf, err_t err)
+{
+    struct httpConn_t * const pConn = (struct httpConn_t *)arg;
+    assert(pConn->pPcb == pPcb);
+
+    if(err != ERR_OK)
+    {
+        if(pPBuf != NULL)
+            pbuf_free(pPBuf);
+        tcp_abort(pPcb);
+        return ERR_ABRT;
+    }
+
+    if(pPBuf == NULL)
+        pConn->isPeerClosed = true;
+    else if(pConn->stParser == stParser_discard)
+    {
+        /* No further requests are served, the data is dropped. */
+        tcp_recved(pPcb, pPBuf->tot_len);
+        pbuf_free(pPBuf);
+    }
+    else if(pConn->pPBufRx == NULL)
+    {
+        pConn->pPBufRx = pPBuf;
+        pConn->offsRx = 0u;
+    }
+    else
+        pbuf_cat(pConn->pPBufRx, pPBuf);
+
+    pConn->tiLastActivity = sys_now();
+
+    return serveConnection(pConn)? ERR_OK: ERR_ABRT;
+
+} /* http_recv */
+
+
+/**
+ * lwIP callback, which is called every #HTTP_POLL_INTERVAL * 500ms. Writing and closing
+ * is retried if it had failed for lack of memory before and the keep-alive timeout is
+ * supervised.
+ *   @return
+ * Get ERR_OK or ERR_ABRT if the connection has been aborted.
+ *   @param arg
+ * The connection object by reference.
+ *   @param pPcb
+ * The lwIP connection object.
+ */
+static err_t http_poll(void *arg, struct tcp_pcb *pPcb)
+{
+    struct httpConn_t * const pConn = (struct httpConn_t *)arg;
+    assert(pConn->pPcb == pPcb);
+
+    const uint32_t tiIdle = sys_now() - pConn->tiLastActivity;
+    const bool isIdle = pConn->pPBufRx == NULL
+                        &&  !pConn->isRequestComplete
+                        &&  pConn->noTxChunks == 0u
+                        &&  pConn->noBytesAcked == pConn->noBytesQueued;
+    if(isIdle  &&  tiIdle >= HTTP_KEEP_ALIVE_TIMEOUT_MS)
+    {
+        /* Don't accept further requests. The connection is closed below. */
+        pConn->stParser = stParser_discard;
+    }
+    else if(!isIdle  &&  tiIdle >= HTTP_STALL_TIMEOUT_MS)
+    {
+        DLG_LOG( "http_poll: Connection %u doesn't make progress and is aborted\r\n"
+               , getIdxOfConnection(pConn)
+               );
+        tcp_abort(pPcb);
+        return ERR_ABRT;
+    }
+
+    return serveConnection(pConn)? ERR_OK: ERR_ABRT;
+
+} /* http_poll */
+
+
+/**
+ * lwIP callback, which is called when sent data has been acknowledged by the peer. The
+ * send buffer is refilled from the queued responses and parsing of pipelined requests is
+ * resumed if it had stalled.
+ *   @return
+ * Get ERR_OK or ERR_ABRT if the connection has been aborted.
+ *   @param arg
+ * The connection object by reference.
+ *   @param pPcb
+ * The lwIP connection object.
+ *   @param len
+ * The number of acknowledged bytes.
+ */
+static err_t http_sent(void *arg, struct tcp_pcb *pPcb, u16_t len)
+{
+    struct httpConn_t * const pConn = (struct httpConn_t *)arg;
+    assert(pConn->pPcb == pPcb);
+
+    pConn->noBytesAcked += len;
+    pConn->tiLastActivity = sys_now();
+    return serveConnection(pConn)? ERR_OK: ERR_ABRT;
 
 } /* http_sent */
 
 
-/* This is the callback function that is called when a connection has been accepted. */
-static err_t http_accept(void *arg ATTRIB_UNUSED, struct tcp_pcb *pcb, err_t err ATTRIB_UNUSED)
+/**
+ * lwIP callback, which is called when a connection has been accepted.
+ *   @return
+ * Get ERR_OK or ERR_ABRT if the connection has been rejected.
+ *   @param arg
+ * Not used.
+ *   @param pPcb
+ * The lwIP connection object of the new connection.
+ *   @param err
+ * An error code. Only ERR_OK is expected.
+ */
+static err_t http_accept(void *arg ATTRIB_UNUSED, struct tcp_pcb *pPcb, err_t err)
 {
-    /* We set the callback argument for this connection to the connection pointer itself;
-       this is useful to identify the connection even in the error callback. (Knowing well
-       that the pointer must not be used in that callback.) */
-    tcp_arg(pcb, /*arg*/ (void*)pcb);
+    if(err != ERR_OK  ||  pPcb == NULL)
+        return ERR_VAL;
 
-    /* Set up the function http_err() to be called upon a connection error. */
-    tcp_err(pcb, http_err);
+    struct httpConn_t * const pConn = findUnusedConnection();
+    if(pConn == NULL)
+    {
+        ++ _noConnRejected;
+        tcp_abort(pPcb);
+        return ERR_ABRT;
+    }
 
-    /* Set up the function http_recv() to be called when data arrives. */
-    tcp_recv(pcb, http_recv);
+    ++ _noHttpConn;
+    ++ _noConnAccepted;
+    memset(pConn, 0, offsetof(struct httpConn_t, dynBuf));
+    pConn->stConn = stConn_established;
+    pConn->pPcb = pPcb;
+    pConn->tiLastActivity = sys_now();
+    resetParser(pConn);
 
-    /* Set up the function http_sent() to be called when response data has been transmitted. */
-    tcp_sent(pcb, http_sent);
+    /* Responses are written completely at once and without delay, Nagle's algorithm would
+       only delay the next response in case of pipelining. */
+    tcp_nagle_disable(pPcb);
 
-    /* Set up the function http_idle() to be called while connection is idle. */
-    tcp_poll(pcb, http_idle, /*interval*/ 10u /*unit 500ms*/);
+    tcp_arg(pPcb, pConn);
+    tcp_err(pPcb, http_err);
+    tcp_recv(pPcb, http_recv);
+    tcp_sent(pPcb, http_sent);
+    tcp_poll(pPcb, http_poll, HTTP_POLL_INTERVAL);
 
-    static unsigned int SBSS_P1(noConn_) = 0u;
-    iprintf("http_accept: Connection %u: %p:%hu\r\n", ++noConn_, pcb, pcb->remote_port);
+    DLG_LOG( "http_accept: Connection %u: %p:%hu\r\n"
+           , getIdxOfConnection(pConn)
+           , pPcb
+           , pPcb->remote_port
+           );
 
     return ERR_OK;
 
 } /* http_accept */
 
 
-/* The initialization function. */
+/**
+ * Initialize the HTTP server. It starts listening for connections.
+ */
 void http_init(void)
 {
-    /* Create a new TCP PCB. */
-    struct tcp_pcb *pcb = tcp_new();
+    struct tcp_pcb *pPcb = tcp_new();
+    if(pPcb == NULL)
+        return;
 
-    /* Bind the PCB to TCP port 80. */
-    tcp_bind(pcb, IP_ADDR_ANY, 80);
+    if(tcp_bind(pPcb, IP_ADDR_ANY, HTTP_TCP_PORT) != ERR_OK)
+    {
+        tcp_close(pPcb);
+        return;
+    }
 
-    /* Change TCP state to LISTEN. */
-    struct tcp_pcb * const pcb_listen = tcp_listen(pcb);
-    if(pcb_listen != NULL)
-        pcb = pcb_listen;
+    struct tcp_pcb * const pPcbListen = tcp_listen(pPcb);
+    if(pPcbListen == NULL)
+    {
+        tcp_close(pPcb);
+        return;
+    }
 
-    /* Set up http_accept() function to be called when a new connection arrives. */
-    tcp_accept(pcb, http_accept);
+    tcp_accept(pPcbListen, http_accept);
 
-} /* http_init */
\ No newline at end of file
+} /* http_init */
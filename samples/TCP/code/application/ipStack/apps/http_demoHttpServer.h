@@ -4,7 +4,7 @@
  * @file http_demoHttpServer.h
  * Definition of global interface of module http_demoHttpServer.c
  *
- * Copyright (C) 2023 Peter Vranken (mailto:Peter_Vranken@Yahoo.de)
+ * Copyright (C) 2023-2026 Peter Vranken (mailto:Peter_Vranken@Yahoo.de)
  *
  * This program is free software: you can redistribute it and/or modify it
  * under the terms of the GNU Lesser General Public License as published by the
@@ -32,6 +32,10 @@
  * Defines
  */
 
+/** The maximum number of simultaneously served HTTP connections. Each connection occupies
+    about 700 Byte of RAM. Further connection requests are rejected. */
+#define HTTP_MAX_NO_CONNECTIONS     4u
+
 
 /*
  * Global type definitions
@@ -47,6 +51,7 @@
  * Global prototypes
  */
 
+/** Initialize the HTTP server and start listening for connections. */
 void http_init(void);
 
 
@@ -69,7 +69,7 @@ void ipa_initLwIPApplications(void)
     /* Initialize the TFTP server. */
     tftp_example_init_server();
 
-    /* Initialize the most simple HTTP server example from the lwIP manual. */
+    /* Initialize the HTTP server, which serves the diagnostics dashboard. */
     http_init();
 
 } /* ipa_initLwIPApplications */
@@ -0,0 +1,381 @@
+/**
+ * @file umt_udpMulticastTelemetry.c
+ * UDP multicast telemetry: All received CAN frames are published to an IPv4 multicast
+ * group, together with their reception time. Any number of subscribers can listen to the
+ * stream; the frames are encoded only once and a single datagram per clock tick of the
+ * publisher is sent, regardless of the number of subscribers.\n
+ *   The CAN frames are received in the CAN task. They are queued in a lock-free single
+ * producer, single consumer ring buffer and fetched by the IP task, which encodes all
+ * queued frames as a batch into one datagram. If the queue overflows then the frames are
+ * counted as lost. The number of lost frames is part of every datagram.\n
+ *   The sender doesn't need to be member of the multicast group. IGMP and the MAC filter
+ * of the Ethernet driver (see setMacFilterForIgmp()) are needed by the subscribers and the
+ * switches in between. The host tool umt_receiveTelemetry.c_ joins the group and prints
+ * the frames. Try:\n
+ *   ./umt_receiveTelemetry.exe\n
+ *   The format of the datagrams is specified below, see #UMT_MAGIC.
+ *
+ * Copyright (C) 2026 Peter Vranken (mailto:Peter_Vranken@Yahoo.de)
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+/* Module interface
+ *   umt_initUdpMulticastTelemetry
+ *   umt_onReceiveFrame
+ *   umt_mainFunction
+ * Local functions
+ *   putU16
+ *   putU32
+ *   sendDatagram
+ */
+
+/*
+ * Include files
+ */
+
+#include "umt_udpMulticastTelemetry.h"
+
+#include <assert.h>
+#include <string.h>
+
+#include "typ_types.h"
+#include "lwip/udp.h"
+#include "lwip/pbuf.h"
+#include "stm_systemTimer.h"
+#include "std_decoratedStorage.h"
+
+/*
+ * Defines
+ */
+
+/** The datagrams begin with these four characters, which identify the stream and its
+    version. All numbers in a datagram are in network byte order. The datagram consists
+    of a header and a sequence of frame records:\n
+      Header:\n
+        - 4 Byte: The magic "UMT1"\n
+        - 2 Byte: Sequence number of the datagram. It is incremented by one with each
+          datagram and wraps around. A gap indicates lost datagrams\n
+        - 2 Byte: The number of frame records in the datagram\n
+        - 4 Byte: The number of frames, which were lost in the publisher since start up,
+          because of an overflow of its queue. Wraps around\n
+        - 4 Byte: The time of sending in units of #STM_TIMER_1_PERIOD_IN_NS; wraps around\n
+      Frame record:\n
+        - 4 Byte: The time of reception in units of #STM_TIMER_1_PERIOD_IN_NS; wraps
+          around. Note, the time is taken when the CAN task processes the frame, not by the
+          CAN device\n
+        - 4 Byte: The CAN ID. Bit 31 is set for an extended ID\n
+        - 1 Byte: The zero based index of the CAN bus\n
+        - 1 Byte: The DLC, 0..8\n
+        - DLC Byte: The payload */
+#define UMT_MAGIC                   "UMT1"
+
+/** The size of the header of a datagram in Byte. */
+#define UMT_SIZE_OF_HEADER          16u
+
+/** The size of a frame record without payload in Byte. */
+#define UMT_SIZE_OF_FRAME_HEADER    10u
+
+/** The maximum size of a datagram, which fits into an Ethernet frame without IP
+    fragmentation. (MTU minus IP and UDP header.) */
+#define UMT_MAX_SIZE_OF_DATAGRAM    (1500u - 20u - 8u)
+
+/** Initializer expression of an lwIP IPv4 address from the comma separated list of its
+    bytes. The indirection expands #UMT_MULTICAST_GROUP before it is split into the four
+    arguments of IPADDR4_INIT_BYTES(). */
+#define GROUP_ADDR_INIT(addrBytes)  IPADDR4_INIT_BYTES(addrBytes)
+
+/** The size of the queue needs to be a power of two. The wrap around of the free running
+    indexes then doesn't harm. */
+_Static_assert( UMT_SIZE_OF_FRAME_QUEUE > 0u
+                &&  (UMT_SIZE_OF_FRAME_QUEUE & (UMT_SIZE_OF_FRAME_QUEUE-1u)) == 0u
+              , "Size of frame queue needs to be a power of two"
+              );
+
+/** A full queue of frames of maximum length will always fit into a single datagram. */
+_Static_assert( UMT_SIZE_OF_HEADER + UMT_SIZE_OF_FRAME_QUEUE*(UMT_SIZE_OF_FRAME_HEADER+8u)
+                <= UMT_MAX_SIZE_OF_DATAGRAM
+              , "Size of frame queue exceeds the capacity of a datagram"
+              );
+
+
+/*
+ * Local type definitions
+ */
+
+/** A received CAN frame, as queued for publication. */
+typedef struct frame_t
+{
+    /** The time of reception in units of #STM_TIMER_1_PERIOD_IN_NS. */
+    uint32_t tiRx;
+
+    /** The CAN ID. Bit 31 is set for an extended ID. */
+    uint32_t canId;
+
+    /** The bus index. */
+    uint8_t idxBus;
+
+    /** The number of payload bytes. */
+    uint8_t DLC;
+
+    /** The payload. */
+    uint8_t payload[8];
+
+} frame_t;
+
+
+/*
+ * Local prototypes
+ */
+
+
+/*
+ * Data definitions
+ */
+
+/** The queue of received, not yet published frames. */
+static frame_t BSS_P1(_frameQueueAry)[UMT_SIZE_OF_FRAME_QUEUE];
+
+/** The free running write index into the queue. Only written by the producer, the CAN
+    task. */
+static volatile uint32_t SBSS_P1(_idxWrQueue) = 0u;
+
+/** The free running read index into the queue. Only written by the consumer, the IP
+    task. */
+static volatile uint32_t SBSS_P1(_idxRdQueue) = 0u;
+
+/** The number of frames lost due to a queue overflow. Only written by the producer. */
+static volatile uint32_t SBSS_P1(_noFramesLost) = 0u;
+
+/** The sequence number of the next datagram. */
+static uint16_t SBSS_P1(_seqNo) = 0u;
+
+/** The number of datagrams, which couldn't be sent; for debugging only. */
+static unsigned int SBSS_P1(_noSendErrors) = 0u;
+
+/** The lwIP protocol control block of the publisher. NULL until successful
+    initialization. The producer doesn't queue frames as long as it is NULL. */
+static struct udp_pcb * volatile SBSS_P1(_pPcb) = NULL;
+
+
+/*
+ * Function implementation
+ */
+
+/**
+ * Serialization helper: Write a 16 Bit word in network byte order to a buffer.
+ *   @return
+ * Get the pointer behind the written bytes.
+ *   @param pWr
+ * The buffer position to write to.
+ *   @param w
+ * The word to write.
+ */
+static inline uint8_t *putU16(uint8_t *pWr, unsigned int w)
+{
+    *pWr++ = (uint8_t)(w >> 8);
+    *pWr++ = (uint8_t)w;
+    return pWr;
+}
+
+
+/**
+ * Serialization helper: Write a 32 Bit word in network byte order to a buffer.
+ *   @return
+ * Get the pointer behind the written bytes.
+ *   @param pWr
+ * The buffer position to write to.
+ *   @param w
+ * The word to write.
+ */
+static inline uint8_t *putU32(uint8_t *pWr, uint32_t w)
+{
+    pWr = putU16(pWr, (unsigned int)(w >> 16));
+    return putU16(pWr, (unsigned int)(w & 0xFFFFu));
+}
+
+
+/**
+ * Encode a number of queued frames into one datagram and send it to the multicast group.
+ *   @param idxRd
+ * The free running index of the first queued frame to publish.
+ *   @param noFrames
+ * The number of frames to publish. They need to fit into one datagram.
+ */
+static void sendDatagram(uint32_t idxRd, unsigned int noFrames)
+{
+    /* Determine the size of the datagram, such that the pbuf can be allocated in one
+       piece. */
+    unsigned int sizeOfDatagram = UMT_SIZE_OF_HEADER;
+    for(unsigned int u=0u; u<noFrames; ++u)
+    {
+        const frame_t * const pFrame = &_frameQueueAry[(idxRd+u) % UMT_SIZE_OF_FRAME_QUEUE];
+        sizeOfDatagram += UMT_SIZE_OF_FRAME_HEADER + pFrame->DLC;
+    }
+    assert(sizeOfDatagram <= UMT_MAX_SIZE_OF_DATAGRAM);
+
+    /* The sequence number is consumed even if the datagram can't be sent. This way, the
+       subscribers recognize the loss. */
+    const unsigned int seqNo = _seqNo++;
+
+    struct pbuf * const pPBuf = pbuf_alloc(PBUF_TRANSPORT, (u16_t)sizeOfDatagram, PBUF_RAM);
+    if(pPBuf == NULL)
+    {
+        ++ _noSendErrors;
+        return;
+    }
+    assert(pPBuf->len == pPBuf->tot_len);
+
+    uint8_t *pWr = (uint8_t*)pPBuf->payload;
+    memcpy(pWr, UMT_MAGIC, sizeof(UMT_MAGIC)-1u);
+    pWr += sizeof(UMT_MAGIC)-1u;
+    pWr = putU16(pWr, seqNo);
+    pWr = putU16(pWr, noFrames);
+    pWr = putU32(pWr, _noFramesLost);
+    pWr = putU32(pWr, stm_getSystemTime(/* idxStmTimer */ 1u));
+
+    for(unsigned int u=0u; u<noFrames; ++u)
+    {
+        const frame_t * const pFrame = &_frameQueueAry[(idxRd+u) % UMT_SIZE_OF_FRAME_QUEUE];
+        pWr = putU32(pWr, pFrame->tiRx);
+        pWr = putU32(pWr, pFrame->canId);
+        *pWr++ = pFrame->idxBus;
+        *pWr++ = pFrame->DLC;
+        memcpy(pWr, pFrame->payload, pFrame->DLC);
+        pWr += pFrame->DLC;
+    }
+    assert(pWr == (uint8_t*)pPBuf->payload + sizeOfDatagram);
+
+    static const ip_addr_t RODATA(groupAddr_) = GROUP_ADDR_INIT(UMT_MULTICAST_GROUP);
+    if(udp_sendto(_pPcb, pPBuf, &groupAddr_, UMT_UDP_PORT) != ERR_OK)
+        ++ _noSendErrors;
+
+    /* lwIP has taken its own reference to the pbuf if it is still needed for transmission. */
+    pbuf_free(pPBuf);
+
+} /* sendDatagram */
+
+
+
+/**
+ * The initialization function of the UDP multicast telemetry. It needs to be called once
+ * at system startup, after lwIP initialization and before the CAN task starts queueing
+ * frames.
+ *   @return
+ * Get \a true if the publisher could be created. Otherwise, all later calls of
+ * umt_onReceiveFrame() and umt_mainFunction() are ignored.
+ */
+bool umt_initUdpMulticastTelemetry(void)
+{
+    struct udp_pcb * const pPcb = udp_new_ip_type(IPADDR_TYPE_V4);
+    if(pPcb == NULL)
+        return false;
+
+    /* The local port is the same as the destination port; this makes the stream easy to
+       identify in a network trace. */
+    if(udp_bind(pPcb, IP4_ADDR_ANY, UMT_UDP_PORT) != ERR_OK)
+    {
+        udp_remove(pPcb);
+        return false;
+    }
+    udp_set_multicast_ttl(pPcb, UMT_MULTICAST_TTL);
+
+    /* The producer must not see the PCB before it is completely set up. */
+    std_fullMemoryBarrier();
+    _pPcb = pPcb;
+
+    return true;
+
+} /* umt_initUdpMulticastTelemetry */
+
+
+
+/**
+ * Queue a received CAN frame for publication. The function is called by the CAN task for
+ * every received frame. It is the single producer of the frame queue; it must not be
+ * called from different contexts.\n
+ *   The function doesn't block and has a constant, small execution time. If the queue is
+ * full then the frame is dropped and counted as lost.
+ *   @param idxBus
+ * The zero based index of the bus, which the frame has been received on.
+ *   @param canId
+ * The CAN ID of the frame.
+ *   @param isExtId
+ * \a true if \a canId is an extended ID.
+ *   @param payload
+ * The \a DLC bytes of the frame contents.
+ *   @param DLC
+ * The number of payload bytes, 0..8.
+ */
+void umt_onReceiveFrame( unsigned int idxBus
+                       , unsigned int canId
+                       , bool isExtId
+                       , const uint8_t payload[]
+                       , unsigned int DLC
+                       )
+{
+    if(_pPcb == NULL)
+        return;
+
+    assert(DLC <= 8u);
+    const uint32_t idxWr = _idxWrQueue;
+    if(idxWr - _idxRdQueue >= UMT_SIZE_OF_FRAME_QUEUE)
+    {
+        ++ _noFramesLost;
+        return;
+    }
+
+    frame_t * const pFrame = &_frameQueueAry[idxWr % UMT_SIZE_OF_FRAME_QUEUE];
+    pFrame->tiRx = stm_getSystemTime(/* idxStmTimer */ 1u);
+    pFrame->canId = (uint32_t)canId | (isExtId? 0x80000000u: 0u);
+    pFrame->idxBus = (uint8_t)idxBus;
+    pFrame->DLC = (uint8_t)DLC;
+    memcpy(pFrame->payload, payload, DLC);
+
+    /* The frame contents need to be complete in memory before the consumer can see the
+       moved write index. */
+    std_fullMemoryBarrier();
+    _idxWrQueue = idxWr + 1u;
+
+} /* umt_onReceiveFrame */
+
+
+
+/**
+ * The step function of the UDP multicast telemetry. It needs to be called regularly from
+ * the IP task. All frames, which have been queued since the previous call, are published
+ * in one datagram. Nothing is sent if no frame has been received.
+ */
+void umt_mainFunction(void)
+{
+    if(_pPcb == NULL)
+        return;
+
+    const uint32_t idxRd = _idxRdQueue
+                 , idxWr = _idxWrQueue;
+
+    /* The frame contents need to be read only after the write index. */
+    std_fullMemoryBarrier();
+
+    const unsigned int noFrames = (unsigned int)(idxWr - idxRd);
+    assert(noFrames <= UMT_SIZE_OF_FRAME_QUEUE);
+    if(noFrames > 0u)
+    {
+        sendDatagram(idxRd, noFrames);
+
+        /* The frame contents need to be completely read before the producer can overwrite
+           them. */
+        std_fullMemoryBarrier();
+        _idxRdQueue = idxWr;
+    }
+} /* umt_mainFunction */
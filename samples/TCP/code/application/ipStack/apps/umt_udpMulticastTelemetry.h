@@ -0,0 +1,89 @@
+#ifndef UMT_UDPMULTICASTTELEMETRY_INCLUDED
+#define UMT_UDPMULTICASTTELEMETRY_INCLUDED
+/**
+ * @file umt_udpMulticastTelemetry.h
+ * Definition of global interface of module umt_udpMulticastTelemetry.c
+ *
+ * Copyright (C) 2026 Peter Vranken (mailto:Peter_Vranken@Yahoo.de)
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Include files
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "typ_types.h"
+
+/*
+ * Defines
+ */
+
+/** The IPv4 multicast group, which the CAN frames are published to. The address is taken
+    from the organization-local scope 239.255.0.0/16, it is not routed beyond the local
+    site. The four bytes of the address are given as a comma separated list. */
+#define UMT_MULTICAST_GROUP             239,255,76,1
+
+/** The multicast group #UMT_MULTICAST_GROUP in dotted decimal notation. */
+#define UMT_MULTICAST_GROUP_STR         "239.255.76.1"
+
+/** The UDP port, which the CAN frames are published to. */
+#define UMT_UDP_PORT                    5800u
+
+/** The time-to-live of the published datagrams. 1 keeps the stream on the local subnet. */
+#define UMT_MULTICAST_TTL               1u
+
+/** The number of received CAN frames, which can be buffered between two clock ticks of
+    the publisher. Needs to be a power of two. */
+#define UMT_SIZE_OF_FRAME_QUEUE         64u
+
+
+/*
+ * Global type definitions
+ */
+
+
+/*
+ * Global data declarations
+ */
+
+
+/*
+ * Global prototypes
+ */
+
+/** The initialization function of the UDP multicast telemetry. */
+bool umt_initUdpMulticastTelemetry(void);
+
+/** Queue a received CAN frame for publication. */
+void umt_onReceiveFrame( unsigned int idxBus
+                       , unsigned int canId
+                       , bool isExtId
+                       , const uint8_t payload[]
+                       , unsigned int DLC
+                       );
+
+/** The step function of the UDP multicast telemetry. */
+void umt_mainFunction(void);
+
+
+/*
+ * Global inline functions
+ */
+
+
+#endif  /* UMT_UDPMULTICASTTELEMETRY_INCLUDED */
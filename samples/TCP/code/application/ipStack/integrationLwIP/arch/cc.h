@@ -38,6 +38,7 @@
 #include <assert.h>
 
 #include "lwipcfg.h"
+#include "ics_internetChecksum.h"
 
 #if defined(BYTE_ORDER)                 \
     || defined(LWIP_NO_STDDEF_H)        \
@@ -49,7 +50,9 @@
     || defined(PACK_STRUCT_Begin)       \
     || defined(PACK_STRUCT_END)         \
     || defined(LWIP_PLATFORM_DIAG)      \
-    || defined(LWIP_RAND)
+    || defined(LWIP_RAND)               \
+    || defined(LWIP_CHKSUM)             \
+    || defined(LWIP_CHKSUM_COPY)
 # error Conflicting configuration made at wrong code location
 #endif
 
@@ -128,6 +131,15 @@
 /** Define random number generator function of your system */
 #define LWIP_RAND() ((u32_t)rand())
 
+/** The Internet checksum routine. lwIP's generic implementation processes 16 Bit at a
+    time; the project's routine is tuned for the big-endian e200z4 and processes aligned
+    32 Bit words. */
+#define LWIP_CHKSUM ics_internetChecksum
+
+/** Copy data and compute the Internet checksum at the same time. Used by lwIP only if
+    #LWIP_CHECKSUM_ON_COPY is set. */
+#define LWIP_CHKSUM_COPY(dst, src, len) ics_internetChecksumCopy((dst), (src), (len))
+
 #define PPP_INCLUDE_SETTINGS_HEADER
 
 #endif /* LWIP_ARCH_CC_H */
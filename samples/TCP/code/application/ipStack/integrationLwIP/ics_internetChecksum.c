@@ -0,0 +1,260 @@
+/**
+ * @file ics_internetChecksum.c
+ * Internet checksum (RFC 1071) for lwIP, which is used in place of lwIP's generic,
+ * 16 Bit oriented implementation lwip_standard_chksum(). The implementation is configured
+ * in arch/cc.h, see macros LWIP_CHKSUM and LWIP_CHKSUM_COPY.\n
+ *   The data is summed up in aligned 32 Bit words into a 64 Bit accumulator. On the
+ * e200z4, the 64 Bit addition compiles into a pair of addc/adde, i.e., the carry out of
+ * the 32 Bit word sum is collected in the upper half of the accumulator and added back
+ * (end-around carry) only once, when folding the result to 16 Bit. The main loop is
+ * unrolled four times.\n
+ *   The Internet checksum doesn't depend on the byte order, if all 16 Bit words are read
+ * in the same, native byte order. The implementation reads the data in native byte order
+ * and returns the sum in the same representation as lwip_standard_chksum() does. On the
+ * big-endian PowerPC, this is the network byte order, no byte swapping is required. The
+ * same code yields correct results on a little-endian machine, which is exploited by the
+ * host test test_internetChecksum.c_.
+ *
+ * Copyright (C) 2026 Peter Vranken (mailto:Peter_Vranken@Yahoo.de)
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+/* Module interface
+ *   ics_internetChecksum
+ *   ics_internetChecksumCopy
+ * Local functions
+ *   sumAndCopy
+ */
+
+/*
+ * Include files
+ */
+
+#include "ics_internetChecksum.h"
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <assert.h>
+
+#include "typ_types.h"
+
+
+/*
+ * Defines
+ */
+
+
+/*
+ * Local type definitions
+ */
+
+/** The data is accessed through these types. They may alias any other type, which avoids
+    conflicts with the strict aliasing rules of C; lwIP passes arbitrary objects. */
+typedef uint32_t __attribute__((__may_alias__)) uint32Alias_t;
+typedef uint16_t __attribute__((__may_alias__)) uint16Alias_t;
+
+
+/*
+ * Local prototypes
+ */
+
+
+/*
+ * Data definitions
+ */
+
+
+/*
+ * Function implementation
+ */
+
+/**
+ * Compute the Internet checksum of a buffer and optionally copy it at the same time. The
+ * function is always inlined with a constant \a isCopy; it is the common implementation of
+ * the two external functions.
+ *   @return
+ * Get the non-inverted Internet checksum in native byte order, see ics_internetChecksum().
+ *   @param pDst
+ * The destination of the copy operation. Not used if \a isCopy is \a false. The address
+ * needs to have the same alignment modulo four as \a pSrc.
+ *   @param pSrc
+ * The data to sum up.
+ *   @param len
+ * The number of bytes at \a pSrc.
+ *   @param isCopy
+ * Whether to copy the data to \a pDst.
+ */
+static ALWAYS_INLINE uint16_t sumAndCopy( uint8_t *pDst
+                                        , const uint8_t *pSrc
+                                        , unsigned int len
+                                        , const bool isCopy
+                                        )
+{
+    assert(!isCopy  ||  (((uintptr_t)pDst ^ (uintptr_t)pSrc) & 3u) == 0u);
+
+    uint64_t sum = 0u;
+
+    /* An odd leading byte is summed as second byte of a 16 Bit word. The remaining data is
+       even aligned and the result is byte-swapped at the end. */
+    const bool isOdd = ((uintptr_t)pSrc & 1u) != 0u;
+    if(isOdd  &&  len > 0u)
+    {
+        uint16_t t = 0u;
+        ((uint8_t*)&t)[1] = *pSrc;
+        if(isCopy)
+            *pDst++ = *pSrc;
+        ++ pSrc;
+        sum += t;
+        -- len;
+    }
+
+    /* Get aligned to 32 Bit. */
+    if(((uintptr_t)pSrc & 2u) != 0u  &&  len >= 2u)
+    {
+        const uint16_t w = *(const uint16Alias_t*)pSrc;
+        if(isCopy)
+        {
+            *(uint16Alias_t*)pDst = w;
+            pDst += 2;
+        }
+        pSrc += 2;
+        sum += w;
+        len -= 2u;
+    }
+
+    /* The bulk of the data. */
+    const uint32Alias_t *pW = (const uint32Alias_t*)pSrc;
+    uint32Alias_t *pWDst = (uint32Alias_t*)pDst;
+    while(len >= 16u)
+    {
+        const uint32_t w0 = pW[0]
+                     , w1 = pW[1]
+                     , w2 = pW[2]
+                     , w3 = pW[3];
+        if(isCopy)
+        {
+            pWDst[0] = w0;
+            pWDst[1] = w1;
+            pWDst[2] = w2;
+            pWDst[3] = w3;
+            pWDst += 4;
+        }
+        sum += w0;
+        sum += w1;
+        sum += w2;
+        sum += w3;
+        pW += 4;
+        len -= 16u;
+    }
+    while(len >= 4u)
+    {
+        const uint32_t w = *pW++;
+        if(isCopy)
+            *pWDst++ = w;
+        sum += w;
+        len -= 4u;
+    }
+
+    /* Trailing bytes. A single last byte is summed as first byte of a 16 Bit word. */
+    pSrc = (const uint8_t*)pW;
+    pDst = (uint8_t*)pWDst;
+    if(len >= 2u)
+    {
+        const uint16_t w = *(const uint16Alias_t*)pSrc;
+        if(isCopy)
+        {
+            *(uint16Alias_t*)pDst = w;
+            pDst += 2;
+        }
+        pSrc += 2;
+        sum += w;
+        len -= 2u;
+    }
+    if(len > 0u)
+    {
+        uint16_t t = 0u;
+        ((uint8_t*)&t)[0] = *pSrc;
+        if(isCopy)
+            *pDst = *pSrc;
+        sum += t;
+    }
+
+    /* Fold the sum to 16 Bit, adding the carries back in. */
+    sum = (sum & 0xFFFFFFFFu) + (sum >> 32);
+    sum = (sum & 0xFFFFFFFFu) + (sum >> 32);
+    uint32_t sum32 = (uint32_t)sum;
+    sum32 = (sum32 & 0xFFFFu) + (sum32 >> 16);
+    sum32 = (sum32 & 0xFFFFu) + (sum32 >> 16);
+    assert(sum32 <= 0xFFFFu);
+
+    /* Swap if alignment was odd. */
+    if(isOdd)
+        sum32 = ((sum32 & 0xFFu) << 8) | (sum32 >> 8);
+
+    return (uint16_t)sum32;
+
+} /* sumAndCopy */
+
+
+
+/**
+ * Compute the Internet checksum of a buffer. The function is a plug-in replacement for
+ * lwIP's lwip_standard_chksum().
+ *   @return
+ * Get the one's complement sum of all 16 Bit words of the data; the sum is not inverted.
+ * The sum is returned in native byte order, i.e., in the same representation as it would
+ * have in the data buffer. (The byte order of the data is considered as network byte order
+ * on both, big- and little-endian machines.)
+ *   @param pData
+ * The data to sum up. Any alignment is permitted, but the best performance is achieved
+ * for four Byte aligned data.
+ *   @param len
+ * The number of bytes at \a pData. A non-positive value yields a sum of zero.
+ */
+uint16_t ics_internetChecksum(const void *pData, int len)
+{
+    if(len <= 0)
+        return 0u;
+    return sumAndCopy(NULL, (const uint8_t*)pData, (unsigned int)len, /* isCopy */ false);
+
+} /* ics_internetChecksum */
+
+
+
+/**
+ * Copy a buffer and compute its Internet checksum at the same time. The function is a
+ * plug-in replacement for lwIP's lwip_chksum_copy(). The data is read only once, which
+ * saves memory bandwidth. This requires that source and destination have the same
+ * alignment modulo four; otherwise the function falls back to copying first and summing
+ * up the copy.
+ *   @return
+ * Get the non-inverted Internet checksum of the data, see ics_internetChecksum().
+ *   @param pDst
+ * The destination of the copy operation. The memory areas must not overlap.
+ *   @param pSrc
+ * The data to copy and sum up.
+ *   @param len
+ * The number of bytes to copy.
+ */
+uint16_t ics_internetChecksumCopy(void *pDst, const void *pSrc, uint16_t len)
+{
+    if((((uintptr_t)pDst ^ (uintptr_t)pSrc) & 3u) == 0u)
+        return sumAndCopy((uint8_t*)pDst, (const uint8_t*)pSrc, len, /* isCopy */ true);
+    else
+    {
+        memcpy(pDst, pSrc, len);
+        return ics_internetChecksum(pDst, (int)len);
+    }
+} /* ics_internetChecksumCopy */
@@ -0,0 +1,61 @@
+#ifndef ICS_INTERNETCHECKSUM_INCLUDED
+#define ICS_INTERNETCHECKSUM_INCLUDED
+/**
+ * @file ics_internetChecksum.h
+ * Definition of global interface of module ics_internetChecksum.c
+ *
+ * Copyright (C) 2026 Peter Vranken (mailto:Peter_Vranken@Yahoo.de)
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Include files
+ */
+
+#include <stdint.h>
+
+
+/*
+ * Defines
+ */
+
+
+/*
+ * Global type definitions
+ */
+
+
+/*
+ * Global data declarations
+ */
+
+
+/*
+ * Global prototypes
+ */
+
+/** The Internet checksum (non-inverted) of a buffer; to be used as lwIP's LWIP_CHKSUM. */
+uint16_t ics_internetChecksum(const void *pData, int len);
+
+/** Copy a buffer and compute its Internet checksum; to be used as lwIP's LWIP_CHKSUM_COPY. */
+uint16_t ics_internetChecksumCopy(void *pDst, const void *pSrc, uint16_t len);
+
+
+/*
+ * Global inline functions
+ */
+
+
+#endif  /* ICS_INTERNETCHECKSUM_INCLUDED */
@@ -37,6 +37,8 @@
 /* Module interface
  *   lwip_initIPStack
  *   lwip_ethIfPollAllInterfaces
+ *   lwip_ethIfIsRxPollPending
+ *   lwip_ethIfIsTxCongested
  *   lwip_onEthBufferTxComplete
  *   lwip_onTimerTick
  * Local functions
@@ -166,6 +168,30 @@
  * Data definitions
  */
  
+/** A status counter. The number of calls of lwip_ethIfPollAllInterfaces() so far. */
+volatile unsigned int SBSS_P1(lwip_noEthRxPolls) = 0u;
+
+/** A status counter. The total number of Rx frames, which were fetched from the Ethernet
+    driver by lwip_ethIfPollAllInterfaces() so far. The ratio with \a lwip_noEthRxPolls is
+    the average number of frames per poll. */
+volatile unsigned int SBSS_P1(lwip_noEthRxFrames) = 0u;
+
+/** A status counter. The maximum number of Rx frames, which were fetched by a single call
+    of lwip_ethIfPollAllInterfaces(). */
+volatile unsigned int SBSS_P1(lwip_maxNoEthRxFramesPerPoll) = 0u;
+
+/** A status counter. The number of times, a network interface still had received frames
+    when its budget of #LWIP_ETH_RX_BUDGET frames per poll was exhausted. */
+volatile unsigned int SBSS_P1(lwip_noEthRxBudgetExhausted) = 0u;
+
+/** A status counter. The number of times, a network interface was not polled at all,
+    because the Tx pbuf queue had no free element besides #LWIP_ETH_TX_RESERVE. */
+volatile unsigned int SBSS_P1(lwip_noEthRxTxCongested) = 0u;
+
+/** At least one network interface still has received frames, which could not be processed
+    in the most recent poll because of the budget. */
+static bool SBSS_P1(_isEthRxPollPending) = false;
+
  
 /*
  * Function implementation
@@ -608,13 +634,29 @@ void lwip_initIPStack(void)
 
 
 /**
- * This function polls the Ethernet driver on all configured devices for all meanwhile
- * received frame and forwards them to lwIP in case.\n
+ * This function polls the Ethernet driver on all configured devices for meanwhile
+ * received frames and forwards them to lwIP in case.\n
  *   This is the major API of the lwIP stack to keep it running. The function shall be
  * called from the integrating code either regularly or when the Ethernet driver notifies
  * the reception of a new frame. The latter option is preferred. The former option actually
  * means polling and requires the Ethernet driver to have enough buffer space for storing
- * all frames potentially arriving within the polling cycle time.
+ * all frames potentially arriving within the polling cycle time.\n
+ *   The number of frames, which are processed per device and call, is limited to
+ * #LWIP_ETH_RX_BUDGET. A high Rx frame rate, e.g., a broadcast storm, can therefore not
+ * starve other tasks. If the budget is exhausted, then the remaining frames stay in the
+ * Rx ring of the driver, lwip_ethIfIsRxPollPending() will return \a true and the
+ * integrating code should call this function again as soon as possible, e.g., by
+ * triggering its task once more after serving other pending work. Frames, which arrive
+ * meanwhile, are dropped by the Ethernet device if the ring is full.\n
+ *   The budget is further limited to the number of free elements in the Tx pbuf queue,
+ * less #LWIP_ETH_TX_RESERVE. A received frame will mostly be answered by one Tx frame and
+ * a peer, which sends requests faster than the link can carry the responses, would
+ * otherwise let the queue overflow and the responses were lost. The frames are rather
+ * held back in the Rx ring until Tx complete events make room in the queue, see
+ * lwip_ethIfIsTxCongested().\n
+ *   If the Ethernet driver is configured for interrupt mitigation
+ * (#ETH_RX_INTERRUPT_MITIGATION), then the frame Rx interrupt is re-enabled only when a
+ * device's Rx ring has been drained.
  *   @return
  * The number of Rx frames, which were fetched from the driver and passed to lwIP is
  * returned.
@@ -627,25 +669,110 @@ void lwip_initIPStack(void)
 unsigned int lwip_ethIfPollAllInterfaces(void)
 {
     unsigned int noRxFrames = 0u;
+    bool isAnyRxPollPending = false;
     for(unsigned int idxIf=0u; idxIf<sizeOfAry(_netIfAry); ++idxIf)
     {
-        /* Poll the device for all meanwhile received Rx frames. */
-        while(true)
+        /* The budget of the device: The configured one but not more than there is room
+           for the responses in the Tx pbuf queue, which is shared by all devices. */
+        const unsigned int noFreeTxElems = nif_queueTxPBuf_getNoFreeElems();
+        unsigned int budget = noFreeTxElems > LWIP_ETH_TX_RESERVE
+                              ? noFreeTxElems - LWIP_ETH_TX_RESERVE
+                              : 0u;
+        if(LWIP_ETH_RX_BUDGET > 0u  &&  budget > LWIP_ETH_RX_BUDGET)
+            budget = LWIP_ETH_RX_BUDGET;
+
+        /* Poll the device for meanwhile received Rx frames, until its ring is drained or
+           its budget is exhausted. */
+        unsigned int noRxFramesIf = 0u;
+        bool isRingDrained = false;
+        while(noRxFramesIf < budget)
         {
+            unsigned int maxNoFrames = ETH_MAX_NO_RX_FRAMES_PER_READ;
+            if(budget - noRxFramesIf < maxNoFrames)
+                maxNoFrames = budget - noRxFramesIf;
+
             bool noRxFrameAnymore;
-            nif_processPendingEthRxFrame(&_netIfAry[idxIf], &noRxFrameAnymore);
+            noRxFramesIf += nif_processPendingEthRxFrames( &_netIfAry[idxIf]
+                                                         , maxNoFrames
+                                                         , &noRxFrameAnymore
+                                                         );
             if(noRxFrameAnymore)
+            {
+#if ETH_RX_INTERRUPT_MITIGATION == 1
+                /* Re-enabling the interrupt fails if another frame has been received
+                   after we saw the ring empty. We need to continue polling in this
+                   case. */
+                if(eth_enableRxInterrupt(/* idxEthDev */ _netIfAry[idxIf].num))
+                {
+                    isRingDrained = true;
+                    break;
+                }
+#else
+                isRingDrained = true;
                 break;
-            else
-                ++ noRxFrames;
+#endif
+            }
+        } /* while(Budget of device not exhausted) */
+
+        if(budget == 0u)
+        {
+            /* The device has not been polled at all because of Tx congestion. Its ring
+               may or may not hold frames; we need to come back. */
+            ++ lwip_noEthRxTxCongested;
+            isAnyRxPollPending = true;
         }
-    }
-    
+        else if(!isRingDrained)
+        {
+            ++ lwip_noEthRxBudgetExhausted;
+            isAnyRxPollPending = true;
+        }
+        noRxFrames += noRxFramesIf;
+
+    } /* for(All network interfaces) */
+
+    _isEthRxPollPending = isAnyRxPollPending;
+
+    ++ lwip_noEthRxPolls;
+    lwip_noEthRxFrames += noRxFrames;
+    if(noRxFrames > lwip_maxNoEthRxFramesPerPoll)
+        lwip_maxNoEthRxFramesPerPoll = noRxFrames;
+
     return noRxFrames;
 
 } /* lwip_ethIfPollAllInterfaces */
 
 
+
+/**
+ * Query whether the most recent call of lwip_ethIfPollAllInterfaces() exhausted the budget
+ * of at least one network interface, such that received frames are still waiting for
+ * processing.
+ *   @return
+ * Get \a true if lwip_ethIfPollAllInterfaces() should be called again, even if there's no
+ * new frame Rx notification from the Ethernet driver.
+ */
+bool lwip_ethIfIsRxPollPending(void)
+{
+    return _isEthRxPollPending;
+
+} /* lwip_ethIfIsRxPollPending */
+
+
+/**
+ * Query whether the Tx pbuf queue is that full, that lwip_ethIfPollAllInterfaces() won't
+ * fetch any pending Rx frame, see #LWIP_ETH_TX_RESERVE. If so, the integrating code should
+ * not continue polling immediately but wait for the next Tx complete notification; the
+ * Ethernet driver sends the queued frames only at the speed of the link.
+ *   @return
+ * Get \a true if the Tx pbuf queue has no free element besides the reserve.
+ */
+bool lwip_ethIfIsTxCongested(void)
+{
+    return nif_queueTxPBuf_getNoFreeElems() <= LWIP_ETH_TX_RESERVE;
+
+} /* lwip_ethIfIsTxCongested */
+
+
 /**
  * This function checks the Tx queue for frames (or fragments of such), which have been
  * submitted for transmission on the Ethernet bus but which have not been handed over to
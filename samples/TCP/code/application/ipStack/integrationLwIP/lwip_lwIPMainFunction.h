@@ -25,12 +25,25 @@
  */
 
 #include "typ_types.h"
+#include "eth_ethernet.h"
 
 
 /*
  * Defines
  */
 
+/** The budget of lwip_ethIfPollAllInterfaces(): The maximum number of received Ethernet
+    frames, which are fetched from the driver and processed per network interface and
+    call. The remaining frames are processed in later calls. Use 0 to fetch all frames
+    until the Rx ring is drained. The default of one ring of Rx buffers lets other tasks
+    on the same core run even under a broadcast storm. */
+#define LWIP_ETH_RX_BUDGET      ETH_ENET0_RING0_NO_RXBD
+
+/** The number of elements of the Tx pbuf queue, which lwip_ethIfPollAllInterfaces() keeps
+    free for frames, which are not a response to a received frame, e.g., sent by timers
+    of lwIP or by the applications. */
+#define LWIP_ETH_TX_RESERVE     4u
+
 
 /*
  * Global type definitions
@@ -41,6 +54,22 @@
  * Global data declarations
  */
 
+/** Status counter: The number of calls of lwip_ethIfPollAllInterfaces() so far. */
+extern volatile unsigned int lwip_noEthRxPolls;
+
+/** Status counter: The total number of Rx frames fetched by lwip_ethIfPollAllInterfaces(). */
+extern volatile unsigned int lwip_noEthRxFrames;
+
+/** Status counter: The maximum number of Rx frames fetched by a single poll. */
+extern volatile unsigned int lwip_maxNoEthRxFramesPerPoll;
+
+/** Status counter: The number of times, the budget of a network interface was exhausted. */
+extern volatile unsigned int lwip_noEthRxBudgetExhausted;
+
+/** Status counter: The number of times, a network interface was not polled because of Tx
+    congestion. */
+extern volatile unsigned int lwip_noEthRxTxCongested;
+
 
 /*
  * Global prototypes
@@ -52,6 +81,12 @@ void lwip_initIPStack(void);
 /** Poll Ethernet driver for meanwhile received Rx frames. */
 unsigned int lwip_ethIfPollAllInterfaces(void);
 
+/** Are there received frames left over from the most recent poll? */
+bool lwip_ethIfIsRxPollPending(void);
+
+/** Is the Tx pbuf queue too full for fetching more Rx frames? */
+bool lwip_ethIfIsTxCongested(void);
+
 /** Acknowledge the completed transmissin of a Tx frame to lwIP. */
 void lwip_onEthBufferTxComplete(void);
 
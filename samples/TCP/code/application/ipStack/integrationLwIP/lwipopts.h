@@ -673,10 +673,14 @@
  * structure, which all together define a single Ethernet packet.\n
  *   The Ethernet device of the MPC5748G, ENET, supports lists of data blocks for a single
  * Ethernet packet, its DMA iterates the data blocks successively to fill the packet
- * before sending. Unfortunately, our driver doesn't support this mode, yet. We need to
- * enable content copying by SW.
- */
-#define LWIP_NETIF_TX_SINGLE_PBUF       1
+ * before sending. Our driver maps each element of a pbuf chain onto a buffer descriptor
+ * of its own, see eth_sendFrames(), and the network interface copies only a chain, which
+ * has more elements than the Tx ring has descriptors, see sendPBufAsEthFrame().
+ * Therefore, we don't let lwIP copy: tcp_write() without #TCP_WRITE_FLAG_COPY chains the
+ * application's data by reference to the segment's header pbuf. The application must not
+ * modify such data until it is acknowledged.
+ */
+#define LWIP_NETIF_TX_SINGLE_PBUF       0
 
 /**
  * LWIP_NUM_NETIF_CLIENT_DATA: Number of clients that may store
@@ -0,0 +1,551 @@
+/**
+ * @file lws_lwIPStatistics.c
+ * Memory usage statistics of the lwIP integration. The size of the lwIP heap, #MEM_SIZE,
+ * of the memory pools, #MEMP_NUM_PBUF, #MEMP_NUM_TCP_SEG, #PBUF_POOL_SIZE, etc., and of
+ * the Tx pbuf queue of the network interface are static configuration items. This module
+ * reports their current and maximum usage and the number of failed allocations, so that
+ * they can be sized on the base of measured data rather than by trial and error.\n
+ *   The data is taken from lwIP's own statistics, #MEM_STATS and #MEMP_STATS, from the
+ * Tx pbuf queue, see nif_queueTxPBuf_getStatistics(), and from the Rx status counters of
+ * the lwIP main function, which tell about the usage of the Ethernet rings.\n
+ *   A report is requested from the console task but the statistics are owned by the lwIP
+ * task. The lwIP task takes a consistent snapshot of all figures in its next clock tick
+ * and the console task prints the snapshot, one line per call of lws_printReport() in
+ * order to not overrun the serial output buffer.\n
+ *   A second kind of report suggests pool and heap sizes. The suggestion is the maximum
+ * usage seen since startup or last reset plus a margin of
+ * #LWS_SUGGESTION_MARGIN_IN_PERCENT. The lines of this report are written as C
+ * preprocessor defines, which can be copied into lwipopts.h. Note, the suggestion can't be
+ * better than the test, which was run before requesting it. For the heap, fragmentation
+ * may require more space than the maximum usage seen.
+ *
+ * Copyright (C) 2026 Peter Vranken (mailto:Peter_Vranken@Yahoo.de)
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+/* Module interface
+ *   lws_requestReport
+ *   lws_mainFunction
+ *   lws_printReport
+ * Local functions
+ *   takeSnapshot
+ *   getSuggestedNoElems
+ *   printErrors
+ *   printLineStatistics
+ *   printLineSuggestion
+ */
+
+/*
+ * Include files
+ */
+
+#include "lws_lwIPStatistics.h"
+
+#include <assert.h>
+#include <stdio.h>
+
+#include "typ_types.h"
+#include "lwip/opt.h"
+#include "lwip/stats.h"
+#include "lwip/memp.h"
+#include "lwip/priv/memp_priv.h"
+#include "lwip_lwIPMainFunction.h"
+#include "nif_queueTxPBuf.h"
+#include "eth_ethernet.h"
+#include "std_decoratedStorage.h"
+
+/*
+ * Defines
+ */
+
+#if MEM_STATS != 1 || MEMP_STATS != 1
+# error lwIP memory statistics are required. Check LWIP_STATS, MEM_STATS and MEMP_STATS
+#endif
+
+/** The lines of a report, which are printed one after another. Each pool has a line of
+    its own. */
+#define IDX_LINE_TITLE          0u
+#define IDX_LINE_HEAP           1u
+#define IDX_LINE_POOL_0         2u
+#define IDX_LINE_QUEUE_TX_PBUF  (IDX_LINE_POOL_0 + (unsigned)MEMP_MAX)
+#define IDX_LINE_ETH_TX         (IDX_LINE_QUEUE_TX_PBUF + 1u)
+#define IDX_LINE_ETH_RX         (IDX_LINE_ETH_TX + 1u)
+#define IDX_LINE_TOTAL          IDX_LINE_ETH_TX
+
+/*
+ * Local type definitions
+ */
+
+/** The states of the hand-shake between console task and lwIP task. */
+typedef enum state_t
+{
+    /** No report is in progress. The console task may request a new one. */
+    state_idle,
+
+    /** The console task has requested a report. The lwIP task will take the snapshot. */
+    state_requested,
+
+    /** The snapshot is taken. The console task is printing it. */
+    state_ready,
+
+} state_t;
+
+/** The figures of a report, taken at a single point in time. */
+typedef struct snapshot_t
+{
+    /** The kind of report, which the snapshot has been taken for. */
+    lws_kindOfReport_t kindOfReport;
+
+    /** The lwIP heap. */
+    struct stats_mem heap;
+
+    /** All lwIP memory pools, in the order of enumeration memp_t. */
+    struct stats_mem poolAry[MEMP_MAX];
+
+    /** The size of an element of the pools in Byte. */
+    uint16_t sizeOfPoolElemAry[MEMP_MAX];
+
+#if NIF_SUPPORT_BUFFER_USAGE_STATISTICS == 1
+    /** The Tx pbuf queue of the network interface. */
+    struct nif_queueTxPBufStatistics_t queueTxPBuf;
+#endif
+
+    /** The Rx status counters of lwip_ethIfPollAllInterfaces(). */
+    unsigned int noEthRxPolls
+               , noEthRxFrames
+               , maxNoEthRxFramesPerPoll
+               , noEthRxBudgetExhausted
+               , noEthRxTxCongested;
+
+} snapshot_t;
+
+
+/*
+ * Local prototypes
+ */
+
+
+/*
+ * Data definitions
+ */
+
+/** The names of the pools. The list is generated from the same include file, which lwIP
+    uses to define the pools. */
+#define LWIP_MEMPOOL(name, num, size, desc)             #name,
+#define LWIP_PBUF_MEMPOOL(name, num, payload, desc)     #name,
+static const char * const RODATA(_poolNameAry)[] =
+{
+#include "lwip/priv/memp_std.h"
+};
+_Static_assert( sizeOfAry(_poolNameAry) == (unsigned)MEMP_MAX
+              , "Inconsistent list of lwIP memory pools"
+              );
+
+/** The names of the configuration items, which determine the number of elements of the
+    pools. Note, some pools share the same configuration item, e.g., IPv4 and IPv6
+    reassembly. */
+#define LWIP_MEMPOOL(name, num, size, desc)             #num,
+#define LWIP_PBUF_MEMPOOL(name, num, payload, desc)     #num,
+static const char * const RODATA(_poolConfigNameAry)[] =
+{
+#include "lwip/priv/memp_std.h"
+};
+_Static_assert( sizeOfAry(_poolConfigNameAry) == (unsigned)MEMP_MAX
+              , "Inconsistent list of lwIP memory pools"
+              );
+
+/** The state of the hand-shake between console task and lwIP task. */
+static volatile state_t SBSS_P1(_state) = state_idle;
+
+/** The kind of the requested report. Written by the console task before the request is
+    signalled to the lwIP task. */
+static volatile lws_kindOfReport_t SBSS_P1(_kindOfReportRequested) =
+                                                                lws_kindOfRpt_statistics;
+
+/** The snapshot of all figures. Written by the lwIP task in state \a state_requested and
+    read by the console task in state \a state_ready. */
+static snapshot_t BSS_P1(_snapshot);
+
+/** The next line of the report to print. Owned by the console task. */
+static unsigned int SBSS_P1(_idxLine) = 0u;
+
+
+/*
+ * Function implementation
+ */
+
+/**
+ * Take the snapshot of all figures and restart the recording if this is requested. Called
+ * in the context of the lwIP task, which owns all the figures.
+ *   @param kindOfReport
+ * The kind of report, which has been requested.
+ */
+static void takeSnapshot(lws_kindOfReport_t kindOfReport)
+{
+    const bool reset = kindOfReport == lws_kindOfRpt_reset;
+
+    _snapshot.kindOfReport = kindOfReport;
+    _snapshot.heap = lwip_stats.mem;
+    if(reset)
+    {
+        lwip_stats.mem.max = lwip_stats.mem.used;
+        lwip_stats.mem.err = 0u;
+    }
+
+    for(unsigned int idxPool=0u; idxPool<(unsigned)MEMP_MAX; ++idxPool)
+    {
+        struct stats_mem * const pStats = lwip_stats.memp[idxPool];
+        _snapshot.poolAry[idxPool] = *pStats;
+        _snapshot.sizeOfPoolElemAry[idxPool] = memp_pools[idxPool]->size;
+        if(reset)
+        {
+            pStats->max = pStats->used;
+            pStats->err = 0u;
+        }
+    }
+
+#if NIF_SUPPORT_BUFFER_USAGE_STATISTICS == 1
+    nif_queueTxPBuf_getStatistics(&_snapshot.queueTxPBuf, reset);
+#endif
+
+    _snapshot.noEthRxPolls = lwip_noEthRxPolls;
+    _snapshot.noEthRxFrames = lwip_noEthRxFrames;
+    _snapshot.maxNoEthRxFramesPerPoll = lwip_maxNoEthRxFramesPerPoll;
+    _snapshot.noEthRxBudgetExhausted = lwip_noEthRxBudgetExhausted;
+    _snapshot.noEthRxTxCongested = lwip_noEthRxTxCongested;
+    if(reset)
+    {
+        lwip_noEthRxPolls = 0u;
+        lwip_noEthRxFrames = 0u;
+        lwip_maxNoEthRxFramesPerPoll = 0u;
+        lwip_noEthRxBudgetExhausted = 0u;
+        lwip_noEthRxTxCongested = 0u;
+    }
+} /* takeSnapshot */
+
+
+/**
+ * Compute the suggested number of elements of a pool or queue.
+ *   @return
+ * Get the maximum usage plus the margin #LWS_SUGGESTION_MARGIN_IN_PERCENT, but at least
+ * one.
+ *   @param maxNoElems
+ * The maximum number of elements, which have been in use at the same time.
+ */
+static inline unsigned int getSuggestedNoElems(unsigned int maxNoElems)
+{
+    const unsigned int noElems = maxNoElems
+                                 + (maxNoElems*LWS_SUGGESTION_MARGIN_IN_PERCENT + 99u) / 100u;
+    return noElems > 0u? noElems: 1u;
+
+} /* getSuggestedNoElems */
+
+
+/**
+ * Print the optional remark about allocation errors, which ends a line of a report.
+ *   @param noErrors
+ * The number of failed allocations. Nothing is printed if this is zero.
+ */
+static void printErrors(unsigned int noErrors)
+{
+    if(noErrors > 0u)
+        iprintf(", %u allocations failed", noErrors);
+
+} /* printErrors */
+
+
+/**
+ * Print a line of the statistics report.
+ *   @return
+ * Get \a false if the line is void and nothing has been printed, e.g., for unused pools.
+ *   @param idxLine
+ * The line to print. Range is 0..#IDX_LINE_ETH_RX.
+ */
+static bool printLineStatistics(unsigned int idxLine)
+{
+    if(idxLine == IDX_LINE_TITLE)
+    {
+        fputs("lwIP memory usage (current, maximum, capacity):\r\n", stdout);
+    }
+    else if(idxLine == IDX_LINE_HEAP)
+    {
+        const struct stats_mem * const pHeap = &_snapshot.heap;
+        iprintf( "Heap: %u, %u, %u Byte"
+               , (unsigned)pHeap->used
+               , (unsigned)pHeap->max
+               , (unsigned)pHeap->avail
+               );
+        printErrors(pHeap->err);
+        if(pHeap->illegal > 0u)
+            iprintf(", %u illegal frees", (unsigned)pHeap->illegal);
+        fputs("\r\n", stdout);
+    }
+    else if(idxLine < IDX_LINE_QUEUE_TX_PBUF)
+    {
+        const unsigned int idxPool = idxLine - IDX_LINE_POOL_0;
+        const struct stats_mem * const pPool = &_snapshot.poolAry[idxPool];
+        if(pPool->avail == 0u)
+            return false;
+
+        iprintf( "%-16s %3u, %3u, %3u (%u Byte each)"
+               , _poolNameAry[idxPool]
+               , (unsigned)pPool->used
+               , (unsigned)pPool->max
+               , (unsigned)pPool->avail
+               , (unsigned)_snapshot.sizeOfPoolElemAry[idxPool]
+               );
+        printErrors(pPool->err);
+        fputs("\r\n", stdout);
+    }
+    else if(idxLine == IDX_LINE_QUEUE_TX_PBUF)
+    {
+#if NIF_SUPPORT_BUFFER_USAGE_STATISTICS == 1
+        const struct nif_queueTxPBufStatistics_t * const pQ = &_snapshot.queueTxPBuf;
+        iprintf( "Tx pbuf queue: %u, %u, %u (max. %u waiting for ETH driver)"
+               , pQ->noElems
+               , pQ->maxNoElems
+               , pQ->capacity
+               , pQ->maxNoElemsPhaseOne
+               );
+        if(pQ->noElemsLost > 0u)
+            iprintf(", %u pbufs lost", pQ->noElemsLost);
+        fputs("\r\n", stdout);
+#else
+        fputs("Tx pbuf queue: No statistics in this compilation\r\n", stdout);
+#endif
+    }
+    else if(idxLine == IDX_LINE_ETH_TX)
+    {
+#if NIF_SUPPORT_BUFFER_USAGE_STATISTICS == 1
+        const struct nif_queueTxPBufStatistics_t * const pQ = &_snapshot.queueTxPBuf;
+        iprintf( "ETH Tx ring: Max. %u frames in %u buffer descriptors, %u scattered frames"
+                 " with up to %u fragments, %u frames coalesced\r\n"
+               , pQ->maxNoElemsPhaseTwo
+               , ETH_ENET0_RING0_NO_TXBD
+               , pQ->noFramesScattered
+               , pQ->maxNoFragments
+               , pQ->noFramesCoalesced
+               );
+#else
+        return false;
+#endif
+    }
+    else
+    {
+        assert(idxLine == IDX_LINE_ETH_RX);
+        iprintf( "ETH Rx ring: Max. %u of %u frames/poll, %u frames, %u polls, %u x budget"
+                 " exhausted, %u x skipped for Tx congestion\r\n"
+               , _snapshot.maxNoEthRxFramesPerPoll
+               , ETH_ENET0_RING0_NO_RXBD
+               , _snapshot.noEthRxFrames
+               , _snapshot.noEthRxPolls
+               , _snapshot.noEthRxBudgetExhausted
+               , _snapshot.noEthRxTxCongested
+               );
+    }
+
+    return true;
+
+} /* printLineStatistics */
+
+
+/**
+ * Print a line of the report with suggested sizes.
+ *   @return
+ * Get \a false if the line is void and nothing has been printed, e.g., for unused pools.
+ *   @param idxLine
+ * The line to print. Range is 0..#IDX_LINE_TOTAL.
+ *   @param pSaving
+ * The RAM saving of the suggestion in Byte is accumulated in * \a pSaving. A negative
+ * number means additionally required RAM.
+ */
+static bool printLineSuggestion(unsigned int idxLine, signed int *pSaving)
+{
+    if(idxLine == IDX_LINE_TITLE)
+    {
+        *pSaving = 0;
+        iprintf( "Suggested configuration (max. usage plus %u%%):\r\n"
+               , LWS_SUGGESTION_MARGIN_IN_PERCENT
+               );
+    }
+    else if(idxLine == IDX_LINE_HEAP)
+    {
+        const struct stats_mem * const pHeap = &_snapshot.heap;
+        const unsigned int max = pHeap->max
+                         , size = getSuggestedNoElems(max) + LWS_HEAP_SIZE_GRANULARITY - 1u;
+        const unsigned int sizeSuggested = size - size % LWS_HEAP_SIZE_GRANULARITY;
+        *pSaving += (signed int)pHeap->avail - (signed int)sizeSuggested;
+        iprintf( "#define %-24s %5u /* is %u, max. used %u"
+               , "MEM_SIZE"
+               , sizeSuggested
+               , (unsigned)pHeap->avail
+               , max
+               );
+        printErrors(pHeap->err);
+        fputs(" */\r\n", stdout);
+    }
+    else if(idxLine < IDX_LINE_QUEUE_TX_PBUF)
+    {
+        const unsigned int idxPool = idxLine - IDX_LINE_POOL_0;
+        const struct stats_mem * const pPool = &_snapshot.poolAry[idxPool];
+        if(pPool->avail == 0u)
+            return false;
+
+        const unsigned int noElemsSuggested = getSuggestedNoElems(pPool->max);
+        *pSaving += ((signed int)pPool->avail - (signed int)noElemsSuggested)
+                    * (signed int)_snapshot.sizeOfPoolElemAry[idxPool];
+        iprintf( "#define %-24s %5u /* is %u, max. used %u"
+               , _poolConfigNameAry[idxPool]
+               , noElemsSuggested
+               , (unsigned)pPool->avail
+               , (unsigned)pPool->max
+               );
+        printErrors(pPool->err);
+        fputs(" */\r\n", stdout);
+    }
+    else if(idxLine == IDX_LINE_QUEUE_TX_PBUF)
+    {
+#if NIF_SUPPORT_BUFFER_USAGE_STATISTICS == 1
+        const struct nif_queueTxPBufStatistics_t * const pQ = &_snapshot.queueTxPBuf;
+        const unsigned int noElemsSuggested = getSuggestedNoElems(pQ->maxNoElemsPhaseOne);
+        *pSaving += ((signed int)NIF_NO_TX_PBUFS_WAITING_FOR_ETH - (signed int)noElemsSuggested)
+                    * (signed int)sizeof(struct nif_queueElemTxPBuf_t);
+        iprintf( "#define %-24s %5u /* is %u, max. used %u"
+               , "NIF_NO_TX_PBUFS_WAITING_FOR_ETH"
+               , noElemsSuggested
+               , NIF_NO_TX_PBUFS_WAITING_FOR_ETH
+               , pQ->maxNoElemsPhaseOne
+               );
+        if(pQ->noElemsLost > 0u)
+            iprintf(", %u pbufs lost", pQ->noElemsLost);
+        fputs(" */\r\n", stdout);
+#else
+        return false;
+#endif
+    }
+    else
+    {
+        assert(idxLine == IDX_LINE_TOTAL);
+        if(*pSaving >= 0)
+            iprintf("The suggestion saves %d Byte of RAM\r\n", *pSaving);
+        else
+            iprintf("The suggestion requires %d Byte of additional RAM\r\n", -*pSaving);
+    }
+
+    return true;
+
+} /* printLineSuggestion */
+
+
+/**
+ * Request a report of the lwIP memory statistics. The report is printed by subsequent
+ * calls of lws_printReport().
+ *   @return
+ * Get \a false if the request is rejected because a previously requested report has not
+ * been printed completely yet.
+ *   @param kindOfReport
+ * The kind of report.
+ *   @remark
+ * This function must be called from the same context as lws_printReport(), which is
+ * normally the task, which runs the serial console.
+ */
+bool lws_requestReport(lws_kindOfReport_t kindOfReport)
+{
+    if(_state != state_idle)
+        return false;
+
+    _kindOfReportRequested = kindOfReport;
+    _idxLine = 0u;
+
+    /* The kind of report needs to be visible to the lwIP task before the request. */
+    std_fullMemoryBarrier();
+    _state = state_requested;
+    return true;
+
+} /* lws_requestReport */
+
+
+/**
+ * The step function of the statistics module. If a report has been requested, then the
+ * snapshot of all figures is taken.
+ *   @remark
+ * This function must be called from the lwIP task, which owns the statistics. It is
+ * intended to be called on the regular clock tick of this task.
+ */
+void lws_mainFunction(void)
+{
+    if(_state == state_requested)
+    {
+        std_fullMemoryBarrier();
+        takeSnapshot(_kindOfReportRequested);
+
+        /* The snapshot needs to be visible to the console task before the state. */
+        std_fullMemoryBarrier();
+        _state = state_ready;
+    }
+} /* lws_mainFunction */
+
+
+/**
+ * Print the next line of a requested report. Nothing is done if no report has been
+ * requested or if the lwIP task has not taken the snapshot, yet.
+ *   @return
+ * Get \a true as long as a requested report has not been printed completely. The caller
+ * may use it to print a report in one go, e.g., at the end of a test run.
+ *   @remark
+ * This function must be called regularly from the same context as lws_requestReport().
+ * Printing one line per call avoids overrunning the buffer of the serial output, it
+ * should be called not more often than every 10ms.
+ */
+bool lws_printReport(void)
+{
+    if(_state != state_ready)
+        return _state != state_idle;
+    std_fullMemoryBarrier();
+
+    /* The saving of the suggestion is accumulated over the lines of the report. */
+    static signed int SBSS_P1(saving_) = 0;
+
+    bool isDone;
+    if(_snapshot.kindOfReport == lws_kindOfRpt_reset)
+    {
+        fputs("lwIP memory statistics have been reset\r\n", stdout);
+        isDone = true;
+    }
+    else
+    {
+        const bool isStatistics = _snapshot.kindOfReport == lws_kindOfRpt_statistics;
+        const unsigned int idxLineLast = isStatistics? IDX_LINE_ETH_RX: IDX_LINE_TOTAL;
+
+        /* Void lines are skipped without consuming a call. */
+        while(_idxLine <= idxLineLast)
+        {
+            const bool isPrinted = isStatistics? printLineStatistics(_idxLine)
+                                               : printLineSuggestion(_idxLine, &saving_);
+            ++ _idxLine;
+            if(isPrinted)
+                break;
+        }
+        isDone = _idxLine > idxLineLast;
+    }
+
+    if(isDone)
+    {
+        std_fullMemoryBarrier();
+        _state = state_idle;
+    }
+
+    return !isDone;
+
+} /* lws_printReport */
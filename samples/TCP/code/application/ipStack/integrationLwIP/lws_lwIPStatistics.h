@@ -0,0 +1,93 @@
+#ifndef LWS_LWIPSTATISTICS_INCLUDED
+#define LWS_LWIPSTATISTICS_INCLUDED
+/**
+ * @file lws_lwIPStatistics.h
+ * Definition of global interface of module lws_lwIPStatistics.c
+ *
+ * Copyright (C) 2026 Peter Vranken (mailto:Peter_Vranken@Yahoo.de)
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Include files
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "typ_types.h"
+
+
+/*
+ * Defines
+ */
+
+/** The safety margin of the suggested pool and heap sizes in percent of the maximum
+    usage seen so far. The suggestions are only as good as the test, which has been run
+    before; the margin covers usage peaks, which didn't occur during the test. */
+#define LWS_SUGGESTION_MARGIN_IN_PERCENT    25u
+
+/** The suggested heap size, #MEM_SIZE, is rounded up to a multiple of this number of
+    Byte. */
+#define LWS_HEAP_SIZE_GRANULARITY           256u
+
+
+/*
+ * Global type definitions
+ */
+
+/** The kinds of report, which can be requested with lws_requestReport(). */
+typedef enum lws_kindOfReport_t
+{
+    /** Current usage, maximum usage and number of allocation errors of heap, pools,
+        Tx pbuf queue and Ethernet rings. */
+    lws_kindOfRpt_statistics,
+
+    /** Suggested sizes of heap, pools and Tx pbuf queue, ready for copying into the
+        configuration files. */
+    lws_kindOfRpt_suggestion,
+
+    /** No report but restart the recording of maximum values and error counts. */
+    lws_kindOfRpt_reset,
+
+} lws_kindOfReport_t;
+
+
+/*
+ * Global data declarations
+ */
+
+
+/*
+ * Global prototypes
+ */
+
+/** Request a report of the lwIP memory statistics. Called from the console task. */
+bool lws_requestReport(lws_kindOfReport_t kindOfReport);
+
+/** The step function of the statistics module. Called from the lwIP task. */
+void lws_mainFunction(void);
+
+/** Print the next line of a requested report. Called regularly from the console task.
+    Returns \a true as long as the report is incomplete. */
+bool lws_printReport(void);
+
+
+/*
+ * Global inline functions
+ */
+
+
+#endif  /* LWS_LWIPSTATISTICS_INCLUDED */
@@ -20,12 +20,14 @@
  */
 /* Module interface
  *   nif_initNetIfForENETDriver
- *   nif_processPendingEthRxFrame
+ *   nif_processPendingEthRxFrames
  *   nif_onEthBufferTxComplete
  * Local functions
  *   setMacFilterForIgmp
  *   setMacFilterForMld
- *   sendUnchainedPBufAsEthFrame
+ *   setFrameDescOfPBuf
+ *   getNoFragmentsOfPBuf
+ *   enqueuePBufAsEthFrame
  *   sendPBufAsEthFrame
  *   onFreePBufEthRx
  *   provideEthRxDataToLwIP
@@ -203,32 +205,56 @@ static err_t setMacFilterForMld( struct netif * const pNetIf
 
 
 /**
- * Hand the payload of a pbuf over to the ETH driver, in order to make it send the payload
- * as a single Ethernet frame.
+ * Describe the payload of a pbuf as a single Ethernet frame for the ETH driver. The pbuf
+ * may be chained; the payload of each element of the chain becomes a fragment of the
+ * frame, which the DMA of the MAC gathers from memory.
+ *   @param pFrameDesc
+ * The frame descriptor is filled in * \a pFrameDesc.
+ *   @param pPBuf
+ * The payload of this pbuf is described as an entire frame. The chain must not have more
+ * than #ETH_MAX_NO_TX_FRAGMENTS non-empty elements.
+ */
+static void setFrameDescOfPBuf( struct eth_txFrameDesc_t * const pFrameDesc
+                              , const struct pbuf *pPBuf
+                              )
+{
+    unsigned int noFragments = 0u;
+    for(; pPBuf!=NULL; pPBuf=pPBuf->next)
+    {
+        /* lwIP may have empty elements in the chain, e.g., after header removal. They
+           don't occupy a buffer descriptor. */
+        if(pPBuf->len > 0u)
+        {
+            assert(noFragments < ETH_MAX_NO_TX_FRAGMENTS);
+            pFrameDesc->fragmentAry[noFragments].data = pPBuf->payload;
+            pFrameDesc->fragmentAry[noFragments].length = pPBuf->len;
+            ++ noFragments;
+        }
+    }
+    assert(noFragments > 0u);
+    pFrameDesc->noFragments = noFragments;
+
+} /* setFrameDescOfPBuf */
+
+
+/**
+ * Count the fragments of the Ethernet frame, which a pbuf chain is mapped onto.
  *   @return
- * If the frame was successfully enqueued for transmission, then the driver returns a
- * handle of the transmission job. It can be used to query the state of the * transmission,
- * in particular whether the transmission has been completed.\n
- *   Otherwise, if there is no available space for the frame in the ring buffer of the MAC
- * device, the function returns zero.
- *   @param idxEthDev
- * The ENET device to use for transmission. Needs to be enabled and configured. Range is
- * 0..1.
+ * Get the number of non-empty elements of the chain.
  *   @param pPBuf
- * The payload of this pbuf is submitted to the ETH driver as an entire frame.
+ * The first element of the pbuf chain by reference.
  */
-static inline uintptr_t submitPBufToEthDriver( unsigned int idxEthDev
-                                             , struct pbuf * const pPBuf
-                                             )
+static unsigned int getNoFragmentsOfPBuf(const struct pbuf *pPBuf)
 {
-    /* Try to put the data as frame into the ring buffer of the MAC device. Return value is
-       NULL if there is (currently) no space in the ring buffer. */
-    return eth_sendFrame( idxEthDev
-                        , ETH_ENET0_IDX_RING_IN_USE
-                        , pPBuf->payload
-                        , pPBuf->tot_len
-                        );
-} /* submitPBufToEthDriver */
+    unsigned int noFragments = 0u;
+    for(; pPBuf!=NULL; pPBuf=pPBuf->next)
+    {
+        if(pPBuf->len > 0u)
+            ++ noFragments;
+    }
+    return noFragments;
+
+} /* getNoFragmentsOfPBuf */
 
 
 /**
@@ -241,16 +267,19 @@ static inline uintptr_t submitPBufToEthDriver( unsigned int idxEthDev
  * The lwIP network interface to apply for frame transmission by reference.
  *   @param pPBuf
  * The pBuf to send by reference. The ETH frame contents are taken from this pBuf, which
- * must not be a chained one. (Only the first element of the chain is read.) The function
+ * may be a chained one with up to #ETH_MAX_NO_TX_FRAGMENTS non-empty elements. The function
  * gets the buffer for read access only. The caller keeps ownership, e.g., to enable
  * re-transmission for the TCP protocol. The reference count of the pBuf must therefore
  * not be changed.
+ *   @param isCoalesced
+ * \a true if \a pPBuf is a copy of a longer chain. Only used for the statistics.
  */
-static err_t sendUnchainedPBufAsEthFrame( const struct netif * const pNetIf
-                                        , struct pbuf * const pPBuf
-                                        )
+static err_t enqueuePBufAsEthFrame( const struct netif * const pNetIf
+                                  , struct pbuf * const pPBuf
+                                  , bool isCoalesced
+                                  )
 {
-    const err_t stsEnqueue = nif_queueTxPBuf_enqueue(pNetIf->num, pPBuf);
+    const err_t stsEnqueue = nif_queueTxPBuf_enqueue(pNetIf->num, pPBuf, isCoalesced);
 
     /* Try sending, the driver may have space to take the just enqueued buffer. */
     if(stsEnqueue == ERR_OK)
@@ -258,7 +287,7 @@ static err_t sendUnchainedPBufAsEthFrame( const struct netif * const pNetIf
 
     return stsEnqueue;
 
-} /* sendUnchainedPBufAsEthFrame */
+} /* enqueuePBufAsEthFrame */
 
 
 /**
@@ -279,20 +308,30 @@ static err_t sendUnchainedPBufAsEthFrame( const struct netif * const pNetIf
  */
 static err_t sendPBufAsEthFrame(struct netif * const pNetIf, struct pbuf * const pPBuf)
 {
-    assert(pPBuf != NULL);
+    assert(pPBuf != NULL  &&  pPBuf->tot_len > 0u);
 #if LWIP_NETIF_TX_SINGLE_PBUF && !(LWIP_IPV4 && IP_FRAG) && (LWIP_IPV6 && LWIP_IPV6_FRAG)
     assert(pPBuf->next == NULL  &&  pPBuf->len == pPBuf->tot_len);
 #endif
 
-    /* We use the Ethernet driver such that a frame is a solid, contiguous block of memory.
-       Therefore we need to check if the delivered pbuf is a chained one - in which case we
-       need to copy all chained data into a single, solid pbuf. */
-    /// @todo The driver should support fragmented frames; we need to spend many more control blocks and do the coalescing only if there are too few available
-    const bool isPBufSolid = pPBuf->next == NULL;
+    /* The Ethernet driver maps each element of a chained pbuf onto a buffer descriptor of
+       its own; normally, a frame is transmitted without copying. A frame, which doesn't
+       find enough free descriptors, waits in the Tx queue until earlier frames have
+       completed. Only if the chain has more elements than the Tx ring has descriptors,
+       it can never be sent as it is and we need to copy all chained data into a single,
+       solid pbuf.
+         Note, we don't decide on the currently free descriptors: They are unknown here,
+       the frame is only queued, and they are free again after a few microseconds, when
+       the earlier frames have been serialized. Copying because of a momentary shortage
+       would cost a heap allocation and a copy just under load, to save the frame a delay
+       of a few microseconds. */
+    _Static_assert( ETH_MAX_NO_TX_FRAGMENTS == ETH_ENET0_RING0_NO_TXBD
+                  , "Coalescing is required for frames, which would fit into the Tx ring"
+                  );
+    const bool isFragmentable = getNoFragmentsOfPBuf(pPBuf) <= ETH_MAX_NO_TX_FRAGMENTS;
 
     err_t stsEthTx;
-    if(isPBufSolid)
-        stsEthTx = sendUnchainedPBufAsEthFrame(pNetIf, pPBuf);
+    if(isFragmentable)
+        stsEthTx = enqueuePBufAsEthFrame(pNetIf, pPBuf, /* isCoalesced */ false);
     else
     {
         /* Increment the reference count of the pbuf: If coalescing takes place and
@@ -310,7 +349,7 @@ static err_t sendPBufAsEthFrame(struct netif * const pNetIf, struct pbuf * const
         {
             /* Operation succeed, we have a clone with solid block of memory holding the
                ETH frame payload and can send it out. */
-            stsEthTx = sendUnchainedPBufAsEthFrame(pNetIf, pPBufClone);
+            stsEthTx = enqueuePBufAsEthFrame(pNetIf, pPBufClone, /* isCoalesced */ true);
 
             /* The clone is no longer needed, we can delete it again. */
             pbuf_free(pPBufClone);
@@ -541,43 +580,50 @@ err_t nif_initNetIfForENETDriver(struct netif * const pNetIf)
 
 
 /**
- * This function polls the ETH driver for received frames and forwards them to lwIP in
- * case.\n
- *   This is the major API of the lwIP stack to keep it running. The function shall be
- * called from the integrating code either regularly or when the Ethernet driver notifies
- * the reception of a new frame. The latter option is preferred. The former option actually
- * means polling and requires the Ethernet driver to have enough buffer space for storing
- * all frames potentially arriving within the polling cycle time.
+ * This function fetches a batch of received frames from the ETH driver and forwards them
+ * to lwIP. It needs only one system call for up to #ETH_MAX_NO_RX_FRAMES_PER_READ
+ * frames.\n
+ *   This is the major API of the lwIP stack to keep it running, see
+ * lwip_ethIfPollAllInterfaces().
+ *   @return
+ * Get the number of frames, which have been fetched and forwarded to lwIP. Range is
+ * 0..\a maxNoFrames.
  *   @param pNetIf
  * An lwIP network interface object by reference. The ENET device, which is controlled by
  * this interface is polled for Rx frames.
+ *   @param maxNoFrames
+ * The maximum number of frames to process. Range is 1..#ETH_MAX_NO_RX_FRAMES_PER_READ.
  *   @param pNoRxFrameAnymore
- * \a true if and only if the net interface reported an empty queue. In case of \a false
- * it is possible but not for sure that the interface still has another queued Rx buffer.
+ * \a true if the net interface reported an empty queue, i.e., if the function returns
+ * less than \a maxNoFrames. In case of \a false it is possible but not for sure that the
+ * interface still has another queued Rx buffer.
  */
-err_t nif_processPendingEthRxFrame(struct netif * const pNetIf, bool *pNoRxFrameAnymore)
+unsigned int nif_processPendingEthRxFrames( struct netif * const pNetIf
+                                          , unsigned int maxNoFrames
+                                          , bool *pNoRxFrameAnymore
+                                          )
 {
     uint8_t idxEthDev = pNetIf->num;
     assert(LWIP_SINGLE_NETIF == 0u || idxEthDev == 0u);
 
-    /* Check if there are any new RX frames and provide them to lwip stack */
-    unsigned int sizeOfPayloadData;
-    uint8_t * const pFrameData = eth_readFrame( idxEthDev
-                                              , ETH_ENET0_IDX_RING_IN_USE
-                                              , &sizeOfPayloadData
-                                              );
-    if(pFrameData != NULL)
+    const struct eth_bufferDesc_t *frameDescAry;
+    const unsigned int noFrames = eth_readFrames( idxEthDev
+                                                , ETH_ENET0_IDX_RING_IN_USE
+                                                , &frameDescAry
+                                                , maxNoFrames
+                                                );
+
+    /* Wrap the Rx data in pbuf objects and hand them over to lwIP. */
+    for(unsigned int u=0u; u<noFrames; ++u)
     {
-        /* Wrap the Rx data in a pbuf object and hand it over to lwIP. */
-        provideEthRxDataToLwIP(pNetIf, pFrameData, (uint16_t)sizeOfPayloadData);
-        *pNoRxFrameAnymore = false;
+        assert(frameDescAry[u].data != NULL);
+        provideEthRxDataToLwIP(pNetIf, frameDescAry[u].data, frameDescAry[u].length);
     }
-    else
-        *pNoRxFrameAnymore = true;
 
-    return ERR_OK;
+    *pNoRxFrameAnymore = noFrames < maxNoFrames;
+    return noFrames;
 
-} /* nif_processPendingEthRxFrame */
+} /* nif_processPendingEthRxFrames */
 
 
 
@@ -598,7 +644,7 @@ err_t nif_processPendingEthRxFrame(struct netif * const pNetIf, bool *pNoRxFrame
  * pbuf queue may overflow and Tx frames were lost.
  *   @note
  * The lwIP core stack implementation is single-threaded. For this API and
- * nif_processPendingEthRxFrame() it means that they must not be used from concurrent
+ * nif_processPendingEthRxFrames() it means that they must not be used from concurrent
  * context. If both are connected to the Ethernet drivers interrupts then these need to
  * implement mutual exclusion, e.g., by being served by the same core and having same
  * priority.
@@ -607,81 +653,86 @@ void nif_onEthBufferTxComplete(void)
 {
     /* Check the pbufs, which had been handed over to the ETH driver, whether their
        transmission has completed meanwhile so that we can release the pbuf memory.
-         The check for transmission-complete is limited to the heading elements in the
-       queue because queuing, handing over to the ETH driver and transmission on the wire
-       occur all in strictly same order. If we hit a still pending element in the queue
-       then we know that all later enqueued pbufs won't have completed their transmission,
-       neither. */
-    while(true)
-    {
-        /* Get access to head element in the queue, which is the pbuf, which had been
-           handed over to the ETH driver longest ago. Note, the queue is not modified by
-           this operation. */
-        const struct nif_queueElemTxPBuf_t * const pQElemTxPBuf =
+         Queuing, handing over to the ETH driver and transmission on the wire occur all in
+       strictly same order. A single query of the driver tells how many of the eldest
+       frames have completed and all of them are released at once. */
+    const struct nif_queueElemTxPBuf_t * const pQElemTxPBufHead =
                                     nif_queueTxPBuf_getPBufWaitingForTransmissionComplete();
-
-        /* The queue returns NULL if not any pbuf is contained, which had been handed over
-           to the ETH driver for transmission. */
-        if(pQElemTxPBuf == NULL)
-            break;
-
-        assert(pQElemTxPBuf->hTxFrame != 0u);
-
-        /* Note, when the query for the transmission status returns "transmission complete"
-           then the related ring buffer is at the same time released for re-use. */
-        if(eth_isTransmissionCompleted(pQElemTxPBuf->hTxFrame))
-        {
-            /* The next pbuf in the chain has been entirely processed by the ETH driver and
-               we can remove it from the queue. This will implicitly free the pbuf and
-               make the memory available to lwIP again. */
-            nif_queueTxPBuf_dequeue();
-        }
-        else
+    if(pQElemTxPBufHead != NULL)
+    {
+        /* Note, the queue holds a single sequence of frames for all devices. The
+           completion count of the head's device matches this sequence only as long as a
+           single device is in use, which is the case in this project. */
+        assert(LWIP_SINGLE_NETIF == 0u || pQElemTxPBufHead->idxEthDev == 0u);
+        const unsigned int noFramesCompleted =
+                        eth_getNoTransmissionsCompleted( pQElemTxPBufHead->idxEthDev
+                                                       , ETH_ENET0_IDX_RING_IN_USE
+                                                       );
+        if(noFramesCompleted > 0u)
         {
-            /* The frame is not transmitted yet and the pbuf -- input to the frame -- needs
-               to stay alive. We leave the loop, which is correct as sending frames is done
-               in strict order of submitting pbuf for transmission. If this one has not
-               completed, yet, then all others in the queue won't have, neither. */
-            break;
+            /* The frames have been entirely processed by the ETH driver and we can remove
+               their pbufs from the queue. This will implicitly free the pbufs and make the
+               memory available to lwIP again. */
+            nif_queueTxPBuf_dequeue(noFramesCompleted);
         }
-    } /* while(ETH driver has pending Tx frames.) */
+    }
 
     /* Check for pbufs, which had been submitted by lwIP for transmission, whether the ETH
-       driver is in the state to transmit them, i.e., whether it has a free ring buffer
-       element available for its (shortly later) transmission. */
-    while(true)
+       driver is in the state to transmit them. We don't know the number of free elements
+       in the driver's Tx ring but each pending frame occupies at least one. This is an
+       upper bound for the number of frames, which can be handed over. */
+    const unsigned int maxNoFrames = ETH_ENET0_RING0_NO_TXBD
+                                     - nif_queueTxPBuf_getNoPBufsWaitingForTransmissionComplete();
+    _Static_assert( ETH_MAX_NO_TX_FRAMES_PER_SEND == ETH_ENET0_RING0_NO_TXBD
+                  , "Tx batch size doesn't match the size of the Tx ring"
+                  );
+
+    /* The frame descriptors are passed to the ETH driver by reference. They are not
+       placed on the stack because of their size. */
+    static struct eth_txFrameDesc_t BSS_P1(frameDescAry_)[ETH_MAX_NO_TX_FRAMES_PER_SEND];
+
+    /* Describe as many queued pbufs as frames as the driver can possibly take. Get access
+       to them in tcp_write() order. Note, the queue is not modified by this operation. */
+    unsigned int noFrames = 0u
+               , idxEthDev = 0u;
+    while(noFrames < maxNoFrames)
     {
-        /* Get access to queued pbuf, which is the next one in tcp_write() order to be
-           handed over to the ETH driver. Note, the queue is not modified by this
-           operation. */
-        struct nif_queueElemTxPBuf_t * const pQElemTxPBuf =
-                                                nif_queueTxPBuf_getPBufWaitingForSubmission();
-        if(pQElemTxPBuf != NULL)
+        const struct nif_queueElemTxPBuf_t * const pQElemTxPBuf =
+                                        nif_queueTxPBuf_getPBufWaitingForSubmission(noFrames);
+        if(pQElemTxPBuf == NULL)
         {
-            assert(pQElemTxPBuf->hTxFrame == 0u);
-            pQElemTxPBuf->hTxFrame = submitPBufToEthDriver( pQElemTxPBuf->idxEthDev
-                                                          , pQElemTxPBuf->pPBuf
-                                                          );
-            if(pQElemTxPBuf->hTxFrame != 0u)
-            {
-                /* The driver has accepted the pbuf, so we can advance its state to
-                   "waiting for transmission complete". */
-                nif_queueTxPBuf_advancePBufWaitingForSubmission();
-            }
-            else
-            {
-                /* ETH driver is currently busy or its ring buffer full, respectively. No
-                   chance to submit further pbufs for transmission. */
-                break;
-            }
+            /* There are no further queued pbufs waiting for submission. */
+            break;
         }
-        else
+        else if(noFrames == 0u)
+            idxEthDev = pQElemTxPBuf->idxEthDev;
+        else if(pQElemTxPBuf->idxEthDev != idxEthDev)
         {
-            /* There are no queued pbuf waiting for submission any more. */
+            /* A batch is submitted to a single device. */
             break;
         }
-    } /* while(Queue still holds pbufs, which need to be handed over to the ETH driver.) */
 
+        setFrameDescOfPBuf(&frameDescAry_[noFrames], pQElemTxPBuf->pPBuf);
+        ++ noFrames;
+    }
+
+    if(noFrames > 0u)
+    {
+        /* Hand all frames over to the ETH driver with a single system call. The driver
+           takes as many as fit into its Tx ring. The others stay in phase one and are
+           submitted on the next Tx complete notification. */
+        const unsigned int noFramesSent = eth_sendFrames( idxEthDev
+                                                        , ETH_ENET0_IDX_RING_IN_USE
+                                                        , frameDescAry_
+                                                        , noFrames
+                                                        );
+        if(noFramesSent > 0u)
+        {
+            /* The driver has accepted the pbufs, so we can advance their state to
+               "waiting for transmission complete". */
+            nif_queueTxPBuf_advancePBufsWaitingForSubmission(noFramesSent);
+        }
+    }
 } /* nif_onEthBufferTxComplete */
 
 
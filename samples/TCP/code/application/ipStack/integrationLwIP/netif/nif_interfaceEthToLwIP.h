@@ -103,8 +103,11 @@
     platform independent lwIP initialization function. */
 err_t nif_initNetIfForENETDriver(struct netif *pNetIf);
 
-/** Poll ETH driver for Rx frames and feed lwIP in case. */
-err_t nif_processPendingEthRxFrame(struct netif *netif, bool *pNoRxFrameAnymore);
+/** Fetch a batch of Rx frames from the ETH driver and feed lwIP with them. */
+unsigned int nif_processPendingEthRxFrames( struct netif *pNetIf
+                                          , unsigned int maxNoFrames
+                                          , bool *pNoRxFrameAnymore
+                                          );
 
 /** Signal: Ethernet driver has completed the transmission of a buffer. */
 void nif_onEthBufferTxComplete(void);
@@ -21,7 +21,12 @@
  * #LWIP_NETIF_TX_SINGLE_PBUF), i.e., if every tcp_write() by the application code sends a
  * pbuf to the ETH driver. In this mode, which minimize data copy operations, the driver
  * will process many, little pbufs and this requires a significantly longer queue for the
- * same buffer capacity.
+ * same buffer capacity.\n
+ *   The transitions between the phases are done in bulk: All pbufs, which the ETH driver
+ * accepts with a single system call, enter phase two at once and all pbufs, whose frames
+ * the ETH driver reports completed with a single system call, are removed at once. The
+ * capacity of the queue is derived from the size of the driver's Tx ring, which bounds
+ * the number of pbufs in phase two.
  *
  * Copyright (C) 2023 Peter Vranken (mailto:Peter_Vranken@Yahoo.de)
  *
@@ -44,9 +49,13 @@
  *   nif_queueTxPBuf_dequeue
  *   nif_queueTxPBuf_getPBufWaitingForSubmission
  *   nif_queueTxPBuf_getPBufWaitingForTransmissionComplete
- *   nif_queueTxPBuf_advancePBufWaitingForSubmission
+ *   nif_queueTxPBuf_getNoPBufsWaitingForTransmissionComplete
+ *   nif_queueTxPBuf_getNoFreeElems
+ *   nif_queueTxPBuf_advancePBufsWaitingForSubmission
+ *   nif_queueTxPBuf_getStatistics
  * Local functions
  *   inc
+ *   add
  *   diff
  *   isEmpty
  *   isFull
@@ -54,6 +63,7 @@
  *   hasPhase2
  *   noElems
  *   noElemsPhase1
+ *   noElemsPhase2
  */
 
 /*
@@ -71,8 +81,10 @@
  * Defines
  */
  
-/** The maximum number of queueable Tx pbufs. */
-#define CAPACITY_QUEUE_TX_PBUF  20u
+/** The maximum number of queueable Tx pbufs. Each frame in the Tx ring of the ETH driver
+    occupies at least one buffer descriptor; the number of pbufs in phase two can't exceed
+    the number of descriptors. */
+#define CAPACITY_QUEUE_TX_PBUF  (ETH_ENET0_RING0_NO_TXBD + NIF_NO_TX_PBUFS_WAITING_FOR_ETH)
 
 /*
  * Local type definitions
@@ -104,6 +116,18 @@ struct queueTxPBuf_t
     
     /** The maximum ever seen number of stored elements, which were in phase one. */
     unsigned int maxNoElemsPhaseOne;
+
+    /** The maximum ever seen number of stored elements, which were in phase two. */
+    unsigned int maxNoElemsPhaseTwo;
+
+    /** The number of enqueued pbufs, which were chained. */
+    unsigned int noFramesScattered;
+
+    /** The maximum ever seen number of non-empty elements of an enqueued pbuf. */
+    unsigned int maxNoFragments;
+
+    /** The number of enqueued pbufs, which are a copy of a longer chain. */
+    unsigned int noFramesCoalesced;
 #endif
 };
  
@@ -129,7 +153,14 @@ static inline unsigned int inc(unsigned int idx)
     return idx < CAPACITY_QUEUE_TX_PBUF? idx+1u: 0u;
 }
 
-#if NIF_SUPPORT_BUFFER_USAGE_STATISTICS == 1
+/** Cyclic addition of a number of elements to an index into the queue's array. */
+static inline unsigned int add(unsigned int idx, unsigned int noElems)
+{
+    assert(noElems <= CAPACITY_QUEUE_TX_PBUF);
+    idx += noElems;
+    return idx <= CAPACITY_QUEUE_TX_PBUF? idx: idx - (CAPACITY_QUEUE_TX_PBUF+1u);
+}
+
 /** The cyclic difference of two indexes into the queue's array. */
 static inline unsigned int diff(unsigned int idxA, unsigned int idxB)
 {
@@ -141,7 +172,6 @@ static inline unsigned int diff(unsigned int idxA, unsigned int idxB)
     return du;
     
 } /* diff */
-#endif
 
 /** Query: Is the queue currently empty? */
 static inline bool isEmpty(void)
@@ -167,7 +197,6 @@ static inline bool hasPhase2(void)
     return _q.idxHead != _q.idxHeadPhaseOne;
 }
 
-#if NIF_SUPPORT_BUFFER_USAGE_STATISTICS == 1
 /** Query: How many pbufs does the queue currently contain? */
 static inline unsigned int noElems(void)
 {
@@ -179,7 +208,12 @@ static inline unsigned int noElemsPhase1(void)
 {
     return diff(_q.idxTail, _q.idxHeadPhaseOne);
 }
-#endif
+
+/** Query: How many pbufs does the queue currently contain, which are in phase two? */
+static inline unsigned int noElemsPhase2(void)
+{
+    return diff(_q.idxHeadPhaseOne, _q.idxHead);
+}
 
 
 /**
@@ -197,6 +231,10 @@ void nif_queueTxPBuf_initModule(void)
     _q.noElemsLost        = 0u;
     _q.maxNoElems         = 0u;
     _q.maxNoElemsPhaseOne = 0u;
+    _q.maxNoElemsPhaseTwo = 0u;
+    _q.noFramesScattered  = 0u;
+    _q.maxNoFragments     = 0u;
+    _q.noFramesCoalesced  = 0u;
 #endif
 } /* nif_queueTxPBuf_initModule */
 
@@ -214,8 +252,14 @@ void nif_queueTxPBuf_initModule(void)
  * The pbuf to send by reference. The function request (partial) ownership of the pbuf by
  * incrementing its reference counter. (The queue will decrement the reference counter and
  * potentially delete the pbuf on dequeuing.)
+ *   @param isCoalesced
+ * \a true if \a pPBuf is a copy of a chain, which had too many elements for the Tx ring.
+ * Only used for the statistics.
  */
-err_t nif_queueTxPBuf_enqueue(unsigned int idxEthDev, struct pbuf * const pPBuf)
+err_t nif_queueTxPBuf_enqueue( unsigned int idxEthDev
+                             , struct pbuf * const pPBuf
+                             , bool isCoalesced ATTRIB_UNUSED
+                             )
 {
     if(!isFull())
     {
@@ -226,11 +270,6 @@ err_t nif_queueTxPBuf_enqueue(unsigned int idxEthDev, struct pbuf * const pPBuf)
            reference counter. */
         pbuf_ref(pPBuf);
         pElem->pPBuf = pPBuf;
-#ifdef DEBUG
-        /* In DEBUG compilation we have a self-test, checking for consistent status, which
-           requires hTxFrame to be zero for newly enqueued pbufs. */
-        pElem->hTxFrame = 0u;
-#endif
         _q.idxTail = inc(_q.idxTail);
         assert(hasPhase1());
 
@@ -241,6 +280,19 @@ err_t nif_queueTxPBuf_enqueue(unsigned int idxEthDev, struct pbuf * const pPBuf)
             _q.maxNoElems = noPBufs;
         if(noPBufsPhase1 > _q.maxNoElemsPhaseOne)
             _q.maxNoElemsPhaseOne = noPBufsPhase1;
+
+        unsigned int noFragments = 0u;
+        for(const struct pbuf *pElem=pPBuf; pElem!=NULL; pElem=pElem->next)
+        {
+            if(pElem->len > 0u)
+                ++ noFragments;
+        }
+        if(noFragments > 1u)
+            ++ _q.noFramesScattered;
+        if(noFragments > _q.maxNoFragments)
+            _q.maxNoFragments = noFragments;
+        if(isCoalesced)
+            ++ _q.noFramesCoalesced;
 #endif
         return ERR_OK;
     }
@@ -255,21 +307,24 @@ err_t nif_queueTxPBuf_enqueue(unsigned int idxEthDev, struct pbuf * const pPBuf)
 
 
 /**
- * Query the queue for the eldest contained pbuf, which is still in phase one. This is the
- * very one, which needs to be handed over to the Ethernet driver as next.\n
- *   The function can be used, too, to query if the queue contains at least one pbuf in
- * phase one.
+ * Query the queue for one of the contained pbufs, which are still in phase one. The
+ * eldest of them is the very one, which needs to be handed over to the Ethernet driver as
+ * next.\n
+ *   The function can be used, too, to query if the queue contains at least \a idxPBuf+1
+ * pbufs in phase one.
  *   @return
- * If a pbuf in phase one is contained then get the eldest of those by reference. The
- * reference grants write access; normal use case it using it to associate the pbuf with
- * the handle to the ring buffer element, which is applied by the Ethernet driver for
- * transmitting the pbuf.\n
- *   The function returns NULL if the queue doesn't contain any such pbuf.
+ * If the queue contains more than \a idxPBuf pbufs in phase one then get the wanted one
+ * by reference. The reference grants read access only.\n
+ *   The function returns NULL if the queue doesn't contain such a pbuf.
+ *   @param idxPBuf
+ * The pbufs in phase one are addressed to by zero based index in order of enqueuing,
+ * i.e., 0 is the eldest one.
  */
-struct nif_queueElemTxPBuf_t * nif_queueTxPBuf_getPBufWaitingForSubmission(void)
+const struct nif_queueElemTxPBuf_t *
+                        nif_queueTxPBuf_getPBufWaitingForSubmission(unsigned int idxPBuf)
 {
-    if(hasPhase1())
-        return &_q.data[_q.idxHeadPhaseOne];
+    if(idxPBuf < noElemsPhase1())
+        return &_q.data[add(_q.idxHeadPhaseOne, idxPBuf)];
     else
         return NULL;
         
@@ -298,36 +353,117 @@ const struct nif_queueElemTxPBuf_t *
 
 
 /**
- * Signal for the eldest pbuf still in phase one that it has entered phase two.
- * This function is used, when a queued pbuf has been accepted by the ETH driver for
+ * Get the number of pbufs in phase two, i.e., the number of frames, which have been handed
+ * over to the ETH driver and which have not been reported completed yet.
+ *   @return
+ * Get the number of pbufs. Range is 0..#ETH_ENET0_RING0_NO_TXBD.
+ */
+unsigned int nif_queueTxPBuf_getNoPBufsWaitingForTransmissionComplete(void)
+{
+    return noElemsPhase2();
+
+} /* nif_queueTxPBuf_getNoPBufsWaitingForTransmissionComplete */
+
+
+/**
+ * Get the number of pbufs, which can still be queued before the queue is full and
+ * nif_queueTxPBuf_enqueue() fails.
+ *   @return
+ * Get the number of free elements. Range is 0..#CAPACITY_QUEUE_TX_PBUF.
+ */
+unsigned int nif_queueTxPBuf_getNoFreeElems(void)
+{
+    return CAPACITY_QUEUE_TX_PBUF - noElems();
+
+} /* nif_queueTxPBuf_getNoFreeElems */
+
+
+/**
+ * Signal for a number of the eldest pbufs still in phase one that they have entered phase
+ * two. This function is used, when queued pbufs have been accepted by the ETH driver for
  * transmission.
+ *   @param noPBufs
+ * The number of pbufs, which have been accepted by the ETH driver. They are the eldest
+ * ones in phase one. Range is 1..n, where n is the number of pbufs in phase one.
  */
-void nif_queueTxPBuf_advancePBufWaitingForSubmission(void)
+void nif_queueTxPBuf_advancePBufsWaitingForSubmission(unsigned int noPBufs)
 {
     /* Only pbufs in phase one can be advanced (to phase two). */
-    assert(hasPhase1());
-    _q.idxHeadPhaseOne = inc(_q.idxHeadPhaseOne);
+    assert(noPBufs > 0u  &&  noPBufs <= noElemsPhase1());
+    _q.idxHeadPhaseOne = add(_q.idxHeadPhaseOne, noPBufs);
     assert(hasPhase2());
 
-} /* nif_queueTxPBuf_advancePBufWaitingForSubmission */
+#if NIF_SUPPORT_BUFFER_USAGE_STATISTICS == 1
+    const unsigned int noPBufsPhase2 = noElemsPhase2();
+    if(noPBufsPhase2 > _q.maxNoElemsPhaseTwo)
+        _q.maxNoElemsPhaseTwo = noPBufsPhase2;
+#endif
+
+} /* nif_queueTxPBuf_advancePBufsWaitingForSubmission */
 
 
 /**
- * Pop the eldest pbuf from the queue and decrement its reference counter. (In most typical
- * situations, this will also delete the pbuf.) Use case is to call this function, when the
- * Ethernet driver has signalled completion of transmission for its next ring buffer
- * element.
+ * Pop a number of the eldest pbufs from the queue and decrement their reference counters.
+ * (In most typical situations, this will also delete the pbufs.) Use case is to call this
+ * function, when the Ethernet driver has signalled completion of transmission for a number
+ * of frames.
+ *   @param noPBufs
+ * The number of pbufs to remove. Range is 1..n, where n is the number of pbufs in phase
+ * two.
  */
-void nif_queueTxPBuf_dequeue(void)
+void nif_queueTxPBuf_dequeue(unsigned int noPBufs)
 {
     /* Only pbufs in phase two can be dequeued. */
-    assert(hasPhase2());
-    struct nif_queueElemTxPBuf_t * const pElem = &_q.data[_q.idxHead];
-    
-    /* The next pbuf in the chain has been entirely processed by the ETH driver and
-       we can free the source memory, i.e., the pbuf... */
-    pbuf_free(pElem->pPBuf);
-    
-    _q.idxHead = inc(_q.idxHead);
-
+    assert(noPBufs > 0u  &&  noPBufs <= noElemsPhase2());
+    while(noPBufs-- > 0u)
+    {
+        /* The next pbuf in the chain has been entirely processed by the ETH driver and
+           we can free the source memory, i.e., the pbuf... */
+        pbuf_free(_q.data[_q.idxHead].pPBuf);
+        _q.idxHead = inc(_q.idxHead);
+    }
 } /* nif_queueTxPBuf_dequeue */
+
+
+
+#if NIF_SUPPORT_BUFFER_USAGE_STATISTICS == 1
+/**
+ * Get the buffer usage statistics of the queue. The statistics help finding the right
+ * queue size, #NIF_NO_TX_PBUFS_WAITING_FOR_ETH, and they indicate how many frames the Tx ring
+ * buffer of the ETH driver held at maximum.
+ *   @param pStatistics
+ * The statistics are returned in * \a pStatistics.
+ *   @param reset
+ * If \a true, then the recording of maximum values and lost elements is restarted after
+ * reading the statistics. The maximum values are set to the current queue usage and the
+ * counts of lost elements and of scattered and coalesced frames are cleared.
+ *   @remark
+ * The function must be called from the context of the lwIP stack, which enqueues and
+ * dequeues the pbufs.
+ */
+void nif_queueTxPBuf_getStatistics( struct nif_queueTxPBufStatistics_t * const pStatistics
+                                  , bool reset
+                                  )
+{
+    pStatistics->capacity = CAPACITY_QUEUE_TX_PBUF;
+    pStatistics->noElems = noElems();
+    pStatistics->maxNoElems = _q.maxNoElems;
+    pStatistics->maxNoElemsPhaseOne = _q.maxNoElemsPhaseOne;
+    pStatistics->maxNoElemsPhaseTwo = _q.maxNoElemsPhaseTwo;
+    pStatistics->noElemsLost = _q.noElemsLost;
+    pStatistics->noFramesScattered = _q.noFramesScattered;
+    pStatistics->maxNoFragments = _q.maxNoFragments;
+    pStatistics->noFramesCoalesced = _q.noFramesCoalesced;
+
+    if(reset)
+    {
+        _q.noElemsLost = 0u;
+        _q.noFramesScattered = 0u;
+        _q.maxNoFragments = 0u;
+        _q.noFramesCoalesced = 0u;
+        _q.maxNoElems = noElems();
+        _q.maxNoElemsPhaseOne = noElemsPhase1();
+        _q.maxNoElemsPhaseTwo = noElemsPhase2();
+    }
+} /* nif_queueTxPBuf_getStatistics */
+#endif
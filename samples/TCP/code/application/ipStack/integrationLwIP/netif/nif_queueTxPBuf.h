@@ -43,6 +43,13 @@
 # endif
 #endif
 
+/** The number of Tx pbufs, which can be queued while waiting for the ETH driver to accept
+    them, i.e., while its Tx ring is occupied. The capacity of the queue is this number
+    plus #ETH_ENET0_RING0_NO_TXBD, the maximum number of frames in the Tx ring. */
+#ifndef NIF_NO_TX_PBUFS_WAITING_FOR_ETH
+# define NIF_NO_TX_PBUFS_WAITING_FOR_ETH    12u
+#endif
+
 /*
  * Global type definitions
  */
@@ -56,12 +63,45 @@ struct nif_queueElemTxPBuf_t
     
     /** The pbuf in prgress by reference. */
     struct pbuf *pPBuf;
+};
+
+#if NIF_SUPPORT_BUFFER_USAGE_STATISTICS == 1
+/** The usage statistics of the Tx pbuf queue, see nif_queueTxPBuf_getStatistics(). */
+struct nif_queueTxPBufStatistics_t
+{
+    /** The maximum number of queueable Tx pbufs. */
+    unsigned int capacity;
+
+    /** The number of currently queued pbufs. */
+    unsigned int noElems;
+
+    /** The maximum ever seen usage of the queue in number of stored elements. */
+    unsigned int maxNoElems;
+
+    /** The maximum ever seen number of stored elements, which were in phase one, i.e.,
+        which were waiting for a free element in the ring buffer of the ETH driver. */
+    unsigned int maxNoElemsPhaseOne;
+
+    /** The maximum ever seen number of stored elements, which were in phase two. Each of
+        them is a frame in the Tx ring buffer of the ETH driver. */
+    unsigned int maxNoElemsPhaseTwo;
 
-    /** The handle of the submitted, pending frame as got from the Ethernet driver, when
-        initiating the transmission of the pbuf. This field is valid only in phase 2, when
-        a queued pbuf was handed over to the Ethernet driver. */
-    uintptr_t hTxFrame;
+    /** The number of pbufs, which are lost so far because of queue full events. */
+    unsigned int noElemsLost;
+
+    /** The number of queued pbufs, which were chained, i.e., whose frames were scattered
+        over several Tx buffer descriptors. */
+    unsigned int noFramesScattered;
+
+    /** The maximum ever seen number of non-empty elements of a queued pbuf, i.e., the
+        number of Tx buffer descriptors occupied by a single frame. */
+    unsigned int maxNoFragments;
+
+    /** The number of frames, which had to be copied into a single pbuf because their chain
+        had more elements than the Tx ring has buffer descriptors. */
+    unsigned int noFramesCoalesced;
 };
+#endif
 
 /*
  * Global data declarations
@@ -76,21 +116,39 @@ struct nif_queueElemTxPBuf_t
 void nif_queueTxPBuf_initModule(void);
 
 /** A buf is put into the queue, when lwIP calls the output function for the pbuf. */
-err_t nif_queueTxPBuf_enqueue(unsigned int idxEthDev, struct pbuf * const pPBuf);
+err_t nif_queueTxPBuf_enqueue( unsigned int idxEthDev
+                             , struct pbuf * const pPBuf
+                             , bool isCoalesced
+                             );
 
-/** After the ETH driver has signalled transmission-complete for the eldest pbuf, this pbuf
-    - the head of the queue - can be removed from the queue. */
-void nif_queueTxPBuf_dequeue(void);
+/** After the ETH driver has signalled transmission-complete for a number of frames, the
+    according, eldest pbufs - the head of the queue - can be removed from the queue. */
+void nif_queueTxPBuf_dequeue(unsigned int noPBufs);
 
-/** Query the queue for the eldest pbuf, which is still in phase one. */
-struct nif_queueElemTxPBuf_t * nif_queueTxPBuf_getPBufWaitingForSubmission(void);
+/** Query the queue for one of the pbufs, which are still in phase one. */
+const struct nif_queueElemTxPBuf_t *
+                        nif_queueTxPBuf_getPBufWaitingForSubmission(unsigned int idxPBuf);
 
 /** Query the queue for the eldest pbuf, which is waiting for transmission complete. */
 const struct nif_queueElemTxPBuf_t * 
                                 nif_queueTxPBuf_getPBufWaitingForTransmissionComplete(void);
 
-/** Signal for the eldest pbuf still in phase one that it has entered phase two. */
-void nif_queueTxPBuf_advancePBufWaitingForSubmission(void);
+/** Get the number of pbufs in phase two, which are waiting for transmission complete. */
+unsigned int nif_queueTxPBuf_getNoPBufsWaitingForTransmissionComplete(void);
+
+/** Get the number of pbufs, which can still be queued. */
+unsigned int nif_queueTxPBuf_getNoFreeElems(void);
+
+/** Signal for a number of the eldest pbufs still in phase one that they have entered phase
+    two. */
+void nif_queueTxPBuf_advancePBufsWaitingForSubmission(unsigned int noPBufs);
+
+#if NIF_SUPPORT_BUFFER_USAGE_STATISTICS == 1
+/** Get the buffer usage statistics of the queue and optionally restart the recording. */
+void nif_queueTxPBuf_getStatistics( struct nif_queueTxPBufStatistics_t * const pStatistics
+                                  , bool reset
+                                  );
+#endif
 
 
 
@@ -33,12 +33,12 @@
  * The shell command should terminate with a message like this one:\n
  *   Transfer successful: 1750 bytes in 1 second(s), 1750 bytes/s\n
  * and you could inspect the contents of the received "file" test.txt in your text editor.
- *   The application integrates a basic HTTP server. From a shell window, submit the
- * command:\n
- *   curl http://192.168.1.200/get -o - or\n
- *   curl http://DEVKIT-MPC5748G/get -o -\n
- * to fetch the HTML code of the "web page". You can also use this address from an Internet
- * browser.
+ *   The application integrates an HTTP/1.1 server, which serves a diagnostics dashboard.
+ * From a shell window, submit the command:\n
+ *   curl http://192.168.1.200/status.json or\n
+ *   curl http://DEVKIT-MPC5748G/status.json\n
+ * to fetch the current status object. Point an Internet browser to http://192.168.1.200/
+ * to see the dashboard, which is updated every two seconds.
  *
  * Copyright (C) 2023-2024 Peter Vranken (mailto:Peter_Vranken@Yahoo.de)
  *
@@ -77,6 +77,7 @@
 #include "rtos.h"
 #include "MPC5748G.h"
 #include "bsw_basicSoftware.h"
+#include "bsw_taskEthernet.h"
 #include "lwip_lwIPMainFunction.h"
 #include "clg_canLoggerOnTCP.h"
 #include "lwipopts.h"
@@ -85,6 +86,9 @@
 #include "apt_applicationTask.h"
 #include "ping.h"
 #include "ats_accessTimeServer.h"
+#include "umt_udpMulticastTelemetry.h"
+#include "cgw_canGatewayUdp.h"
+#include "lws_lwIPStatistics.h"
 
 
 /*
@@ -148,6 +152,28 @@ void lwd_lwIpDemo_init(void)
     /* The initialization function of the time service application. */
     ats_initAccessTimeService();
 
+    /* The initialization function of the CAN telemetry on UDP multicast. */
+    if(umt_initUdpMulticastTelemetry())
+    {
+        iprintf("CAN telemetry is published to UDP multicast group " UMT_MULTICAST_GROUP_STR
+                ":%u\r\n"
+               , UMT_UDP_PORT
+               );
+    }
+    else
+        iprintf("CAN telemetry on UDP multicast can't be started. Out of memory?\r\n");
+
+    /* The initialization function of the CAN-over-UDP gateway. */
+    if(cgw_initCanGatewayUdp())
+    {
+        iprintf("CAN-over-UDP gateway started on UDP port %u. Try: cgw_hostPeer.exe"
+                " 192.168.1.200 vcan0\r\n"
+               , CGW_UDP_PORT_BUS_0
+               );
+    }
+    else
+        iprintf("CAN-over-UDP gateway can't be started. Out of memory?\r\n");
+
 } /* lwd_lwIpDemo_init */
 
 
@@ -167,9 +193,10 @@ void lwd_lwIpDemo_init(void)
  * The task is activated by Ethernet frame reception or transmission complete and by
  * regular timer events.
  *   @param noNotificationsRx
- * The number of Ethernet frame Rx events since last activation of the task. This number of
- * Ethernet frames is currently buffered in the driver, waits for fetching and needs
- * processing.
+ * The number of Ethernet frame Rx events since last activation of the task. At least this
+ * number of Ethernet frames is currently buffered in the driver, waits for fetching and
+ * needs processing. With interrupt mitigation (#ETH_RX_INTERRUPT_MITIGATION), there is only
+ * one event per drained Rx ring, regardless of the number of frames.
  *   @param noNotificationsTx
  * The number of Ethernet frame Tx events since last activation of the task. The driver has
  * buffer space available to submitted at least this number of Ethernet frames for
@@ -177,7 +204,9 @@ void lwd_lwIpDemo_init(void)
  * reception; a packet is sent on demand by the peer, e.g., by ACKnowledge of the preceding
  * packet.)
  *   @param noNotificationsTimer
- * This number of timer events has been occurred since last activation of the task. 
+ * This number of timer events has been occurred since last activation of the task.\n
+ *   All three counts are zero if the task has triggered itself to continue fetching Rx
+ * frames, see bsw_retriggerEthernetTask().
  */
 void lwd_lwIpDemo_main( unsigned int noNotificationsRx
                       , unsigned int noNotificationsTx
@@ -191,9 +220,22 @@ void lwd_lwIpDemo_main( unsigned int noNotificationsRx
         lwip_onEthBufferTxComplete();
 
     /* Activity: The Ethernet driver has one or more new Rx frames, which we fetch and hand
-       over to lwIP for evaluation and response. */
-    if(noNotificationsRx > 0u)
+       over to lwIP for evaluation and response. If the poll exhausts its budget, then the
+       task triggers itself to fetch the remaining frames with its next activation. The
+       frames are not left in the Rx ring until the next timer tick, where they would
+       block reception, but tasks of higher priority and the Tx complete and timer events
+       of this task are still served in between. If the responses to the frames fill the
+       Tx queue faster than the link can send them, then we don't trigger ourselves but
+       continue with the next Tx complete event, which comes along with free queue space. */
+    if(noNotificationsRx > 0u  ||  lwip_ethIfIsRxPollPending())
+    {
         lwip_ethIfPollAllInterfaces();
+        if(lwip_ethIfIsRxPollPending()  &&  !lwip_ethIfIsTxCongested())
+        {
+            const bool success ATTRIB_DBG_ONLY = bsw_retriggerEthernetTask();
+            assert(success);
+        }
+    }
 
     if(noNotificationsTimer > 0u)
     {
@@ -203,6 +245,15 @@ void lwd_lwIpDemo_main( unsigned int noNotificationsRx
         /* The step function of the time service application. */
         ats_mainFunction();
 
+        /* The step function of the CAN telemetry: Publish the frames of the last tick. */
+        umt_mainFunction();
+
+        /* The step function of the CAN-over-UDP gateway. */
+        cgw_mainFunction();
+
+        /* The step function of the memory statistics: Take a requested snapshot. */
+        lws_mainFunction();
+
 #if LWIP_PING_APP && LWIP_RAW && LWIP_ICMP
         /* The following looks crude but the state machine in the ping application makes it
            work fine. It is ensured that the user can enable and disable ping and switch
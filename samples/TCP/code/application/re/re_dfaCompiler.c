@@ -0,0 +1,1049 @@
+/**
+ * @file re_dfaCompiler.c
+ * Generation of a deterministic finite automaton (DFA) from a compiled regular expression.
+ * The generation is done on the development machine, as part of the demo application
+ * regExpDemo, and the DFA is exported as C source code. On the embedded target, the DFA
+ * is matched with the table walking matcher re_matchDFA(), which costs two table lookups
+ * per input character and no further memory.\n
+ *   The DFA is the subset construction of the lockstep matcher re_matchPikeVM(): A state
+ * of the DFA is the ordered list of threads, which the lockstep matcher has after a given
+ * input, and a transition is the step of the lockstep matcher from one character to the
+ * next. Since the threads are ordered by priority and since a thread, which has
+ * completed the match, cuts all threads of lower priority, the DFA yields the same match
+ * as re_match() and re_matchPikeVM(), including the end of the match.\n
+ *   Captured groups are not generally supported; the threads of a DFA state would need
+ * to carry an individual copy of the captured groups. The DFA supports a single capture
+ * group, which is the final element of the regular expression, e.g., "Date: <.*>". Its
+ * end is the end of the match and its beginning is recorded as a flag of the state,
+ * which is entered when the capture group begins. This is possible only if all threads
+ * of a state, which are inside the capture group, have entered it at the same input
+ * character. The generation fails if this is not the case.\n
+ *   The input characters are mapped onto equivalence classes before looking up the
+ * transition. Two characters are in the same class if all instructions of the expression,
+ * which consume an input character, either accept or reject both of them. The classes are
+ * determined from the character sets of these instructions. Real expressions have much
+ * less classes than 256 and the transition table becomes accordingly small.
+ *
+ * Copyright (C) 2026 Peter Vranken (mailto:Peter_Vranken@Yahoo.de)
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+/* Module interface
+ *   re_dfaCompile
+ *   re_exportDFA
+ * Local functions
+ *   getUInt16
+ *   getLenOfInstruction
+ *   isCntLoop
+ *   isConsumingInstruction
+ *   isCharAccepted
+ *   checkRegExp
+ *   findCharClasses
+ *   getSuccessor
+ *   beginClosure
+ *   addThread
+ *   runClosure
+ *   addState
+ */
+
+/*
+ * Include files
+ */
+
+#include "re_dfaCompiler.h"
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <ctype.h>
+#include <assert.h>
+
+#include "re_charSet.h"
+
+/*
+ * Defines
+ */
+
+
+/*
+ * Local type definitions
+ */
+
+/** The threads, which are reached from a set of threads without consuming an input
+    character. */
+struct closure_t
+{
+    /** The closure is formed at the beginning of the input. The anchor ^ matches. */
+    bool atStart;
+
+    /** The closure is formed at the end of the input. The anchor $ matches. */
+    bool atEnd;
+
+    /** The threads, which consume the next input character, and the matching thread are
+        stored in this list, in the order of priority. May be NULL if only the match is of
+        interest. */
+    struct re_dfaThread_t *listAry;
+
+    /** The number of threads in \a listAry. */
+    unsigned int noThreads;
+
+    /** The capacity of \a listAry. */
+    unsigned int maxNoThreads;
+
+    /** A thread has completed the match. All threads of lower priority are dropped. */
+    bool hasMatch;
+
+    /** The thread, which has completed the match, if \a hasMatch is set. */
+    struct re_dfaThread_t match;
+};
+
+
+/*
+ * Local prototypes
+ */
+
+
+/*
+ * Data definitions
+ */
+
+
+/*
+ * Function implementation
+ */
+
+#if RE_REQUIRE_COMPILER == 1  &&  RE_REQUIRE_MATCHER == 1
+/**
+ * Read a 16 Bit argument of an instruction.
+ *   @return
+ * Get the value.
+ *   @param pArg
+ * The argument by reference. It is stored with the most significant Byte first.
+ */
+static inline unsigned int getUInt16(const uint8_t * const pArg)
+{
+    return ((unsigned int)pArg[0] << 8) + pArg[1];
+
+} /* getUInt16 */
+
+
+/**
+ * Get the length of an instruction.
+ *   @return
+ * Get the number of Bytes of the instruction.
+ *   @param pI
+ * The instruction by reference.
+ */
+static unsigned int getLenOfInstruction(const uint8_t * const pI)
+{
+    switch(*pI)
+    {
+    case OP_LOOP:
+    case OP_LOOPNG:
+        _Static_assert(LEN_I_LOOP == LEN_I_LOOP_NG, "Implementation can't combine instructions");
+        return LEN_I_LOOP;
+
+    case OP_LOOPEND:
+    case OP_OR:
+    case OP_JMP:
+    case OP_CHARSET:
+        _Static_assert( LEN_I_LOOPEND == 3u  &&  LEN_I_OR == 3u  &&  LEN_I_JMP == 3u
+                        &&  LEN_I_CHARSET == 3u
+                      , "Implementation can't combine instructions"
+                      );
+        return 3u;
+
+    case OP_CAP:
+    case OP_CAPEND:
+    case OP_ESC:
+        _Static_assert( LEN_I_CAP == 2u  &&  LEN_I_CAPEND == 2u  &&  LEN_I_LIT_ESC == 2u
+                      , "Implementation can't combine instructions"
+                      );
+        return 2u;
+
+    default:
+        return 1u;
+    }
+} /* getLenOfInstruction */
+
+
+/**
+ * Check if a loop needs a cycle counter. Needs to be the same decision as in the matcher,
+ * see isCntLoop() in re_regExpMatcher.c.
+ *   @return
+ * Get \a true if a counter needs to be maintained for the loop.
+ *   @param pILoop
+ * The loop instruction by reference.
+ */
+static inline bool isCntLoop(const uint8_t * const pILoop)
+{
+    const unsigned int min = pILoop[3]
+                     , max = pILoop[4];
+    return min > 1u  ||  (max > 1u  &&  max < UINT8_MAX);
+
+} /* isCntLoop */
+
+
+/**
+ * Check if an instruction consumes an input character.
+ *   @return
+ * Get \a true for the immediate match instructions, like literals and character sets.
+ *   @param pI
+ * The instruction by reference.
+ */
+static inline bool isConsumingInstruction(const uint8_t * const pI)
+{
+    return (*pI & 0x80u) == 0u  ||  *pI == OP_ESC  ||  *pI == OP_CHARSET
+           ||  (*pI >= I_DIGIT  &&  *pI <= I_ANY);
+
+} /* isConsumingInstruction */
+
+
+/**
+ * Check if an instruction, which consumes an input character, accepts a given character.
+ * Needs to be the same decision as in the matcher, see immediateMatch() in
+ * re_regExpMatcher.c.
+ *   @return
+ * Get \a true if the character is accepted.
+ *   @param pI
+ * The instruction by reference.
+ *   @param c
+ * The input character.
+ */
+static bool isCharAccepted(const uint8_t * const pI, char c)
+{
+    assert(isConsumingInstruction(pI));
+    if((*pI & 0x80u) == 0u)
+        return c == (char)*pI;
+
+    switch(*pI)
+    {
+    case OP_ESC:
+        return c == (char)pI[1];
+
+    case OP_CHARSET:
+        return re_isCharInCharSet(pI + LEN_I_CHARSET + getUInt16(pI+1), (uint8_t)c);
+
+    case I_ANY:
+        return c != '\n';
+
+    case I_DIGIT:
+        return isdigit((int)c);
+
+    case I_HEXDIGIT:
+        return isdigit((int)c)  ||  (toupper((int)c) >= 'A'  &&  toupper((int)c) <= 'F');
+
+    case I_SPC:
+        return c == ' '  ||  c == '\t'  ||  c == '\f'  ||  c == '\r';
+
+    case I_AZ:
+        return c >= 'a'  &&  c <= 'z';
+
+    case I_LTR:
+        return isalpha((int)c);
+
+    case I_ID1ST:
+        return isalpha((int)c) || c == '_';
+
+    case I_ID:
+        return isalpha((int)c) || isdigit((int)c) || c == '_';
+
+    case I_CRLF:
+        return c == '\r'  ||  c == '\n';
+
+    default:
+        assert(false);
+        return false;
+    }
+} /* isCharAccepted */
+
+
+/**
+ * Check if the DFA can be generated for the compiled regular expression. This relates to
+ * the capture group, to the number of loop counters and to sets of expressions.
+ *   @return
+ * Get \a true if the DFA can be generated. Otherwise, the error is set in the generator
+ * object.
+ *   @param pDC
+ * The DFA generator by reference.
+ */
+static bool checkRegExp(struct re_dfaCompiler_t * const pDC)
+{
+    const struct re_compiledRegExp_t * const pRe = pDC->pRe;
+    const uint8_t * const iStream = pRe->iStream;
+
+    if(pRe->noRegExpsInSet > 0u)
+        pDC->err = re_errDfaComp_regExpSetNotSupported;
+    else if(pRe->noCaptureGrps > 1u)
+        pDC->err = re_errDfaComp_captureGrpNotSupported;
+
+    pDC->noLoopCnts = 0u;
+    for(unsigned int idxI=0u; idxI<pRe->lenIStream  &&  pDC->err == re_errDfaComp_success;)
+    {
+        const uint8_t * const pI = iStream + idxI;
+        if((*pI == OP_LOOP  ||  *pI == OP_LOOPNG)  &&  isCntLoop(pI))
+        {
+            const unsigned int idxLoop = pI[5];
+            if(idxLoop >= RE_DFA_MAX_NO_LOOP_CNTS)
+                pDC->err = re_errDfaComp_maxNoLoopCntsExceeded;
+            else if(idxLoop >= pDC->noLoopCnts)
+                pDC->noLoopCnts = idxLoop + 1u;
+        }
+        else if(*pI == OP_CAPEND)
+        {
+            /* The capture group needs to be the final element: Behind its end, only jumps
+               to the end of an OR expression and the anchor $ are permitted. */
+            unsigned int idxINext = idxI + LEN_I_CAPEND;
+            while(idxINext < pRe->lenIStream)
+            {
+                if(iStream[idxINext] == OP_JMP)
+                    idxINext += LEN_I_JMP + getUInt16(iStream + idxINext + 1u);
+                else if(iStream[idxINext] == I_DOLLAR)
+                    idxINext += LEN_I_DOLLAR;
+                else
+                {
+                    pDC->err = re_errDfaComp_captureGrpNotSupported;
+                    break;
+                }
+            }
+        }
+        idxI += getLenOfInstruction(pI);
+
+    } /* for(All instructions) */
+
+    return pDC->err == re_errDfaComp_success;
+
+} /* checkRegExp */
+
+
+/**
+ * Determine the equivalence classes of the input characters. The set of accepted
+ * characters of each consuming instruction splits the existing classes.
+ *   @param pDC
+ * The DFA generator by reference.
+ */
+static void findCharClasses(struct re_dfaCompiler_t * const pDC)
+{
+    const struct re_compiledRegExp_t * const pRe = pDC->pRe;
+
+    /* Initially, all characters are in one class. */
+    memset(pDC->classAry, 0, sizeof(pDC->classAry));
+    unsigned int noClasses = 1u;
+    for(unsigned int idxI=0u; idxI<pRe->lenIStream; )
+    {
+        const uint8_t * const pI = pRe->iStream + idxI;
+        if(isConsumingInstruction(pI))
+        {
+            re_charSet_t charSet;
+            memset(charSet, 0, sizeof(charSet));
+            unsigned int noCAryIn[UINT8_MAX+1u] = {[0] = 0u,}
+                       , noCAry[UINT8_MAX+1u] = {[0] = 0u,};
+            for(unsigned int c=0u; c<=UINT8_MAX; ++c)
+            {
+                ++ noCAry[pDC->classAry[c]];
+                if(isCharAccepted(pI, (char)c))
+                {
+                    charSet[c/8u] |= (uint8_t)(1u << (c & 7u));
+                    ++ noCAryIn[pDC->classAry[c]];
+                }
+            }
+
+            /* A class, which is partly in the set, is split. The accepted characters form
+               a new class. */
+            unsigned int idxNewClassAry[UINT8_MAX+1u];
+            const unsigned int noClassesBefore = noClasses;
+            for(unsigned int idxClass=0u; idxClass<noClassesBefore; ++idxClass)
+            {
+                if(noCAryIn[idxClass] > 0u  &&  noCAryIn[idxClass] < noCAry[idxClass])
+                {
+                    assert(noClasses <= UINT8_MAX);
+                    idxNewClassAry[idxClass] = noClasses++;
+                }
+                else
+                    idxNewClassAry[idxClass] = idxClass;
+            }
+            for(unsigned int c=0u; c<=UINT8_MAX; ++c)
+            {
+                if(re_isCharInCharSet(charSet, (uint8_t)c))
+                    pDC->classAry[c] = (uint8_t)idxNewClassAry[pDC->classAry[c]];
+            }
+        }
+        idxI += getLenOfInstruction(pI);
+
+    } /* for(All instructions) */
+
+    /* Any character of a class can represent it when determining the transitions. */
+    for(unsigned int c=UINT8_MAX+1u; c-->0u; )
+        pDC->cRepresentativeAry[pDC->classAry[c]] = (uint8_t)c;
+    pDC->dfa.noClasses = noClasses;
+
+} /* findCharClasses */
+
+
+/**
+ * Get the successor of a thread, which points at an instruction, which doesn't consume
+ * an input character. This is the same as getSuccessor() in re_regExpMatcher.c, but the
+ * captured group is reduced to a flag.
+ *   @return
+ * Get \a true if the requested successor exists.
+ *   @param pDC
+ * The DFA generator by reference.
+ *   @param pT
+ * The thread by reference, whose successor is requested.
+ *   @param idxSuccessor
+ * 0 for the first successor, 1 for the second one.
+ *   @param pSuccessor
+ * If the function returns \a true then the successor thread has been written into * \a
+ * pSuccessor.
+ *   @param pHasSecondSuccessor
+ * The function returns by reference whether the thread has a second successor.
+ *   @param pClosure
+ * The closure, which the thread belongs to. It tells whether the anchors match.
+ */
+static bool getSuccessor( const struct re_dfaCompiler_t * const pDC
+                        , const struct re_dfaThread_t * const pT
+                        , unsigned int idxSuccessor
+                        , struct re_dfaThread_t * const pSuccessor
+                        , bool * const pHasSecondSuccessor
+                        , const struct closure_t * const pClosure
+                        )
+{
+    const uint8_t * const iStream = pDC->pRe->iStream;
+    const uint8_t *pI = iStream + pT->idxI;
+
+    *pHasSecondSuccessor = false;
+    if(pT->idxI >= pDC->pRe->lenIStream
+       ||  !((*pI >= OP_LOOP  &&  *pI <= OP_CAPEND)  ||  *pI == I_CARET  ||  *pI == I_DOLLAR)
+      )
+    {
+        return false;
+    }
+
+    *pSuccessor = *pT;
+    bool hasSuccessor = true;
+    if(*pI == OP_LOOP  ||  *pI == OP_LOOPNG)
+    {
+        const bool isGreedy = *pI == OP_LOOP
+                 , isCnt = isCntLoop(pI);
+        const unsigned int lenIBody = getUInt16(pI+1)
+                         , min = pI[3]
+                         , idxLoop = pI[5];
+        pI += LEN_I_LOOP;
+        if(isCnt)
+            pSuccessor->loopCntAry[idxLoop] = 0u;
+
+        const bool hasTwoPaths = min == 0u
+                 , takeBody = isGreedy == (idxSuccessor == 0u);
+        *pHasSecondSuccessor = hasTwoPaths;
+        if(!hasTwoPaths  &&  idxSuccessor > 0u)
+            hasSuccessor = false;
+        else if(hasTwoPaths  &&  !takeBody)
+            pI += lenIBody + LEN_I_LOOPEND;
+    }
+    else if(*pI == OP_LOOPEND)
+    {
+        const uint8_t * const pIBody = pI - getUInt16(pI+1)
+                    , * const pILoop = pIBody - LEN_I_LOOP;
+        const bool isGreedy = *pILoop == OP_LOOP
+                 , isCnt = isCntLoop(pILoop)
+                 , isUnbounded = pILoop[4] == UINT8_MAX;
+        const unsigned int min = pILoop[3]
+                         , max = pILoop[4]
+                         , idxLoop = pILoop[5];
+        pI += LEN_I_LOOPEND;
+
+        unsigned int cnt = 1u;
+        if(isCnt)
+            cnt += pT->loopCntAry[idxLoop];
+        const bool cntPermitsTwoPaths = cnt >= min  &&  (isUnbounded ||  cnt < max)
+                 , cntForcesBreak = !isUnbounded &&  cnt >= max;
+        *pHasSecondSuccessor = cntPermitsTwoPaths;
+
+        bool takeBody;
+        if(cntPermitsTwoPaths)
+            takeBody = isGreedy == (idxSuccessor == 0u);
+        else
+        {
+            takeBody = !cntForcesBreak;
+            if(idxSuccessor > 0u)
+                hasSuccessor = false;
+        }
+
+        if(hasSuccessor)
+        {
+            if(takeBody)
+            {
+                pI = pIBody;
+                if(isCnt)
+                {
+                    if(isUnbounded &&  cnt > min)
+                        cnt = min;
+                    pSuccessor->loopCntAry[idxLoop] = (uint8_t)cnt;
+                }
+            }
+            else if(isCnt)
+                pSuccessor->loopCntAry[idxLoop] = 0u;
+        }
+    }
+    else if(*pI == OP_OR)
+    {
+        *pHasSecondSuccessor = true;
+        if(idxSuccessor > 0u)
+            pI += getUInt16(pI+1);
+        pI += LEN_I_OR;
+    }
+    else if(idxSuccessor > 0u)
+    {
+        /* All other instructions have a single successor. */
+        hasSuccessor = false;
+    }
+    else if(*pI == OP_JMP)
+        pI += LEN_I_JMP + getUInt16(pI+1);
+    else if(*pI == OP_CAP)
+    {
+        pI += LEN_I_CAP;
+        pSuccessor->isInCGrp = 1u;
+        pSuccessor->isNewInCGrp = 1u;
+    }
+    else if(*pI == OP_CAPEND)
+    {
+        /* The end of the only supported capture group is the end of the match. */
+        pI += LEN_I_CAPEND;
+    }
+    else if(*pI == I_CARET)
+    {
+        ++ pI;
+        hasSuccessor = pClosure->atStart;
+    }
+    else
+    {
+        assert(*pI == I_DOLLAR);
+        ++ pI;
+        hasSuccessor = pClosure->atEnd;
+    }
+
+    if(hasSuccessor)
+        pSuccessor->idxI = (uint16_t)(pI - iStream);
+
+    return hasSuccessor;
+
+} /* getSuccessor */
+
+
+/**
+ * Prepare the generator for forming a new closure. All threads, which had been visited
+ * for the previous closure, are forgotten.
+ *   @param pDC
+ * The DFA generator by reference.
+ */
+static void beginClosure(struct re_dfaCompiler_t * const pDC)
+{
+    pDC->noClosureThreads = 0u;
+    if(++pDC->stamp == 0u)
+    {
+        memset(pDC->stampAry, 0, sizeof(pDC->stampAry));
+        pDC->stamp = 1u;
+    }
+} /* beginClosure */
+
+
+/**
+ * Add a thread to a closure. Like addThread() in re_regExpMatcher.c, all threads, which
+ * are reached from the thread without consuming an input character, are visited in
+ * priority order and each of them only once. The threads, which consume the next input
+ * character, are stored in the closure. Once a thread completes the match, the closure is
+ * complete; all threads still to come would have a lower priority.
+ *   @param pDC
+ * The DFA generator by reference.
+ *   @param pClosure
+ * The closure by reference.
+ *   @param pT
+ * The thread to add by reference.
+ */
+static void addThread( struct re_dfaCompiler_t * const pDC
+                     , struct closure_t * const pClosure
+                     , const struct re_dfaThread_t * const pT
+                     )
+{
+    if(pClosure->hasMatch)
+        return;
+
+    unsigned int noStackElems = 0u;
+    if(pDC->noClosureThreads >= RE_DFA_MAX_NO_CLOSURE_THREADS)
+    {
+        pDC->err = re_errDfaComp_maxNoThreadsExceeded;
+        return;
+    }
+    pDC->closureAry[pDC->noClosureThreads] = *pT;
+
+    while(pDC->err == re_errDfaComp_success)
+    {
+        const unsigned int idxCand = pDC->noClosureThreads;
+        struct re_dfaThread_t * const pCand = &pDC->closureAry[idxCand];
+        bool isNew = pDC->stampAry[pCand->idxI] != pDC->stamp;
+        if(isNew)
+            pDC->stampAry[pCand->idxI] = pDC->stamp;
+        else if(pDC->noLoopCnts > 0u)
+        {
+            isNew = true;
+            for(unsigned int idxT=0u; idxT<idxCand; ++idxT)
+            {
+                const struct re_dfaThread_t * const pT = &pDC->closureAry[idxT];
+                if(pT->idxI == pCand->idxI
+                   &&  memcmp(pT->loopCntAry, pCand->loopCntAry, pDC->noLoopCnts) == 0
+                  )
+                {
+                    isNew = false;
+                    break;
+                }
+            }
+        }
+
+        bool hasCand = false;
+        if(isNew)
+        {
+            ++ pDC->noClosureThreads;
+
+            const bool isMatch = pCand->idxI == pDC->pRe->lenIStream;
+            if(isMatch  ||  isConsumingInstruction(pDC->pRe->iStream + pCand->idxI))
+            {
+                if(pClosure->listAry != NULL)
+                {
+                    if(pClosure->noThreads < pClosure->maxNoThreads)
+                        pClosure->listAry[pClosure->noThreads++] = *pCand;
+                    else
+                    {
+                        pDC->err = re_errDfaComp_maxNoThreadsExceeded;
+                        break;
+                    }
+                }
+                if(isMatch)
+                {
+                    pClosure->hasMatch = true;
+                    pClosure->match = *pCand;
+                    break;
+                }
+            }
+
+            if(pDC->noClosureThreads >= RE_DFA_MAX_NO_CLOSURE_THREADS)
+            {
+                pDC->err = re_errDfaComp_maxNoThreadsExceeded;
+                break;
+            }
+
+            bool hasSecondSuccessor;
+            hasCand = getSuccessor( pDC
+                                  , pCand
+                                  , /*idxSuccessor*/ 0u
+                                  , &pDC->closureAry[pDC->noClosureThreads]
+                                  , &hasSecondSuccessor
+                                  , pClosure
+                                  );
+            if(hasSecondSuccessor)
+                pDC->closureStackAry[noStackElems++] = (uint16_t)idxCand;
+        }
+
+        while(!hasCand  &&  noStackElems > 0u)
+        {
+            bool hasSecondSuccessor __attribute__((unused));
+            const unsigned int idxT = pDC->closureStackAry[--noStackElems];
+            hasCand = getSuccessor( pDC
+                                  , &pDC->closureAry[idxT]
+                                  , /*idxSuccessor*/ 1u
+                                  , &pDC->closureAry[pDC->noClosureThreads]
+                                  , &hasSecondSuccessor
+                                  , pClosure
+                                  );
+            assert(hasSecondSuccessor);
+        }
+
+        if(!hasCand)
+            break;
+
+    } /* while(All threads reached from the added one) */
+
+} /* addThread */
+
+
+/**
+ * Form the closure of a list of threads, optionally after consuming an input character.
+ *   @param pDC
+ * The DFA generator by reference.
+ *   @param pClosure
+ * The closure by reference. On entry, the fields, which tell about the position in the
+ * input and the list for the threads, are set. On exit, it contains the reached threads.
+ *   @param pThreadAry
+ * The threads to start from, in priority order.
+ *   @param noThreads
+ * The number of threads in \a pThreadAry.
+ *   @param doConsume
+ * If \a true then the threads in \a pThreadAry are the threads of a DFA state, which are
+ * advanced by consuming character \a c. Threads, which don't accept \a c, are dropped. If
+ * \a false then the threads in \a pThreadAry are added as they are.
+ *   @param c
+ * The input character to consume.
+ */
+static void runClosure( struct re_dfaCompiler_t * const pDC
+                      , struct closure_t * const pClosure
+                      , const struct re_dfaThread_t * const pThreadAry
+                      , unsigned int noThreads
+                      , bool doConsume
+                      , char c
+                      )
+{
+    beginClosure(pDC);
+    for(unsigned int idxT=0u; idxT<noThreads  &&  pDC->err == re_errDfaComp_success; ++idxT)
+    {
+        const struct re_dfaThread_t *pT = &pThreadAry[idxT];
+        struct re_dfaThread_t successor;
+        if(doConsume)
+        {
+            /* The match, if any, is the last thread of a state. It consumes no more
+               input. */
+            const uint8_t * const pI = pDC->pRe->iStream + pT->idxI;
+            if(pT->idxI >= pDC->pRe->lenIStream  ||  !isCharAccepted(pI, c))
+                continue;
+            successor = *pT;
+            successor.idxI = (uint16_t)(successor.idxI + getLenOfInstruction(pI));
+            successor.isNewInCGrp = 0u;
+            pT = &successor;
+        }
+        addThread(pDC, pClosure, pT);
+    }
+} /* runClosure */
+
+
+/**
+ * Make a DFA state from the closures, which are reached by consuming an input character.
+ * If the same state already exists then this one is reused.
+ *   @return
+ * Get the index of the state. If the generation fails then the error is set in the
+ * generator object and the dead state is returned.
+ *   @param pDC
+ * The DFA generator by reference.
+ *   @param pClosure
+ * The closure of the threads, which is formed assuming that the input doesn't end. Its
+ * threads have been stored at the end of \a threadAry.
+ *   @param pClosureAtEnd
+ * The closure of the threads, which is formed assuming that the input ends.
+ *   @param forceNew
+ * The state is added as a new state, even if the same state exists already. Used for
+ * the start state.
+ */
+static unsigned int addState( struct re_dfaCompiler_t * const pDC
+                            , const struct closure_t * const pClosure
+                            , const struct closure_t * const pClosureAtEnd
+                            , bool forceNew
+                            )
+{
+    if(pDC->err != re_errDfaComp_success)
+        return RE_DFA_IDX_STATE_DEAD;
+
+    /* The beginning of the capture group is a single position in the input. All threads
+       inside the group need to have entered it at the same character. */
+    struct re_dfaThread_t * const listAry = pClosure->listAry;
+    bool isCGrpStart = false
+       , hasThreadInCGrp = false;
+    for(unsigned int idxT=0u; idxT<pClosure->noThreads; ++idxT)
+    {
+        if(listAry[idxT].isNewInCGrp)
+            isCGrpStart = true;
+        else if(listAry[idxT].isInCGrp)
+            hasThreadInCGrp = true;
+    }
+    if(isCGrpStart &&  hasThreadInCGrp)
+    {
+        pDC->err = re_errDfaComp_captureGrpAmbiguous;
+        return RE_DFA_IDX_STATE_DEAD;
+    }
+
+    uint8_t flags = isCGrpStart? RE_DFA_STATE_CGRP_START: 0u;
+    if(pClosure->hasMatch)
+    {
+        flags |= RE_DFA_STATE_MATCH;
+        if(pClosure->match.isInCGrp)
+            flags |= RE_DFA_STATE_MATCH_CGRP;
+    }
+    if(pClosureAtEnd->hasMatch)
+    {
+        flags |= RE_DFA_STATE_MATCH_AT_END;
+        if(pClosureAtEnd->match.isInCGrp)
+        {
+            flags |= RE_DFA_STATE_MATCH_AT_END_CGRP;
+            if((pClosureAtEnd->match.isNewInCGrp != 0u) != isCGrpStart)
+            {
+                pDC->err = re_errDfaComp_captureGrpAmbiguous;
+                return RE_DFA_IDX_STATE_DEAD;
+            }
+        }
+    }
+
+    /* The state is identified by its flags and its threads. When entering the capture
+       group has been recorded by flag then the threads are the same as those inside. */
+    for(unsigned int idxT=0u; idxT<pClosure->noThreads; ++idxT)
+        listAry[idxT].isNewInCGrp = 0u;
+
+    if(!forceNew)
+    {
+        for(unsigned int idxState=0u; idxState<pDC->dfa.noStates; ++idxState)
+        {
+            const unsigned int idxT0 = pDC->idxThreadAry[idxState]
+                             , noThreads = pDC->idxThreadAry[idxState+1u] - idxT0;
+            if(pDC->stateFlagAry[idxState] == flags
+               &&  noThreads == pClosure->noThreads
+               &&  memcmp( &pDC->threadAry[idxT0]
+                         , listAry
+                         , noThreads*sizeof(struct re_dfaThread_t)
+                         ) == 0
+              )
+            {
+                return idxState;
+            }
+        }
+    }
+
+    if(pDC->dfa.noStates >= RE_DFA_MAX_NO_STATES)
+    {
+        pDC->err = re_errDfaComp_maxNoStatesExceeded;
+        return RE_DFA_IDX_STATE_DEAD;
+    }
+    assert(listAry == &pDC->threadAry[pDC->noThreads]);
+    const unsigned int idxState = pDC->dfa.noStates++;
+    pDC->stateFlagAry[idxState] = flags;
+    pDC->noThreads += pClosure->noThreads;
+    pDC->idxThreadAry[idxState+1u] = pDC->noThreads;
+
+    return idxState;
+
+} /* addState */
+
+
+/**
+ * Main API: Generate the DFA for a compiled regular expression.
+ *   @return
+ * Get \a true if the DFA could be generated. The DFA is found in field \a dfa of the
+ * generator object. If \a false is returned then field \a err of the generator object
+ * tells why.
+ *   @param pDfaCompiler
+ * The DFA generator by reference. No fields need to be initialized.
+ *   @param pRe
+ * The compiled regular expression by reference. The DFA refers to it only during
+ * generation.
+ */
+bool re_dfaCompile( struct re_dfaCompiler_t * const pDfaCompiler
+                  , const struct re_compiledRegExp_t * const pRe
+                  )
+{
+    struct re_dfaCompiler_t * const pDC = pDfaCompiler;
+    pDC->pRe = pRe;
+    pDC->err = re_errDfaComp_success;
+    pDC->stamp = 0u;
+    memset(pDC->stampAry, 0, sizeof(pDC->stampAry));
+    pDC->dfa = (struct re_dfa_t){ .classAry = pDC->classAry
+                                , .transitionAry = pDC->transitionAry
+                                , .stateFlagAry = pDC->stateFlagAry
+                                , .noClasses = 0u
+                                , .noStates = 0u
+                                , .noCaptureGrps = pRe->noCaptureGrps
+                                };
+    if(!checkRegExp(pDC))
+        return false;
+
+    findCharClasses(pDC);
+
+    /* The dead state has no threads. */
+    pDC->noThreads = 0u;
+    pDC->idxThreadAry[RE_DFA_IDX_STATE_DEAD] = 0u;
+    pDC->idxThreadAry[RE_DFA_IDX_STATE_DEAD+1u] = 0u;
+    pDC->stateFlagAry[RE_DFA_IDX_STATE_DEAD] = 0u;
+    pDC->dfa.noStates = 1u;
+    memset(&pDC->transitionAry[0], RE_DFA_IDX_STATE_DEAD, pDC->dfa.noClasses);
+
+    /* The start state is the closure of the initial thread at the beginning of the input,
+       where the anchor ^ matches. */
+    const struct re_dfaThread_t t0 = {.idxI = 0u,};
+    struct closure_t closure = { .atStart = true
+                               , .atEnd = false
+                               , .listAry = &pDC->threadAry[pDC->noThreads]
+                               , .maxNoThreads = RE_DFA_MAX_NO_THREADS - pDC->noThreads
+                               }
+                   , closureAtEnd = {.atStart = true, .atEnd = true,};
+    runClosure(pDC, &closure, &t0, /*noThreads*/ 1u, /*doConsume*/ false, /*c*/ '\0');
+    runClosure(pDC, &closureAtEnd, &t0, /*noThreads*/ 1u, /*doConsume*/ false, /*c*/ '\0');
+#ifndef DEBUG
+    __attribute__((unused))
+#endif
+    const unsigned int idxStateStart = addState(pDC, &closure, &closureAtEnd, /*forceNew*/ true);
+    assert(pDC->err != re_errDfaComp_success  ||  idxStateStart == RE_DFA_IDX_STATE_START);
+
+    /* All states are visited in the order of appearance and their successors are
+       determined for each character class. New states are appended and visited later. */
+    for(unsigned int idxState=RE_DFA_IDX_STATE_START;
+        idxState<pDC->dfa.noStates  &&  pDC->err == re_errDfaComp_success;
+        ++idxState
+       )
+    {
+        const unsigned int idxT0 = pDC->idxThreadAry[idxState]
+                         , noThreads = pDC->idxThreadAry[idxState+1u] - idxT0;
+        for(unsigned int idxClass=0u;
+            idxClass<pDC->dfa.noClasses  &&  pDC->err == re_errDfaComp_success;
+            ++idxClass
+           )
+        {
+            const char c = (char)pDC->cRepresentativeAry[idxClass];
+            closure = (struct closure_t){ .atStart = false
+                                        , .atEnd = false
+                                        , .listAry = &pDC->threadAry[pDC->noThreads]
+                                        , .maxNoThreads = RE_DFA_MAX_NO_THREADS
+                                                          - pDC->noThreads
+                                        };
+            closureAtEnd = (struct closure_t){.atStart = false, .atEnd = true,};
+            runClosure(pDC, &closure, &pDC->threadAry[idxT0], noThreads, true, c);
+            runClosure(pDC, &closureAtEnd, &pDC->threadAry[idxT0], noThreads, true, c);
+            pDC->transitionAry[idxState*pDC->dfa.noClasses + idxClass] =
+                                (uint8_t)addState(pDC, &closure, &closureAtEnd, false);
+        }
+    } /* for(All states, including those, which are added in the loop) */
+
+    return pDC->err == re_errDfaComp_success;
+
+} /* re_dfaCompile */
+
+
+/**
+ * Export a generated DFA as fragment of valid C code, which allows integration of the DFA
+ * into some embedded software program. The C code requires the preceding inclusion of
+ * header file re_dfaMatcher.h.
+ *   @param file
+ * The code is written into this stream.
+ *   @param pDfaCompiler
+ * The DFA generator by reference after successful generation.
+ *   @param regExpStr
+ * The regular expression, which the DFA has been generated from. Used for the comments.
+ *   @param namespc
+ * The namespace used for the global elements in the exported C source code snippet. The
+ * passed string will precede the name of all of these elements.
+ *   @param nameRe
+ * The name of the regular expression, see exportCompiledExpression() in
+ * re_regExpCompiler.c. The DFA has the same name with suffix _dfa.
+ */
+void re_exportDFA( FILE *file
+                 , const struct re_dfaCompiler_t * const pDfaCompiler
+                 , const char *regExpStr
+                 , const char *namespc
+                 , const char *nameRe
+                 )
+{
+    const struct re_dfa_t * const pDFA = &pDfaCompiler->dfa;
+
+    fprintf( file
+           , "/** The equivalence classes of the input characters of the DFA of regular\n"
+             "    expression %s. */\n"
+             "static const uint8_t %s%s_dfaClassAry[%u] =\n"
+             "{\n"
+           , nameRe
+           , namespc
+           , nameRe
+           , UINT8_MAX+1u
+           );
+    for(unsigned int c=0u; c<=UINT8_MAX; c+=16u)
+    {
+        fprintf(file, "    /* 0x%02X */", c);
+        for(unsigned int u=0u; u<16u; ++u)
+            fprintf(file, " %3u,", (unsigned)pDFA->classAry[c+u]);
+        fprintf(file, "\n");
+    }
+
+    fprintf( file
+           , "};\n"
+             "\n"
+             "/** The transition table of the DFA of regular expression %s. A row holds the\n"
+             "    successors of a state for all %u character classes. */\n"
+             "static const uint8_t %s%s_dfaTransitionAry[%u] =\n"
+             "{\n"
+           , nameRe
+           , pDFA->noClasses
+           , namespc
+           , nameRe
+           , pDFA->noStates * pDFA->noClasses
+           );
+    for(unsigned int idxState=0u; idxState<pDFA->noStates; ++idxState)
+    {
+        fprintf(file, "    /* State %u */\n", idxState);
+        for(unsigned int idxClass=0u; idxClass<pDFA->noClasses; ++idxClass)
+        {
+            fprintf( file
+                   , "%s %3u,%s"
+                   , idxClass%16u == 0u? "   ": ""
+                   , (unsigned)pDFA->transitionAry[idxState*pDFA->noClasses + idxClass]
+                   , idxClass%16u == 15u  ||  idxClass+1u == pDFA->noClasses? "\n": ""
+                   );
+        }
+    }
+
+    fprintf( file
+           , "};\n"
+             "\n"
+             "/** The flags of the states of the DFA of regular expression %s. */\n"
+             "static const uint8_t %s%s_dfaStateFlagAry[%u] =\n"
+             "{\n"
+           , nameRe
+           , namespc
+           , nameRe
+           , pDFA->noStates
+           );
+    for(unsigned int idxState=0u; idxState<pDFA->noStates; ++idxState)
+    {
+        fprintf( file
+               , "%s 0x%02X,%s"
+               , idxState%16u == 0u? "   ": ""
+               , (unsigned)pDFA->stateFlagAry[idxState]
+               , idxState%16u == 15u  ||  idxState+1u == pDFA->noStates? "\n": ""
+               );
+    }
+
+    fprintf( file
+           , "};\n"
+             "\n"
+             "/** The DFA of regular expression %s:\\n\n"
+             "    %s\\n\n"
+             "      The DFA has %u states, %u character classes and the tables require %u\n"
+             "    Byte. */\n"
+             "static const struct re_dfa_t %s%s_dfa =\n"
+             "{\n"
+             "    .classAry      = &%s%s_dfaClassAry[0],\n"
+             "    .transitionAry = &%s%s_dfaTransitionAry[0],\n"
+             "    .stateFlagAry  = &%s%s_dfaStateFlagAry[0],\n"
+             "    .noClasses     = %uu,\n"
+             "    .noStates      = %uu,\n"
+             "    .noCaptureGrps = %uu,\n"
+             "};\n"
+             "\n"
+             "\n"
+           , nameRe
+           , regExpStr
+           , pDFA->noStates
+           , pDFA->noClasses
+           , UINT8_MAX+1u + pDFA->noStates*(pDFA->noClasses + 1u)
+           , namespc, nameRe
+           , namespc, nameRe
+           , namespc, nameRe
+           , namespc, nameRe
+           , pDFA->noClasses
+           , pDFA->noStates
+           , pDFA->noCaptureGrps
+           );
+} /* re_exportDFA */
+#endif
@@ -0,0 +1,192 @@
+#ifndef RE_DFA_COMPILER_INCLUDED
+#define RE_DFA_COMPILER_INCLUDED
+/**
+ * @file re_dfaCompiler.h
+ * Definition of global interface of module re_dfaCompiler.c
+ *
+ * Copyright (C) 2026 Peter Vranken (mailto:Peter_Vranken@Yahoo.de)
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Include files
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "re_regExpMatcher.h"
+#include "re_regExpCompiler.h"
+#include "re_dfaMatcher.h"
+
+/*
+ * Defines
+ */
+
+/** The maximum number of bounded loops, which need a cycle counter, like x{2,5}. Actually,
+    the limit relates to the loop index: The greatest index of such a loop needs to be less
+    than this number. */
+#define RE_DFA_MAX_NO_LOOP_CNTS             32u
+
+/** The maximum number of threads of all states of the DFA together. A thread is a match
+    path, which has come until an instruction, which consumes an input character. */
+#define RE_DFA_MAX_NO_THREADS               0x4000u
+
+/** The maximum number of threads, which are visited when determining the successor of a
+    state. This includes the threads, which don't consume an input character. */
+#define RE_DFA_MAX_NO_CLOSURE_THREADS       0x1000u
+
+/*
+ * Global type definitions
+ */
+
+/** Enumeration of all possible errors of the DFA generation. */
+enum re_dfaCompilerError_t
+{
+    /** No error, the DFA has been generated. */
+    re_errDfaComp_success,                      /* 0 */
+
+    /** The DFA supports at maximum one capture group. It needs to be the last element of
+        the regular expression; only the anchor $ may follow. */
+    re_errDfaComp_captureGrpNotSupported,       /* 1 */
+
+    /** The captured group would depend on the path through the regular expression; the
+        DFA can't tell, where it begins. An example is \d*<\d+>. */
+    re_errDfaComp_captureGrpAmbiguous,          /* 2 */
+
+    /** The regular expression has too many bounded loops, see #RE_DFA_MAX_NO_LOOP_CNTS. */
+    re_errDfaComp_maxNoLoopCntsExceeded,        /* 3 */
+
+    /** The DFA would need more than #RE_DFA_MAX_NO_STATES states. */
+    re_errDfaComp_maxNoStatesExceeded,          /* 4 */
+
+    /** The DFA would need more threads than #RE_DFA_MAX_NO_THREADS or
+        #RE_DFA_MAX_NO_CLOSURE_THREADS. */
+    re_errDfaComp_maxNoThreadsExceeded,         /* 5 */
+
+    /** A set of regular expressions, see re_compileSet(), can't be converted into a DFA.
+        The DFA can't tell, which of the expressions has matched. */
+    re_errDfaComp_regExpSetNotSupported,        /* 6 */
+};
+
+/** A thread of the DFA generation. This is the same as a thread of the lockstep matcher,
+    re_matchPikeVM(), but instead of the captured groups, it has just a flag, whether the
+    only capture group has begun. */
+struct re_dfaThread_t
+{
+    /** The instruction, which the thread will execute next, as index into the instruction
+        stream. */
+    uint16_t idxI;
+
+    /** The thread has entered the capture group. */
+    uint8_t isInCGrp;
+
+    /** The thread has entered the capture group at the current input character. */
+    uint8_t isNewInCGrp;
+
+    /** The counters of the bounded loops, by loop index. */
+    uint8_t loopCntAry[RE_DFA_MAX_NO_LOOP_CNTS];
+};
+
+/** The DFA generator. The object holds the generated DFA and all the memory, which is
+    needed for the generation. It is large and should be allocated statically. */
+struct re_dfaCompiler_t
+{
+    /** The generated DFA. The tables point into the fields of this object. */
+    struct re_dfa_t dfa;
+
+    /** The class of each input character. */
+    uint8_t classAry[UINT8_MAX+1u];
+
+    /** For each character class, a character, which represents it. */
+    uint8_t cRepresentativeAry[UINT8_MAX+1u];
+
+    /** The transition table. */
+    uint8_t transitionAry[RE_DFA_MAX_NO_STATES*(UINT8_MAX+1u)];
+
+    /** The flags of the states. */
+    uint8_t stateFlagAry[RE_DFA_MAX_NO_STATES];
+
+    /** The threads of all states. The threads of a state are stored one after another,
+        ordered by priority. */
+    struct re_dfaThread_t threadAry[RE_DFA_MAX_NO_THREADS];
+
+    /** The number of threads in \a threadAry. */
+    unsigned int noThreads;
+
+    /** For each state, the index of its first thread in \a threadAry. The entry behind the
+        last state is the end of the threads of the last state. */
+    unsigned int idxThreadAry[RE_DFA_MAX_NO_STATES+1u];
+
+    /** The threads visited when determining the successor of a state. */
+    struct re_dfaThread_t closureAry[RE_DFA_MAX_NO_CLOSURE_THREADS];
+
+    /** The number of threads in \a closureAry. */
+    unsigned int noClosureThreads;
+
+    /** The stack of threads in \a closureAry, whose second successor has not been visited
+        yet. */
+    uint16_t closureStackAry[RE_DFA_MAX_NO_CLOSURE_THREADS];
+
+    /** For each instruction, the stamp of the closure, which has most recently visited a
+        thread at this instruction. */
+    uint32_t stampAry[UINT16_MAX+1u];
+
+    /** The stamp of the current closure. */
+    uint32_t stamp;
+
+    /** The compiled regular expression, which the DFA is generated from, by reference. */
+    const struct re_compiledRegExp_t *pRe;
+
+    /** The number of loop counters in use. */
+    unsigned int noLoopCnts;
+
+    /** Principal state information of the generation: Still successful? Or an error
+        message otherwise. */
+    enum re_dfaCompilerError_t err;
+};
+
+
+/*
+ * Global data declarations
+ */
+
+
+/*
+ * Global prototypes
+ */
+
+#if RE_REQUIRE_COMPILER == 1  &&  RE_REQUIRE_MATCHER == 1
+/** Generate the DFA for a compiled regular expression. */
+bool re_dfaCompile( struct re_dfaCompiler_t *pDfaCompiler
+                  , const struct re_compiledRegExp_t *pRe
+                  );
+
+/** Export a generated DFA as fragment of C code. */
+void re_exportDFA( FILE *file
+                 , const struct re_dfaCompiler_t *pDfaCompiler
+                 , const char *regExpStr
+                 , const char *namespc
+                 , const char *nameRe
+                 );
+#endif
+
+/*
+ * Global inline functions
+ */
+
+
+#endif  /* RE_DFA_COMPILER_INCLUDED */
@@ -0,0 +1,154 @@
+/**
+ * @file re_dfaMatcher.c
+ * A table walking matcher for regular expressions, which have been converted into a
+ * deterministic finite automaton (DFA) on the development machine, see re_dfaCompiler.c.\n
+ *   Each input character costs two table lookups, the equivalence class of the character
+ * and the successor state. There is no backtracking, no recursion and the matcher doesn't
+ * need any memory beyond a few local variables. This makes it suitable for validating
+ * protocol data in time critical code. The match result is the same as of re_match(),
+ * including the end of the match and the optional final capture group.
+ *
+ * Copyright (C) 2026 Peter Vranken (mailto:Peter_Vranken@Yahoo.de)
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+/* Module interface
+ *   re_matchDFA
+ * Local functions
+ */
+
+/*
+ * Include files
+ */
+
+#include "re_dfaMatcher.h"
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <assert.h>
+
+/*
+ * Defines
+ */
+
+
+/*
+ * Local type definitions
+ */
+
+
+/*
+ * Local prototypes
+ */
+
+
+/*
+ * Data definitions
+ */
+
+
+/*
+ * Function implementation
+ */
+
+#if RE_REQUIRE_MATCHER == 1
+/**
+ * Main API: Match an input character sequence with a DFA.
+ *   @return
+ * Get \a true if the regular expression matches the input. If the DFA had been generated
+ * from an expression, which was compiled with \a matchAnywhere (see re_compile()), then this
+ * means a match anywhere in the input, otherwise only from the beginning of the input.
+ *   @param[in] pDFA
+ * The DFA by reference. Normally, a DFA, which had been exported as source code by
+ * application regExpDemo.
+ *   @param[in] inputStream
+ * The input to match. The end of the input is not a zero byte but specified by \a
+ * lenInputStream.
+ *   @param[in] lenInputStream
+ * The number of characters of the input.
+ *   @param[out] pMatch
+ * If the function returns \a true, then the end of the match and the optional captured
+ * group are returned in * \a pMatch. The pointer may be NULL if only the Boolean result is
+ * of interest.
+ */
+bool re_matchDFA( const struct re_dfa_t * const pDFA
+                , const char * const inputStream
+                , unsigned int lenInputStream
+                , struct re_dfaMatch_t * const pMatch
+                )
+{
+    const uint8_t * const classAry = pDFA->classAry
+                , * const transitionAry = pDFA->transitionAry
+                , * const stateFlagAry = pDFA->stateFlagAry;
+    const unsigned int noClasses = pDFA->noClasses;
+    assert(pDFA->noStates > RE_DFA_IDX_STATE_START);
+
+    bool isMatching = false;
+    unsigned int idxState = RE_DFA_IDX_STATE_START
+               , idxC = 0u
+               , idxEnd = 0u
+               , idxCGrpFrom = 0u
+               , idxMatchCGrpFrom = 0u
+               , flagCGrp = 0u;
+    while(true)
+    {
+        const unsigned int flags = stateFlagAry[idxState];
+        if(idxC == lenInputStream)
+        {
+            /* At the end of the input, the anchor $ matches. This can yield another match
+               than at the same position inside the input. */
+            if((flags & RE_DFA_STATE_MATCH_AT_END) != 0u)
+            {
+                isMatching = true;
+                idxEnd = idxC;
+                idxMatchCGrpFrom = idxCGrpFrom;
+                flagCGrp = flags & RE_DFA_STATE_MATCH_AT_END_CGRP;
+            }
+            break;
+        }
+
+        /* A match replaces a match, which had been found at an earlier position. It has
+           the higher priority; otherwise the DFA would have dropped the path. */
+        if((flags & RE_DFA_STATE_MATCH) != 0u)
+        {
+            isMatching = true;
+            idxEnd = idxC;
+            idxMatchCGrpFrom = idxCGrpFrom;
+            flagCGrp = flags & RE_DFA_STATE_MATCH_CGRP;
+        }
+
+        idxState = transitionAry[idxState*noClasses + classAry[(uint8_t)inputStream[idxC]]];
+        ++ idxC;
+        if(idxState == RE_DFA_IDX_STATE_DEAD)
+            break;
+        if((stateFlagAry[idxState] & RE_DFA_STATE_CGRP_START) != 0u)
+            idxCGrpFrom = idxC;
+
+    } /* while(All input characters) */
+
+    if(isMatching  &&  pMatch != NULL)
+    {
+        /* The only supported capture group is the final one, its end is the end of the
+           match. */
+        pMatch->idxEnd = idxEnd;
+        pMatch->noCapturedGrps = flagCGrp != 0u? 1u: 0u;
+        pMatch->idxCGrpFrom = idxMatchCGrpFrom;
+        pMatch->idxCGrpTo = idxEnd;
+    }
+
+    return isMatching;
+
+} /* re_matchDFA */
+#endif
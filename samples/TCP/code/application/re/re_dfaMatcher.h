@@ -0,0 +1,136 @@
+#ifndef RE_DFA_MATCHER_INCLUDED
+#define RE_DFA_MATCHER_INCLUDED
+/**
+ * @file re_dfaMatcher.h
+ * Definition of global interface of module re_dfaMatcher.c
+ *
+ * Copyright (C) 2026 Peter Vranken (mailto:Peter_Vranken@Yahoo.de)
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Include files
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "re_regExpMatcher.h"
+
+/*
+ * Defines
+ */
+
+/** The maximum number of states of a DFA, including the dead state. The states are
+    encoded as Byte in the transition table. */
+#define RE_DFA_MAX_NO_STATES            (UINT8_MAX+1u)
+
+/** The index of the dead state. The match is decided once the DFA reaches this state. */
+#define RE_DFA_IDX_STATE_DEAD           0u
+
+/** The index of the start state. */
+#define RE_DFA_IDX_STATE_START          1u
+
+/** State flag: A match ends at the current position, if the input doesn't end here. */
+#define RE_DFA_STATE_MATCH              0x01u
+
+/** State flag: The match, which ends at the current position, has the captured group. */
+#define RE_DFA_STATE_MATCH_CGRP         0x02u
+
+/** State flag: A match ends at the current position, if the input ends here. */
+#define RE_DFA_STATE_MATCH_AT_END       0x04u
+
+/** State flag: The match at the end of the input has the captured group. */
+#define RE_DFA_STATE_MATCH_AT_END_CGRP  0x08u
+
+/** State flag: When entering the state, the captured group begins at the current
+    position. */
+#define RE_DFA_STATE_CGRP_START         0x10u
+
+/*
+ * Global type definitions
+ */
+
+/** A deterministic finite automaton (DFA), which has been generated from a compiled
+    regular expression on the development machine. See re_dfaCompiler.c. */
+struct re_dfa_t
+{
+    /** The input characters are mapped onto equivalence classes; all characters in a class
+        take the same transitions in all states. This table has 256 entries, the class for
+        each character. */
+    const uint8_t *classAry;
+
+    /** The transition table. Row \a s, column \a k is the successor of state \a s for an
+        input character of class \a k. There are \a noStates rows of \a noClasses
+        entries. */
+    const uint8_t *transitionAry;
+
+    /** A combination of the flags RE_DFA_STATE_* for each state. */
+    const uint8_t *stateFlagAry;
+
+    /** The number of equivalence classes of input characters. */
+    unsigned int noClasses;
+
+    /** The number of states, including the dead state. */
+    unsigned int noStates;
+
+    /** The number of capture groups in the regular expression, either zero or one. */
+    unsigned int noCaptureGrps;
+};
+
+/** The result of matching with a DFA. */
+struct re_dfaMatch_t
+{
+    /** The end of the match, as index of the first input character, which doesn't belong
+        to the match. This is the same as field \a pC of the matcher object after
+        re_match(). */
+    unsigned int idxEnd;
+
+    /** The number of matches of the capture group, either zero or one. */
+    unsigned int noCapturedGrps;
+
+    /** The first character of the captured group by zero based index. */
+    unsigned int idxCGrpFrom;
+
+    /** The first character, which doesn't belong to the captured group, by zero based
+        index. */
+    unsigned int idxCGrpTo;
+};
+
+
+/*
+ * Global data declarations
+ */
+
+
+/*
+ * Global prototypes
+ */
+
+#if RE_REQUIRE_MATCHER == 1
+/** Match an input character sequence with a DFA. */
+bool re_matchDFA( const struct re_dfa_t *pDFA
+                , const char *inputStream
+                , unsigned int lenInputStream
+                , struct re_dfaMatch_t *pMatch
+                );
+#endif
+
+/*
+ * Global inline functions
+ */
+
+
+#endif  /* RE_DFA_MATCHER_INCLUDED */
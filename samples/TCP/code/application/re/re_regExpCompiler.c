@@ -108,6 +108,7 @@
 /* Module interface
  *   re_compEmitCode
  *   re_compile
+ *   re_compileSet
  *   usage
  *   main
  * Local functions
@@ -124,6 +125,12 @@
  *   compileImmediate
  *   compileSequence
  *   compileOrExpr
+ *   findRequiredLiteral
+ *   isCharAccepted
+ *   findFirstChars
+ *   writeSetDispatchTable
+ *   beginCompilation
+ *   insertMatchAnywherePrefix
  *   exportCompiledExpression
  *   usage
  */
@@ -145,12 +152,16 @@
 
 #include "re_charSet.h"
 #include "re_regExpMatcher.h"
+#if RE_REQUIRE_MAIN == 1
+# include "re_dfaMatcher.h"
+# include "re_dfaCompiler.h"
+#endif
 
 /*
  * Defines
  */
 
-#define MAX_LEN_ISTREAM     1000u
+#define MAX_LEN_ISTREAM     4000u
 
 /** The number of operands, which are allowed for an OR expression. This number of integers
     is stored on the stack of the compiler and in the worst case for each recursion level.
@@ -165,6 +176,16 @@
 # define MAX_NO_OR_OPERANDS  4u
 #endif
 
+/** The length of the instructions, which implement "matchAnywhere", see
+    insertMatchAnywherePrefix(). */
+#define LEN_MATCH_ANYWHERE_PREFIX   (LEN_I_LOOP_NG + LEN_I_ANY + LEN_I_LOOPEND)
+
+/** The analysis, which characters an expression of a set can begin with, keeps a list of
+    the instructions, which it still has to visit. This is the capacity of the list. If it
+    doesn't suffice then the expression is assumed to begin with any character. The list
+    is stored on the stack of the compiler. */
+#define MAX_NO_PENDING_FIRST_INSTR  16u
+
 #if RE_REQUIRE_MAIN != 0
 /** Maximum number of character sets, which may be used in a single regular expression. The
     footprint of a single charset is sizeof(uint16_t) or 2 Byte.\n
@@ -329,6 +350,13 @@ static void printIStream( FILE *ostream
         case I_DOLLAR:
             fprintf(ostream, "%s%04u%s  I_DOLLAR%s\n", s1, idxI, s2, s3);
             break;
+        case OP_ACCEPT:
+            {
+                lenI = 2u;
+                unsigned int idxRegExp = * ++pI;
+                fprintf(ostream, "%s%04u%s  I_ACCEPT(%u)%s\n", s1, idxI, s2, idxRegExp, s3);
+            }
+            break;
         case OP_LOOP:
         case OP_LOOPNG:
             {
@@ -485,6 +513,75 @@ static void printCompiledIStream( FILE *ostream
         re_printCharSetBinary(ostream, pRe, idxCS, idxIOfCharSet, asCCode);
         idxIOfCharSet += sizeof(re_charSet_t);
     }
+
+    /* The required literal, if any, is the last element of the constant data. */
+    assert(pRe->lenRequiredLit == 0u  ||  pRe->idxRequiredLit == idxIOfCharSet);
+    for(unsigned int u=0u; u<pRe->lenRequiredLit; ++u)
+    {
+        const uint8_t c = pRe->iStream[idxIOfCharSet + u];
+        fprintf( ostream
+               , asCCode? "    /* %04u */  I_DB(0x%02X),  /* %c */\n"
+                        : "%04u  I_DB(%02X)  %c\n"
+               , idxIOfCharSet + u
+               , (unsigned)c
+               , isprint(c) && c != '*' && c != '/'? (char)c: '.'
+               );
+    }
+
+    /* A set has the dispatch table instead of the required literal: The entries into the
+       expressions and a mask of expressions for each character and at the end of the
+       input. For human reading, the masks of the characters, which no expression can
+       begin with, are omitted. */
+    if(pRe->noRegExpsInSet > 0u)
+    {
+        assert(pRe->idxSetDispatch == idxIOfCharSet);
+        const uint8_t * const table = &pRe->iStream[pRe->idxSetDispatch];
+        fprintf( ostream
+               , asCCode? "    /* %04u */  I_DB(0x%02X), I_DB(0x%02X),  /* Loop counters */\n"
+                        : "%04u  I_DB(%02X), I_DB(%02X)  Loop counters\n"
+               , pRe->idxSetDispatch
+               , (unsigned)table[0]
+               , (unsigned)table[1]
+               );
+        for(unsigned int idxRegExp=0u; idxRegExp<pRe->noRegExpsInSet; ++idxRegExp)
+        {
+            fprintf( ostream
+                   , asCCode? "    /* %04u */  I_DB(0x%02X), I_DB(0x%02X),  /* Expression %u */\n"
+                            : "%04u  I_DB(%02X), I_DB(%02X)  Expression %u\n"
+                   , pRe->idxSetDispatch + 2u + 2u*idxRegExp
+                   , (unsigned)table[2u + 2u*idxRegExp]
+                   , (unsigned)table[2u + 2u*idxRegExp + 1u]
+                   , idxRegExp
+                   );
+        }
+        const unsigned int sizeOfMask = RE_SIZE_OF_SET_DISPATCH_MASK(pRe->noRegExpsInSet)
+                         , idxIMaskAry = pRe->idxSetDispatch + 2u + 2u*pRe->noRegExpsInSet;
+        for(unsigned int idxMask=0u; idxMask<RE_SET_DISPATCH_NO_MASKS; ++idxMask)
+        {
+            const uint8_t * const mask = &pRe->iStream[idxIMaskAry + sizeOfMask*idxMask];
+            bool isEmpty = true;
+            for(unsigned int u=0u; u<sizeOfMask; ++u)
+                isEmpty = isEmpty &&  mask[u] == 0u;
+            if(!asCCode  &&  isEmpty)
+                continue;
+
+            fprintf( ostream
+                   , asCCode? "    /* %04u */ ": "%04u "
+                   , idxIMaskAry + sizeOfMask*idxMask
+                   );
+            for(unsigned int u=0u; u<sizeOfMask; ++u)
+                fprintf(ostream, asCCode? " I_DB(0x%02X),": " I_DB(%02X)", (unsigned)mask[u]);
+
+            if(idxMask == RE_SET_DISPATCH_IDX_END)
+                fprintf(ostream, asCCode? "  /* End of input */\n": "  End of input\n");
+            else if(idxMask == RE_SET_DISPATCH_IDX_ANCHORED)
+                fprintf(ostream, asCCode? "  /* Anchored */\n": "  Anchored\n");
+            else if(isprint((int)idxMask)  &&  idxMask != '*'  &&  idxMask != '/')
+                fprintf(ostream, asCCode? "  /* %c */\n": "  %c\n", (char)idxMask);
+            else
+                fprintf(ostream, asCCode? "  /* \\x%02X */\n": "  \\x%02X\n", idxMask);
+        }
+    }
 } /* printCompiledIStream */
 #endif
 
@@ -846,6 +943,7 @@ static bool compileImmediate( struct re_compiler_t * const pCompiler
         case 'f':  iStream[0] = I_LIT('\f'); break;
         case 'r':  iStream[0] = I_LIT('\r'); break;
         case 'n':  iStream[0] = I_LIT('\n'); break;
+        case 't':  iStream[0] = I_LIT('\t'); break;
         case 'N':  iStream[0] = I_CRLF; break;
         case '\\': iStream[0] = I_LIT('\\'); break;
 
@@ -1136,6 +1234,564 @@ static void compileOrExpr(struct re_compiler_t * const pCompiler, bool *pPotenti
 } /* compileOrExpr */
 
 
+/**
+ * Find the longest literal character sequence, which every match of the compiled
+ * expression contains, and append it to the constant data at the end of the instruction
+ * stream. The matchers use the literal as fast pre-filter, see re_match().\n
+ *   The analysis walks along the instructions, which every match path passes: Literal
+ * characters extend the current literal, capture groups are transparent, the body of a loop
+ * with a minimum of at least one cycle is required but can't be joined with its
+ * surrounding, and optional loops and OR expressions are skipped. All other instructions
+ * terminate the current literal.\n
+ *   Of several literals, the one outside of a loop body is preferred: A literal, which
+ * the expression repeats, is likely to occur often in the input, like the "a" of
+ * "a{1,200}b", and the search for it hardly rejects anything. Then the longest literal is
+ * chosen and, of literals of same length, the one at the beginning of each match; it
+ * doesn't only reject the input but also tells, where the match can begin.\n
+ *   The function doesn't raise an error. If nothing is found or if the instruction stream
+ * has no space left, then the compiled expression simply has no required literal.
+ *   @param pCompiler
+ * The compiler object by reference after successful compilation and after
+ * re_writeCharSets().
+ *   @param hasMatchAnywherePrefix
+ * \a true if the compiler has put the instructions for \a matchAnywhere in front of the
+ * user expression.
+ */
+static void findRequiredLiteral( struct re_compiler_t * const pCompiler
+                               , bool hasMatchAnywherePrefix
+                               )
+{
+    struct re_compiledRegExp_t * const pRe = &pCompiler->re;
+    pRe->lenRequiredLit = 0u;
+    pRe->idxRequiredLit = 0u;
+    pRe->isPrefixLit = false;
+
+    const uint8_t * const iStream = pRe->iStream;
+    uint8_t lit[UINT8_MAX]
+          , bestLit[UINT8_MAX];
+    unsigned int lenLit = 0u
+               , lenBestLit = 0u;
+
+    /* The nesting depth of the loop bodies, which are visited, and if the current and
+       the best literal are inside such a body. */
+    unsigned int loopDepth = 0u;
+    bool isInLoop = false
+       , isBestInLoop = false;
+
+    /* A literal is a prefix of all matches, if no other instruction than capture groups
+       precedes it. This is of use only if it can be searched for in the input, i.e., if
+       the expression is meant to match anywhere. */
+    bool isPrefix = hasMatchAnywherePrefix
+       , isBestPrefix = false;
+    unsigned int idxI = hasMatchAnywherePrefix? LEN_I_LOOP_NG + LEN_I_ANY + LEN_I_LOOPEND: 0u;
+    while(true)
+    {
+        bool isLit = false
+           , isEndOfLit = true;
+        uint8_t c = 0u;
+        if(idxI >= pRe->lenIStream)
+        {
+            /* End of instruction stream, the last literal is still to be considered. */
+        }
+        else if(iStream[idxI] < 0x80u  ||  iStream[idxI] == OP_ESC)
+        {
+            if(iStream[idxI] == OP_ESC)
+            {
+                c = iStream[++idxI];
+                idxI += LEN_I_LIT_ESC - 1u;
+            }
+            else
+            {
+                c = iStream[idxI];
+                idxI += LEN_I_LIT;
+            }
+            isLit = true;
+            isEndOfLit = lenLit >= sizeof(lit);
+        }
+        else if(iStream[idxI] == OP_CAP  ||  iStream[idxI] == OP_CAPEND)
+        {
+            /* Capture groups don't consume input. */
+            idxI += LEN_I_CAP;
+            isEndOfLit = false;
+        }
+        else if(iStream[idxI] == OP_LOOP  ||  iStream[idxI] == OP_LOOPNG)
+        {
+            /* The body of a loop, which needs to be passed at least once, is visited. The
+               loop instructions separate the literals in the body from the surrounding. An
+               optional loop is skipped. */
+            const unsigned int lenIBody = (iStream[idxI+1u]<<8) + iStream[idxI+2u]
+                             , min = iStream[idxI+3u];
+            idxI += LEN_I_LOOP;
+            if(min == 0u)
+                idxI += lenIBody + LEN_I_LOOPEND;
+            else
+                ++ loopDepth;
+        }
+        else if(iStream[idxI] == OP_OR)
+        {
+            /* None of the alternatives is required. The first alternative ends with a jump
+               to the end of the entire OR expression. */
+            const unsigned int lenAlternative = (iStream[idxI+1u]<<8) + iStream[idxI+2u]
+                             , idxIJmp = idxI + LEN_I_OR + lenAlternative - LEN_I_JMP;
+            assert(iStream[idxIJmp] == OP_JMP);
+            idxI = idxIJmp + LEN_I_JMP + (iStream[idxIJmp+1u]<<8) + iStream[idxIJmp+2u];
+        }
+        else
+        {
+            /* Loop end, character classes, character sets and anchors. All of these are
+               single byte instructions besides the loop end and the character set. */
+            if(iStream[idxI] == OP_LOOPEND)
+            {
+                /* Only the loop end of a visited body is seen, the optional loops are
+                   skipped as a whole. */
+                assert(loopDepth > 0u);
+                -- loopDepth;
+                idxI += LEN_I_LOOPEND;
+            }
+            else if(iStream[idxI] == OP_CHARSET)
+                idxI += LEN_I_CHARSET;
+            else
+                idxI += 1u;
+        }
+
+        if(isEndOfLit)
+        {
+            /* Outside of a loop body is better than inside, then longer is better than
+               shorter and, for same length, a prefix is better. */
+            const bool isBetter = isInLoop != isBestInLoop
+                                  ? !isInLoop
+                                  : lenLit > lenBestLit
+                                    ||  (lenLit == lenBestLit  &&  isPrefix
+                                         &&  !isBestPrefix
+                                        );
+            if(lenLit > 0u  &&  (lenBestLit == 0u  ||  isBetter))
+            {
+                memcpy(bestLit, lit, lenLit);
+                lenBestLit = lenLit;
+                isBestPrefix = isPrefix;
+                isBestInLoop = isInLoop;
+            }
+            lenLit = 0u;
+            isPrefix = false;
+
+            if(idxI >= pRe->lenIStream)
+                break;
+        }
+        if(isLit)
+        {
+            if(lenLit == 0u)
+                isInLoop = loopDepth > 0u;
+            lit[lenLit++] = c;
+        }
+
+    } /* while(All required instructions) */
+
+    /* The literal is appended to the constant data behind the character sets. */
+    const unsigned int idxLit = pRe->lenIStream + pRe->noCharSets*sizeof(re_charSet_t);
+    if(lenBestLit > 0u  &&  idxLit + lenBestLit <= pCompiler->maxLenIStream)
+    {
+        memcpy(&pRe->iStream[idxLit], bestLit, lenBestLit);
+        pRe->lenRequiredLit = lenBestLit;
+        pRe->idxRequiredLit = idxLit;
+        pRe->isPrefixLit = isBestPrefix;
+    }
+} /* findRequiredLiteral */
+
+
+/**
+ * Helper of findFirstChars(): Check if an instruction, which consumes an input character,
+ * accepts a given character. Needs to be the same decision as in the matcher, see
+ * immediateMatch() in re_regExpMatcher.c.
+ *   @return
+ * Get \a true if the character is accepted.
+ *   @param pI
+ * The instruction by reference. The character sets have already been written into the
+ * constant data of the instruction stream.
+ *   @param c
+ * The input character.
+ */
+static bool isCharAccepted(const uint8_t * const pI, uint8_t c)
+{
+    if((*pI & 0x80u) == 0u)
+        return c == *pI;
+
+    switch(*pI)
+    {
+    case OP_ESC:
+        return c == pI[1];
+
+    case OP_CHARSET:
+    {
+        const uint8_t * const charSet = pI + LEN_I_CHARSET + (pI[1]<<8) + pI[2];
+        return (charSet[c/8u] & (1u<<(c & 7u))) != 0u;
+    }
+
+    case I_ANY:
+        return c != '\n';
+
+    case I_DIGIT:
+        return isdigit((int)(char)c);
+
+    case I_HEXDIGIT:
+        return isdigit((int)(char)c)
+               ||  (toupper((int)(char)c) >= 'A'  &&  toupper((int)(char)c) <= 'F');
+
+    case I_SPC:
+        return c == ' '  ||  c == '\t'  ||  c == '\f'  ||  c == '\r';
+
+    case I_AZ:
+        return c >= 'a'  &&  c <= 'z';
+
+    case I_LTR:
+        return isalpha((int)(char)c);
+
+    case I_ID1ST:
+        return isalpha((int)(char)c) || c == '_';
+
+    case I_ID:
+        return isalpha((int)(char)c) || isdigit((int)(char)c) || c == '_';
+
+    case I_CRLF:
+        return c == '\r'  ||  c == '\n';
+
+    default:
+        /* Not a consuming instruction. The caller will assume every character. */
+        assert(false);
+        return true;
+    }
+} /* isCharAccepted */
+
+
+/**
+ * Helper of writeSetDispatchTable(): Find all input characters, which an expression of a
+ * set can begin with.
+ *   @return
+ * Get \a false if the expression is too complex for the analysis. The caller needs to
+ * assume that the expression can begin with any character and match at the end of the
+ * input.
+ *   @param pRe
+ * The compiled set by reference. The character sets have already been written into the
+ * constant data of the instruction stream.
+ *   @param idxIEntry
+ * The first instruction of the expression as index into the instruction stream.
+ *   @param firstCharSet
+ * The characters, which the expression can begin with, are returned in this set.
+ *   @param pCanBeEmpty
+ * The function returns by reference whether the expression can match without consuming
+ * an input character, i.e., at any input position.
+ *   @param pCanMatchAtEnd
+ * The function returns by reference whether the expression can match at the end of the
+ * input.
+ */
+static bool findFirstChars( const struct re_compiledRegExp_t * const pRe
+                          , unsigned int idxIEntry
+                          , re_charSet_t firstCharSet
+                          , bool * const pCanBeEmpty
+                          , bool * const pCanMatchAtEnd
+                          )
+{
+    const uint8_t * const iStream = pRe->iStream;
+    memset(firstCharSet, 0, sizeof(re_charSet_t));
+    *pCanBeEmpty = false;
+    *pCanMatchAtEnd = false;
+
+    /* The instructions, which don't consume a character, lead to instructions at higher
+       index. The only jump backwards is at the end of a loop, which can't be reached
+       without consuming a character; the compiler rejects loops with potentially empty
+       body. Visiting the pending instructions in ascending order visits each of them only
+       once. */
+    uint16_t pendingAry[MAX_NO_PENDING_FIRST_INSTR];
+    unsigned int noPending = 1u;
+    pendingAry[0] = (uint16_t)idxIEntry;
+    while(noPending > 0u)
+    {
+        /* Take the pending instruction with lowest index and drop its duplicates. */
+        unsigned int idxI = pendingAry[0];
+        for(unsigned int u=1u; u<noPending; ++u)
+        {
+            if(pendingAry[u] < idxI)
+                idxI = pendingAry[u];
+        }
+        unsigned int noRemaining = 0u;
+        for(unsigned int u=0u; u<noPending; ++u)
+        {
+            if(pendingAry[u] != idxI)
+                pendingAry[noRemaining++] = pendingAry[u];
+        }
+        noPending = noRemaining;
+
+        assert(idxI < pRe->lenIStream);
+        const uint8_t * const pI = &iStream[idxI];
+        unsigned int idxISuccAry[2], noSucc = 0u;
+        switch(*pI)
+        {
+        case OP_LOOP:
+        case OP_LOOPNG:
+            /* Into the body and, if the loop is optional, behind the loop end. */
+            idxISuccAry[noSucc++] = idxI + LEN_I_LOOP;
+            if(pI[3] == 0u)
+            {
+                idxISuccAry[noSucc++] = idxI + LEN_I_LOOP + (pI[1]<<8) + pI[2]
+                                        + LEN_I_LOOPEND;
+            }
+            break;
+
+        case OP_LOOPEND:
+            idxISuccAry[noSucc++] = idxI + LEN_I_LOOPEND;
+            break;
+
+        case OP_OR:
+            idxISuccAry[noSucc++] = idxI + LEN_I_OR;
+            idxISuccAry[noSucc++] = idxI + LEN_I_OR + (pI[1]<<8) + pI[2];
+            break;
+
+        case OP_JMP:
+            idxISuccAry[noSucc++] = idxI + LEN_I_JMP + (pI[1]<<8) + pI[2];
+            break;
+
+        case OP_CAP:
+        case OP_CAPEND:
+            _Static_assert( LEN_I_CAP == LEN_I_CAPEND
+                          , "Implementation can't combine instructions"
+                          );
+            idxISuccAry[noSucc++] = idxI + LEN_I_CAP;
+            break;
+
+        case I_CARET:
+            idxISuccAry[noSucc++] = idxI + LEN_I_CARET;
+            break;
+
+        case I_DOLLAR:
+            *pCanMatchAtEnd = true;
+            break;
+
+        case OP_ACCEPT:
+            *pCanBeEmpty = true;
+            *pCanMatchAtEnd = true;
+            break;
+
+        default:
+            for(unsigned int c=0u; c<=UINT8_MAX; ++c)
+            {
+                if(isCharAccepted(pI, (uint8_t)c))
+                    firstCharSet[c/8u] |= (uint8_t)(1u<<(c & 7u));
+            }
+        } /* switch(Which instruction?) */
+
+        if(noPending + noSucc > MAX_NO_PENDING_FIRST_INSTR)
+            return false;
+        for(unsigned int u=0u; u<noSucc; ++u)
+            pendingAry[noPending++] = (uint16_t)idxISuccAry[u];
+
+    } /* while(All instructions reached without consuming a character) */
+
+    return true;
+
+} /* findFirstChars */
+
+
+/**
+ * Append the dispatch table of a set of regular expressions to the constant data of the
+ * instruction stream. See field \a idxSetDispatch of struct re_compiledRegExp_t for the
+ * layout.
+ *   @param pCompiler
+ * The compiler object by reference after compilation of the set and after writing the
+ * character sets.
+ *   @param idxIEntryAry
+ * The first instruction of each expression of the set as index into the instruction
+ * stream.
+ */
+static void writeSetDispatchTable( struct re_compiler_t * const pCompiler
+                                 , const unsigned int idxIEntryAry[]
+                                 )
+{
+    struct re_compiledRegExp_t * const pRe = &pCompiler->re;
+    const unsigned int noRegExps = pRe->noRegExpsInSet
+                     , sizeOfMask = RE_SIZE_OF_SET_DISPATCH_MASK(noRegExps)
+                     , idxTable = pRe->lenIStream + pRe->noCharSets*sizeof(re_charSet_t);
+    assert(noRegExps >= 1u  &&  noRegExps <= RE_MAX_NO_REGEXPS_IN_SET);
+    if(idxTable + RE_SIZE_OF_SET_DISPATCH(noRegExps) > pCompiler->maxLenIStream)
+    {
+        pCompiler->err = re_errComp_maxLenIStreamExceeded;
+        return;
+    }
+
+    uint8_t * const table = &pRe->iStream[idxTable]
+          , * const entryAry = &table[2u]
+          , * const maskAry = &entryAry[2u*noRegExps];
+    memset(table, 0, RE_SIZE_OF_SET_DISPATCH(noRegExps));
+
+    /* The lockstep matcher finds the number of loop counters of a single expression by
+       stepping through the instruction stream. For a set, this would cost more than
+       matching a short input, so it is found here, by the same rule: The greatest index
+       of a bounded loop plus one. */
+    unsigned int noLoopCnts = 0u;
+    for(unsigned int idxI=0u; idxI<pRe->lenIStream; )
+    {
+        const uint8_t * const pI = &pRe->iStream[idxI];
+        switch(*pI)
+        {
+        case OP_LOOP:
+        case OP_LOOPNG:
+            if((pI[3] > 1u  ||  (pI[4] > 1u  &&  pI[4] < UINT8_MAX))  &&  pI[5] >= noLoopCnts)
+                noLoopCnts = pI[5] + 1u;
+            idxI += LEN_I_LOOP;
+            break;
+
+        case OP_LOOPEND:
+        case OP_OR:
+        case OP_JMP:
+        case OP_CHARSET:
+            _Static_assert( LEN_I_LOOPEND == 3u  &&  LEN_I_OR == 3u  &&  LEN_I_JMP == 3u
+                            &&  LEN_I_CHARSET == 3u
+                          , "Implementation can't combine instructions"
+                          );
+            idxI += 3u;
+            break;
+
+        case OP_CAP:
+        case OP_CAPEND:
+        case OP_ESC:
+        case OP_ACCEPT:
+            _Static_assert( LEN_I_CAP == 2u  &&  LEN_I_CAPEND == 2u
+                            &&  LEN_I_LIT_ESC == 2u  &&  LEN_I_ACCEPT == 2u
+                          , "Implementation can't combine instructions"
+                          );
+            idxI += 2u;
+            break;
+
+        default:
+            ++ idxI;
+        }
+    } /* for(All instructions) */
+    table[0] = (uint8_t)(noLoopCnts >> 8);
+    table[1] = (uint8_t)(noLoopCnts & 0xFFu);
+
+    for(unsigned int idxRegExp=0u; idxRegExp<noRegExps; ++idxRegExp)
+    {
+        const unsigned int idxIEntry = idxIEntryAry[idxRegExp];
+        entryAry[2u*idxRegExp] = (uint8_t)(idxIEntry >> 8);
+        entryAry[2u*idxRegExp+1u] = (uint8_t)(idxIEntry & 0xFFu);
+
+        re_charSet_t firstCharSet;
+        bool canBeEmpty, canMatchAtEnd;
+        if(!findFirstChars(pRe, idxIEntry, firstCharSet, &canBeEmpty, &canMatchAtEnd))
+        {
+            canBeEmpty = true;
+            canMatchAtEnd = true;
+        }
+
+        /* The masks are stored with the least significant Byte first. */
+        const unsigned int idxByte = idxRegExp/8u;
+        const uint8_t bit = (uint8_t)(1u << (idxRegExp & 7u));
+        for(unsigned int c=0u; c<=UINT8_MAX; ++c)
+        {
+            if(canBeEmpty  ||  (firstCharSet[c/8u] & (1u<<(c & 7u))) != 0u)
+                maskAry[sizeOfMask*c + idxByte] |= bit;
+        }
+        if(canMatchAtEnd)
+            maskAry[sizeOfMask*RE_SET_DISPATCH_IDX_END + idxByte] |= bit;
+        if(pRe->iStream[idxIEntry] == I_CARET)
+            maskAry[sizeOfMask*RE_SET_DISPATCH_IDX_ANCHORED + idxByte] |= bit;
+    }
+    pRe->idxSetDispatch = idxTable;
+
+} /* writeSetDispatchTable */
+
+
+/**
+ * Check the configuration of the compiler object and reset it for the compilation of a
+ * regular expression or a set of those.
+ *   @return
+ * Get \a true if the compilation can be started. Otherwise, the error is set in the
+ * compiler object.
+ *   @param pCompiler
+ * The compiler object by reference. See re_compile().
+ *   @param matchAnywhere
+ * See re_compile().
+ *   @param maxAllowedRecursionDepth
+ * See re_compile().
+ */
+static bool beginCompilation( struct re_compiler_t * const pCompiler
+                            , bool matchAnywhere
+                            , unsigned int maxAllowedRecursionDepth
+                            )
+{
+    /* First do a plausibility check if the compiler object has been properly
+       pre-configured by the user.
+         Note, we shortly disable the C compiler's warning about suggested use of
+       parenthesis as it would make the anyway complex condition entirely unreadable. */
+    #pragma GCC diagnostic push
+    #pragma GCC diagnostic ignored "-Wparentheses"
+    if(pCompiler->re.iStream == NULL
+       ||  pCompiler->maxLenIStream < 10u  ||  pCompiler->maxLenIStream > UINT16_MAX
+       ||  pCompiler->idxICharSetAry == NULL
+           &&  (pCompiler->maxNoICharSet != 0u  ||  pCompiler->maxNoCharSets != 0u)
+       ||  pCompiler->idxICharSetAry != NULL
+           &&  (pCompiler->maxNoICharSet < 1u  ||  pCompiler->maxNoICharSet > UINT16_MAX)
+       ||  pCompiler->charSetMem == NULL
+           &&  (pCompiler->maxNoICharSet != 0u  ||  pCompiler->maxNoCharSets != 0u)
+       ||  pCompiler->charSetMem != NULL
+           &&  (pCompiler->maxNoCharSets < 1u  ||  pCompiler->maxNoCharSets >= UINT16_MAX)
+       ||  pCompiler->idxICharSetAry == NULL  &&  pCompiler->charSetMem != NULL
+       ||  pCompiler->idxICharSetAry != NULL  &&  pCompiler->charSetMem == NULL
+       ||  maxAllowedRecursionDepth < 1u  ||  maxAllowedRecursionDepth > 1000u
+      )
+    {
+        pCompiler->err = re_errComp_badMemoryConfiguration;
+    }
+    else
+        pCompiler->err = re_errComp_success;
+    #pragma GCC diagnostic pop
+
+    /* Reset the counters. */
+    if(COMP_OK)
+    {
+        pCompiler->re.lenIStream = 0u;
+
+        /* Index 0 is reserved for implementing "matchAnywhere", see
+           insertMatchAnywherePrefix(). */
+        pCompiler->nextIdxLoop = matchAnywhere? 1u: 0u;
+
+        pCompiler->noICharSet = 0u;
+        pCompiler->re.noCharSets = 0u;
+        pCompiler->re.noCaptureGrps = 0u;
+        pCompiler->re.lenRequiredLit = 0u;
+        pCompiler->re.idxRequiredLit = 0u;
+        pCompiler->re.isPrefixLit = false;
+        pCompiler->re.noRegExpsInSet = 0u;
+        pCompiler->re.idxSetDispatch = 0u;
+        pCompiler->re.isSetMatchAnywhere = false;
+
+        pCompiler->recursionDepth = 0u;
+        pCompiler->maxRecursionDepth = 0u;
+        pCompiler->maxAllowedRecursionDepth = maxAllowedRecursionDepth;
+    }
+
+    return COMP_OK;
+
+} /* beginCompilation */
+
+
+/**
+ * Matching anywhere is implemented by preceding the compiled expression with the
+ * non-greedy consume-everything, ".*?".
+ *   @param pCompiler
+ * The compiler object by reference after compilation of the expression.
+ */
+static void insertMatchAnywherePrefix(struct re_compiler_t * const pCompiler)
+{
+    static const uint8_t iStream[LEN_MATCH_ANYWHERE_PREFIX] =
+    {
+        I_LOOP_NG(0, 1, 0, 255),
+        I_ANY,
+        I_LOOPEND(1),
+    };
+    insertCodeAt(pCompiler, iStream, sizeof(iStream), /*at*/ 0);
+
+} /* insertMatchAnywherePrefix */
+
+
 /**
  * Append a code fragment to the already existing instruction stream.
  *   @param pCompiler
@@ -1192,52 +1848,11 @@ bool re_compile( struct re_compiler_t * const pCompiler
                , unsigned int maxAllowedRecursionDepth
                )
 {
-    /* First do a plausibility check if the compiler object has been properly
-       pre-configured by the user.
-         Note, we shortly disable the C compiler's warning about suggested use of
-       parenthesis as it would make the anyway complex condition entirely unreadable. */
-    #pragma GCC diagnostic push
-    #pragma GCC diagnostic ignored "-Wparentheses"
-    if(pCompiler->re.iStream == NULL
-       ||  pCompiler->maxLenIStream < 10u  ||  pCompiler->maxLenIStream > UINT16_MAX
-       ||  pCompiler->idxICharSetAry == NULL
-           &&  (pCompiler->maxNoICharSet != 0u  ||  pCompiler->maxNoCharSets != 0u)
-       ||  pCompiler->idxICharSetAry != NULL
-           &&  (pCompiler->maxNoICharSet < 1u  ||  pCompiler->maxNoICharSet > UINT16_MAX)
-       ||  pCompiler->charSetMem == NULL
-           &&  (pCompiler->maxNoICharSet != 0u  ||  pCompiler->maxNoCharSets != 0u)
-       ||  pCompiler->charSetMem != NULL
-           &&  (pCompiler->maxNoCharSets < 1u  ||  pCompiler->maxNoCharSets >= UINT16_MAX)
-       ||  pCompiler->idxICharSetAry == NULL  &&  pCompiler->charSetMem != NULL
-       ||  pCompiler->idxICharSetAry != NULL  &&  pCompiler->charSetMem == NULL
-       ||  maxAllowedRecursionDepth < 1u  ||  maxAllowedRecursionDepth > 1000u
-      )
-    {
-        pCompiler->err = re_errComp_badMemoryConfiguration;
-    }
-    else
-        pCompiler->err = re_errComp_success;
-    #pragma GCC diagnostic pop
-
-    /* Reset the counters. */
-    if(COMP_OK)
+    if(beginCompilation(pCompiler, matchAnywhere, maxAllowedRecursionDepth))
     {
-        pCompiler->re.lenIStream = 0u;
-
         pCompiler->cStream = regExpAsString;
         pCompiler->pC = regExpAsString;
 
-        /* Index 0 is reserved for implementing "matchAnywhere", see below. */
-        pCompiler->nextIdxLoop = matchAnywhere? 1u: 0u;
-
-        pCompiler->noICharSet = 0u;
-        pCompiler->re.noCharSets = 0u;
-        pCompiler->re.noCaptureGrps = 0u;
-
-        pCompiler->recursionDepth = 0u;
-        pCompiler->maxRecursionDepth = 0u;
-        pCompiler->maxAllowedRecursionDepth = maxAllowedRecursionDepth;
-
         if(*pCompiler->pC != '\0')
         {
             bool potentiallyEmpty __attribute__((unused));
@@ -1249,21 +1864,16 @@ bool re_compile( struct re_compiler_t * const pCompiler
                expression with the non-greedy consume-everything, ".*?". This is
                however not required (and would lead to higher matching effort) if the
                compiled expression anyway begins with the anchor instruction. */
-            if(COMP_OK && matchAnywhere
-               &&  pCompiler->re.lenIStream >= 1  &&  *pCompiler->re.iStream != I_CARET
-              )
-            {
-                static const uint8_t iStream[10] =
-                {
-                    I_LOOP_NG(0, 1, 0, 255),
-                    I_ANY,
-                    I_LOOPEND(1),
-                };
-                insertCodeAt(pCompiler, iStream, sizeof(iStream), /*at*/ 0);
-            }
+            const bool hasMatchAnywherePrefix = COMP_OK && matchAnywhere
+                                                &&  pCompiler->re.lenIStream >= 1
+                                                &&  *pCompiler->re.iStream != I_CARET;
+            if(hasMatchAnywherePrefix)
+                insertMatchAnywherePrefix(pCompiler);
 
             if(COMP_OK)
                 re_writeCharSets(pCompiler);
+            if(COMP_OK)
+                findRequiredLiteral(pCompiler, hasMatchAnywherePrefix);
         }
         else
             pCompiler->err = re_errComp_emptyRegularExpr;
@@ -1272,6 +1882,117 @@ bool re_compile( struct re_compiler_t * const pCompiler
     return COMP_OK;
 
 } /* re_compile */
+
+
+/**
+ * Main API: Compile a set of regular expressions into a single instruction stream, which
+ * can be matched with re_matchSet(). The matcher tells all expressions of the set, which
+ * match the input, in one pass over the input.\n
+ *   The expressions are combined like the operands of an OR expression but each of them
+ * ends with an accept instruction, which carries its index in the set. Each expression
+ * numbers its capture groups from zero, as if it were compiled alone. The loops of all
+ * expressions are numbered through.
+ *   @return
+ * Get \a true if all expressions could be compiled. Otherwise, the error is found in \a
+ * pCompiler->err and \a pCompiler->cStream points to the failing expression.
+ *   @param[in,out] pCompiler
+ * The compiler object by reference. See re_compile().
+ *   @param[in] regExpAry
+ * The regular expressions to compile.
+ *   @param[in] noRegExps
+ * The number of expressions in \a regExpAry. Range is 1..#RE_MAX_NO_REGEXPS_IN_SET.
+ *   @param[in] matchAnywhere
+ * If \a true then the expressions can match at any position in the input character
+ * stream. As for re_compile(), this has no effect if all expressions begin with the
+ * anchor ^.
+ *   @param[in] maxAllowedRecursionDepth
+ * See re_compile().
+ */
+bool re_compileSet( struct re_compiler_t * const pCompiler
+                  , const char * const regExpAry[]
+                  , unsigned int noRegExps
+                  , bool matchAnywhere
+                  , unsigned int maxAllowedRecursionDepth
+                  )
+{
+    if(beginCompilation(pCompiler, matchAnywhere, maxAllowedRecursionDepth)
+       &&  (noRegExps < 1u  ||  noRegExps > RE_MAX_NO_REGEXPS_IN_SET)
+      )
+    {
+        pCompiler->err = re_errComp_badNoRegExpsInSet;
+    }
+
+    unsigned int maxNoCaptureGrps = 0u
+               , idxIEntryAry[RE_MAX_NO_REGEXPS_IN_SET];
+    bool isAnchored = true;
+    for(unsigned int idxRegExp=0u; idxRegExp<noRegExps && COMP_OK; ++idxRegExp)
+    {
+        pCompiler->cStream = regExpAry[idxRegExp];
+        pCompiler->pC = regExpAry[idxRegExp];
+        pCompiler->re.noCaptureGrps = 0u;
+
+        const unsigned int idxIRegExp = pCompiler->re.lenIStream;
+        idxIEntryAry[idxRegExp] = idxIRegExp;
+        if(*pCompiler->pC != '\0')
+        {
+            bool potentiallyEmpty __attribute__((unused));
+            compileOrExpr(pCompiler, &potentiallyEmpty);
+            if(COMP_OK &&  *pCompiler->pC != '\0')
+                pCompiler->err = re_errComp_notAllInputConsumed;
+        }
+        else
+            pCompiler->err = re_errComp_emptyRegularExpr;
+
+        if(COMP_OK)
+        {
+            if(pCompiler->re.iStream[idxIRegExp] != I_CARET)
+                isAnchored = false;
+            const uint8_t iStreamAccept[] = {I_ACCEPT(idxRegExp)};
+            re_compEmitCode(pCompiler, iStreamAccept, sizeof(iStreamAccept));
+        }
+
+        /* All but the last expression are the first alternative of an OR instruction.
+           Other than for the OR expression, no jump is required as the accept instruction
+           terminates the match path. */
+        if(COMP_OK  &&  idxRegExp+1u < noRegExps)
+        {
+            const uint8_t iStreamOr[] = {I_OR(pCompiler->re.lenIStream - idxIRegExp)};
+            insertCodeAt(pCompiler, iStreamOr, sizeof(iStreamOr), /*insertAt*/ idxIRegExp);
+            idxIEntryAry[idxRegExp] += LEN_I_OR;
+        }
+
+        if(pCompiler->re.noCaptureGrps > maxNoCaptureGrps)
+            maxNoCaptureGrps = pCompiler->re.noCaptureGrps;
+
+    } /* for(All regular expressions of the set) */
+
+    if(COMP_OK)
+    {
+        pCompiler->re.noCaptureGrps = maxNoCaptureGrps;
+        pCompiler->re.noRegExpsInSet = noRegExps;
+
+        /* As for a single expression, matching anywhere is useless if all expressions
+           begin with the anchor ^. Even a single unanchored expression requires it. */
+        if(matchAnywhere  &&  !isAnchored)
+        {
+            insertMatchAnywherePrefix(pCompiler);
+            for(unsigned int idxRegExp=0u; idxRegExp<noRegExps; ++idxRegExp)
+                idxIEntryAry[idxRegExp] += LEN_MATCH_ANYWHERE_PREFIX;
+            pCompiler->re.isSetMatchAnywhere = true;
+        }
+    }
+    if(COMP_OK)
+        re_writeCharSets(pCompiler);
+
+    /* A required literal is not determined for a set; a literal of a single expression
+       can't be used to reject the input for the others. Instead, the dispatch table tells
+       the matcher, which expressions can begin with a given character. */
+    if(COMP_OK)
+        writeSetDispatchTable(pCompiler, idxIEntryAry);
+
+    return COMP_OK;
+
+} /* re_compileSet */
 #endif
 
 
@@ -1284,6 +2005,11 @@ bool re_compile( struct re_compiler_t * const pCompiler
  *   @param pRe
  * The compiler object by reference after successful compilation, so that it contains the
  * compiled regular expression to export.
+ *   @param regExpAry
+ * The compiled regular expression or, for a set, all of its expressions as text. They
+ * are shown in the doc comments of the exported code.
+ *   @param noRegExps
+ * The number of expressions in \a regExpAry.
  *   @param namespc
  * The namespace used for the the global, regular expression related elements in the
  * exported C source code snippet. The passed string will precede the name of all of these
@@ -1295,22 +2021,42 @@ bool re_compile( struct re_compiler_t * const pCompiler
  */
 void exportCompiledExpression( FILE *file
                              , const struct re_compiler_t * const pCompiler
+                             , const char * const regExpAry[]
+                             , unsigned int noRegExps
                              , const char *namespc
                              , const char *nameRe
                              )
 {
+    /* The regular expression, or all expressions of a set, go into the doc comments. */
+    char regExpsAsComment[1000];
+    unsigned int lenComment = 0u;
+    for(unsigned int u=0u; u<noRegExps && lenComment<sizeof(regExpsAsComment); ++u)
+    {
+        lenComment += (unsigned)snprintf( &regExpsAsComment[lenComment]
+                                        , sizeof(regExpsAsComment) - lenComment
+                                        , "%s    %s"
+                                        , u > 0u? "\\n\n": ""
+                                        , regExpAry[u]
+                                        );
+    }
+
     fprintf( file
            , "/** The instruction stream of compiled regular expression %s. The regular\n"
              "    expression is:\\n\n"
-             "    %s */\n"
+             "%s */\n"
              "static const uint8_t %s%s_iStream[%u] =\n"
              "{\n"
            , nameRe
-           , pCompiler->cStream
+           , regExpsAsComment
            , namespc
            , nameRe
            , (unsigned)(pCompiler->re.lenIStream
                         + pCompiler->re.noCharSets*sizeof(re_charSet_t)
+                        + pCompiler->re.lenRequiredLit
+                        + (pCompiler->re.noRegExpsInSet > 0u
+                           ? RE_SIZE_OF_SET_DISPATCH(pCompiler->re.noRegExpsInSet)
+                           : 0u
+                          )
                        )
            );
     printCompiledIStream(file, &pCompiler->re, /*asCCode*/ true);
@@ -1318,24 +2064,37 @@ void exportCompiledExpression( FILE *file
            , "};\n"
              "\n"
              "/** The compiled regular expression %s:\\n\n"
-             "    %s */\n"
+             "%s */\n"
              "static const struct re_compiledRegExp_t %s%s =\n"
              "{\n"
-             "    .iStream       = (uint8_t*)&re_%s_iStream[0],\n"
-             "    .lenIStream    = %uu,\n"
-             "    .noCaptureGrps = %uu,\n"
-             "    .noCharSets    = %uu,\n"
+             "    .iStream        = (uint8_t*)&%s%s_iStream[0],\n"
+             "    .lenIStream     = %uu,\n"
+             "    .noCaptureGrps  = %uu,\n"
+             "    .noCharSets     = %uu,\n"
+             "    .lenRequiredLit = %uu,\n"
+             "    .idxRequiredLit = %uu,\n"
+             "    .isPrefixLit    = %s,\n"
+             "    .noRegExpsInSet = %uu,\n"
+             "    .idxSetDispatch = %uu,\n"
+             "    .isSetMatchAnywhere = %s,\n"
              "};\n"
              "\n"
              "\n"
            , nameRe
-           , pCompiler->cStream
+           , regExpsAsComment
            , namespc
            , nameRe
+           , namespc
            , nameRe
            , pCompiler->re.lenIStream
            , pCompiler->re.noCaptureGrps
            , pCompiler->re.noCharSets
+           , pCompiler->re.lenRequiredLit
+           , pCompiler->re.idxRequiredLit
+           , pCompiler->re.isPrefixLit? "true": "false"
+           , pCompiler->re.noRegExpsInSet
+           , pCompiler->re.idxSetDispatch
+           , pCompiler->re.isSetMatchAnywhere? "true": "false"
            );
 
 } /* exportCompiledExpression */
@@ -1359,7 +2118,9 @@ static void usage(void)
       "  -help: Boolean, print this text.\n"
       "  -h: Same as -help.\n"
       "  -re: Define regular expression. Next argument is the regular expression. This\n"
-      "option is mandatory unless help is requested.\n"
+      "option is mandatory unless help is requested. If it is repeated, then all the\n"
+      "regular expressions are compiled into a set, which is matched with\n"
+      "re_matchSet(). The expressions, which match an input string, are reported.\n"
       "  -file: The successfully compiled regular expression is exported as a C source\n"
       "code snippet, which enables integration of compiled expressions into an\n"
       "embedded software program. Next argument is the file path and name.\n"
@@ -1374,7 +2135,13 @@ static void usage(void)
       "expressions in one and the same file by repeated runs of the application.\n"
       "  -namespc: Next argument is the namespace used for the global, regular expression\n"
       "related elements in the exported C source code snippet. The passed string will\n"
-      "precede the name of all of these elements. Optional, default is the empty string.\n";
+      "precede the name of all of these elements. Optional, default is the empty string.\n"
+      "  -pikevm: Boolean, match the input strings with the lockstep matcher\n"
+      "re_matchPikeVM() instead of the backtracking matcher re_match().\n"
+      "  -dfa: Boolean, generate a DFA from the compiled regular expression. The DFA is\n"
+      "exported together with the compiled expression and the input strings are matched\n"
+      "with the table walking matcher re_matchDFA(). The regular expression must not\n"
+      "have more than one capture group, which needs to be its final element.\n";
 
     puts(usageMsg);
 
@@ -1405,11 +2172,15 @@ int main(int noArgs, const char * const * pArgStr)
     signed int idxArg = 1
              , idxArg1stInputString = noArgs;
     const char * const * pAStr = pArgStr;
+    const char *regExpStrAry[RE_MAX_NO_REGEXPS_IN_SET];
+    unsigned int noRegExps = 0u;
     const char *regExpStr = NULL
              , *regExpName = NULL
              , *regExpNamespc = NULL
              , *codeFileName = NULL;
     bool appendToCodeFile = false
+       , usePikeVM = false
+       , useDFA = false
        , help = false;
     while(idxArg < noArgs)
     {
@@ -1421,8 +2192,19 @@ int main(int noArgs, const char * const * pArgStr)
         }
         else if(idxArg+1 < noArgs  &&  strcmp(arg, "-re") == 0)
         {
-            regExpStr = * ++pAStr;
-            idxArg += 2u;
+            /* Repeated use of -re forms a set of regular expressions. */
+            if(noRegExps < RE_MAX_NO_REGEXPS_IN_SET)
+            {
+                regExpStrAry[noRegExps++] = * ++pAStr;
+                regExpStr = regExpStrAry[0];
+                idxArg += 2u;
+            }
+            else
+            {
+                printf("Too many regular expressions given on the command line.\n");
+                help = true;
+                break;
+            }
         }
         else if(idxArg+1 < noArgs  &&  strcmp(arg, "-file") == 0)
         {
@@ -1444,6 +2226,16 @@ int main(int noArgs, const char * const * pArgStr)
             appendToCodeFile = true;
             idxArg += 1u;
         }
+        else if(idxArg < noArgs  &&  strcmp(arg, "-pikevm") == 0)
+        {
+            usePikeVM = true;
+            idxArg += 1u;
+        }
+        else if(idxArg < noArgs  &&  strcmp(arg, "-dfa") == 0)
+        {
+            useDFA = true;
+            idxArg += 1u;
+        }
         else if(arg[0] != '-')
         {
             idxArg1stInputString = idxArg;
@@ -1481,7 +2273,8 @@ int main(int noArgs, const char * const * pArgStr)
     }
 
     /* Step 2 of 4: Compilation of regular expression. */
-    printf("main: Try to compile regexp %s\n", regExpStr);
+    for(unsigned int u=0u; u<noRegExps; ++u)
+        printf("main: Try to compile regexp %s\n", regExpStrAry[u]);
     uint8_t iStream[MAX_LEN_ISTREAM];
     for(unsigned idxI=0u; idxI<sizeof(iStream)/sizeof(iStream[0]); ++idxI)
         iStream[idxI] = I_ILLEGAL;
@@ -1514,7 +2307,24 @@ int main(int noArgs, const char * const * pArgStr)
         .maxAllowedRecursionDepth = 0u,
         .err = re_errComp_success,
     };
-    re_compile(&compiler, regExpStr, /*matchAnywhere*/ true, /*maxAllowedRecursionDepth*/ 10u);
+    const bool isSet = noRegExps > 1u;
+    if(isSet)
+    {
+        re_compileSet( &compiler
+                     , regExpStrAry
+                     , noRegExps
+                     , /*matchAnywhere*/ true
+                     , /*maxAllowedRecursionDepth*/ 10u
+                     );
+    }
+    else
+    {
+        re_compile( &compiler
+                  , regExpStr
+                  , /*matchAnywhere*/ true
+                  , /*maxAllowedRecursionDepth*/ 10u
+                  );
+    }
     assert(compiler.recursionDepth == 0u);
     assert(compiler.err != re_errComp_success  ||  *compiler.pC == '\0');
     printf( "main: Compilation %s. Error: %u\n"
@@ -1523,22 +2333,63 @@ int main(int noArgs, const char * const * pArgStr)
           , compiler.err
           , compiler.maxRecursionDepth
           );
+    if(compiler.err == re_errComp_success  &&  compiler.re.lenRequiredLit > 0u)
+    {
+        printf( "  Required literal: %.*s (%s)\n"
+              , (int)compiler.re.lenRequiredLit
+              , (const char*)&compiler.re.iStream[compiler.re.idxRequiredLit]
+              , compiler.re.isPrefixLit? "prefix of match": "anywhere in match"
+              );
+    }
 
     /* Step 3 of 4: Export of compiled regular expression. (As listing to the console and
        optionally as C source code to a user chosen file. */
     int err = 0;
+    static struct re_dfaCompiler_t dfaCompiler;
     if(compiler.err == re_errComp_success)
     {
         printf( "main: Compiled expression:\n");
         printCompiledIStream(stdout, &compiler.re, /*asCCode*/ false);
 
+        if(useDFA)
+        {
+            if(re_dfaCompile(&dfaCompiler, &compiler.re))
+            {
+                printf( "main: DFA generation succeeded. States: %u, character classes: %u,"
+                        " size of tables: %u Byte\n"
+                      , dfaCompiler.dfa.noStates
+                      , dfaCompiler.dfa.noClasses
+                      , UINT8_MAX+1u
+                        + dfaCompiler.dfa.noStates*(dfaCompiler.dfa.noClasses+1u)
+                      );
+            }
+            else
+            {
+                printf("main: DFA generation failed. Error: %u\n", dfaCompiler.err);
+                err = -5;
+            }
+        }
+    }
+    else
+        err = -2;
+
+    if(err == 0)
+    {
         if(codeFileName != NULL  &&  regExpName != NULL)
         {
             const char * const namespc = regExpNamespc != NULL? regExpNamespc: "";
             FILE *file = fopen(codeFileName, appendToCodeFile? "a": "w");
             if(file != NULL)
             {
-                exportCompiledExpression(file, &compiler, namespc, regExpName);
+                exportCompiledExpression( file
+                                        , &compiler
+                                        , regExpStrAry
+                                        , noRegExps
+                                        , namespc
+                                        , regExpName
+                                        );
+                if(useDFA)
+                    re_exportDFA(file, &dfaCompiler, regExpStr, namespc, regExpName);
                 fclose(file);
                 printf( "The compiled regular expression has been exported to file %s\n"
                       , codeFileName
@@ -1554,8 +2405,6 @@ int main(int noArgs, const char * const * pArgStr)
             } /* if(File could be successfully opened?) */
         } /* if(Export of compiled expression demanded on command line?) */
     }
-    else
-        err = -2;
 
     /* Step 4 of 4: Use of compiled regular expression for testing; all further input
        arguments are matched against the expression. */
@@ -1564,6 +2413,7 @@ int main(int noArgs, const char * const * pArgStr)
         pAStr = pArgStr + idxArg1stInputString;
         struct re_matcherStackElement_t matcherPathElementAry[50];
         struct re_matcherCGrpStackElement_t matcherCGrpStack[20];
+        static uint16_t threadMem[0x8000];
 
         /* The user needs to pre-configure the matcher object with respect to the memory
            configuration. The other fields don't care. This is a static descision; we need
@@ -1584,6 +2434,12 @@ int main(int noArgs, const char * const * pArgStr)
                should suffice for the number of groups used in the regular expression. */
             .cGrpStack = matcherCGrpStack,
             .maxNoCapturedGrps = sizeof(matcherCGrpStack)/sizeof(matcherCGrpStack[0]),
+
+            /* The memory for the threads of the lockstep matcher is chosen large enough
+               for all expressions the compiler accepts, which don't have many bounded
+               loops. */
+            .threadMem = threadMem,
+            .sizeOfThreadMem = sizeof(threadMem),
         };
 
         /* All remaining command line arguments are considered strings to be matched
@@ -1591,20 +2447,79 @@ int main(int noArgs, const char * const * pArgStr)
         for(idxArg=idxArg1stInputString; idxArg<noArgs; ++idxArg)
         {
             const char * const arg = * pAStr++;
-            const bool patternMatches = re_matchCString(&matcher, &compiler.re, arg);
+
+            /* The DFA has its own, much simpler matcher, which doesn't use the matcher
+               object. */
+            if(useDFA)
+            {
+                struct re_dfaMatch_t match;
+                if(re_matchDFA(&dfaCompiler.dfa, arg, strlen(arg), &match))
+                {
+                    printf( "Matching %s against DFA of %s succeeded\n"
+                            "Unconsumed input: '%s'\n"
+                          , arg
+                          , regExpStr
+                          , arg + match.idxEnd
+                          );
+                    if(match.noCapturedGrps > 0u)
+                    {
+                        printf( "  Group 1, match 1, from %u to %u: '%.*s'\n"
+                              , match.idxCGrpFrom
+                              , match.idxCGrpTo
+                              , (int)(match.idxCGrpTo - match.idxCGrpFrom)
+                              , arg + match.idxCGrpFrom
+                              );
+                    }
+                }
+                else
+                {
+                    printf("Matching %s against DFA of %s failed\n", arg, regExpStr);
+                    err = -4;
+                }
+                continue;
+            }
+
+            /* A set is matched in one pass with the lockstep matcher. */
+            bool patternMatches;
+            if(isSet)
+            {
+                uint32_t matchMask;
+                unsigned int idxRegExp;
+                patternMatches = re_matchSet( &matcher
+                                            , &compiler.re
+                                            , arg
+                                            , strlen(arg)
+                                            , &matchMask
+                                            , &idxRegExp
+                                            );
+                printf("Matching %s against set of %u regexps:", arg, noRegExps);
+                for(unsigned int u=0u; u<noRegExps; ++u)
+                {
+                    if((matchMask & (1ul<<u)) != 0u)
+                        printf(" %s", regExpStrAry[u]);
+                }
+                printf(patternMatches? "\n": " (none)\n");
+                if(patternMatches)
+                    printf("  Winner: %s\n", regExpStrAry[idxRegExp]);
+            }
+            else if(usePikeVM)
+                patternMatches = re_matchPikeVM(&matcher, &compiler.re, arg, strlen(arg));
+            else
+                patternMatches = re_matchCString(&matcher, &compiler.re, arg);
             assert(patternMatches == (matcher.err == re_errMatch_success));
             printf( "Matching %s against %s %s (error %u)\n"
 #if RE_MATCHER_COMPILE_STATISTICS != 0
                     "  Instructions needed: %u\n"
-                    "  Path stack elements needed: %u\n"
+                    "  %s needed: %u\n"
 #endif
                   , arg
-                  , regExpStr
+                  , isSet? "the set": regExpStr
                   , patternMatches? "succeeded": "failed"
                   , (unsigned)matcher.err
 #if RE_MATCHER_COMPILE_STATISTICS != 0
                   , matcher.noInstructions
-                  , matcher.maxUsePathElements
+                  , usePikeVM || isSet? "Threads": "Path stack elements"
+                  , usePikeVM || isSet? matcher.maxUseThreads: matcher.maxUsePathElements
 #endif
                   );
 
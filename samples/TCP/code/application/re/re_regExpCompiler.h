@@ -159,6 +159,10 @@ enum re_compilerError_t
     /** A character range contains the construct x-y, but character x has a character code
         greater or equal than character y. */
     re_errComp_charSetBadRange,                 /* 18 */
+
+    /** A set of regular expressions, see re_compileSet(), needs to have at least one and
+        not more than #RE_MAX_NO_REGEXPS_IN_SET expressions. */
+    re_errComp_badNoRegExpsInSet,               /* 19 */
 };
 
 /** The regular expression compiler. The object contains a combination of configuration
@@ -277,6 +281,14 @@ bool re_compile( struct re_compiler_t * const pCompiler
                , bool matchAnywhere
                , unsigned int maxAllowedRecursionDepth
                );
+
+/** Compile a set of regular expressions for matching in a single pass. */
+bool re_compileSet( struct re_compiler_t * const pCompiler
+                  , const char * const regExpAry[]
+                  , unsigned int noRegExps
+                  , bool matchAnywhere
+                  , unsigned int maxAllowedRecursionDepth
+                  );
 #endif
 
 #if RE_REQUIRE_MAIN == 1
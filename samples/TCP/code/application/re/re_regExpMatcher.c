@@ -2,7 +2,20 @@
  * @file re_regExpMatcher.c
  * Implementation of a simple regular expression matcher. The matcher operates on
  * expressions, which have been compiled before using the compiler in file
- * re_regExpCompiler.c.
+ * re_regExpCompiler.c.\n
+ *   Two matchers are offered for the same compiled expressions. re_match() is a
+ * backtracking matcher, which tries one match path after another. It is fast and needs
+ * little memory for typical expressions and input but it can take exponential time and
+ * run out of memory for unfortunate combinations of both. re_matchPikeVM() is a lockstep
+ * matcher, which advances all still possible match paths, the threads, together, character
+ * by character. Its time per character is proportional to the number of threads. Without
+ * bounded loops, this number is bounded by the length of the expression and the time is
+ * linear in the length of the input; bounded loops can multiply it by their counts. Its
+ * memory is bounded and can be configured in advance. Both matchers yield the same result,
+ * including the captured groups.\n
+ *   re_matchSet() applies the lockstep matcher to a set of regular expressions, which have
+ * been compiled into a single instruction stream. It reports all matching expressions in
+ * one pass over the input.
  *
  * Copyright (C) 2024 Peter Vranken (mailto:Peter_Vranken@Yahoo.de)
  *
@@ -22,6 +35,12 @@
 /* Module interface
  *   re_match
  *   re_matchCString
+ *   re_matchPikeVM
+ *   re_matchSet
+ *   re_matchBegin
+ *   re_matchFeed
+ *   re_matchEnd
+ *   re_getSizeOfThreadMem
  *   re_getNoMatchesCaptureGrp
  *   re_getMatchOfCaptureGrp
  *   re_copyMatchOfCaptureGrp
@@ -41,8 +60,23 @@
  *   getCurrentLoopState
  *   pushCGrpStart
  *   storeCGrpEnd
+ *   isCntLoop
  *   matchLoop
  *   matchLoopEnd
+ *   getThreadLayout
+ *   getThread
+ *   getSuccessor
+ *   hashThread
+ *   isNewThread
+ *   addThread
+ *   initPikeVM
+ *   resetStamps
+ *   startPikeVM
+ *   stepPikeVM
+ *   getIdxCFirstReferenced
+ *   startSetThreads
+ *   findLiteral
+ *   prefilterInput
  */
 
 /// @todo Possible improvements:\n
@@ -86,6 +120,7 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
@@ -190,6 +225,99 @@ struct iCapEnd_t
     unsigned int idxCGrp;
 };
 
+/** A thread of the lockstep matcher re_matchPikeVM(). A thread is a match path, which
+    has come until a given instruction with a given input character. The struct is the
+    header of the thread object; in the thread memory, it is followed by the counters of
+    the bounded loops and by the stack of captured groups of the thread. */
+struct pikeVMThread_t
+{
+    /** The instruction, which the thread will execute next, as index into the instruction
+        stream. */
+    uint16_t idxI;
+
+    /** The number of captured groups of the thread. */
+    uint8_t noCapturedGrps;
+
+    /** The counters of the bounded loops, by loop index. The number of counters is the
+        same for all threads of a match; it depends on the regular expression. */
+    uint8_t loopCntAry[];
+};
+
+/** The run-time data of the lockstep matcher re_matchPikeVM(). The object organizes the
+    user provided thread memory of the matcher object for the given regular expression. */
+struct pikeVM_t
+{
+    /** The matcher object by reference. */
+    struct re_matcher_t *pMatcher;
+
+    /** The number of loop counters of a thread. */
+    unsigned int noLoopCnts;
+
+    /** The offset in Byte of the stack of captured groups in a thread object. */
+    unsigned int offsCGrpAry;
+
+    /** The size in Byte of a thread object. */
+    unsigned int sizeOfThread;
+
+    /** The capacity of either list of threads. */
+    unsigned int maxNoThreads;
+
+    /** For each instruction, the stamp of the thread list, which has most recently got a
+        thread at this instruction. The stamp of a list is the index of its input character
+        plus one. */
+    uint16_t *stampAry;
+
+    /** Only if the threads have loop counters: For each instruction with a current stamp,
+        the index of the first thread, which the list has got at this instruction. */
+    uint16_t *idxFirstThreadAry;
+
+    /** Only if the threads have loop counters: The hash table of the further threads,
+        which the list has got at an instruction. The stamps don't suffice to tell whether
+        a thread is in the list; threads with different loop counts may wait at the same
+        instruction. A slot holds the stamp of the list and the index of the thread in the
+        list; a slot with an outdated stamp is empty. */
+    uint16_t *hashAry;
+
+    /** The number of slots of \a hashAry, two per thread, or zero if there are no loop
+        counters. */
+    unsigned int noHashSlots;
+
+    /** Stack of the threads, whose second successor has not been visited yet. */
+    uint16_t *stackAry;
+
+    /** The two lists of threads, for the current and for the next input character. A list
+        has one slot more than \a maxNoThreads. The additional slot is the scratch space
+        for the next candidate. */
+    uint8_t *threadListAry[2];
+
+    /** The number of threads in either list. */
+    unsigned int noThreadsAry[2];
+
+    /** A thread has matched. */
+    bool isMatching;
+
+    /** If \a isMatching: The index of the input position, where the match ends. */
+    unsigned int idxCEndOfMatch;
+
+    /** If \a isMatching: The index of the matching regular expression of a set or zero
+        for a single expression. */
+    unsigned int idxRegExpOfMatch;
+
+    /** Normally, a match drops all threads of lower priority. If this flag is set, then
+        these threads are continued, for a set of regular expressions, to find all
+        matching expressions. */
+    bool isCollectingAll;
+
+    /** If \a isCollectingAll: For either list, the number of threads, which have a higher
+        priority than the current match and which can still replace it. The threads behind
+        can only add to \a matchMask. */
+    unsigned int noCandidatesAry[2];
+
+    /** If \a isCollectingAll: The expressions of the set, which have matched so far, as a
+        bit mask. */
+    uint32_t matchMask;
+};
+
 _Static_assert(sizeof(struct re_matcherPathElement_t)==6, "Unexpected size");
 _Static_assert( offsetof(struct re_matcherPathElement_t, idxI)
                 == offsetof(struct re_matcherPathElement_t, idxI_s)
@@ -1065,6 +1193,21 @@ static void storeCGrpEnd( struct re_matcher_t * const pMatcher
 } /* storeCGrpEnd */
 
 
+/**
+ * Check if a loop requires a cycle counter. The common loops *, +, ? and {1} don't, they
+ * can decide without knowing the number of already matched cycles.
+ *   @return
+ * Get \a true if a counter needs to be maintained for the loop.
+ *   @param pILoop
+ * The loop instruction by reference.
+ */
+static inline bool isCntLoop(const struct iLoop_t * const pILoop)
+{
+    return pILoop->min > 1u  ||  (pILoop->max > 1u  &&  pILoop->max < UINT8_MAX);
+
+} /* isCntLoop */
+
+
 /**
  * Execution of the loop instruction. Mainly the initialization of the loop counter (if
  * applicable as for bounded loops) and the decision, where to continue matching and what
@@ -1090,9 +1233,8 @@ static void matchLoop( struct re_matcher_t * const pMatcher
     const uint8_t *pI = *ppI;
     const bool isAltBehindLoop = pILoop->isGreedy &&  pILoop->min == 0u
              , isAltBody = !pILoop->isGreedy &&  pILoop->min == 0u
-             , isCntLoop = pILoop->min > 1u
-                           ||  (pILoop->max > 1u  &&  pILoop->max < UINT8_MAX);
-    if(isCntLoop)
+             , isCnt = isCntLoop(pILoop);
+    if(isCnt)
     {
         TRACE_ALT( "%2u, Push counter value 0 at entry in loop %u at %u\n"
                  , pMatcher->noPathElements
@@ -1169,15 +1311,13 @@ static void matchLoopEnd( struct re_matcher_t * const pMatcher
 {
     const uint8_t *pI = *ppI;
 
-    const bool is01Loop = pILoopEnd->iLoop.min == 0u
-                          &&  pILoopEnd->iLoop.max == 1u
-             , isCntLoop = !is01Loop
-                           &&  (pILoopEnd->iLoop.min > 1u
-                                ||  pILoopEnd->iLoop.max < UINT8_MAX
-                               );
+    /* Note, the loop counter needs to be decided in the same way as at the loop entry,
+       see matchLoop(). Otherwise the counter state is not found, e.g., for x{1}. */
+    const bool isCnt = isCntLoop(&pILoopEnd->iLoop)
+             , isUnbounded = pILoopEnd->iLoop.max == UINT8_MAX;
     unsigned int cnt =  1u;
     struct re_matcherLoopState_t *pLoopState = NULL;
-    if(isCntLoop)
+    if(isCnt)
     {
         pLoopState = getCurrentLoopState(pMatcher, pILoopEnd->iLoop.idxLoop);
         cnt += pLoopState->noCycles;
@@ -1188,15 +1328,17 @@ static void matchLoopEnd( struct re_matcher_t * const pMatcher
                  , (unsigned)(pI-3-pMatcher->pRe->iStream)
                  );
     }
-    const bool cntPermitsTwoPaths = !(isCntLoop || is01Loop)
-                                    ||  (cnt >= pILoopEnd->iLoop.min
-                                         &&  cnt < pILoopEnd->iLoop.max
-                                        )
-             , cntForcesBreak = cnt >= pILoopEnd->iLoop.max
+    const bool cntPermitsTwoPaths = cnt >= pILoopEnd->iLoop.min
+                                    &&  (isUnbounded ||  cnt < pILoopEnd->iLoop.max)
+             , cntForcesBreak = !isUnbounded &&  cnt >= pILoopEnd->iLoop.max
              , isAltBehindLoop = pILoopEnd->iLoop.isGreedy && cntPermitsTwoPaths
              , isAltBody = !pILoopEnd->iLoop.isGreedy && cntPermitsTwoPaths
              , contBehindLoop = isAltBody || cntForcesBreak
-             , updateCnt = isCntLoop && !cntForcesBreak;
+             , updateCnt = isCnt && !cntForcesBreak;
+
+    /* An unbounded loop, x{m,}, needs to count only until it reaches the minimum. */
+    if(isUnbounded &&  cnt > pILoopEnd->iLoop.min)
+        cnt = pILoopEnd->iLoop.min;
 
     if(updateCnt)
     {
@@ -1208,7 +1350,17 @@ static void matchLoopEnd( struct re_matcher_t * const pMatcher
                  );
         assert(pILoopEnd->iLoop.idxLoop == pLoopState->idxLoop);
         assert(cnt < UINT8_MAX);
-        pLoopState->noCycles = (uint8_t)cnt;
+
+        /* The counter state can be updated in place only if it is the top of the stack.
+           Otherwise, path alternatives have been pushed since, which still refer to the
+           old count, and the new count needs to be pushed; it is discarded together with
+           the current path if one of these alternatives is popped. */
+        const struct re_matcherStackElement_t * const pTop =
+                                    &pMatcher->matcherPathStack[pMatcher->noPathElements-1u];
+        if(!pTop->isPathElem  &&  &pTop->loopState == pLoopState)
+            pLoopState->noCycles = (uint8_t)cnt;
+        else
+            pushLoop(pMatcher, pILoopEnd->iLoop.idxLoop, (uint8_t)cnt);
     }
 
     if(isAltBehindLoop)
@@ -1253,6 +1405,948 @@ static void matchLoopEnd( struct re_matcher_t * const pMatcher
 } /* matchLoopEnd */
 
 
+/**
+ * Helper of the lockstep matcher: Get the layout of a thread object for a given regular
+ * expression and capacity of the captured group stack.
+ *   @return
+ * Get the size in Byte of a thread object. The size is a multiple of two in order to
+ * properly align all thread objects in the thread memory.
+ *   @param pRe
+ * The compiled regular expression by reference.
+ *   @param maxNoCapturedGrps
+ * The capacity of the captured group stack of a thread.
+ *   @param pNoLoopCnts
+ * The number of loop counters of a thread is returned by reference. The bounded loops
+ * are addressed to by their loop index, so this is the greatest index of a bounded loop
+ * plus one, or zero if the expression has no bounded loops.
+ *   @param pOffsCGrpAry
+ * The offset in Byte of the captured group stack in the thread object is returned by
+ * reference.
+ */
+static unsigned int getThreadLayout( const struct re_compiledRegExp_t * const pRe
+                                   , unsigned int maxNoCapturedGrps
+                                   , unsigned int * const pNoLoopCnts
+                                   , unsigned int * const pOffsCGrpAry
+                                   )
+{
+    /* Find the bounded loops. We need to step through the instruction stream; the
+       instruction length depends on the op code. For a set, the compiler has done this
+       already, the result is found in the dispatch table. */
+    unsigned int noLoopCnts = 0u;
+    const uint8_t *pI = pRe->iStream;
+    const uint8_t * const pEndIStream = pI + pRe->lenIStream;
+    if(pRe->noRegExpsInSet > 0u)
+    {
+        const uint8_t * const table = pRe->iStream + pRe->idxSetDispatch;
+        noLoopCnts = (table[0] << 8) + table[1];
+        pI = pEndIStream;
+    }
+    while(pI < pEndIStream)
+    {
+        struct iLoop_t iLoop;
+        if(iFetchLoop(&iLoop, &pI))
+        {
+            if(isCntLoop(&iLoop)  &&  iLoop.idxLoop >= noLoopCnts)
+                noLoopCnts = iLoop.idxLoop + 1u;
+        }
+        else
+        {
+            switch(*pI)
+            {
+            case OP_LOOPEND:
+            case OP_OR:
+            case OP_JMP:
+            case OP_CHARSET:
+                _Static_assert( LEN_I_LOOPEND == 3u  &&  LEN_I_OR == 3u  &&  LEN_I_JMP == 3u
+                                &&  LEN_I_CHARSET == 3u
+                              , "Implementation can't combine instructions"
+                              );
+                pI += 3u;
+                break;
+
+            case OP_CAP:
+            case OP_CAPEND:
+            case OP_ESC:
+            case OP_ACCEPT:
+                _Static_assert( LEN_I_CAP == 2u  &&  LEN_I_CAPEND == 2u
+                                &&  LEN_I_LIT_ESC == 2u  &&  LEN_I_ACCEPT == 2u
+                              , "Implementation can't combine instructions"
+                              );
+                pI += 2u;
+                break;
+
+            default:
+                ++ pI;
+            }
+        }
+    } /* while(All instructions) */
+    assert(pI == pEndIStream);
+
+    /* The captured groups contain 16 Bit integers and need to be aligned. */
+    _Static_assert( _Alignof(struct re_matcherCGrpStackElement_t) <= 2u
+                    &&  _Alignof(struct pikeVMThread_t) <= 2u
+                  , "Bad alignment of thread objects"
+                  );
+    const unsigned int offsCGrpAry = (offsetof(struct pikeVMThread_t, loopCntAry)
+                                      + noLoopCnts + 1u
+                                     ) & ~1u;
+    *pNoLoopCnts = noLoopCnts;
+    *pOffsCGrpAry = offsCGrpAry;
+    return (offsCGrpAry
+            + maxNoCapturedGrps*sizeof(struct re_matcherCGrpStackElement_t)
+            + 1u
+           ) & ~1u;
+
+} /* getThreadLayout */
+
+
+/**
+ * Helper of the lockstep matcher: Get a thread object by reference.
+ *   @return
+ * Get the thread object.
+ *   @param pVM
+ * The lockstep matcher by reference.
+ *   @param idxList
+ * The thread list, 0 or 1.
+ *   @param idxThread
+ * The index of the thread in the list. The index of the number of threads in the list is
+ * permitted; it addresses the scratch space for the next candidate.
+ */
+static inline struct pikeVMThread_t *getThread( const struct pikeVM_t * const pVM
+                                              , unsigned int idxList
+                                              , unsigned int idxThread
+                                              )
+{
+    assert(idxList < 2u  &&  idxThread <= pVM->maxNoThreads);
+    return (struct pikeVMThread_t*)(pVM->threadListAry[idxList]
+                                    + idxThread*pVM->sizeOfThread
+                                   );
+} /* getThread */
+
+
+/**
+ * Helper of the lockstep matcher: A thread, which points at an instruction, which doesn't
+ * consume an input character, is replaced by its successors. These are the threads, which
+ * are reached when executing the instruction. These are at maximum two; this function
+ * yields one of them.\n
+ *   The order of the successors is the priority of the match paths, as they are tried by
+ * the backtracking matcher.
+ *   @return
+ * Get \a true if the requested successor exists. \a false is returned if the thread ends
+ * at its instruction (e.g., an anchor, which doesn't match), if the instruction consumes an
+ * input character or if the second successor is requested of an instruction, which has
+ * just one.\n
+ *   If the function returns \a false then the matcher can have been set to an error
+ * state, if the thread exceeds the capacity of its captured group stack.
+ *   @param pVM
+ * The lockstep matcher by reference.
+ *   @param pT
+ * The thread by reference, whose successor is requested.
+ *   @param idxSuccessor
+ * 0 for the first successor, 1 for the second one.
+ *   @param pSuccessor
+ * If the function returns \a true then the successor thread has been written into * \a
+ * pSuccessor.
+ *   @param pHasSecondSuccessor
+ * The function returns by reference whether the thread has a second successor.
+ *   @param idxC
+ * The index of the next input character, i.e., the position in the input stream, which
+ * the thread relates to.
+ */
+static bool getSuccessor( struct pikeVM_t * const pVM
+                        , const struct pikeVMThread_t * const pT
+                        , unsigned int idxSuccessor
+                        , struct pikeVMThread_t * const pSuccessor
+                        , bool * const pHasSecondSuccessor
+                        , unsigned int idxC
+                        )
+{
+    struct re_matcher_t * const pMatcher = pVM->pMatcher;
+    const uint8_t * const iStream = pMatcher->pRe->iStream;
+    const uint8_t *pI = iStream + pT->idxI;
+
+#if RE_MATCHER_COMPILE_STATISTICS != 0
+    ++ pMatcher->noInstructions;
+#endif
+
+    /* Behind the last instruction, the thread has matched. At an instruction, which
+       consumes an input character, the thread waits for the next character. In either
+       case, there's no successor. */
+    *pHasSecondSuccessor = false;
+    _Static_assert( OP_LOOP+1u == OP_LOOPNG  &&  OP_LOOPNG+1u == OP_LOOPEND
+                    &&  OP_LOOPEND+1u == OP_OR  &&  OP_OR+1u == OP_JMP  &&  OP_JMP+1u == OP_CAP
+                    &&  OP_CAP+1u == OP_CAPEND
+                  , "Bad op code assignment"
+                  );
+    if(pT->idxI >= pMatcher->pRe->lenIStream
+       ||  !((*pI >= OP_LOOP  &&  *pI <= OP_CAPEND)  ||  *pI == I_CARET  ||  *pI == I_DOLLAR)
+      )
+    {
+        return false;
+    }
+
+    /* The successor inherits the state of the thread. We copy only the used part of the
+       captured group stack. */
+    memcpy( pSuccessor
+          , pT
+          , pVM->offsCGrpAry + pT->noCapturedGrps*sizeof(struct re_matcherCGrpStackElement_t)
+          );
+    struct re_matcherCGrpStackElement_t * const cGrpAry =
+                        (struct re_matcherCGrpStackElement_t*)((uint8_t*)pSuccessor
+                                                               + pVM->offsCGrpAry
+                                                              );
+    union
+    {
+        struct iLoop_t loop;
+        struct iLoopEnd_t loopEnd;
+        struct iOr_t or;
+        struct iJmp_t jmp;
+        struct iCap_t cap;
+        struct iCapEnd_t capEnd;
+    } instr = {.or = {.lenAlternative = 0u,},};
+
+    bool hasSuccessor = true;
+    if(iFetchLoop(&instr.loop, &pI))
+    {
+        /* See matchLoop(): A greedy loop first tries the body, a non-greedy loop first
+           tries to continue behind the loop. */
+        const bool isCnt = isCntLoop(&instr.loop);
+        if(isCnt)
+        {
+            assert(instr.loop.idxLoop < pVM->noLoopCnts);
+            pSuccessor->loopCntAry[instr.loop.idxLoop] = 0u;
+        }
+
+        const bool hasTwoPaths = instr.loop.min == 0u
+                 , takeBody = instr.loop.isGreedy == (idxSuccessor == 0u);
+        *pHasSecondSuccessor = hasTwoPaths;
+        if(!hasTwoPaths  &&  idxSuccessor > 0u)
+            hasSuccessor = false;
+        else if(!hasTwoPaths  ||  takeBody)
+        {
+            /* Instruction pointer already points to the body. */
+        }
+        else
+            pI += instr.loop.lenIBody + LEN_I_LOOPEND;
+    }
+    else if(iFetchLoopEnd(&instr.loopEnd, &pI))
+    {
+        /* See matchLoopEnd() for the decision, whether to repeat or leave the loop. */
+        const struct iLoop_t * const pILoop = &instr.loopEnd.iLoop;
+        const bool isCnt = isCntLoop(pILoop)
+                 , isUnbounded = pILoop->max == UINT8_MAX;
+        unsigned int cnt = 1u;
+        if(isCnt)
+        {
+            assert(pILoop->idxLoop < pVM->noLoopCnts);
+            cnt += pT->loopCntAry[pILoop->idxLoop];
+        }
+        const bool cntPermitsTwoPaths = cnt >= pILoop->min
+                                        &&  (isUnbounded ||  cnt < pILoop->max)
+                 , cntForcesBreak = !isUnbounded &&  cnt >= pILoop->max;
+        *pHasSecondSuccessor = cntPermitsTwoPaths;
+
+        bool takeBody;
+        if(cntPermitsTwoPaths)
+            takeBody = pILoop->isGreedy == (idxSuccessor == 0u);
+        else
+        {
+            takeBody = !cntForcesBreak;
+            if(idxSuccessor > 0u)
+                hasSuccessor = false;
+        }
+
+        if(hasSuccessor)
+        {
+            if(takeBody)
+            {
+                pI = instr.loopEnd.pIBody;
+                if(isCnt)
+                {
+                    /* An unbounded loop, x{m,}, needs to count only until it reaches the
+                       minimum. Counting further would only make the threads different,
+                       which are actually the same. */
+                    if(isUnbounded &&  cnt > pILoop->min)
+                        cnt = pILoop->min;
+                    assert(cnt < UINT8_MAX);
+                    pSuccessor->loopCntAry[pILoop->idxLoop] = (uint8_t)cnt;
+                }
+            }
+            else if(isCnt)
+            {
+                /* The counter of a left loop is reset. It is not used any more and all
+                   threads, which continue behind the loop, become identical. */
+                pSuccessor->loopCntAry[pILoop->idxLoop] = 0u;
+            }
+        }
+    }
+    else if(iFetchOr(&instr.or, &pI))
+    {
+        *pHasSecondSuccessor = true;
+        if(idxSuccessor > 0u)
+            pI += instr.or.lenAlternative;
+    }
+    else if(idxSuccessor > 0u)
+    {
+        /* All other instructions have a single successor. */
+        hasSuccessor = false;
+    }
+    else if(iFetchJmp(&instr.jmp, &pI))
+        pI += instr.jmp.dist;
+    else if(iFetchCap(&instr.cap, &pI))
+    {
+        if(pSuccessor->noCapturedGrps < pMatcher->maxNoCapturedGrps)
+        {
+            struct re_matcherCGrpStackElement_t * const pCGrp =
+                                                    &cGrpAry[pSuccessor->noCapturedGrps++];
+            assert(instr.cap.idxCGrp < UINT8_MAX);
+            pCGrp->idxCGrp = (uint8_t)instr.cap.idxCGrp;
+            pCGrp->idxCStreamFrom = (uint16_t)idxC;
+            pCGrp->idxCStreamTo   = (uint16_t)idxC;
+        }
+        else
+        {
+            hasSuccessor = false;
+            if(MATCHER_OK)
+                pMatcher->err = re_errMatch_captureGroupBufferOverflow;
+        }
+    }
+    else if(iFetchCapEnd(&instr.capEnd, &pI))
+    {
+        /* The end belongs to the top-most entry of the given group, see storeCGrpEnd(). */
+        unsigned int idxCGrp = pSuccessor->noCapturedGrps;
+        while(idxCGrp > 0u)
+        {
+            if(cGrpAry[--idxCGrp].idxCGrp == instr.capEnd.idxCGrp)
+            {
+                cGrpAry[idxCGrp].idxCStreamTo = (uint16_t)idxC;
+                break;
+            }
+        }
+    }
+    else if(*pI == I_CARET)
+    {
+        ++ pI;
+        hasSuccessor = idxC == 0u;
+    }
+    else if(*pI == I_DOLLAR)
+    {
+        ++ pI;
+        hasSuccessor = idxC == pMatcher->lenCStream;
+    }
+    else
+        assert(false);
+
+    if(hasSuccessor)
+        pSuccessor->idxI = (uint16_t)(pI - iStream);
+
+    return hasSuccessor;
+
+} /* getSuccessor */
+
+
+/**
+ * Helper of the lockstep matcher: Compute the hash of a thread from its instruction and
+ * its loop counters. The captured groups don't matter. (FNV-1a)
+ *   @return
+ * Get the hash value.
+ *   @param pVM
+ * The lockstep matcher by reference.
+ *   @param pT
+ * The thread by reference.
+ */
+static inline uint32_t hashThread( const struct pikeVM_t * const pVM
+                                 , const struct pikeVMThread_t * const pT
+                                 )
+{
+    uint32_t hash = 2166136261u;
+    hash = (hash ^ (pT->idxI & 0xffu)) * 16777619u;
+    hash = (hash ^ (pT->idxI >> 8)) * 16777619u;
+    for(unsigned int u=0u; u<pVM->noLoopCnts; ++u)
+        hash = (hash ^ pT->loopCntAry[u]) * 16777619u;
+    return hash;
+
+} /* hashThread */
+
+
+/**
+ * Helper of the lockstep matcher: Check if the candidate in the scratch space of a thread
+ * list is new to the list. It is not if the list already contains a thread with same
+ * instruction and loop counters. (The captured groups don't matter for the further course
+ * of a thread.) A new candidate is registered as the next thread of the list.\n
+ *   Normally, the instruction stamps decide in constant time. With loop counters, an
+ * instruction can have many threads, one for each count, and comparing the candidate
+ * with all of them would make the time per input character quadratic in the number of
+ * threads. The first thread at an instruction is compared directly and the further ones
+ * are looked up in the hash table, which takes constant time on average, too.
+ *   @return
+ * Get \a true if the candidate is new to the list.
+ *   @param pVM
+ * The lockstep matcher by reference.
+ *   @param idxList
+ * The list, 0 or 1.
+ *   @param stamp
+ * The stamp of the list, see \a stampAry.
+ */
+static bool isNewThread( struct pikeVM_t * const pVM
+                       , unsigned int idxList
+                       , uint16_t stamp
+                       )
+{
+    const unsigned int idxCand = pVM->noThreadsAry[idxList];
+    const struct pikeVMThread_t * const pCand = getThread(pVM, idxList, idxCand);
+    if(pVM->stampAry[pCand->idxI] != stamp)
+    {
+        pVM->stampAry[pCand->idxI] = stamp;
+        if(pVM->noHashSlots > 0u)
+            pVM->idxFirstThreadAry[pCand->idxI] = (uint16_t)idxCand;
+        return true;
+    }
+    else if(pVM->noHashSlots == 0u)
+        return false;
+
+    const struct pikeVMThread_t * const pFirstT =
+                            getThread(pVM, idxList, pVM->idxFirstThreadAry[pCand->idxI]);
+    if(memcmp(pFirstT->loopCntAry, pCand->loopCntAry, pVM->noLoopCnts) == 0)
+        return false;
+
+    /* Linear probing. The table has two slots per thread, so there's always an empty
+       one. */
+    unsigned int idxSlot = hashThread(pVM, pCand) % pVM->noHashSlots;
+    while(true)
+    {
+        uint16_t * const pSlot = &pVM->hashAry[2u*idxSlot];
+        if(pSlot[0] != stamp)
+        {
+            pSlot[0] = stamp;
+            pSlot[1] = (uint16_t)idxCand;
+            return true;
+        }
+
+        const struct pikeVMThread_t * const pT = getThread(pVM, idxList, pSlot[1]);
+        if(pT->idxI == pCand->idxI
+           &&  memcmp(pT->loopCntAry, pCand->loopCntAry, pVM->noLoopCnts) == 0
+          )
+        {
+            return false;
+        }
+        if(++idxSlot == pVM->noHashSlots)
+            idxSlot = 0u;
+    }
+} /* isNewThread */
+
+
+/**
+ * Helper of the lockstep matcher: Add a thread to a thread list. Actually, not the thread
+ * itself is added but all threads, which are reached from it without consuming an input
+ * character, and which wait at an instruction, which consumes the next input character or
+ * which have completed the match. The threads are added in the order of their priority and
+ * a thread is not added if the list already contains the same thread. (The one in the
+ * list has the higher priority and both will behave identical from now on.)
+ *   @param pVM
+ * The lockstep matcher by reference.
+ *   @param idxList
+ * The list to add to, 0 or 1. The thread to add has been put into the scratch space of
+ * the list, i.e., the slot behind the last thread.
+ *   @param idxC
+ * The index of the next input character, i.e., the position in the input stream, which
+ * the threads of the list relate to.
+ */
+static void addThread(struct pikeVM_t * const pVM, unsigned int idxList, unsigned int idxC)
+{
+    struct re_matcher_t * const pMatcher = pVM->pMatcher;
+    const uint16_t stamp = (uint16_t)(idxC + 1u);
+    unsigned int * const pNoThreads = &pVM->noThreadsAry[idxList]
+               , noStackElems = 0u;
+    assert(idxC < UINT16_MAX);
+
+    /* The threads are visited in depth first order, which is the priority order of the
+       match paths. A thread with two successors is put onto a stack until its first
+       successor and all of the threads reached from there have been visited. */
+    while(MATCHER_OK)
+    {
+        /* Try to commit the candidate in the scratch space. It is rejected if the list
+           already contains the same thread. */
+        const unsigned int idxCand = *pNoThreads;
+        struct pikeVMThread_t * const pCand = getThread(pVM, idxList, idxCand);
+        bool hasCand = false;
+        if(isNewThread(pVM, idxList, stamp))
+        {
+            if(idxCand < pVM->maxNoThreads)
+            {
+                ++ *pNoThreads;
+#if RE_MATCHER_COMPILE_STATISTICS != 0
+                if(*pNoThreads > pMatcher->maxUseThreads)
+                    pMatcher->maxUseThreads = *pNoThreads;
+#endif
+            }
+            else
+            {
+                pMatcher->err = re_errMatch_stateBufferOverflow;
+                break;
+            }
+
+            /* Visit the new thread and get the next candidate. */
+            bool hasSecondSuccessor;
+            hasCand = getSuccessor( pVM
+                                  , pCand
+                                  , /*idxSuccessor*/ 0u
+                                  , getThread(pVM, idxList, idxCand+1u)
+                                  , &hasSecondSuccessor
+                                  , idxC
+                                  );
+            if(hasSecondSuccessor)
+            {
+                assert(noStackElems < pVM->maxNoThreads);
+                pVM->stackAry[noStackElems++] = (uint16_t)idxCand;
+            }
+        }
+
+        /* If the thread didn't have a (new) successor then we continue with the second
+           successor of the most recently visited thread, which has one. */
+        while(!hasCand  &&  noStackElems > 0u  &&  MATCHER_OK)
+        {
+            bool hasSecondSuccessor __attribute__((unused));
+            const unsigned int idxT = pVM->stackAry[--noStackElems];
+            hasCand = getSuccessor( pVM
+                                  , getThread(pVM, idxList, idxT)
+                                  , /*idxSuccessor*/ 1u
+                                  , getThread(pVM, idxList, *pNoThreads)
+                                  , &hasSecondSuccessor
+                                  , idxC
+                                  );
+            assert(hasSecondSuccessor);
+        }
+
+        if(!hasCand)
+            break;
+
+    } /* while(All threads reached from the added one) */
+
+} /* addThread */
+
+
+/**
+ * Helper of the lockstep matcher: Organize the user provided thread memory of the matcher
+ * object for the given regular expression and check the configuration of the matcher
+ * object.
+ *   @return
+ * Get \a true if the configuration is alright. Otherwise, the error has been set in the
+ * matcher object and \a false is returned.
+ *   @param pVM
+ * The lockstep matcher is initialized by reference.
+ *   @param pMatcher
+ * The matcher object by reference. Its field \a pRe needs to be set.
+ */
+static bool initPikeVM(struct pikeVM_t * const pVM, struct re_matcher_t * const pMatcher)
+{
+    const struct re_compiledRegExp_t * const pCompiledRe = pMatcher->pRe;
+    *pVM = (struct pikeVM_t){ .pMatcher = pMatcher
+                            , .noCandidatesAry = {[0] = UINT_MAX, [1] = UINT_MAX}
+                            };
+
+    /* The memory holds the stamps of all instructions, the hash table of threads and the
+       first thread of each instruction if there are loop counters, the stack for the
+       depth first search and the two thread lists. */
+    pVM->sizeOfThread = getThreadLayout( pCompiledRe
+                                       , pMatcher->maxNoCapturedGrps
+                                       , &pVM->noLoopCnts
+                                       , &pVM->offsCGrpAry
+                                       );
+    const unsigned int noStamps = pCompiledRe->lenIStream + 1u
+                     , sizeOfStamps = (pVM->noLoopCnts > 0u? 2u: 1u)
+                                      * noStamps * sizeof(uint16_t)
+                     , sizeOfHashPerThread = pVM->noLoopCnts > 0u? 4u*sizeof(uint16_t): 0u;
+    if(pMatcher->sizeOfThreadMem >= sizeOfStamps + 2u*pVM->sizeOfThread)
+    {
+        /* The thread lists have one more slot, the scratch space. */
+        pVM->maxNoThreads = (pMatcher->sizeOfThreadMem - sizeOfStamps - 2u*pVM->sizeOfThread)
+                            / (sizeof(uint16_t) + sizeOfHashPerThread
+                               + 2u*pVM->sizeOfThread
+                              );
+        if(pVM->maxNoThreads > UINT16_MAX)
+            pVM->maxNoThreads = UINT16_MAX;
+    }
+    else
+        pVM->maxNoThreads = 0u;
+    pVM->noHashSlots = pVM->noLoopCnts > 0u? 2u*pVM->maxNoThreads: 0u;
+
+    /* Plausibility check of the configuration of the matcher object. */
+    if(pMatcher->threadMem == NULL  ||  pVM->maxNoThreads < 1u
+       ||  (pMatcher->cGrpStack == NULL) != (pMatcher->maxNoCapturedGrps == 0u)
+       ||  pMatcher->maxNoCapturedGrps > UINT8_MAX
+      )
+    {
+        pMatcher->err = re_errMatch_badMemoryConfiguration;
+        return false;
+    }
+
+    pVM->stampAry = pMatcher->threadMem;
+    pVM->hashAry = pVM->stampAry + noStamps;
+    pVM->idxFirstThreadAry = pVM->hashAry + 2u*pVM->noHashSlots;
+    pVM->stackAry = pVM->idxFirstThreadAry + (pVM->noHashSlots > 0u? noStamps: 0u);
+    pVM->threadListAry[0] = (uint8_t*)(pVM->stackAry + pVM->maxNoThreads);
+    pVM->threadListAry[1] = pVM->threadListAry[0] + (pVM->maxNoThreads+1u)*pVM->sizeOfThread;
+    assert((uint8_t*)pVM->threadListAry[1] + (pVM->maxNoThreads+1u)*pVM->sizeOfThread
+           <= (uint8_t*)pMatcher->threadMem + pMatcher->sizeOfThreadMem
+          );
+    return true;
+
+} /* initPikeVM */
+
+
+/**
+ * Helper of the lockstep matcher: Reset the instruction stamps and empty the hash table.
+ * This is required before the first thread list is filled; the thread memory may contain
+ * stamps from a previous use.
+ *   @param pVM
+ * The lockstep matcher by reference. It has been initialized with initPikeVM().
+ */
+static void resetStamps(struct pikeVM_t * const pVM)
+{
+    /* The hash table follows the stamps in memory. */
+    memset( pVM->stampAry
+          , 0
+          , (pVM->pMatcher->pRe->lenIStream + 1u + 2u*pVM->noHashSlots) * sizeof(uint16_t)
+          );
+} /* resetStamps */
+
+
+/**
+ * Helper of the lockstep matcher: Put the initial thread, which starts at the first
+ * instruction, and all threads reached from it into the thread list of the first input
+ * position.
+ *   @param pVM
+ * The lockstep matcher by reference. It has been initialized with initPikeVM().
+ *   @param idxC
+ * The input position, where matching begins. Normally zero but the pre-filter can tell
+ * that matching can't succeed at the preceding positions.
+ */
+static void startPikeVM(struct pikeVM_t * const pVM, unsigned int idxC)
+{
+    resetStamps(pVM);
+    struct pikeVMThread_t * const pT0 = getThread(pVM, /*idxList*/ idxC & 1u, /*idxT*/ 0u);
+    memset(pT0, 0, pVM->offsCGrpAry);
+    pVM->noThreadsAry[0] = 0u;
+    pVM->noThreadsAry[1] = 0u;
+    addThread(pVM, /*idxList*/ idxC & 1u, idxC);
+
+} /* startPikeVM */
+
+
+/**
+ * Helper of the lockstep matcher: Process the threads of one input position. If a thread
+ * has matched, then its result is stored in the matcher object. Otherwise, all threads,
+ * which accept the input character, are advanced into the other thread list.
+ *   @return
+ * Get \a true if the other thread list is not empty, i.e., if processing the next input
+ * position can still change the result of matching.
+ *   @param pVM
+ * The lockstep matcher by reference.
+ *   @param idxListCur
+ * The list of the threads to process, 0 or 1. The other list receives the advanced
+ * threads.
+ *   @param idxC
+ * The index of the processed input position.
+ *   @param pC
+ * The input character at position \a idxC by reference or NULL if \a idxC is the end of
+ * the input.
+ */
+static bool stepPikeVM( struct pikeVM_t * const pVM
+                      , unsigned int idxListCur
+                      , unsigned int idxC
+                      , const char * const pC
+                      )
+{
+    struct re_matcher_t * const pMatcher = pVM->pMatcher;
+    const struct re_compiledRegExp_t * const pCompiledRe = pMatcher->pRe;
+    const unsigned int idxListNext = idxListCur ^ 1u
+                     , noThreads = pVM->noThreadsAry[idxListCur];
+    pVM->noThreadsAry[idxListNext] = 0u;
+    pVM->noCandidatesAry[idxListNext] = UINT_MAX;
+    unsigned int noCandidates = pVM->noCandidatesAry[idxListCur];
+    for(unsigned int idxT=0u; idxT<noThreads && MATCHER_OK; ++idxT)
+    {
+        /* The successors of the threads behind the current match are behind the
+           successors of the candidates in the other list. */
+        if(idxT == noCandidates)
+            pVM->noCandidatesAry[idxListNext] = pVM->noThreadsAry[idxListNext];
+
+        const struct pikeVMThread_t * const pT = getThread(pVM, idxListCur, idxT);
+        if(pT->idxI == pCompiledRe->lenIStream
+           ||  pCompiledRe->iStream[pT->idxI] == OP_ACCEPT
+          )
+        {
+            /* The thread has matched. It has a higher priority than all threads, which
+               come later in the list; these are dropped. All earlier threads are still
+               continued and, if one of these matches later, then its result will replace
+               this one.
+                 The expressions of a set end with an accept instruction, which tells,
+               which expression has matched. */
+            const unsigned int idxRegExp = pT->idxI < pCompiledRe->lenIStream
+                                           ? pCompiledRe->iStream[pT->idxI+1u]
+                                           : 0u;
+            if(idxT < noCandidates)
+            {
+                const struct re_matcherCGrpStackElement_t * const cGrpAry =
+                            (const struct re_matcherCGrpStackElement_t*)((uint8_t*)pT
+                                                                         + pVM->offsCGrpAry
+                                                                        );
+                if(pT->noCapturedGrps > 0u)
+                {
+                    memcpy( pMatcher->cGrpStack
+                          , cGrpAry
+                          , pT->noCapturedGrps*sizeof(struct re_matcherCGrpStackElement_t)
+                          );
+                }
+                pMatcher->noCapturedGrps = pT->noCapturedGrps;
+                pVM->isMatching = true;
+                pVM->idxCEndOfMatch = idxC;
+                pVM->idxRegExpOfMatch = idxRegExp;
+                noCandidates = idxT + 1u;
+            }
+
+            /* When collecting all matches of a set, the threads of lower priority are
+               continued but they can't replace this match any more. */
+            if(!pVM->isCollectingAll)
+                break;
+            assert(idxRegExp < RE_MAX_NO_REGEXPS_IN_SET);
+            pVM->matchMask |= (uint32_t)1u << idxRegExp;
+        }
+        else if(pC != NULL)
+        {
+#if RE_MATCHER_COMPILE_STATISTICS != 0
+            ++ pMatcher->noInstructions;
+#endif
+            /* All threads in the list wait at an instruction, which consumes a
+               character. If it matches then the thread is advanced and added to the list
+               for the next character. */
+            const uint8_t *pI = pCompiledRe->iStream + pT->idxI;
+            bool shouldMatch;
+            if(immediateMatch(&shouldMatch, &pI, *pC))
+            {
+                struct pikeVMThread_t * const pNewT =
+                                getThread(pVM, idxListNext, pVM->noThreadsAry[idxListNext]);
+                memcpy( pNewT
+                      , pT
+                      , pVM->offsCGrpAry
+                        + pT->noCapturedGrps*sizeof(struct re_matcherCGrpStackElement_t)
+                      );
+                pNewT->idxI = (uint16_t)(pI - pCompiledRe->iStream);
+                addThread(pVM, idxListNext, idxC+1u);
+            }
+        }
+    } /* for(All threads of the current character) */
+
+    /* If the match had been the last candidate, then all threads, which are added to the
+       other list later, are behind the match. */
+    if(noCandidates <= noThreads  &&  pVM->noCandidatesAry[idxListNext] == UINT_MAX)
+        pVM->noCandidatesAry[idxListNext] = pVM->noThreadsAry[idxListNext];
+
+    return pC != NULL  &&  pVM->noThreadsAry[idxListNext] > 0u;
+
+} /* stepPikeVM */
+
+
+/**
+ * Streaming matcher: Find the lowest input position, which is still referenced by a
+ * captured group, either of a thread, which waits for the next input character, or of the
+ * match found so far. Later input can't add a captured group, which starts before the
+ * current input position.
+ *   @return
+ * Get the position as index into the concatenation of all chunks. If no captured group
+ * is referenced then get \a idxC.
+ *   @param pVM
+ * The lockstep matcher by reference.
+ *   @param idxList
+ * The list of the waiting threads, 0 or 1.
+ *   @param noThreads
+ * The number of waiting threads in list \a idxList.
+ *   @param idxC
+ * The current input position, which the waiting threads wait for.
+ */
+static unsigned int getIdxCFirstReferenced( const struct pikeVM_t * const pVM
+                                          , unsigned int idxList
+                                          , unsigned int noThreads
+                                          , unsigned int idxC
+                                          )
+{
+    const struct re_matcher_t * const pMatcher = pVM->pMatcher;
+    unsigned int idxCFirst = idxC;
+    if(pMatcher->stream.isMatching)
+    {
+        for(unsigned int u=0u; u<pMatcher->noCapturedGrps; ++u)
+        {
+            if(pMatcher->cGrpStack[u].idxCStreamFrom < idxCFirst)
+                idxCFirst = pMatcher->cGrpStack[u].idxCStreamFrom;
+        }
+    }
+    for(unsigned int idxT=0u; idxT<noThreads; ++idxT)
+    {
+        const struct pikeVMThread_t * const pT = getThread(pVM, idxList, idxT);
+        const struct re_matcherCGrpStackElement_t * const cGrpAry =
+                    (const struct re_matcherCGrpStackElement_t*)((const uint8_t*)pT
+                                                                 + pVM->offsCGrpAry
+                                                                );
+        for(unsigned int u=0u; u<pT->noCapturedGrps; ++u)
+        {
+            if(cGrpAry[u].idxCStreamFrom < idxCFirst)
+                idxCFirst = cGrpAry[u].idxCStreamFrom;
+        }
+    }
+    return idxCFirst;
+
+} /* getIdxCFirstReferenced */
+
+
+
+/**
+ * Helper of the set matcher: Start the expressions of a set, which can begin at a given
+ * input position, and add their threads to the thread list of this position. The threads
+ * are appended; they have a lower priority than all threads, which have begun at an
+ * earlier position. The dispatch table of the set tells, which expressions can begin with
+ * the input character; the other expressions don't cost anything.
+ *   @param pVM
+ * The lockstep matcher by reference.
+ *   @param idxC
+ * The index of the input position.
+ *   @param pC
+ * The input character at position \a idxC by reference or NULL if \a idxC is the end of
+ * the input.
+ */
+static void startSetThreads( struct pikeVM_t * const pVM
+                           , unsigned int idxC
+                           , const char * const pC
+                           )
+{
+    const struct re_matcher_t * const pMatcher = pVM->pMatcher;
+    const struct re_compiledRegExp_t * const pCompiledSet = pMatcher->pRe;
+    const unsigned int sizeOfMask = RE_SIZE_OF_SET_DISPATCH_MASK(pCompiledSet->noRegExpsInSet);
+    const uint8_t * const entryAry = pCompiledSet->iStream + pCompiledSet->idxSetDispatch + 2u
+                , * const maskAry = entryAry + 2u*pCompiledSet->noRegExpsInSet
+                , * const pMask = &maskAry[sizeOfMask*(pC != NULL? (unsigned)(uint8_t)*pC
+                                                                 : RE_SET_DISPATCH_IDX_END
+                                                      )
+                                          ]
+                , * const pMaskAnchored = &maskAry[sizeOfMask*RE_SET_DISPATCH_IDX_ANCHORED];
+    uint32_t mask = 0u;
+    for(unsigned int u=0u; u<sizeOfMask; ++u)
+    {
+        uint32_t byte = pMask[u];
+        if(idxC > 0u)
+            byte &= ~(uint32_t)pMaskAnchored[u];
+        mask |= byte << 8u*u;
+    }
+
+    /* The expressions are started in the order of the set, which is their priority. */
+    const unsigned int idxList = idxC & 1u;
+    for(unsigned int idxRegExp=0u; mask!=0u && MATCHER_OK; ++idxRegExp, mask>>=1u)
+    {
+        if((mask & 1u) != 0u)
+        {
+            struct pikeVMThread_t * const pT =
+                                    getThread(pVM, idxList, pVM->noThreadsAry[idxList]);
+            memset(pT, 0, pVM->offsCGrpAry);
+            pT->idxI = (uint16_t)((entryAry[2u*idxRegExp] << 8) + entryAry[2u*idxRegExp+1u]);
+            addThread(pVM, idxList, idxC);
+        }
+    }
+} /* startSetThreads */
+
+
+/**
+ * Helper of the pre-filter: Find the first occurrence of a character sequence in the
+ * input. The Boyer-Moore-Horspool algorithm is applied; on average, the search doesn't
+ * look at all input characters but skips by up to the length of the sequence.
+ *   @return
+ * Get the pointer to the first character of the first occurrence of \a lit in the input
+ * or NULL if \a lit is not found.
+ *   @param pC
+ * The first input character by reference.
+ *   @param pEnd
+ * The end of the input, i.e., the pointer behind the last input character.
+ *   @param lit
+ * The searched character sequence. It is not zero terminated.
+ *   @param lenLit
+ * The number of characters in \a lit. Range is 1..255.
+ */
+static const char *findLiteral( const char *pC
+                              , const char * const pEnd
+                              , const uint8_t * const lit
+                              , unsigned int lenLit
+                              )
+{
+    assert(lenLit >= 1u  &&  lenLit <= UINT8_MAX);
+    if((ptrdiff_t)lenLit > pEnd - pC)
+        return NULL;
+    else if(lenLit == 1u)
+        return memchr(pC, lit[0], (size_t)(pEnd - pC));
+
+    /* The skip table: For each input character, which is found at the position of the
+       last character of the sequence, the distance, by which the sequence can be moved
+       ahead without missing an occurrence. The table costs 256 Byte of stack. */
+    uint8_t skipAry[UINT8_MAX+1u];
+    memset(skipAry, (int)lenLit, sizeof(skipAry));
+    for(unsigned int u=0u; u<lenLit-1u; ++u)
+        skipAry[lit[u]] = (uint8_t)(lenLit-1u-u);
+
+    const uint8_t cLast = lit[lenLit-1u];
+    for(const char *pLast=pC+lenLit-1u; pLast<pEnd; pLast+=skipAry[(uint8_t)*pLast])
+    {
+        if((uint8_t)*pLast == cLast  &&  memcmp(pLast-(lenLit-1u), lit, lenLit-1u) == 0)
+            return pLast - (lenLit-1u);
+    }
+    return NULL;
+
+} /* findLiteral */
+
+
+/**
+ * The pre-filter of the matchers: Check the input for the literal character sequence,
+ * which every match of the regular expression contains, see field \a lenRequiredLit of
+ * the compiled expression. The fast substring search avoids running the instruction stream
+ * on inputs, which can't match, and, if the literal is the beginning of each match, on the
+ * input positions in front of its first occurrence.
+ *   @return
+ * Get \a false if the input can't match.
+ *   @param pMatcher
+ * The matcher object by reference. It has been configured with the compiled expression and
+ * the input.
+ *   @param pIdxCStart
+ * If the function returns \a true, then the first input position, where matching needs to
+ * begin, is returned in * \a pIdxCStart.
+ */
+static bool prefilterInput( const struct re_matcher_t * const pMatcher
+                          , unsigned int * const pIdxCStart
+                          )
+{
+    const struct re_compiledRegExp_t * const pRe = pMatcher->pRe;
+    *pIdxCStart = 0u;
+    if(pRe->lenRequiredLit == 0u)
+        return true;
+
+    const char * const pEnd = pMatcher->cStream + pMatcher->lenCStream
+             , * const pLit = findLiteral( pMatcher->cStream
+                                         , pEnd
+                                         , &pRe->iStream[pRe->idxRequiredLit]
+                                         , pRe->lenRequiredLit
+                                         );
+    if(pLit == NULL)
+        return false;
+    else if(pRe->isPrefixLit)
+    {
+        /* The match can begin at the first occurrence of the literal at earliest. The
+           preceding .*?, which implements matchAnywhere, doesn't consume a newline; if
+           there's a newline in front of the literal then the expression can't match. */
+        const unsigned int idxLit = (unsigned int)(pLit - pMatcher->cStream);
+        if(memchr(pMatcher->cStream, '\n', idxLit) != NULL)
+            return false;
+        *pIdxCStart = idxLit;
+    }
+    return true;
+
+} /* prefilterInput */
+
 
 /**
  * Main API: Call of the regular expression matcher. The input to match is an arbitrary
@@ -1314,7 +2408,18 @@ bool re_match( struct re_matcher_t * const pMatcher
     pMatcher->maxUsePathElements = 0u;
 #endif
 
-    const char * const endCStream = pMatcher->pC + pMatcher->lenCStream;
+    /* The input, which doesn't contain the required literal, is rejected without running
+       the instruction stream. */
+    unsigned int idxCStart;
+    if(MATCHER_OK)
+    {
+        if(prefilterInput(pMatcher, &idxCStart))
+            pMatcher->pC = inputStream + idxCStart;
+        else
+            pMatcher->err = re_errMatch_inputDoesNotMatch;
+    }
+
+    const char * const endCStream = pMatcher->cStream + pMatcher->lenCStream;
     const uint8_t *pI = pMatcher->pRe->iStream;
     const uint8_t * const pEndIStream = pI + pMatcher->pRe->lenIStream;
 
@@ -1391,6 +2496,12 @@ bool re_match( struct re_matcher_t * const pMatcher
             ++ pI;
             isMatching = pMatcher->pC == endCStream;
         }
+        else if(*pI == OP_ACCEPT)
+        {
+            /* An expression of a set has matched. This matcher doesn't tell which one, see
+               re_matchSet(). */
+            pI = pEndIStream;
+        }
         else if(pMatcher->pC < endCStream)
         {
             /* If we get here, then we have an immediate match with a consumed input
@@ -1491,6 +2602,447 @@ bool re_matchCString( struct re_matcher_t * const pMatcher
 } /* re_matchCString */
 
 
+/**
+ * Main API: Call of the lockstep regular expression matcher. The input to match is an
+ * arbitrary character sequence.\n
+ *   The function is an alternative to re_match(). It yields the same result, including
+ * the captured groups, but it doesn't backtrack. It simulates all possible match paths,
+ * the threads, in lockstep: Each input character is read only once and all threads, which
+ * still match, are advanced together. Threads, which reach the same instruction, are
+ * merged. Consequently, the matching time is proportional to the length of the input times
+ * the number of threads, which is bounded by the length of the compiled expression. (For
+ * expressions with bounded loops, like x{2,5}, a thread also differs by the loop cycle
+ * counts and the bound is higher.) The required memory is determined by the maximum
+ * number of simultaneous threads. It doesn't depend on the length of the input.\n
+ *   The lockstep matcher has a higher constant cost per input character than the
+ * backtracking matcher. It is the choice if an expression can take many alternative
+ * paths, e.g., (.|\N)*?, and if the input is large or can't be trusted.
+ *   @return
+ * The matcher returns \a true if the regular expression matches the input stream. See
+ * re_match() for details.
+ *   @param[in,out] pMatcher
+ * The matcher object by reference.\n
+ *   On entry, all fields have been configured, which relate to the user specified memory
+ * spaces. Other than for re_match(), these are the memory for the threads (.threadMem and
+ * .sizeOfThreadMem) and the storage for capture groups (.cGrpStack and
+ * .maxNoCapturedGrps). The field .matcherPathStack is not used.\n
+ *   On exit, the matcher contains the status field, err, which potentially indicates a
+ * matching error, the contents of the capture groups and some statistic values about
+ * matching effort and actually required number of threads. The capture groups can be
+ * fetched with the same API as after re_match(), e.g., re_getMatchOfCaptureGrp().
+ *   @param[in] pCompiledRe
+ * The compiled regular expression by reference. See re_match().
+ *   @param[in] inputStream
+ * The input to match as a character string in random access memory. See re_match().
+ *   @param[in] lenInputStream
+ * The number of characters of the input; see \a inputStream also.
+ */
+bool re_matchPikeVM( struct re_matcher_t * const pMatcher
+                   , const struct re_compiledRegExp_t * const pCompiledRe
+                   , const char * const inputStream
+                   , unsigned int lenInputStream
+                   )
+{
+    pMatcher->pRe = pCompiledRe;
+    pMatcher->cStream = inputStream;
+    pMatcher->lenCStream = lenInputStream;
+    pMatcher->pC = inputStream;
+    pMatcher->noPathElements = 0u;
+    pMatcher->noCapturedGrps = 0u;
+#if RE_MATCHER_COMPILE_STATISTICS != 0
+    pMatcher->noInstructions = 0u;
+    pMatcher->maxUsePathElements = 0u;
+    pMatcher->maxUseThreads = 0u;
+#endif
+
+    struct pikeVM_t vm;
+    if(!initPikeVM(&vm, pMatcher))
+        return false;
+    else if(lenInputStream >= UINT16_MAX)
+    {
+        /* The position in the input is the stamp of a thread list, which needs to fit
+           into 16 Bit. */
+        pMatcher->err = re_errMatch_inputStringTooLong;
+        return false;
+    }
+    else
+        pMatcher->err = re_errMatch_success;
+
+    /* The input, which doesn't contain the required literal, is rejected without running
+       the instruction stream. */
+    unsigned int idxC;
+    if(!prefilterInput(pMatcher, &idxC))
+    {
+        pMatcher->err = re_errMatch_inputDoesNotMatch;
+        return false;
+    }
+
+    /* The initial thread starts at the first instruction. */
+    startPikeVM(&vm, idxC);
+
+    while(MATCHER_OK)
+    {
+        const char * const pC = idxC < lenInputStream? &inputStream[idxC]: NULL;
+        if(!stepPikeVM(&vm, /*idxListCur*/ idxC & 1u, idxC, pC))
+            break;
+        ++ idxC;
+
+    } /* while(All input characters) */
+
+    /* Process may have been aborted due to out-of-memory, while we still had threads. */
+    bool isMatching = vm.isMatching;
+    if(!MATCHER_OK)
+        isMatching = false;
+    else if(!isMatching)
+        pMatcher->err = re_errMatch_inputDoesNotMatch;
+    else
+        pMatcher->pC = inputStream + vm.idxCEndOfMatch;
+
+    return isMatching;
+
+} /* re_matchPikeVM */
+
+
+/**
+ * Main API: Call of the lockstep matcher for a set of regular expressions, which have been
+ * compiled together with re_compileSet(). The input is read only once and the result tells
+ * all expressions of the set, which match the input. This is cheaper than matching the
+ * expressions one after another: The threads of all expressions are advanced together and
+ * an expression is started at an input position only if the dispatch table of the set
+ * says that it can begin with the input character there. The cost is determined by the
+ * number of simultaneously alive threads rather than by the number of expressions.\n
+ *   The captured groups and the end of the match, \a pMatcher->pC, relate to the match of
+ * highest priority, the "winner". This is the same match, which re_matchPikeVM() would
+ * find for the OR expression of all expressions of the set, like "re0|re1|re2": With \a
+ * matchAnywhere, the match, which begins first in the input, wins and, if several matches
+ * begin at the same position, then the expression, which comes first in the set.
+ *   @return
+ * Get \a true if at least one of the expressions matches the input.
+ *   @param[in,out] pMatcher
+ * The matcher object by reference. It needs to be configured as for re_matchPikeVM().
+ *   @param[in] pCompiledSet
+ * The compiled set of regular expressions by reference.
+ *   @param[in] inputStream
+ * The input to match as a character string in random access memory. See re_match().
+ *   @param[in] lenInputStream
+ * The number of characters of the input; see \a inputStream also.
+ *   @param[out] pMatchMask
+ * The matching expressions are returned as bit mask in * \a pMatchMask. Bit n is set if
+ * the expression with index n in the set matches. The mask is zero if the function returns
+ * \a false.
+ *   @param[out] pIdxRegExp
+ * If the function returns \a true, then the index of the winning expression in the set is
+ * returned in * \a pIdxRegExp. The captured groups are numbered as in this expression. The
+ * pointer may be NULL if the winner is not of interest.
+ */
+bool re_matchSet( struct re_matcher_t * const pMatcher
+                , const struct re_compiledRegExp_t * const pCompiledSet
+                , const char * const inputStream
+                , unsigned int lenInputStream
+                , uint32_t * const pMatchMask
+                , unsigned int * const pIdxRegExp
+                )
+{
+    pMatcher->pRe = pCompiledSet;
+    pMatcher->cStream = inputStream;
+    pMatcher->lenCStream = lenInputStream;
+    pMatcher->pC = inputStream;
+    pMatcher->noPathElements = 0u;
+    pMatcher->noCapturedGrps = 0u;
+#if RE_MATCHER_COMPILE_STATISTICS != 0
+    pMatcher->noInstructions = 0u;
+    pMatcher->maxUsePathElements = 0u;
+    pMatcher->maxUseThreads = 0u;
+#endif
+    *pMatchMask = 0u;
+
+    struct pikeVM_t vm;
+    if(!initPikeVM(&vm, pMatcher))
+        return false;
+    else if(lenInputStream >= UINT16_MAX)
+    {
+        pMatcher->err = re_errMatch_inputStringTooLong;
+        return false;
+    }
+    else
+        pMatcher->err = re_errMatch_success;
+
+    /* A set doesn't have a required literal. Instead of running the instruction stream
+       from the beginning, which visits all expressions at each input position, where a
+       match can begin, only those expressions are started, which can begin with the
+       input character. The prefix for matching anywhere is not executed but emulated: It
+       would start the expressions at the next position unless it is behind a newline. */
+    assert(pCompiledSet->lenRequiredLit == 0u  &&  pCompiledSet->noRegExpsInSet > 0u);
+    vm.isCollectingAll = true;
+    resetStamps(&vm);
+
+    unsigned int idxC = 0u;
+    bool mayStart = true;
+    while(MATCHER_OK)
+    {
+        const char * const pC = idxC < lenInputStream? &inputStream[idxC]: NULL;
+        if(mayStart)
+        {
+            startSetThreads(&vm, idxC, pC);
+            mayStart = pCompiledSet->isSetMatchAnywhere  &&  pC != NULL  &&  *pC != '\n';
+        }
+        if(!stepPikeVM(&vm, /*idxListCur*/ idxC & 1u, idxC, pC)  &&  !mayStart)
+            break;
+        ++ idxC;
+
+    } /* while(All input characters) */
+
+    bool isMatching = vm.isMatching;
+    if(!MATCHER_OK)
+        isMatching = false;
+    else if(!isMatching)
+        pMatcher->err = re_errMatch_inputDoesNotMatch;
+    else
+    {
+        pMatcher->pC = inputStream + vm.idxCEndOfMatch;
+        *pMatchMask = vm.matchMask;
+        if(pIdxRegExp != NULL)
+            *pIdxRegExp = vm.idxRegExpOfMatch;
+    }
+
+    return isMatching;
+
+} /* re_matchSet */
+
+
+/**
+ * Main API: Begin matching an input stream, which is not available as a whole but which
+ * arrives in chunks, like the segments of a TCP connection. The lockstep matcher is
+ * applied; the function prepares the matcher object for the later calls of
+ * re_matchFeed(), which pass the chunks one by one, and a final call of re_matchEnd().\n
+ *   The matcher doesn't need to see more than one chunk at a time and it doesn't keep a
+ * reference to the chunks. The match result is the same as of re_matchPikeVM() for the
+ * concatenation of all chunks, including the captured groups. After each chunk, field \a
+ * stream.idxCFirstReferenced of the matcher object tells, from which position on the
+ * caller needs to keep the input for fetching the captured groups.
+ *   @param[in,out] pMatcher
+ * The matcher object by reference. It needs to be configured as for re_matchPikeVM().
+ * Between the calls of re_matchBegin(), re_matchFeed() and re_matchEnd(), the matcher
+ * object holds the state of the matching and it must not be used for anything else.
+ *   @param[in] pCompiledRe
+ * The compiled regular expression by reference. See re_match().
+ */
+void re_matchBegin( struct re_matcher_t * const pMatcher
+                  , const struct re_compiledRegExp_t * const pCompiledRe
+                  )
+{
+    /* The input is never available as a whole. The end of the input is still unknown;
+       the anchor $ can't match before re_matchEnd(). */
+    pMatcher->pRe = pCompiledRe;
+    pMatcher->cStream = NULL;
+    pMatcher->lenCStream = UINT_MAX;
+    pMatcher->pC = NULL;
+    pMatcher->noPathElements = 0u;
+    pMatcher->noCapturedGrps = 0u;
+    pMatcher->stream = (struct re_matcherStreamState_t){.idxC = 0u,};
+#if RE_MATCHER_COMPILE_STATISTICS != 0
+    pMatcher->noInstructions = 0u;
+    pMatcher->maxUsePathElements = 0u;
+    pMatcher->maxUseThreads = 0u;
+#endif
+
+    struct pikeVM_t vm;
+    if(initPikeVM(&vm, pMatcher))
+    {
+        pMatcher->err = re_errMatch_success;
+        startPikeVM(&vm, /*idxC*/ 0u);
+        pMatcher->stream.noThreads = vm.noThreadsAry[0];
+    }
+} /* re_matchBegin */
+
+
+/**
+ * Main API: Match the next chunk of an input stream, after re_matchBegin().
+ *   @return
+ * Get \a true if more input can still change the result of matching. If the function
+ * returns \a false then the result is already decided; the caller should not feed more
+ * input but call re_matchEnd(). This happens if all match paths have failed, if the
+ * match of highest priority has been found, or in case of an error.
+ *   @param[in,out] pMatcher
+ * The matcher object by reference.
+ *   @param[in] chunk
+ * The next characters of the input stream. The memory contents doesn't need to persist
+ * after return.
+ *   @param[in] lenChunk
+ * The number of characters in \a chunk. The total length of all chunks needs to be less
+ * than 65535. (The captured groups store the positions in the input stream in 16 Bit.)
+ */
+bool re_matchFeed( struct re_matcher_t * const pMatcher
+                 , const char * const chunk
+                 , unsigned int lenChunk
+                 )
+{
+    struct re_matcherStreamState_t * const pStream = &pMatcher->stream;
+    if(!MATCHER_OK  ||  pStream->noThreads == 0u)
+        return false;
+    else if(pStream->idxC + lenChunk >= UINT16_MAX)
+    {
+        pMatcher->err = re_errMatch_inputStringTooLong;
+        return false;
+    }
+
+    /* The thread lists and the instruction stamps persist in the thread memory. The
+       other data of the lockstep matcher is restored from the matcher object. */
+    struct pikeVM_t vm;
+#ifndef DEBUG
+    __attribute__((unused))
+#endif
+    const bool success = initPikeVM(&vm, pMatcher);
+    assert(success);
+    vm.noThreadsAry[pStream->idxC & 1u] = pStream->noThreads;
+
+    const char *pC = chunk;
+    const char * const pEnd = chunk + lenChunk;
+    bool hasThreads = true;
+    while(pC < pEnd  &&  hasThreads  &&  MATCHER_OK)
+    {
+        hasThreads = stepPikeVM(&vm, /*idxListCur*/ pStream->idxC & 1u, pStream->idxC, pC);
+        ++ pStream->idxC;
+        ++ pC;
+    }
+
+    if(vm.isMatching)
+    {
+        pStream->isMatching = true;
+        pStream->idxCEnd = vm.idxCEndOfMatch;
+    }
+    pStream->noThreads = hasThreads? vm.noThreadsAry[pStream->idxC & 1u]: 0u;
+    pStream->idxCFirstReferenced = getIdxCFirstReferenced( &vm
+                                                         , /*idxList*/ pStream->idxC & 1u
+                                                         , pStream->noThreads
+                                                         , pStream->idxC
+                                                         );
+    return MATCHER_OK  &&  pStream->noThreads > 0u;
+
+} /* re_matchFeed */
+
+
+/**
+ * Main API: Complete matching of an input stream after the last call of re_matchFeed().
+ *   @return
+ * The matcher returns \a true if the regular expression matches the concatenation of all
+ * chunks. See re_match() for details.\n
+ *   On exit, the matcher object contains the status field, err, and the captured groups
+ * as after re_matchPikeVM(). The positions of the captured groups, which are returned by
+ * re_getMatchOfCaptureGrp(), are indexes into the concatenation of all chunks; the
+ * caller, who has fed the chunks, can map them onto its segments, e.g., with
+ * pbuf_copy_partial() for an lwIP pbuf chain. re_copyMatchOfCaptureGrp() can't be used as
+ * the matcher doesn't have the input. The end of the match is returned in field \a
+ * stream.idxCEnd of the matcher object.
+ *   @param[in,out] pMatcher
+ * The matcher object by reference.
+ */
+bool re_matchEnd(struct re_matcher_t * const pMatcher)
+{
+    struct re_matcherStreamState_t * const pStream = &pMatcher->stream;
+    if(MATCHER_OK  &&  pStream->noThreads > 0u)
+    {
+        /* Now the end of the input is known. The remaining threads have been built with a
+           never matching anchor $. The threads, which wait at an $, are continued from
+           there. Together with the threads, which have matched already, they are added
+           to the other list in their order, which maintains their priorities. The
+           instruction stamps are reset; the added threads relate to the same input
+           position as the remaining ones. */
+        struct pikeVM_t vm;
+#ifndef DEBUG
+        __attribute__((unused))
+#endif
+        const bool success = initPikeVM(&vm, pMatcher);
+        assert(success);
+        pMatcher->lenCStream = pStream->idxC;
+        resetStamps(&vm);
+
+        const unsigned int idxListCur = pStream->idxC & 1u
+                         , idxListEnd = idxListCur ^ 1u;
+        const uint8_t * const iStream = pMatcher->pRe->iStream;
+        vm.noThreadsAry[idxListEnd] = 0u;
+        for(unsigned int idxT=0u; idxT<pStream->noThreads && MATCHER_OK; ++idxT)
+        {
+            const struct pikeVMThread_t * const pT = getThread(&vm, idxListCur, idxT);
+            if(pT->idxI == pMatcher->pRe->lenIStream
+               ||  iStream[pT->idxI] == I_DOLLAR
+               ||  iStream[pT->idxI] == OP_ACCEPT
+              )
+            {
+                memcpy( getThread(&vm, idxListEnd, vm.noThreadsAry[idxListEnd])
+                      , pT
+                      , vm.offsCGrpAry
+                        + pT->noCapturedGrps*sizeof(struct re_matcherCGrpStackElement_t)
+                      );
+                addThread(&vm, idxListEnd, pStream->idxC);
+            }
+        }
+
+        if(MATCHER_OK)
+            stepPikeVM(&vm, idxListEnd, pStream->idxC, /*pC*/ NULL);
+        if(vm.isMatching)
+        {
+            pStream->isMatching = true;
+            pStream->idxCEnd = vm.idxCEndOfMatch;
+        }
+        pStream->noThreads = 0u;
+        pStream->idxCFirstReferenced = getIdxCFirstReferenced( &vm
+                                                             , idxListEnd
+                                                             , /*noThreads*/ 0u
+                                                             , pStream->idxC
+                                                             );
+    }
+
+    /* Process may have been aborted due to out-of-memory, while we still had threads. */
+    if(!MATCHER_OK)
+        return false;
+    else if(!pStream->isMatching)
+    {
+        pMatcher->err = re_errMatch_inputDoesNotMatch;
+        return false;
+    }
+    else
+        return true;
+
+} /* re_matchEnd */
+
+
+/**
+ * Get the size of the memory for the threads of the lockstep matcher re_matchPikeVM() for
+ * a given regular expression.
+ *   @return
+ * Get the size in Byte. This is the value to configure in field \a sizeOfThreadMem of the
+ * matcher object.
+ *   @param[in] pCompiledRe
+ * The compiled regular expression by reference.
+ *   @param[in] maxNoThreads
+ * The maximum number of threads, which the matcher can handle at a time. The number of
+ * instructions of \a pCompiledRe plus one suffices for all expressions, which don't
+ * contain bounded loops. Typically, a much lower number suffices, see field \a
+ * maxUseThreads of the matcher object.
+ *   @param[in] maxNoCapturedGrps
+ * The capacity of the captured group stack, i.e., the value of field \a maxNoCapturedGrps
+ * of the matcher object.
+ */
+unsigned int re_getSizeOfThreadMem( const struct re_compiledRegExp_t * const pCompiledRe
+                                  , unsigned int maxNoThreads
+                                  , unsigned int maxNoCapturedGrps
+                                  )
+{
+    unsigned int noLoopCnts, offsCGrpAry;
+    const unsigned int sizeOfThread = getThreadLayout( pCompiledRe
+                                                     , maxNoCapturedGrps
+                                                     , &noLoopCnts
+                                                     , &offsCGrpAry
+                                                     );
+    return (noLoopCnts > 0u? 2u: 1u) * (pCompiledRe->lenIStream + 1u) * sizeof(uint16_t)
+           + (noLoopCnts > 0u? 4u*maxNoThreads * sizeof(uint16_t): 0u)
+           + maxNoThreads * sizeof(uint16_t)
+           + 2u * (maxNoThreads + 1u) * sizeOfThread;
+
+} /* re_getSizeOfThreadMem */
+
+
 /**
  * Fetching match results after successful matching: Get the number of matches for a given
  * capture group.
@@ -1658,6 +3210,13 @@ bool re_copyMatchOfCaptureGrp( struct re_matcher_t * const pMatcher
     if(noCharsToCpy + 1u > sizeOfMatchBuf)
         noCharsToCpy = sizeOfMatchBuf - 1u;
 
+    /* The streaming matcher doesn't have the input. */
+    if(pMatcher->cStream == NULL)
+    {
+        *pMatchBuf = '\0';
+        return false;
+    }
+
     /* We provide the result as zero terminated C string, although the matcher is not
        restricted to input of such format. If the matching has to deal with zero bytes
        in the input stream then this function may potentially not behave as expected. */
@@ -53,6 +53,29 @@
     compiled expression for a given match. */
 #define RE_MATCHER_COMPILE_STATISTICS  1
 
+/** The maximum number of regular expressions, which can be combined into a set, see
+    re_compileSet() and re_matchSet(). The matching expressions of a set are reported as
+    bits in a 32 Bit integer. */
+#define RE_MAX_NO_REGEXPS_IN_SET    32u
+
+/** The dispatch table of a set of regular expressions, see field \a idxSetDispatch of
+    struct re_compiledRegExp_t, has a bit mask of expressions for each input character and
+    two more: The expressions, which can match at the end of the input, and the
+    expressions, which can begin only at the beginning of the input. */
+#define RE_SET_DISPATCH_IDX_END         (UINT8_MAX+1u)
+#define RE_SET_DISPATCH_IDX_ANCHORED    (UINT8_MAX+2u)
+#define RE_SET_DISPATCH_NO_MASKS        (UINT8_MAX+3u)
+
+/** The size in Byte of a bit mask of the dispatch table of a set of \a noRegExps
+    expressions. */
+#define RE_SIZE_OF_SET_DISPATCH_MASK(noRegExps)  (((noRegExps)+7u)/8u)
+
+/** The size in Byte of the dispatch table of a set of \a noRegExps expressions. */
+#define RE_SIZE_OF_SET_DISPATCH(noRegExps)                                                  \
+            (2u + 2u*(noRegExps)                                                            \
+             + RE_SET_DISPATCH_NO_MASKS*RE_SIZE_OF_SET_DISPATCH_MASK(noRegExps)             \
+            )
+
 /* The instructions to build a compiled regular expression. */
 #define I_ILLEGAL           (0x80u)
 #define OP_LOOP             (0x81u)
@@ -85,7 +108,10 @@
 #define I_ANY               (0x92u)
 #define I_CARET             (0x93u)
 #define I_DOLLAR            (0x94u)
+#define OP_ACCEPT           (0x95u)
+#define I_ACCEPT(idx)       (OP_ACCEPT),(idx)
 #define I_DC(a,b,c,d)       (a),(b),(c),(d)
+#define I_DB(a)             (a)
 
 /* The lengths of the instructions. */
 #define LEN_I_ILLEGAL       1u
@@ -110,7 +136,9 @@
 #define LEN_I_ANY           1u
 #define LEN_I_CARET         1u
 #define LEN_I_DOLLAR        1u
+#define LEN_I_ACCEPT        2u
 #define LEN_I_DC            4u
+#define LEN_I_DB            1u
 
 /*
  * Global type definitions
@@ -128,8 +156,9 @@ enum re_matcherError_t {
     re_errMatch_inputDoesNotMatch,
     
     /** The matching process didn't complete. The matcher ran out of memory. The capacity
-        of field \a matcherPathStack in the matcher object was to little for the given
-        combination of regular expression and input character stream. */
+        of field \a matcherPathStack (re_match()) or of field \a threadMem
+        (re_matchPikeVM()) in the matcher object was to little for the given combination
+        of regular expression and input character stream. */
     re_errMatch_stateBufferOverflow,
 
     /** The matching process didn't complete. The matcher ran out of memory. The capacity
@@ -166,6 +195,41 @@ struct re_compiledRegExp_t
 
     /** The number of character sets used in the instruction stream. */
     unsigned int noCharSets;
+
+    /** The length of the longest literal character sequence, which every match of the
+        regular expression contains, or zero if the compiler didn't find such a literal.
+        The matchers use it to reject an input or to skip the start positions, which can't
+        match, with a fast substring search before they run the instruction stream. */
+    unsigned int lenRequiredLit;
+
+    /** The required literal as index into the instruction stream. It is stored in the
+        constant data behind the character sets. Don't care if \a lenRequiredLit is zero. */
+    unsigned int idxRequiredLit;
+
+    /** If \a true, then the required literal is the beginning of each match and the
+        expression has been compiled with \a matchAnywhere. The matchers can then begin
+        with the first occurrence of the literal rather than at the beginning of the input. */
+    bool isPrefixLit;
+
+    /** The number of regular expressions if this is a set of expressions, which has been
+        compiled with re_compileSet(), or zero for a single expression. For a set, \a
+        noCaptureGrps is the maximum of all expressions; each expression numbers its
+        capture groups from zero. */
+    unsigned int noRegExpsInSet;
+
+    /** For a set only: The dispatch table as index into the instruction stream. It is
+        stored in the constant data behind the character sets. The table begins with the
+        number of loop counters, which a thread of the lockstep matcher needs for the set,
+        and the index of the first instruction of each expression (two Byte each, most
+        significant Byte first). It is followed by #RE_SET_DISPATCH_NO_MASKS bit masks of
+        one Byte per eight expressions (least significant Byte first). Bit n of the mask of
+        a character is set if expression n can begin with this character. re_matchSet()
+        starts only these expressions at an input position. */
+    unsigned int idxSetDispatch;
+
+    /** For a set only: The expressions have been compiled with \a matchAnywhere and at
+        least one of them doesn't begin with the anchor ^. */
+    bool isSetMatchAnywhere;
 };
 
 /// @todo Make all of the matcher private, but add a constructor to make this possible
@@ -255,6 +319,34 @@ struct re_matcherCGrpStackElement_t
     uint8_t idxCGrp;
 };
 
+/** The state of the streaming lockstep matcher between the calls of re_matchBegin(),
+    re_matchFeed() and re_matchEnd(). */
+struct re_matcherStreamState_t
+{
+    /** The number of input characters fed so far. This is the index of the next input
+        character in the concatenation of all chunks. */
+    unsigned int idxC;
+
+    /** The number of threads, which wait for the next input character. Zero if the result
+        of matching is decided. */
+    unsigned int noThreads;
+
+    /** A match has been found so far. Until re_matchEnd(), it can still be replaced by
+        a match of higher priority. */
+    bool isMatching;
+
+    /** If \a isMatching: The end of the match as index into the concatenation of all
+        chunks. */
+    unsigned int idxCEnd;
+
+    /** The lowest input position, which is still referenced by the captured groups of a
+        live thread or of the match found so far, as index into the concatenation of all
+        chunks. It is \a idxC if no input is referenced. The caller needs to keep the input
+        from here on to fetch the captured groups after re_matchEnd(); all input before
+        can be released. The position only moves forward. */
+    unsigned int idxCFirstReferenced;
+};
+
 /** The matcher, which processes a compiled regular expression and the character input
     stream. */
 struct re_matcher_t
@@ -274,7 +366,9 @@ struct re_matcher_t
 
     /** The number of input characters, which \a cStream provides. The match fails if this
         number of characters has been matched before all of the regular expression has been
-        processed. */
+        processed.\n
+          The streaming matcher, see re_matchBegin(), doesn't have \a cStream. The field
+        is UINT_MAX until the end of the input is known. */
     unsigned int lenCStream;
 
     /** The current position the matching process. Points to the next character in \a
@@ -320,6 +414,29 @@ struct re_matcher_t
     /** The current number of elements stored in \a cGrpStack. */
     unsigned int noCapturedGrps;
 
+    /** Memory for the threads of the lockstep matcher re_matchPikeVM(). The field is not
+        used by the backtracking matcher re_match() and can be left NULL if only that is
+        applied.\n
+          The lockstep matcher advances all still possible match paths, the threads,
+        character by character. Each thread holds its own copy of the captured groups, with
+        a capacity of \a maxNoCapturedGrps elements. The number of threads is bounded by
+        the number of instructions of the compiled expression plus one if the expression
+        doesn't contain bounded loops like x{2,5}; most expressions need far less. Use
+        re_getSizeOfThreadMem() to get the size of the memory for a given number of
+        threads.\n
+          This is a user configured field, to be set prior to using the matcher the first
+        time. It is not changed during the run of the matcher. */
+    uint16_t *threadMem;
+
+    /** The size in Byte of the memory area \a threadMem.\n
+          This is a user configured field, to be set prior to using the matcher the first
+        time. It is not changed during the run of the matcher. */
+    unsigned int sizeOfThreadMem;
+
+    /** The state of the streaming lockstep matcher, see re_matchBegin(). The field is
+        not used by re_match() and re_matchPikeVM(). */
+    struct re_matcherStreamState_t stream;
+
     /** Principal state information of the matcher: Still successful? Or an error message
         otherwise. */
     enum re_matcherError_t err;
@@ -336,6 +453,12 @@ struct re_matcher_t
         input would typically require another number of elements and could fail in this
         case. This field should be evaluated by the user after matching. */
     unsigned int maxUsePathElements;
+
+    /** Diagnostic information of re_matchPikeVM(): The maximum number of threads, which
+        were simultaneously required. Configuring \a threadMem with re_getSizeOfThreadMem()
+        and this number of threads would suffice to successfully repeat the match. This
+        field should be evaluated by the user after matching. */
+    unsigned int maxUseThreads;
 #endif
 };
 
@@ -364,6 +487,42 @@ bool re_matchCString( struct re_matcher_t * const pMatcher
                     , const char * const inputStream
                     );
 
+/** Call of the lockstep (Pike VM) matcher for an arbitrary input characer sequence. */
+bool re_matchPikeVM( struct re_matcher_t *pMatcher
+                   , const struct re_compiledRegExp_t *pCompiledRe
+                   , const char *inputStream
+                   , unsigned int lenInputStream
+                   );
+
+/** Call of the lockstep matcher for a set of regular expressions. */
+bool re_matchSet( struct re_matcher_t *pMatcher
+                , const struct re_compiledRegExp_t *pCompiledSet
+                , const char *inputStream
+                , unsigned int lenInputStream
+                , uint32_t *pMatchMask
+                , unsigned int *pIdxRegExp
+                );
+
+/** Begin matching a stream, which arrives in chunks, with the lockstep matcher. */
+void re_matchBegin( struct re_matcher_t *pMatcher
+                  , const struct re_compiledRegExp_t *pCompiledRe
+                  );
+
+/** Match the next chunk of a stream. */
+bool re_matchFeed( struct re_matcher_t *pMatcher
+                 , const char *chunk
+                 , unsigned int lenChunk
+                 );
+
+/** Complete matching of a stream and get the result. */
+bool re_matchEnd(struct re_matcher_t *pMatcher);
+
+/** Get the size of the thread memory of the lockstep matcher. */
+unsigned int re_getSizeOfThreadMem( const struct re_compiledRegExp_t *pCompiledRe
+                                  , unsigned int maxNoThreads
+                                  , unsigned int maxNoCapturedGrps
+                                  );
+
 /** After matching: Get no. matches of capture group. */
 unsigned int re_getNoMatchesCaptureGrp( struct re_matcher_t * const pMatcher
                                       , unsigned int idxCGrp
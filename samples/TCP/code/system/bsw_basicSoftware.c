@@ -440,10 +440,15 @@ int /* _Noreturn */ main(int noArgs ATTRIB_DBG_ONLY, const char *argAry[] ATTRIB
        requires that we create the events in the right order and this requires in practice
        a double-check by assertion - later maintenance errors are unavoidable otherwise. */
     unsigned int idEventProc;
-    #define CREATE_REGULAR_EVENT(tiInMs, ti1stInMs) \
-                CREATE_EVENT(tiInMs##ms, tiInMs, ti1stInMs, /*timerTaskTriggerParam*/ 0x0u)
-
-    #define CREATE_EVENT(name, tiInMs, tiFirstInMs, timerTaskTriggerParam)                  \
+    #define CREATE_REGULAR_EVENT(tiInMs, ti1stInMs)                                         \
+                CREATE_EVENT( tiInMs##ms                                                    \
+                            , tiInMs                                                        \
+                            , ti1stInMs                                                     \
+                            , /*timerTaskTriggerParam*/ 0x0u                                \
+                            , /*minPIDToTrigger*/ RTOS_EVENT_PROC_NOT_USER_TRIGGERABLE      \
+                            )
+
+    #define CREATE_EVENT(name, tiInMs, tiFirstInMs, timerTaskTriggerParam, minPIDToTrigger) \
     {                                                                                       \
         if(initOk                                                                           \
            && rtos_osCreateEventProcessor                                                   \
@@ -451,7 +456,7 @@ int /* _Noreturn */ main(int noArgs ATTRIB_DBG_ONLY, const char *argAry[] ATTRIB
                     , /* tiCycleInMs */              (tiInMs)                               \
                     , /* tiFirstActivationInMs */    (tiFirstInMs)                          \
                     , /* priority */                 prioEv##name                           \
-                    , /* minPIDToTriggerThisEvProc */ RTOS_EVENT_PROC_NOT_USER_TRIGGERABLE  \
+                    , /* minPIDToTriggerThisEvProc */ (minPIDToTrigger)                     \
                     , /* timerUsesCountableEvents */ (timerTaskTriggerParam) > 0u           \
                     , (timerTaskTriggerParam)                                               \
                     )                                                                       \
@@ -490,8 +495,15 @@ int /* _Noreturn */ main(int noArgs ATTRIB_DBG_ONLY, const char *argAry[] ATTRIB
        some activations of the 1ms application task can be lost. To compensate a bit for
        this, we activate the 1ms task with a countable event such that the task function at
        least knowns, how many ticks were lost. One could consider to let the 1ms task have
-       the higher priority - if it executes fast then it won't do much harm to the IP task. */
-    CREATE_EVENT(1ms, /* tiInMs */ 1, /* tiFirstInMs */ 0, /* countableEvMask */ 0x3u)
+       the higher priority - if it executes fast then it won't do much harm to the IP task.
+         The IP task may trigger itself if it couldn't fetch all received Ethernet frames
+       within its budget, see bsw_retriggerEthernetTask(). */
+    CREATE_EVENT( 1ms
+                , /* tiInMs */ 1
+                , /* tiFirstInMs */ 0
+                , /* countableEvMask */ 0x3u
+                , /* minPIDToTrigger */ RTOS_EVENT_PROC_NOT_USER_TRIGGERABLE
+                )
     CREATE_REGULAR_EVENT(/* tiInMs */ 10, /* tiFirstInMs */ 1)
     CREATE_REGULAR_EVENT(/* tiInMs */ 100, /* tiFirstInMs */ 5)
     CREATE_REGULAR_EVENT(/* tiInMs */ 1000, /* tiFirstInMs */ 55)
@@ -499,6 +511,7 @@ int /* _Noreturn */ main(int noArgs ATTRIB_DBG_ONLY, const char *argAry[] ATTRIB
                 , /* tiInMs */ 10u
                 , /* ti1stInMs */ 1u
                 , /* countableEvMask */ 0x1u
+                , /* minPIDToTrigger */ bsw_pidUser
                 )
 
     /* OS task are created first. This ensures that they will get the CPU first if the
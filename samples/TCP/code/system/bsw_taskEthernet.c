@@ -41,6 +41,8 @@
 #include "rtos.h"
 #include "MPC5748G.h"
 #include "bsw_basicSoftware.h"
+#include "eth_ethernet.h"
+#include "dlg_deferredLogging.h"
 
 /*
  * Defines
@@ -103,8 +105,14 @@
 #define GET_COUNT_OF_EV_TX_ETH_BUFFER(taskParam) \
                             GET_COUNT_OF_EVENT((taskParam), EV_TX_ETH_BUFFER, 16u)
 
+/** Helper: Get the count from countable event #BSW_EV_RETRIGGER_ETH_TASK. The task
+    parameter is input to the operation. */
+#define GET_COUNT_OF_EV_RETRIGGER_ETH_TASK(taskParam) \
+                            GET_COUNT_OF_EVENT((taskParam), BSW_EV_RETRIGGER_ETH_TASK, 24u)
+
 _Static_assert( GET_COUNT_OF_EV_RX_ETH_FRAME(EV_RX_ETH_FRAME) == 0xFFu
                 &&  GET_COUNT_OF_EV_TX_ETH_BUFFER(EV_TX_ETH_BUFFER) == 0xFFu
+                &&  GET_COUNT_OF_EV_RETRIGGER_ETH_TASK(BSW_EV_RETRIGGER_ETH_TASK) == 0xFu
               , "Bad extraction of event counts"
               );
 
@@ -167,6 +175,12 @@ void bsw_ethFrameRxCallback(uint32_t EIR ATTRIB_DBG_ONLY)
     assert(EIR == ENET_EIR_RXF_MASK);
     ++ bsw_noRxNotifications;
 
+#if ETH_RX_INTERRUPT_MITIGATION == 1
+    /* The user task will poll the driver for this and all further frames, which arrive
+       meanwhile. It re-enables the interrupt after it drained the Rx ring. */
+    eth_osDisableRxInterrupt(/* idxEthDev */ 0u);
+#endif
+
     /* We received an Ethernet frame, which needs handling by our protocol state
        machine. So we trigger the task implementing the state machine. */
     if(!rtos_osSendEventCountable( BSW_ID_EV_TRIG_INTERNET_PROTOCOL_TASK
@@ -226,9 +240,9 @@ void bsw_ethFrameTxCallback(uint32_t EIR ATTRIB_DBG_ONLY)
  *   Note, this task belongs to user code process P1.
  *   @param taskParam
  * The task parameter is 0 if the task has been activated by the regular 10ms timer event.
- * It is EV_RX_ETH_BUFFER in case of task activation by an Ethernet driver frame Rx event
- * and EV_TX_ETH_BUFFER in case of task activation by an Ethernet driver frame or fragment
- * Tx complete event.\n
+ * It is EV_RX_ETH_BUFFER in case of task activation by an Ethernet driver frame Rx event,
+ * EV_TX_ETH_BUFFER in case of task activation by an Ethernet driver frame or fragment
+ * Tx complete event and BSW_EV_RETRIGGER_ETH_TASK if the task has triggered itself.\n
  */
 int32_t bsw_taskEthernetInternal(uint32_t PID ATTRIB_DBG_ONLY, uint32_t taskParam)
 {
@@ -236,7 +250,7 @@ int32_t bsw_taskEthernetInternal(uint32_t PID ATTRIB_DBG_ONLY, uint32_t taskPara
 
 #if 0
     if((taskParam & ~0x010101u) != 0u)
-        iprintf("bsw_taskEthernetInternal: 0x%06lX\r\n", taskParam);
+        DLG_LOG("bsw_taskEthernetInternal: 0x%06lX\r\n", taskParam);
 #endif
 
     /* We can send up to 255 without risking a task activation loss. Theoretically,
@@ -244,14 +258,18 @@ int32_t bsw_taskEthernetInternal(uint32_t PID ATTRIB_DBG_ONLY, uint32_t taskPara
       (It's only meant a demonstrative software.) */
     assert(bsw_noLostTaskTriggersRx == 0u  &&  bsw_noLostTaskTriggersTx == 0u);
   
+    /* The task may have been activated by itself, see bsw_retriggerEthernetTask(). This
+       is not reported to the application; it knows, why it has requested the
+       activation. */
     const unsigned int noNotificationsRx = GET_COUNT_OF_EV_RX_ETH_FRAME(taskParam)
                      , noNotificationsTx = GET_COUNT_OF_EV_TX_ETH_BUFFER(taskParam)
-                     , noNotificationsTimer = taskParam & 1u;
+                     , noNotificationsTimer = taskParam & 1u
+                     , noRetriggers = GET_COUNT_OF_EV_RETRIGGER_ETH_TASK(taskParam);
 
     static unsigned int SDATA_P1(totalNoDoubleNotifications_) = 0u;
     static unsigned int SDATA_P1(totalNoTrippleNotifications_) = 0u;
     static unsigned int SDATA_P1(totalNoMultipleNotifications_) = 0u;
-    switch(noNotificationsRx + noNotificationsTx + noNotificationsTimer)
+    switch(noNotificationsRx + noNotificationsTx + noNotificationsTimer + noRetriggers)
     {
     case 0u:
         assert(false);
@@ -275,11 +293,11 @@ int32_t bsw_taskEthernetInternal(uint32_t PID ATTRIB_DBG_ONLY, uint32_t taskPara
         static unsigned int cnt_ = 0u;
         if(++cnt_ >= 6000u)
         {
-            iprintf( "bsw_taskEthernetInternal: %u/%u Rx/Tx frames\r\n"
+            DLG_LOG( "bsw_taskEthernetInternal: %u/%u Rx/Tx frames\r\n"
                    , bsw_noRxNotifications
                    , bsw_noTxNotifications
                    );
-            iprintf( "2/3/n-fold task triggers: %u/%u/%u\r\n"
+            DLG_LOG( "2/3/n-fold task triggers: %u/%u/%u\r\n"
                    , totalNoDoubleNotifications_ 
                    , totalNoTrippleNotifications_
                    , totalNoMultipleNotifications_
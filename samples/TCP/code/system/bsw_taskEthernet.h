@@ -25,6 +25,7 @@
  */
 
 #include "typ_types.h"
+#include "rtos.h"
 
 
 /*
@@ -35,6 +36,10 @@
     after reception or transmission of a an IP frame. */
 #define BSW_ID_EV_TRIG_INTERNET_PROTOCOL_TASK   (4u)
 
+/** Mask to define the countable event for triggering the IP protocol task by itself, see
+    bsw_retriggerEthernetTask(). */
+#define BSW_EV_RETRIGGER_ETH_TASK               0x0F000000u
+
 
 
 /*
@@ -81,4 +86,23 @@ static inline uint32_t bsw_getLwIPTime(void)
 }
 
 
+/**
+ * Activate the IP protocol task once more, as soon as its current activation has ended.
+ * The IP task uses this if it couldn't fetch all received Ethernet frames within its
+ * budget. Tasks of higher priority and the other events of the IP task, like Tx complete
+ * and timer, are served in between.
+ *   @return
+ * Get \a false if the event couldn't be sent. This should not happen as long as the
+ * function is called at maximum once per task activation.
+ *   @remark
+ * This API must be called only from the IP protocol task in process bsw_pidUser.
+ */
+static inline bool bsw_retriggerEthernetTask(void)
+{
+    return rtos_sendEventCountable( BSW_ID_EV_TRIG_INTERNET_PROTOCOL_TASK
+                                  , /*evMask*/ BSW_EV_RETRIGGER_ETH_TASK
+                                  );
+}
+
+
 #endif  /* BSW_TASKETHERNET_INCLUDED */
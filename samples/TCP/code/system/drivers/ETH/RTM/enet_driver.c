@@ -22,6 +22,7 @@
  *   ENET_DRV_Deinit
  *   ENET_DRV_ReadFrame
  *   ENET_DRV_SendFrame
+ *   ENET_DRV_SendFrameFragments
  *   ENET_DRV_GetTransmitStatus
  *   ENET_DRV_ProvideRxBuff
  *   ENET_DRV_EnableMDIO
@@ -38,6 +39,8 @@
  *   ENET_DRV_ConfigCounters
  *   ENET_DRV_GetCounter
  *   ENET_DRV_GetInterruptFlags
+ *   ENET_DRV_DisableRxFrameInterrupt
+ *   ENET_DRV_EnableRxFrameInterrupt
  *   ENET_DRV_SetSpeed
  *   ENET_DRV_TimerInit
  *   ENET_DRV_TimerStart
@@ -781,86 +784,161 @@ status_t ENET_DRV_SendFrame( enet_buffer_descriptor_t * * const ppRingBufferElem
                            , const enet_tx_options_t * const pOptions
                            )
 {
-    status_t status = STATUS_SUCCESS;
+    /* A frame in a single buffer is the special case of a single fragment. */
+    return ENET_DRV_SendFrameFragments( ppRingBufferElement
+                                      , idxEthDev
+                                      , idxRing
+                                      , pFrameDesc
+                                      , /* noFragments */ 1u
+                                      , pOptions
+                                      );
+} /* ENET_DRV_SendFrame */
 
+
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : ENET_DRV_SendFrameFragments
+ * Description   : Sends an Ethernet frame, which is scattered over several buffers
+ *
+ * This function sends an Ethernet frame, whose contents are the concatenation of the
+ * buffers received as parameter. Each buffer occupies one element of the Tx ring; the DMA
+ * gathers the frame from the buffers.
+ *   @return
+ * - STATUS_SUCCESS if the frame was successfully enqueued for transmission,\n
+ * - STATUS_ENET_TX_QUEUE_FULL if there are less than \a noFragments available ring buffer
+ *   elements. No element is occupied in this case.
+ *   @param ppRingBufferElement
+ * The driver's ring buffer element, which holds the last fragment, is returned by
+ * reference. This pointer is the handle to the transmission job. It can be used to queury
+ * the state of the transmission, in particular if the transmission has been completed. The
+ * DMA processes the ring buffer elements in order; if the last fragment has completed then
+ * so have all others.\n
+ *   * \a ppRingBufferElement is set to NULL if the function doesn't return STATUS_SUCCESS.
+ *   @param idxEthDev
+ * The ENET device to use for transmission. Needs to be enabled and configured. Range is
+ * 0..1.
+ *   @param idxRing
+ * The ring (or queue) of the ENET device by zero based index to be used for transmission.
+ * Range is 0..2, but only if the selected ring is configured for use.
+ *   @param fragmentAry
+ * The descriptors of the \a noFragments buffers in terms of address and length. The
+ * frame is the concatenation of the buffers in order of appearance in the array.
+ *   @param noFragments
+ * The number of fragments. Range is 1..n, where n is the number of configured Tx ring
+ * buffer elements.
+ *   @param pOptions
+ * A set of options by reference. Optional; pass NULL if not needed.
+ *END**************************************************************************/
+status_t ENET_DRV_SendFrameFragments( enet_buffer_descriptor_t * * const ppRingBufferElement
+                                    , uint8_t idxEthDev
+                                    , uint8_t idxRing
+                                    , const enet_buffer_t * const fragmentAry
+                                    , unsigned int noFragments
+                                    , const enet_tx_options_t * const pOptions
+                                    )
+{
     DEV_ASSERT(idxEthDev <  ENET_INSTANCE_COUNT);
     DEV_ASSERT(g_enetState[idxEthDev] != NULL);
     DEV_ASSERT(idxRing < g_enetState[idxEthDev]->ringCount);
-    DEV_ASSERT(pFrameDesc != NULL  &&  ppRingBufferElement != NULL);
+    DEV_ASSERT(fragmentAry != NULL  &&  noFragments > 0u  &&  ppRingBufferElement != NULL);
 
     ENET_Type * const pEthDev = s_enetBases[idxEthDev];
-
-    enet_buffer_descriptor_t * const pRgBufElem = g_enetState[idxEthDev]->txBdCurrent[idxRing];
-
-    /* Status of ring buffer element: We don't release it for sending when only the HW
-       device has reset the READY bit. Additionally, an explicit reading of this HW
-       reported status change is also required to release the buffer. */
-    if((pRgBufElem->control & (ENET_BUFFDESCR_TX_READY_MASK|ENET_BUFFDESCR_TX_ACK_MASK)) != 0U)
-    {
-        status = STATUS_ENET_TX_QUEUE_FULL;
-        *ppRingBufferElement = NULL;
-    }
-    else
+    enet_buffer_descriptor_t * const pRgBufElemFirst =
+                                                g_enetState[idxEthDev]->txBdCurrent[idxRing];
+
+    /* Status of ring buffer elements: We don't release an element for sending when only
+       the HW device has reset the READY bit. Additionally, an explicit reading of this HW
+       reported status change is also required to release the buffer. This is tracked with
+       the ACK bit, which is set only for the element holding the last fragment of a frame.
+       The elements of the other fragments become free as soon as the DMA has read them.
+         We need to check all required elements before we occupy the first one; a frame
+       can't be submitted partially. */
+    enet_buffer_descriptor_t *pRgBufElem = pRgBufElemFirst;
+    unsigned int u;
+    for(u=0u; u<noFragments; ++u)
     {
-        /* Configure buffer descriptor. */
-        pRgBufElem->length = pFrameDesc->length;
-        pRgBufElem->buffer = pFrameDesc->data;
-        pRgBufElem->control |= (uint16_t)(ENET_BUFFDESCR_TX_READY_MASK
-                                          | ENET_BUFFDESCR_TX_ACK_MASK
-                                          | ENET_BUFFDESCR_TX_LAST_MASK
-                                          | ENET_BUFFDESCR_TX_TRANSMITCRC_MASK
-                                         );
-#if FEATURE_ENET_HAS_ENHANCED_BD
-        /* Enable interrupt generation for processing of this frame. */
-        pRgBufElem->enh1 |= ENET_TX_ENH1_INT_MASK;
-#endif /* FEATURE_ENET_HAS_ENHANCED_BD */
-
-        if (pOptions != NULL)
+        if((pRgBufElem->control & (ENET_BUFFDESCR_TX_READY_MASK|ENET_BUFFDESCR_TX_ACK_MASK))
+           != 0U
+           ||  (u > 0u  &&  pRgBufElem == pRgBufElemFirst)
+          )
         {
-            if (pOptions->noCRC)
-            {
-                pRgBufElem->control &= ~ENET_BUFFDESCR_TX_TRANSMITCRC_MASK;
-            }
-#if FEATURE_ENET_HAS_ENHANCED_BD
-            if (pOptions->noInt)
-            {
-                pRgBufElem->enh1 &= ~ENET_TX_ENH1_INT_MASK;
-            }
-#if FEATURE_ENET_HAS_TBS
-            if (pOptions->useTLT)
-            {
-                pRgBufElem->enh1 |= ENET_TX_ENH1_UTLT_MASK;
-                pRgBufElem->enh2 = pOptions->TLT;
-            }
-#endif /* FEATURE_ENET_HAS_TBS */
-#endif /* FEATURE_ENET_HAS_ENHANCED_BD */
+            *ppRingBufferElement = NULL;
+            return STATUS_ENET_TX_QUEUE_FULL;
         }
 
-        /* Ensure that all relevant memory changes are visible to the ENET's DMA before we
-           trigger the transfer. */
-        std_fullMemoryBarrier();
+        if((pRgBufElem->control & ENET_BUFFDESCR_TX_WRAP_MASK) != 0U)
+            pRgBufElem = g_enetState[idxEthDev]->txBdBase[idxRing];
+        else
+            ++ pRgBufElem;
+    }
 
-        /* Activate the transmit buffer descriptor. */
-        ENET_ActivateTransmit(pEthDev, idxRing);
+    /* Configure the buffer descriptors. The READY bit of the first one is set only at the
+       very end; the DMA must not start reading an incomplete frame. */
+    pRgBufElem = pRgBufElemFirst;
+    for(u=0u; u<noFragments; ++u)
+    {
+        const bool isLast = u+1u == noFragments;
 
-        /* Provide access to the ring buffer element to the caller. (For status check.) */
-        *ppRingBufferElement = pRgBufElem;
+        pRgBufElem->length = fragmentAry[u].length;
+        pRgBufElem->buffer = fragmentAry[u].data;
 
-        /* Update the current buffer descriptor pointer. */
-        if ((pRgBufElem->control & ENET_BUFFDESCR_TX_WRAP_MASK) != 0U)
+        /* Note, the buffer descriptor may have been used for the last fragment of a frame
+           before; we need to clear all flags but the ring's wrap bit. */
+        uint16_t control = pRgBufElem->control & ENET_BUFFDESCR_TX_WRAP_MASK;
+        if(isLast)
         {
-            g_enetState[idxEthDev]->txBdCurrent[idxRing] =
-                                                    g_enetState[idxEthDev]->txBdBase[idxRing];
+            control |= (uint16_t)(ENET_BUFFDESCR_TX_ACK_MASK
+                                  | ENET_BUFFDESCR_TX_LAST_MASK
+                                  | ENET_BUFFDESCR_TX_TRANSMITCRC_MASK
+                                 );
+            if(pOptions != NULL  &&  pOptions->noCRC)
+                control &= (uint16_t)~ENET_BUFFDESCR_TX_TRANSMITCRC_MASK;
         }
+        if(u > 0u)
+            control |= ENET_BUFFDESCR_TX_READY_MASK;
+        pRgBufElem->control = control;
+
+#if FEATURE_ENET_HAS_ENHANCED_BD
+        /* Enable interrupt generation only for processing of the last fragment. */
+        if(isLast  &&  (pOptions == NULL  ||  !pOptions->noInt))
+            pRgBufElem->enh1 |= ENET_TX_ENH1_INT_MASK;
         else
+            pRgBufElem->enh1 &= ~ENET_TX_ENH1_INT_MASK;
+# if FEATURE_ENET_HAS_TBS
+        if(u == 0u  &&  pOptions != NULL  &&  pOptions->useTLT)
         {
-            g_enetState[idxEthDev]->txBdCurrent[idxRing]++;
+            pRgBufElem->enh1 |= ENET_TX_ENH1_UTLT_MASK;
+            pRgBufElem->enh2 = pOptions->TLT;
         }
+# endif /* FEATURE_ENET_HAS_TBS */
+#endif /* FEATURE_ENET_HAS_ENHANCED_BD */
+
+        /* Provide access to the ring buffer element of the last fragment to the caller.
+           (For status check.) */
+        if(isLast)
+            *ppRingBufferElement = pRgBufElem;
+
+        /* Update the current buffer descriptor pointer. */
+        if((pRgBufElem->control & ENET_BUFFDESCR_TX_WRAP_MASK) != 0U)
+            pRgBufElem = g_enetState[idxEthDev]->txBdBase[idxRing];
+        else
+            ++ pRgBufElem;
     }
+    g_enetState[idxEthDev]->txBdCurrent[idxRing] = pRgBufElem;
 
-    return status;
+    /* Ensure that all relevant memory changes are visible to the ENET's DMA before we
+       release the first fragment, which makes the complete frame available to the DMA. */
+    std_fullMemoryBarrier();
+    pRgBufElemFirst->control |= ENET_BUFFDESCR_TX_READY_MASK;
+    std_fullMemoryBarrier();
 
-} /* ENET_DRV_SendFrame */
+    /* Activate the transmit buffer descriptor. */
+    ENET_ActivateTransmit(pEthDev, idxRing);
+
+    return STATUS_SUCCESS;
+
+} /* ENET_DRV_SendFrameFragments */
 
 
 
@@ -1520,6 +1598,70 @@ uint32_t ENET_DRV_GetInterruptFlags(uint8_t idxEthDev)
     return base->EIR;
 }
 
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : ENET_DRV_DisableRxFrameInterrupt
+ * Description   : Masks the frame Rx interrupt of ring 0.
+ *
+ * The frame Rx event is still latched in EIR while the interrupt is masked. The
+ * interrupt will be raised immediately on re-enabling, if a frame had been received
+ * meanwhile, see ENET_DRV_EnableRxFrameInterrupt().
+ *   @param idxEthDev
+ * The ENET device by zero based index.
+ *   @remark
+ * The function can be called from the Rx callback, i.e., from the ISR.
+ *END**************************************************************************/
+void ENET_DRV_DisableRxFrameInterrupt(uint8_t idxEthDev)
+{
+    DEV_ASSERT(idxEthDev <  ENET_INSTANCE_COUNT);
+
+    ENET_DisableInterrupts(s_enetBases[idxEthDev], (uint32_t)ENET_RX_FRAME_INTERRUPT);
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : ENET_DRV_EnableRxFrameInterrupt
+ * Description   : Re-enables the frame Rx interrupt of ring 0 if the ring is drained.
+ *
+ * The latched frame Rx event is acknowledged and the next ring buffer element is
+ * checked for a received frame. If there is none, then the interrupt is unmasked.
+ * Otherwise, the interrupt stays masked and the caller needs to continue fetching
+ * frames. A frame, which is received after the check, sets the event again and will
+ * raise the interrupt as soon as it is unmasked; no notification can be lost.
+ *   @return
+ * Get \a true if the interrupt has been unmasked and \a false if there is still a frame
+ * waiting for ENET_DRV_ReadFrame().
+ *   @param idxEthDev
+ * The ENET device by zero based index. Only a configured and initialized device can be
+ * addressed.
+ *   @param idxRing
+ * The ring buffer, whose drain state is checked. Only ring 0 is supported.
+ *END**************************************************************************/
+bool ENET_DRV_EnableRxFrameInterrupt(uint8_t idxEthDev, uint8_t idxRing)
+{
+    DEV_ASSERT(idxEthDev <  ENET_INSTANCE_COUNT);
+    DEV_ASSERT(g_enetState[idxEthDev] != NULL);
+    DEV_ASSERT(idxRing == 0u);
+
+    ENET_Type * const base = s_enetBases[idxEthDev];
+
+    /* Acknowledge the events of all frames, which had been received while the interrupt
+       was masked. These frames have either been fetched already or they are seen by the
+       check of the ring below. */
+    base->EIR = (uint32_t)ENET_RX_FRAME_INTERRUPT;
+    std_fullMemoryBarrier();
+
+    const enet_buffer_descriptor_t * const bd = g_enetState[idxEthDev]->rxBdCurrent[idxRing];
+    if((bd->control & (ENET_BUFFDESCR_RX_EMPTY_MASK | ENET_BUFFDESCR_RX_INUSE_MASK)) != 0U)
+    {
+        ENET_EnableInterrupts(base, (uint32_t)ENET_RX_FRAME_INTERRUPT);
+        return true;
+    }
+    else
+        return false;
+
+} /* ENET_DRV_EnableRxFrameInterrupt */
+
 /*FUNCTION**********************************************************************
  *
  * Function Name : ENET_DRV_SetSpeed
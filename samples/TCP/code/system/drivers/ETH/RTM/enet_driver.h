@@ -833,6 +833,46 @@ status_t ENET_DRV_SendFrame( enet_buffer_descriptor_t * * const ppRingBufferElem
                            , const enet_tx_options_t * const pOptions
                            );
 
+/*!
+ * @brief Sends an Ethernet frame, which is scattered over several buffers
+ *
+ * This function sends an Ethernet frame, whose contents are the concatenation of the
+ * buffers received as parameter. Each buffer occupies one element of the Tx ring.
+ *
+ * Note: The same restrictions apply as for ENET_DRV_SendFrame(). The transmission status
+ * is queried with the returned handle, which is the ring buffer element of the last
+ * fragment. None of the buffers must be altered before this status query returns
+ * STATUS_SUCCESS.
+ *
+ *   @return
+ * - STATUS_SUCCESS if the frame was successfully enqueued for transmission,\n
+ * - STATUS_ENET_TX_QUEUE_FULL if there are less than \a noFragments available elements in
+ *   the queue. Nothing has been enqueued in this case.
+ *   @param ppRingBufferElement
+ * The driver's ring buffer element of the last fragment is returned by reference. This
+ * pointer is the handle to the transmission job.
+ *   @param idxEthDev
+ * The ENET device to use for transmission. Needs to be enabled and configured. Range is
+ * 0..1.
+ *   @param idxRing
+ * The ring (or queue) of the ENET device by zero based index to be used for transmission.
+ * Range is 0..2, but only if the selected ring is configured for use.
+ *   @param fragmentAry
+ * The descriptors of the frame fragments in terms of address and length.
+ *   @param noFragments
+ * The number of elements in \a fragmentAry. At least one.
+ *   @param pOptions
+ * A set of transmit options for this frame by reference. Optional, pass NULL if no
+ * special option is required.
+ */
+status_t ENET_DRV_SendFrameFragments( enet_buffer_descriptor_t * * const ppRingBufferElement
+                                    , uint8_t idxEthDev
+                                    , uint8_t idxRing
+                                    , const enet_buffer_t * const fragmentAry
+                                    , unsigned int noFragments
+                                    , const enet_tx_options_t * const pOptions
+                                    );
+
 /*!
  * @brief Checks if the transmission of a buffer is complete and extracts information
  * related to the transmission.
@@ -1078,6 +1118,22 @@ uint32_t ENET_DRV_GetCounter(uint8_t instance,
  */
 uint32_t ENET_DRV_GetInterruptFlags(uint8_t instance);
 
+/*!
+ * @brief Masks the frame Rx interrupt of ring 0.
+ *
+ * @param[in] instance Instance number
+ */
+void ENET_DRV_DisableRxFrameInterrupt(uint8_t instance);
+
+/*!
+ * @brief Re-enables the frame Rx interrupt of ring 0 if no received frame is pending.
+ *
+ * @param[in] instance Instance number
+ * @param[in] ring Ring number, needs to be 0
+ * @return true if the interrupt has been unmasked, false if a frame is still pending
+ */
+bool ENET_DRV_EnableRxFrameInterrupt(uint8_t instance, uint8_t ring);
+
 /*!
  * @brief Sets the speed of the MII interface
  *
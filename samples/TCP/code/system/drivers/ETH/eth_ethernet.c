@@ -30,19 +30,29 @@
 /* Module interface
  *   eth_setMulticastForward (inline)
  *   eth_readFrame (inline)
+ *   eth_readFrames (inline)
+ *   eth_enableRxInterrupt (inline)
  *   eth_releaseRxFramePayloadBuffer (inline)
  *   eth_sendFrame (inline)
  *   eth_isTransmissionCompleted (inline)
+ *   eth_sendFrames (inline)
+ *   eth_getNoTransmissionsCompleted (inline)
  *   eth_scSmplHdlr_setMulticastForward
  *   eth_scSmplHdlr_readFrame
+ *   eth_scSmplHdlr_readFrames
  *   eth_scSmplHdlr_releaseRxFramePayloadBuffer
  *   eth_scSmplHdlr_sendFrame
  *   eth_scSmplHdlr_isTransmissionCompleted
+ *   eth_scSmplHdlr_enableRxInterrupt
+ *   eth_scSmplHdlr_sendFrames
+ *   eth_scSmplHdlr_getNoTransmissionsCompleted
  *   eth_osInitEthernetDriver
+ *   eth_osDisableRxInterrupt
  * Local functions
  *   configSIULForUseWithDEVKIT_MPC5748G
  *   checkRxPayloadBufferPtr
  *   checkTxRingBufferElementPtr
+ *   submitFrame
  */
 
 /*
@@ -109,6 +119,19 @@ _Alignas(FEATURE_ENET_BUFFDESCR_ALIGNMENT) static
 _Alignas(FEATURE_ENET_BUFF_ALIGNMENT) static uint8_t
     UNCACHED_P1(_enet0RxFramePayloadBufAry)[ETH_ENET0_RING0_NO_RXBD][ENET_BUFF_ALIGN(1518U)];
 
+/** The frames, which have been submitted by eth_scSmplHdlr_sendFrames() and which have not
+    been reported completed by eth_scSmplHdlr_getNoTransmissionsCompleted() yet. A FIFO
+    in order of submission; a frame is represented by the Tx ring buffer element, which
+    holds its last fragment. Each frame occupies at least one ring buffer element until it
+    is reported, so the FIFO can't hold more elements than the ring. */
+static enet_buffer_descriptor_t * BSS_OS(_enet0Ring0TxPendingFrameAry)[ETH_ENET0_RING0_NO_TXBD];
+
+/** The read index into the FIFO \a _enet0Ring0TxPendingFrameAry. */
+static unsigned int SBSS_OS(_idxTxPendingFrameRd);
+
+/** The number of frames in the FIFO \a _enet0Ring0TxPendingFrameAry. */
+static unsigned int SBSS_OS(_noTxPendingFrames);
+
 _Static_assert( sizeof(enet_buffer_descriptor_t) == 32u
               , "Unexpected size of buffer descriptor"
               );
@@ -252,7 +275,7 @@ static inline bool checkTxRingBufferElementPtr
     /* For the general case, we need to do an active address calculation. We may safely
        exploit the power-of-two size of the buffer element, because it is a hardware given.
        However, a check is still essential in order not to jeopardize portability. */
-    const unsigned int sizeOfRingBufElem = 32u;
+    enum { sizeOfRingBufElem = 32u };
     _Static_assert( sizeof(struct eth_enetBufferDesc_t) == sizeOfRingBufElem
                   , "Implementation is inappropriate for the given MAC hardware"
                   );
@@ -284,6 +307,56 @@ static inline bool checkTxRingBufferElementPtr
 } /* checkTxRingBufferElementPtr */
 
 
+/**
+ * Validate the fragments of a frame from the user process and submit the frame to the
+ * Ethernet driver. The common part of the system calls, which send frames.
+ *   @return
+ * Get the ring buffer element holding the last fragment of the frame if the driver has
+ * accepted the frame or NULL if its Tx ring has too few free elements.
+ *   @param idxEthDev
+ * The zero based index of the MAC, already validated.
+ *   @param idxRing
+ * The zero based index of the ring, already validated.
+ *   @param fragmentAry
+ * The fragments of the frame by reference. The caller has validated the read access to
+ * the array but not its contents.
+ *   @param noFragments
+ * The number of fragments, already validated.
+ */
+static enet_buffer_descriptor_t *submitFrame( unsigned int idxEthDev
+                                            , unsigned int idxRing
+                                            , const struct eth_bufferDesc_t fragmentAry[]
+                                            , unsigned int noFragments
+                                            )
+{
+    assert(noFragments >= 1u  &&  noFragments <= ETH_MAX_NO_TX_FRAGMENTS);
+
+    /* The fragment descriptors are copied before they are checked. Otherwise, the
+       user code on another core could modify them after the check. */
+    enet_buffer_t fragmentCopyAry[ETH_MAX_NO_TX_FRAGMENTS];
+    unsigned int u;
+    for(u=0u; u<noFragments; ++u)
+    {
+        fragmentCopyAry[u] = fragmentAry[u];
+        if(!rtos_checkUserCodeReadPtr(fragmentCopyAry[u].data, fragmentCopyAry[u].length))
+            rtos_osSystemCallBadArgument();
+    }
+
+    /* All arguments are alright, we can safely delegate the request to the OS
+       implementation. */
+    struct eth_enetBufferDesc_t *pRingBufferElement;
+    ENET_DRV_SendFrameFragments( &pRingBufferElement
+                               , (uint8_t)idxEthDev
+                               , (uint8_t)idxRing
+                               , fragmentCopyAry
+                               , noFragments
+                               , /*pOptions*/ NULL
+                               );
+    return pRingBufferElement;
+
+} /* submitFrame */
+
+
 
 /**
  * System call of Ethernet driver function ENET_DRV_SetMulticastForward(); a function,
@@ -412,6 +485,79 @@ const struct eth_bufferDesc_t *eth_scSmplHdlr_readFrame( uint32_t pidOfCallingTa
 
 
 
+/**
+ * System call for fetching a batch of received frames; it repeatedly applies Ethernet
+ * driver function ENET_DRV_ReadFrame(), which is otherwise available only to OS code.\n
+ *   This function reads the eldest received Ethernet frames in the given Rx ring, until
+ * the ring is empty or the requested number of frames has been fetched.
+ *   @return
+ * Get the batch of frames by reference. Field \a noFrames is zero if no Rx frame is
+ * currently buffered. Each of the first \a noFrames descriptors has the same meaning as
+ * the result of eth_scSmplHdlr_readFrame().\n
+ *   The returned information is valid until the next invocation of this API function.
+ * Each of the returned payload buffers needs to be released after use by system call
+ * eth_releaseRxFramePayloadBuffer().
+ *   @param pidOfCallingTask
+ * The process ID of the calling task. This system call is available only to the QM
+ * process, \a bsw_pidUser. An exception is raised if another process try to make the system
+ * call.
+ *   @param idxEthDev
+ * The zero based index of the MAC. Only device 0 is enabled in this project.
+ *   @param idxRing
+ * The zero based index of the ring buffer (or Rx queue) of the MAC. Only ring 0 is in use
+ * in this project.
+ *   @param maxNoFrames
+ * The maximum number of frames to fetch. Range is 1..#ETH_MAX_NO_RX_FRAMES_PER_READ.
+ *   @remark
+ * This function must never be called directly. The function is only made for placing it in
+ * the global system call table.
+ */
+const struct eth_rxFrameBatch_t *eth_scSmplHdlr_readFrames( uint32_t pidOfCallingTask
+                                                          , unsigned int idxEthDev
+                                                          , unsigned int idxRing
+                                                          , unsigned int maxNoFrames
+                                                          )
+{
+    /* Check all kinds of input argument errors, which can make the OS code potentially
+       fail. Also exclude input, which is forbidden by design, e.g., violation of granted
+       privileges. */
+    if(pidOfCallingTask == bsw_pidUser
+       &&  idxEthDev == 0u
+       &&  idxRing == 0u
+       &&  maxNoFrames >= 1u  &&  maxNoFrames <= ETH_MAX_NO_RX_FRAMES_PER_READ
+      )
+    {
+        /* We use a static buffer for returning the information to the caller for the same
+           reason as eth_scSmplHdlr_readFrame() does. */
+        static struct eth_rxFrameBatch_t DATA_OS(rxFrameBatch_);
+
+        /* All arguments are alright, we can safely delegate the request to the OS
+           implementation. */
+        unsigned int noFrames = 0u;
+        while(noFrames < maxNoFrames
+              &&  ENET_DRV_ReadFrame( idxEthDev
+                                    , idxRing
+                                    , &rxFrameBatch_.frameDescAry[noFrames]
+                                    , /*pInfo*/ NULL
+                                    )
+                  == STATUS_SUCCESS
+             )
+        {
+            ++ noFrames;
+        }
+        rxFrameBatch_.noFrames = noFrames;
+        return &rxFrameBatch_;
+    }
+    else
+    {
+        /* There is a severe user code error, which is handeld with an exception, task
+           abort and counted error. */
+        rtos_osSystemCallBadArgument();
+    }
+} /* eth_scSmplHdlr_readFrames */
+
+
+
 /**
  * System call of Ethernet driver function ENET_DRV_ProvideRxBuff(); a function,
  * which is otherwise available only to OS code.\n
@@ -472,18 +618,19 @@ void eth_scSmplHdlr_releaseRxFramePayloadBuffer( uint32_t pidOfCallingTask
 
 
 /**
- * System call of Ethernet driver function ENET_DRV_SendFrame(); a function,
+ * System call of Ethernet driver function ENET_DRV_SendFrameFragments(); a function,
  * which is otherwise available only to OS code.\n
- *   This function hands an Ethernet frame, or a fragment of it, over to the Ethernet
- * driver for transmission.
+ *   This function hands an Ethernet frame, which may be scattered over several buffers,
+ * over to the Ethernet driver for transmission. Each fragment occupies a Tx ring buffer
+ * element.
  *   @return
- * Get the handle \a hTxFrame of the frame or fragment if the transmission request has been
- * accepted by the Ethernet driver, i.e., the driver has had enough memory for queing the
- * request. This handle is required to query the progress of transmission using
+ * Get the handle \a hTxFrame of the frame if the transmission request has been accepted by
+ * the Ethernet driver, i.e., the driver has had a free ring buffer element for each
+ * fragment. This handle is required to query the progress of transmission using
  * eth_isTransmissionCompleted().\n
- *   Get zero, the invalid handle, if the driver's Tx queue is currently full. The frame or
- * fragment is lost if the caller doesn't submit it again after a while. The ownership of
- * the memory at \a payloadData has not been passed to the Ethernet driver.
+ *   Get zero, the invalid handle, if the driver's Tx queue has too few free elements. The
+ * frame is lost if the caller doesn't submit it again after a while. The ownership of the
+ * memory of the fragments has not been passed to the Ethernet driver.
  *   @param pidOfCallingTask
  * The process ID of the calling task. This system call is available only to the QM
  * process, \a bsw_pidUser. An exception is raised if another process try to make the system
@@ -494,18 +641,19 @@ void eth_scSmplHdlr_releaseRxFramePayloadBuffer( uint32_t pidOfCallingTask
  * is raised.\n
  *   In this project, only device 0 is enabled.
  *   @param idxRing
- * The zero based index of the ring buffer (or Rx queue) of the MAC, which is used for
- * reception of frames. The MACs in the MPC5748G have three ring buffers, but the
+ * The zero based index of the ring buffer (or Tx queue) of the MAC, which is used for
+ * transmission of frames. The MACs in the MPC5748G have three ring buffers, but the
  * specified index needs to address to a configured ring. Otherwise, an exception is
  * raised.\n
  *   In this project, only ring 0 is in use.
- *   @param payloadData
- * The frame's payload data by read reference. Note, the memory is read at an unspecified
- * time after entry into this function. If the function succeeds, then the memory contents
- * must not be changed until the other system call eth_isTransmissionCompleted() has
- * confirmed that the Ethernet driver has consumed the data.
- *   @param sizeOfPayloadData
- * The number of bytes in \a payloadData.
+ *   @param fragmentAry
+ * The fragments of the frame's payload data by read reference. Note, the memory of the
+ * fragments is read at an unspecified time after entry into this function. If the
+ * function succeeds, then the memory contents must not be changed until the other system
+ * call eth_isTransmissionCompleted() has confirmed that the Ethernet driver has consumed
+ * the data.
+ *   @param noFragments
+ * The number of elements of \a fragmentAry. Range is 1..#ETH_MAX_NO_TX_FRAGMENTS.
  *   @remark
  * This function must never be called directly. The function is only made for placing it in
  * the global system call table.
@@ -513,36 +661,25 @@ void eth_scSmplHdlr_releaseRxFramePayloadBuffer( uint32_t pidOfCallingTask
 uintptr_t eth_scSmplHdlr_sendFrame( uint32_t pidOfCallingTask
                                   , unsigned int idxEthDev
                                   , unsigned int idxRing
-                                  , const void * const payloadData
-                                  , unsigned int sizeOfPayloadData
+                                  , const struct eth_bufferDesc_t fragmentAry[]
+                                  , unsigned int noFragments
                                   )
 {
+    _Static_assert( ETH_MAX_NO_TX_FRAGMENTS <= ETH_ENET0_RING0_NO_TXBD
+                  , "A frame with the maximum number of fragments doesn't fit into the ring"
+                  );
+
     /* Check all kinds of input argument errors, which can make the OS code potentially
        fail. Also exclude input, which is forbidden by design, e.g., violation of granted
        privileges. */
     if(pidOfCallingTask == bsw_pidUser
        &&  idxEthDev == 0u
        &&  idxRing == 0u
-       &&  rtos_checkUserCodeReadPtr(payloadData, sizeOfPayloadData)
+       &&  noFragments >= 1u  &&  noFragments <= ETH_MAX_NO_TX_FRAGMENTS
+       &&  rtos_checkUserCodeReadPtr(fragmentAry, noFragments*sizeof(fragmentAry[0]))
       )
     {
-        /* All arguments are alright, we can safely delegate the request to the OS
-           implementation. */
-           
-        /// @todo Design error in driver API. Dedicated buffer descriptors are required for
-        // read and write buffers. Otherwise no proper use of const is possible. We are
-        // forced to cast the const away.
-        const enet_buffer_t frameDesc = { .data = (uint8_t*)payloadData,
-                                          .length = sizeOfPayloadData,
-                                        };
-        struct eth_enetBufferDesc_t *pRingBufferElement;
-        ENET_DRV_SendFrame( &pRingBufferElement
-                          , (uint8_t)idxEthDev
-                          , (uint8_t)idxRing
-                          , &frameDesc
-                          , /*pOptions*/ NULL
-                          );
-        return (uintptr_t)pRingBufferElement;
+        return (uintptr_t)submitFrame(idxEthDev, idxRing, fragmentAry, noFragments);
     }
     else
     {
@@ -627,6 +764,183 @@ bool eth_scSmplHdlr_isTransmissionCompleted(uint32_t pidOfCallingTask, uintptr_t
 
 
 
+/**
+ * System call for re-enabling the frame Rx interrupt after the client code has drained
+ * the Rx ring; it uses Ethernet driver function ENET_DRV_EnableRxFrameInterrupt(), which is
+ * otherwise available only to OS code.
+ *   @return
+ * Get \a true if the interrupt has been re-enabled and \a false if the Rx ring still
+ * contains a frame. The interrupt stays disabled in the latter case.
+ *   @param pidOfCallingTask
+ * The process ID of the calling task. This system call is available only to the QM
+ * process, \a bsw_pidUser. An exception is raised if another process try to make the system
+ * call.
+ *   @param idxEthDev
+ * The zero based index of the MAC. Only device 0 is enabled in this project.
+ *   @remark
+ * This function must never be called directly. The function is only made for placing it in
+ * the global system call table.
+ */
+bool eth_scSmplHdlr_enableRxInterrupt(uint32_t pidOfCallingTask, unsigned int idxEthDev)
+{
+    if(pidOfCallingTask == bsw_pidUser  &&  idxEthDev == 0u)
+    {
+        return ENET_DRV_EnableRxFrameInterrupt( (uint8_t)idxEthDev
+                                              , (uint8_t)ETH_ENET0_IDX_RING_IN_USE
+                                              );
+    }
+    else
+    {
+        /* There is a severe user code error, which is handeld with an exception, task
+           abort and counted error. */
+        rtos_osSystemCallBadArgument();
+    }
+} /* eth_scSmplHdlr_enableRxInterrupt */
+
+
+
+/**
+ * System call for the transmission of several frames at once; it repeatedly applies
+ * Ethernet driver function ENET_DRV_SendFrameFragments(), which is otherwise available
+ * only to OS code.\n
+ *   The frames are submitted in order until the Tx ring has too few free elements for the
+ * next one. The submitted frames are recorded in a FIFO, which is evaluated by
+ * eth_scSmplHdlr_getNoTransmissionsCompleted().
+ *   @return
+ * Get the number of submitted frames. Range is 0..\a noFrames.
+ *   @param pidOfCallingTask
+ * The process ID of the calling task. This system call is available only to the QM
+ * process, \a bsw_pidUser. An exception is raised if another process try to make the system
+ * call.
+ *   @param idxEthDev
+ * The zero based index of the MAC. Only device 0 is enabled in this project.
+ *   @param idxRing
+ * The zero based index of the ring buffer (or Tx queue) of the MAC. Only ring 0 is in use
+ * in this project.
+ *   @param frameDescAry
+ * The frames by read reference. Each element has the meaning of the fragment array
+ * argument of eth_scSmplHdlr_sendFrame().
+ *   @param noFrames
+ * The number of elements of \a frameDescAry. Range is 1..#ETH_MAX_NO_TX_FRAMES_PER_SEND.
+ *   @remark
+ * This function must never be called directly. The function is only made for placing it in
+ * the global system call table.
+ */
+unsigned int eth_scSmplHdlr_sendFrames( uint32_t pidOfCallingTask
+                                      , unsigned int idxEthDev
+                                      , unsigned int idxRing
+                                      , const struct eth_txFrameDesc_t frameDescAry[]
+                                      , unsigned int noFrames
+                                      )
+{
+    /* Check all kinds of input argument errors, which can make the OS code potentially
+       fail. Also exclude input, which is forbidden by design, e.g., violation of granted
+       privileges. */
+    if(pidOfCallingTask == bsw_pidUser
+       &&  idxEthDev == 0u
+       &&  idxRing == 0u
+       &&  noFrames >= 1u  &&  noFrames <= ETH_MAX_NO_TX_FRAMES_PER_SEND
+       &&  rtos_checkUserCodeReadPtr(frameDescAry, noFrames*sizeof(frameDescAry[0]))
+      )
+    {
+        unsigned int noFramesSent = 0u;
+        while(noFramesSent < noFrames)
+        {
+            /* The number of fragments is read only once; the user code on another core
+               could modify it after the check. */
+            const unsigned int noFragments = frameDescAry[noFramesSent].noFragments;
+            if(noFragments < 1u  ||  noFragments > ETH_MAX_NO_TX_FRAGMENTS)
+                rtos_osSystemCallBadArgument();
+
+            /* The FIFO of pending frames can't overflow: A pending frame holds at least
+               one ring buffer element and the driver rejects the frame if there is no
+               free element. */
+            enet_buffer_descriptor_t * const pRingBufferElement =
+                                        submitFrame( idxEthDev
+                                                   , idxRing
+                                                   , &frameDescAry[noFramesSent].fragmentAry[0]
+                                                   , noFragments
+                                                   );
+            if(pRingBufferElement == NULL)
+                break;
+
+            assert(_noTxPendingFrames < ETH_ENET0_RING0_NO_TXBD);
+            unsigned int idxWr = _idxTxPendingFrameRd + _noTxPendingFrames;
+            if(idxWr >= ETH_ENET0_RING0_NO_TXBD)
+                idxWr -= ETH_ENET0_RING0_NO_TXBD;
+            _enet0Ring0TxPendingFrameAry[idxWr] = pRingBufferElement;
+            ++ _noTxPendingFrames;
+
+            ++ noFramesSent;
+        }
+        return noFramesSent;
+    }
+    else
+    {
+        /* There is a severe user code error, which is handeld with an exception, task
+           abort and counted error. */
+        rtos_osSystemCallBadArgument();
+    }
+} /* eth_scSmplHdlr_sendFrames */
+
+
+
+/**
+ * System call to query and release the frames, which had been submitted with
+ * eth_scSmplHdlr_sendFrames() and whose transmission has completed meanwhile; it
+ * repeatedly applies Ethernet driver function ENET_DRV_GetTransmitStatus(), which is
+ * otherwise available only to OS code.\n
+ *   The DMA processes the frames in order of submission. The query starts with the eldest
+ * pending frame and ends at the first one, which is still in progress.
+ *   @return
+ * Get the number of frames, whose transmission has completed since the previous call.
+ * These frames are released; their ring buffer elements can be reused.
+ *   @param pidOfCallingTask
+ * The process ID of the calling task. This system call is available only to the QM
+ * process, \a bsw_pidUser. An exception is raised if another process try to make the system
+ * call.
+ *   @param idxEthDev
+ * The zero based index of the MAC. Only device 0 is enabled in this project.
+ *   @param idxRing
+ * The zero based index of the ring buffer (or Tx queue) of the MAC. Only ring 0 is in use
+ * in this project.
+ *   @remark
+ * This function must never be called directly. The function is only made for placing it in
+ * the global system call table.
+ */
+unsigned int eth_scSmplHdlr_getNoTransmissionsCompleted( uint32_t pidOfCallingTask
+                                                       , unsigned int idxEthDev
+                                                       , unsigned int idxRing
+                                                       )
+{
+    if(pidOfCallingTask == bsw_pidUser  &&  idxEthDev == 0u  &&  idxRing == 0u)
+    {
+        unsigned int noFramesCompleted = 0u;
+        while(_noTxPendingFrames > 0u
+              &&  ENET_DRV_GetTransmitStatus
+                            ( _enet0Ring0TxPendingFrameAry[_idxTxPendingFrameRd]
+                            , /*pInfo*/ NULL
+                            )
+                  == STATUS_SUCCESS
+             )
+        {
+            if(++_idxTxPendingFrameRd >= ETH_ENET0_RING0_NO_TXBD)
+                _idxTxPendingFrameRd = 0u;
+            -- _noTxPendingFrames;
+            ++ noFramesCompleted;
+        }
+        return noFramesCompleted;
+    }
+    else
+    {
+        /* There is a severe user code error, which is handeld with an exception, task
+           abort and counted error. */
+        rtos_osSystemCallBadArgument();
+    }
+} /* eth_scSmplHdlr_getNoTransmissionsCompleted */
+
+
+
 /**
  * Initialization of the Ethernet driver. Call this function once after startup of the
  * software and only from a single core, which is at the same time the core, which receives
@@ -727,3 +1041,24 @@ void eth_osInitEthernetDriver(void (*isrRxFrame)(uint32_t), void (*isrTxBuffer)(
                  , macAddr
                  );
 } /* eth_osInitEthernetDriver */
+
+
+
+#if ETH_RX_INTERRUPT_MITIGATION == 1
+/**
+ * Mask the frame Rx interrupt. To be called from the Rx callback, which had been passed to
+ * eth_osInitEthernetDriver(), if the interrupt mitigation is configured, see
+ * #ETH_RX_INTERRUPT_MITIGATION. The interrupt remains masked until the client code has
+ * drained the Rx ring and re-enables it using eth_enableRxInterrupt().
+ *   @param idxEthDev
+ * The zero based index of the MAC. Only device 0 is enabled in this project.
+ *   @remark
+ * Needs to be called from supervisor code only.
+ */
+void eth_osDisableRxInterrupt(unsigned int idxEthDev)
+{
+    assert(idxEthDev == 0u);
+    ENET_DRV_DisableRxFrameInterrupt((uint8_t)idxEthDev);
+
+} /* eth_osDisableRxInterrupt */
+#endif
@@ -39,8 +39,36 @@
 /** @brief Number of receive buffer descriptors for ENET0 ring 0 */
 #define ETH_ENET0_RING0_NO_RXBD     (6u)
 
-/** @brief Number of transmit buffer descriptors for ENET0 ring 0 */
-#define ETH_ENET0_RING0_NO_TXBD     (2u)
+/** @brief Number of transmit buffer descriptors for ENET0 ring 0. A frame occupies one
+    descriptor per fragment, see eth_sendFrameFragments(). */
+#define ETH_ENET0_RING0_NO_TXBD     (8u)
+
+/** The maximum number of fragments of a single Tx frame, see eth_sendFrameFragments(). The
+    fragment descriptors are copied onto the stack of the system call.\n
+      A frame occupies one Tx buffer descriptor per fragment. The limit is the size of the
+    Tx ring, so that any frame is accepted, which can fit into the ring at all. A frame,
+    which doesn't find enough free descriptors at the moment, is rejected and can be
+    submitted again after earlier frames have completed. */
+#define ETH_MAX_NO_TX_FRAGMENTS     ETH_ENET0_RING0_NO_TXBD
+
+/** The maximum number of received frames, which are fetched by a single call of
+    eth_readFrames(). There is no point in having more than there are Rx buffer
+    descriptors. */
+#define ETH_MAX_NO_RX_FRAMES_PER_READ   ETH_ENET0_RING0_NO_RXBD
+
+/** The maximum number of frames, which are submitted by a single call of
+    eth_sendFrames(). A frame occupies at least one Tx buffer descriptor; there is no point
+    in having more than there are Tx buffer descriptors. */
+#define ETH_MAX_NO_TX_FRAMES_PER_SEND   ETH_ENET0_RING0_NO_TXBD
+
+/** Interrupt mitigation for frame reception: If this switch is set to 1, then the frame Rx
+    interrupt is masked on its first occurrence and it remains masked until the client of
+    the driver has fetched all received frames and re-enables it with
+    eth_enableRxInterrupt(). The client code polls the driver meanwhile, it is not
+    interrupted by further frames and decides on its own how many frames it'll process per
+    activation.\n
+      If the switch is 0, then each received frame raises an interrupt. */
+#define ETH_RX_INTERRUPT_MITIGATION 1
 
 
 /** Index of system call for forwarding multicast traffic having a specific MAC address. */
@@ -52,18 +80,33 @@
 /** Index of system call for fetching a received frame from the Ethernet driver. */
 #define ETH_SYSCALL_READ_FRAME                  (47u)
 
-/** Index of system call for tranmission of a frame or frame fragment. */
+/** Index of system call for tranmission of a frame, which may be scattered over several
+    buffers. */
 #define ETH_SYSCALL_SEND_FRAME                  (48u)
 
 /** Index of system call to query the progress of an earlier submitted Tx frame. */
 #define ETH_SYSCALL_IS_TRANSMISSION_COMPLETED   (49u)
 
+/** Index of system call for fetching several received frames at once. */
+#define ETH_SYSCALL_READ_FRAMES                 (50u)
+
+/** Index of system call for re-enabling the frame Rx interrupt after draining the Rx ring. */
+#define ETH_SYSCALL_ENABLE_RX_INTERRUPT         (51u)
+
+/** Index of system call for transmission of several frames at once. */
+#define ETH_SYSCALL_SEND_FRAMES                 (52u)
+
+/** Index of system call to query and release the frames, which have been submitted with
+    ETH_SYSCALL_SEND_FRAMES and whose transmission has completed meanwhile. */
+#define ETH_SYSCALL_GET_NO_TRANSMISSIONS_COMPLETED  (53u)
+
 /*
  * Global type definitions
  */
 
 /** Definition of return value of system call ETH_SYSCALL_READ_FRAME: The contents of a
-    received Ethernet frame. */
+    received Ethernet frame. The same type is used to describe the fragments of a frame for
+    transmission with system call ETH_SYSCALL_SEND_FRAME. */
 struct eth_bufferDesc_t
 {
     /** The payload data of the frame. */
@@ -73,6 +116,30 @@ struct eth_bufferDesc_t
     uint16_t length;
 };
 
+/** Definition of return value of system call ETH_SYSCALL_READ_FRAMES: The contents of a
+    batch of received Ethernet frames. */
+struct eth_rxFrameBatch_t
+{
+    /** The number of frames in the batch. */
+    unsigned int noFrames;
+
+    /** The descriptors of the received frames, in order of reception. The first \a
+        noFrames elements are valid. */
+    struct eth_bufferDesc_t frameDescAry[ETH_MAX_NO_RX_FRAMES_PER_READ];
+};
+
+/** An element of the argument of system call ETH_SYSCALL_SEND_FRAMES: A frame for
+    transmission, which may be scattered over several buffers. */
+struct eth_txFrameDesc_t
+{
+    /** The number of fragments of the frame. Range is 1..#ETH_MAX_NO_TX_FRAGMENTS. */
+    unsigned int noFragments;
+
+    /** The fragments of the frame. The first \a noFragments elements are valid. The frame
+        is the concatenation of the fragments in order of appearance. */
+    struct eth_bufferDesc_t fragmentAry[ETH_MAX_NO_TX_FRAGMENTS];
+};
+
 /* Forward declarations needed for the APIs below. */
 struct eth_enetBufferDesc_t;
 
@@ -90,6 +157,11 @@ void eth_osInitEthernetDriver( void (*isrRxFrame)(uint32_t EIR)
                              , void (*isrTxBuffer)(uint32_t EIR)
                              );
 
+#if ETH_RX_INTERRUPT_MITIGATION == 1
+/** Mask the frame Rx interrupt until the client code has drained the Rx ring. */
+void eth_osDisableRxInterrupt(unsigned int idxEthDev);
+#endif
+
 /*
  * Global inline functions
  */
@@ -196,6 +268,88 @@ static inline void * eth_readFrame( unsigned int idxEthDev
 
 
 
+/**
+ * System call for fetching a batch of received frames. The system call repeatedly uses
+ * Ethernet driver function ENET_DRV_ReadFrame(). It saves the overhead of one system call
+ * per frame, if the frames arrive in bursts.
+ *   @return
+ * Get the number of returned frames. Range is 0..\a maxNoFrames. The ring of the Ethernet
+ * driver has been found empty if the result is less than \a maxNoFrames.
+ *   @param idxEthDev
+ * The zero based index of the MAC, used for the communication. Only device 0 is enabled in
+ * this project, any other value raises an exception.
+ *   @param idxRing
+ * The zero based index of the ring buffer (or Rx queue) of the MAC. Only ring 0 is in use
+ * in this project, any other value raises an exception.
+ *   @param pFrameDescAry
+ * The descriptors of the received frames are returned in * \a pFrameDescAry. The returned
+ * array is owned by the driver and it is valid until the next call of eth_readFrames()
+ * only. Each of its elements describes a frame in the same way as eth_readFrame() does.
+ * The ownership of the payload buffers is transferred to the caller. Each of them needs to
+ * be returned to the driver by eth_releaseRxFramePayloadBuffer() after use.\n
+ *   * \a pFrameDescAry is not touched if the function returns zero.
+ *   @param maxNoFrames
+ * The maximum number of frames to fetch. Range is 1..#ETH_MAX_NO_RX_FRAMES_PER_READ.
+ * Otherwise, an exception is raised.
+ *   @remark
+ * This function must be called only from the user task context executing in process
+ * bsw_pidUser on core 0. Any attempt to use it from OS code or another core or process
+ * will lead to undefined behavior.
+ *   @remark
+ * The API of the Ethernet driver is not reentrant. All function need to be called from the
+ * same context or from context, which implement mutual exclusion.
+ */
+static inline unsigned int eth_readFrames( unsigned int idxEthDev
+                                         , unsigned int idxRing
+                                         , const struct eth_bufferDesc_t ** const pFrameDescAry
+                                         , unsigned int maxNoFrames
+                                         )
+{
+    const struct eth_rxFrameBatch_t * const pBatch =
+                    (const struct eth_rxFrameBatch_t *)rtos_systemCall( ETH_SYSCALL_READ_FRAMES
+                                                                      , idxEthDev
+                                                                      , idxRing
+                                                                      , maxNoFrames
+                                                                      );
+    /* Being here back in the supervised user code space, using the pointer is not an
+       issue. */
+    assert(pBatch->noFrames <= maxNoFrames);
+    if(pBatch->noFrames > 0u)
+        *pFrameDescAry = &pBatch->frameDescAry[0];
+    return pBatch->noFrames;
+
+} /* eth_readFrames */
+
+
+
+
+/**
+ * System call for re-enabling the frame Rx interrupt after the client code has drained
+ * the Rx ring of the Ethernet driver. See #ETH_RX_INTERRUPT_MITIGATION for details.\n
+ *   The interrupt is not re-enabled if a frame has been received after the client code
+ * had seen the ring empty. The client code needs to continue fetching frames in this
+ * case.
+ *   @return
+ * Get \a true if the interrupt has been re-enabled. The next received frame will notify
+ * the client code. Get \a false if the ring is not empty. The interrupt stays disabled and
+ * the client code needs to continue polling the Rx ring.
+ *   @param idxEthDev
+ * The zero based index of the MAC, used for the communication. Only device 0 is enabled in
+ * this project, any other value raises an exception.
+ *   @remark
+ * This function must be called only from the user task context executing in process
+ * bsw_pidUser on core 0. Any attempt to use it from OS code or another core or process
+ * will lead to undefined behavior.
+ */
+static inline bool eth_enableRxInterrupt(unsigned int idxEthDev)
+{
+    return (bool)rtos_systemCall(ETH_SYSCALL_ENABLE_RX_INTERRUPT, idxEthDev);
+
+} /* eth_enableRxInterrupt */
+
+
+
+
 /** 
  * System call of Ethernet driver function ENET_DRV_ProvideRxBuff().\n
  *   A memory buffer, which had been got from the Ethernet driver as result of
@@ -233,6 +387,74 @@ static inline void eth_releaseRxFramePayloadBuffer( unsigned int idxEthDev
 
 
 
+/** 
+ * System call of Ethernet driver function ENET_DRV_SendFrameFragments().\n
+ *   An Ethernet frame, whose contents are scattered over several memory areas, is
+ * submitted for transmission by the Ethernet driver. The DMA of the MAC gathers the
+ * fragments from memory; no copying into a contiguous buffer is needed. The function is
+ * non blocking. When it successfully returns then it has programmed the MAC's DMA to
+ * upload the data. (Which has not necessarily begun or even completed yet on exit from
+ * this function.)\n
+ *   By calling this function, the caller transfers ownership of the memory space of all
+ * fragments to the Ethernet driver. The caller must no longer touch this memory. The
+ * ownership of this memory space is returned back to the caller when he gets a success
+ * message from the counterpart function eth_isTransmissionCompleted().
+ *   @return
+ * Get the handle \a hTxFrame of the frame if the transmission request has been accepted by
+ * the Ethernet driver, i.e., the driver has had a free ring buffer element for each
+ * fragment. This handle is required to query the progress of transmission using
+ * eth_isTransmissionCompleted().\n
+ *   Get zero, the invalid handle, if the driver's Tx queue currently has too few free
+ * elements. Nothing has been enqueued. The frame is lost if the caller doesn't submit it
+ * again after a while. The ownership of the memory of the fragments has not been passed to
+ * the Ethernet driver.
+ *   @param idxEthDev
+ * The zero based index of the MAC, used for the communication. The MPC5748G has two MACs
+ * but the specified index needs to address to a configured device. Otherwise, an exception
+ * is raised.\n
+ *   In this project, only device 0 is enabled.
+ *   @param idxRing
+ * The zero based index of the ring buffer (or Tx queue) of the MAC, which is used for
+ * transmission of frames. The MACs in the MPC5748G have three ring buffers, but the
+ * specified index needs to address to a configured ring. Otherwise, an exception is
+ * raised.\n
+ *   In this project, only ring 0 is in use.
+ *   @param fragmentAry
+ * The fragments of the frame's payload data by read reference. The frame is the
+ * concatenation of the fragments in order of appearance. The array itself is read only
+ * during the function call but the memory of the fragments is read at an unspecified time
+ * after entry into this function. If the function succeeds, then the memory contents must
+ * not be changed until the other function eth_isTransmissionCompleted() has confirmed that
+ * the Ethernet driver has consumed the data.
+ *   @param noFragments
+ * The number of elements in \a fragmentAry. Range is 1..#ETH_MAX_NO_TX_FRAGMENTS. Otherwise
+ * an exception is raised.
+ *   @remark
+ * This function must be called only from the user task context executing in process
+ * bsw_pidUser on core 0. Any attempt to use it from OS code or another core or process
+ * will lead to undefined behavior.
+ *   @remark
+ * The API of the Ethernet driver is not reentrant. All function need to be called from the
+ * same context or from context, which implement mutual exclusion. This holds in particular
+ * for the paired calls of eth_sendFrameFragments() and eth_isTransmissionCompleted().
+ */
+static inline uintptr_t eth_sendFrameFragments( unsigned int idxEthDev
+                                              , unsigned int idxRing
+                                              , const struct eth_bufferDesc_t fragmentAry[]
+                                              , unsigned int noFragments
+                                              )
+{
+    return (uintptr_t)rtos_systemCall( ETH_SYSCALL_SEND_FRAME
+                                     , idxEthDev
+                                     , idxRing
+                                     , fragmentAry
+                                     , noFragments
+                                     );
+} /* eth_sendFrameFragments */
+
+
+
+
 /** 
  * System call of Ethernet driver function ENET_DRV_SendFrame().\n
  *   Some memory contents are submitted for transmission by the Ethernet driver. The
@@ -244,21 +466,21 @@ static inline void eth_releaseRxFramePayloadBuffer( unsigned int idxEthDev
  * ownership of this memory space is returned back to the caller when he gets a success
  * message from the counterpart function eth_isTransmissionCompleted().
  *   @return
- * Get the handle \a hTxFrame of the frame or fragment if the transmission request has been
- * accepted by the Ethernet driver, i.e., the driver has had enough memory for queing the
- * request. This handle is required to query the progress of transmission using
+ * Get the handle \a hTxFrame of the frame if the transmission request has been accepted
+ * by the Ethernet driver, i.e., the driver has had enough memory for queing the request.
+ * This handle is required to query the progress of transmission using
  * eth_isTransmissionCompleted().\n
- *   Get zero, the invalid handle, if the driver's Tx queue is currently full. The frame or
- * fragment is lost if the caller doesn't submit it again after a while. The ownership of
- * the memory at \a payloadData has not been passed to the Ethernet driver.
+ *   Get zero, the invalid handle, if the driver's Tx queue is currently full. The frame is
+ * lost if the caller doesn't submit it again after a while. The ownership of the memory at
+ * \a payloadData has not been passed to the Ethernet driver.
  *   @param idxEthDev
  * The zero based index of the MAC, used for the communication. The MPC5748G has two MACs
  * but the specified index needs to address to a configured device. Otherwise, an exception
  * is raised.\n
  *   In this project, only device 0 is enabled.
  *   @param idxRing
- * The zero based index of the ring buffer (or Rx queue) of the MAC, which is used for
- * reception of frames. The MACs in the MPC5748G have three ring buffers, but the
+ * The zero based index of the ring buffer (or Tx queue) of the MAC, which is used for
+ * transmission of frames. The MACs in the MPC5748G have three ring buffers, but the
  * specified index needs to address to a configured ring. Otherwise, an exception is
  * raised.\n
  *   In this project, only ring 0 is in use.
@@ -280,10 +502,7 @@ static inline void eth_releaseRxFramePayloadBuffer( unsigned int idxEthDev
  * same context or from context, which implement mutual exclusion. This holds in particular
  * for the paired calls of eth_sendFrame() and eth_isTransmissionCompleted().
  *   @remark
- * So far, submitting frame fragments has not be implemented yet. Each call of this
- * function will request to transmit an Ethernet frame having \a payloadData[] as content
- * data.
- *   
+ * The function is the special case of eth_sendFrameFragments() with a single fragment.
  */
 static inline uintptr_t eth_sendFrame( unsigned int idxEthDev
                                      , unsigned int idxRing
@@ -291,12 +510,12 @@ static inline uintptr_t eth_sendFrame( unsigned int idxEthDev
                                      , unsigned int sizeOfPayloadData
                                      )
 {
-    return (uintptr_t)rtos_systemCall( ETH_SYSCALL_SEND_FRAME
-                                     , idxEthDev
-                                     , idxRing
-                                     , payloadData
-                                     , sizeOfPayloadData
-                                     );
+    /// @todo The driver API doesn't distinguish read and write buffers. We are forced to cast the const away
+    const struct eth_bufferDesc_t frameDesc = { .data = (uint8_t*)payloadData,
+                                                .length = (uint16_t)sizeOfPayloadData,
+                                              };
+    return eth_sendFrameFragments(idxEthDev, idxRing, &frameDesc, /* noFragments */ 1u);
+
 } /* eth_sendFrame */
 
 
@@ -343,4 +562,99 @@ static inline bool eth_isTransmissionCompleted(uintptr_t hTxFrame)
 
 } /* eth_isTransmissionCompleted */
 
+
+
+
+/**
+ * System call for the transmission of several frames at once. The system call repeatedly
+ * uses Ethernet driver function ENET_DRV_SendFrameFragments(). It saves the overhead of
+ * one system call per frame, if a burst of frames is sent, e.g., during a bulk transfer
+ * of a TCP connection.\n
+ *   The frames are submitted in order of appearance until all are submitted or until the
+ * Tx ring of the driver has too few free elements for the next one. The ownership of the
+ * memory of the fragments of all submitted frames is transferred to the Ethernet driver
+ * in the same way as by eth_sendFrameFragments(). It is returned to the caller by the
+ * counterpart function eth_getNoTransmissionsCompleted().
+ *   @return
+ * Get the number of submitted frames. Range is 0..\a noFrames. If the result is less than
+ * \a noFrames, then the remaining frames have not been submitted and the ownership of
+ * their memory stays with the caller. They are lost if the caller doesn't submit them
+ * again after a while.
+ *   @param idxEthDev
+ * The zero based index of the MAC, used for the communication. Only device 0 is enabled in
+ * this project, any other value raises an exception.
+ *   @param idxRing
+ * The zero based index of the ring buffer (or Tx queue) of the MAC. Only ring 0 is in use
+ * in this project, any other value raises an exception.
+ *   @param frameDescAry
+ * The frames by read reference. The array itself is read only during the function call
+ * but the memory of the fragments is read at an unspecified time after entry into this
+ * function. See eth_sendFrameFragments() for details.
+ *   @param noFrames
+ * The number of elements in \a frameDescAry. Range is 1..#ETH_MAX_NO_TX_FRAMES_PER_SEND.
+ * Otherwise, an exception is raised.
+ *   @remark
+ * This function must be called only from the user task context executing in process
+ * bsw_pidUser on core 0. Any attempt to use it from OS code or another core or process
+ * will lead to undefined behavior.
+ *   @remark
+ * The API of the Ethernet driver is not reentrant. All function need to be called from the
+ * same context or from context, which implement mutual exclusion.
+ *   @remark
+ * The frames submitted by this function are released only by
+ * eth_getNoTransmissionsCompleted(). The function must not be mixed with
+ * eth_sendFrameFragments() and eth_isTransmissionCompleted() on the same ring.
+ */
+static inline unsigned int eth_sendFrames( unsigned int idxEthDev
+                                         , unsigned int idxRing
+                                         , const struct eth_txFrameDesc_t frameDescAry[]
+                                         , unsigned int noFrames
+                                         )
+{
+    return (unsigned int)rtos_systemCall( ETH_SYSCALL_SEND_FRAMES
+                                        , idxEthDev
+                                        , idxRing
+                                        , frameDescAry
+                                        , noFrames
+                                        );
+} /* eth_sendFrames */
+
+
+
+
+/**
+ * System call to query the progress of the frames, which had been submitted with
+ * eth_sendFrames(). The counterpart of eth_isTransmissionCompleted() for frames submitted
+ * in batches: All frames, whose transmission has completed, are released with a single
+ * call.\n
+ *   The frames are transmitted in order of submission. Therefore, it suffices to report
+ * the number of completed frames; they are the eldest ones, which have not been reported
+ * yet.\n
+ *   The same side-effect applies as for eth_isTransmissionCompleted(): The reported
+ * frames are released, their buffer descriptors can be reused by the driver and the
+ * ownership of their fragments' memory is returned to the caller.
+ *   @return
+ * Get the number of frames, whose transmission has completed since the previous call of
+ * this function. Range is 0..#ETH_ENET0_RING0_NO_TXBD.
+ *   @param idxEthDev
+ * The zero based index of the MAC, used for the communication. Only device 0 is enabled in
+ * this project, any other value raises an exception.
+ *   @param idxRing
+ * The zero based index of the ring buffer (or Tx queue) of the MAC. Only ring 0 is in use
+ * in this project, any other value raises an exception.
+ *   @remark
+ * This function must be called only from the user task context executing in process
+ * bsw_pidUser on core 0. Any attempt to use it from OS code or another core or process
+ * will lead to undefined behavior.
+ */
+static inline unsigned int eth_getNoTransmissionsCompleted( unsigned int idxEthDev
+                                                          , unsigned int idxRing
+                                                          )
+{
+    return (unsigned int)rtos_systemCall( ETH_SYSCALL_GET_NO_TRANSMISSIONS_COMPLETED
+                                        , idxEthDev
+                                        , idxRing
+                                        );
+} /* eth_getNoTransmissionsCompleted */
+
 #endif  /* ETH_ETHERNET_INCLUDED */
@@ -171,6 +171,110 @@
 # define RTOS_CORE_2_SYSCALL_TABLE_ENTRY_0049   RTOS_SYSCALL_DUMMY_TABLE_ENTRY
 #endif
 
+#if !defined(RTOS_CORE_0_SYSCALL_TABLE_ENTRY_0050)    \
+    && !defined(RTOS_CORE_1_SYSCALL_TABLE_ENTRY_0050) \
+    && !defined(RTOS_CORE_2_SYSCALL_TABLE_ENTRY_0050)
+    
+# if ETH_SYSCALL_READ_FRAMES != 50
+#  error Inconsistent definition of system call
+# endif
+
+/* The system call is only available only on the very core, which serves the Ethernet
+   interrupts. The others will be redirected to the illegal system call exception. */
+# define RTOS_CORE_0_SYSCALL_TABLE_ENTRY_0050 \
+                            RTOS_SC_TABLE_ENTRY(eth_scSmplHdlr_readFrames, SIMPLE)
+# define RTOS_CORE_1_SYSCALL_TABLE_ENTRY_0050 RTOS_SYSCALL_DUMMY_TABLE_ENTRY
+# define RTOS_CORE_2_SYSCALL_TABLE_ENTRY_0050 RTOS_SYSCALL_DUMMY_TABLE_ENTRY
+
+#else
+# error System call 0050 is ambiguously defined
+
+/* We purposely redefine the table entry and despite of the already reported error; this
+   makes the compiler emit a message with the location of the conflicting previous
+   definition.*/
+# define RTOS_CORE_0_SYSCALL_TABLE_ENTRY_0050   RTOS_SYSCALL_DUMMY_TABLE_ENTRY
+# define RTOS_CORE_1_SYSCALL_TABLE_ENTRY_0050   RTOS_SYSCALL_DUMMY_TABLE_ENTRY
+# define RTOS_CORE_2_SYSCALL_TABLE_ENTRY_0050   RTOS_SYSCALL_DUMMY_TABLE_ENTRY
+#endif
+
+#if !defined(RTOS_CORE_0_SYSCALL_TABLE_ENTRY_0051)    \
+    && !defined(RTOS_CORE_1_SYSCALL_TABLE_ENTRY_0051) \
+    && !defined(RTOS_CORE_2_SYSCALL_TABLE_ENTRY_0051)
+    
+# if ETH_SYSCALL_ENABLE_RX_INTERRUPT != 51
+#  error Inconsistent definition of system call
+# endif
+
+/* The system call is only available only on the very core, which serves the Ethernet
+   interrupts. The others will be redirected to the illegal system call exception. */
+# define RTOS_CORE_0_SYSCALL_TABLE_ENTRY_0051 \
+                            RTOS_SC_TABLE_ENTRY(eth_scSmplHdlr_enableRxInterrupt, SIMPLE)
+# define RTOS_CORE_1_SYSCALL_TABLE_ENTRY_0051 RTOS_SYSCALL_DUMMY_TABLE_ENTRY
+# define RTOS_CORE_2_SYSCALL_TABLE_ENTRY_0051 RTOS_SYSCALL_DUMMY_TABLE_ENTRY
+
+#else
+# error System call 0051 is ambiguously defined
+
+/* We purposely redefine the table entry and despite of the already reported error; this
+   makes the compiler emit a message with the location of the conflicting previous
+   definition.*/
+# define RTOS_CORE_0_SYSCALL_TABLE_ENTRY_0051   RTOS_SYSCALL_DUMMY_TABLE_ENTRY
+# define RTOS_CORE_1_SYSCALL_TABLE_ENTRY_0051   RTOS_SYSCALL_DUMMY_TABLE_ENTRY
+# define RTOS_CORE_2_SYSCALL_TABLE_ENTRY_0051   RTOS_SYSCALL_DUMMY_TABLE_ENTRY
+#endif
+
+#if !defined(RTOS_CORE_0_SYSCALL_TABLE_ENTRY_0052)    \
+    && !defined(RTOS_CORE_1_SYSCALL_TABLE_ENTRY_0052) \
+    && !defined(RTOS_CORE_2_SYSCALL_TABLE_ENTRY_0052)
+    
+# if ETH_SYSCALL_SEND_FRAMES != 52
+#  error Inconsistent definition of system call
+# endif
+
+/* The system call is only available only on the very core, which serves the Ethernet
+   interrupts. The others will be redirected to the illegal system call exception. */
+# define RTOS_CORE_0_SYSCALL_TABLE_ENTRY_0052 \
+                            RTOS_SC_TABLE_ENTRY(eth_scSmplHdlr_sendFrames, SIMPLE)
+# define RTOS_CORE_1_SYSCALL_TABLE_ENTRY_0052 RTOS_SYSCALL_DUMMY_TABLE_ENTRY
+# define RTOS_CORE_2_SYSCALL_TABLE_ENTRY_0052 RTOS_SYSCALL_DUMMY_TABLE_ENTRY
+
+#else
+# error System call 0052 is ambiguously defined
+
+/* We purposely redefine the table entry and despite of the already reported error; this
+   makes the compiler emit a message with the location of the conflicting previous
+   definition.*/
+# define RTOS_CORE_0_SYSCALL_TABLE_ENTRY_0052   RTOS_SYSCALL_DUMMY_TABLE_ENTRY
+# define RTOS_CORE_1_SYSCALL_TABLE_ENTRY_0052   RTOS_SYSCALL_DUMMY_TABLE_ENTRY
+# define RTOS_CORE_2_SYSCALL_TABLE_ENTRY_0052   RTOS_SYSCALL_DUMMY_TABLE_ENTRY
+#endif
+
+#if !defined(RTOS_CORE_0_SYSCALL_TABLE_ENTRY_0053)    \
+    && !defined(RTOS_CORE_1_SYSCALL_TABLE_ENTRY_0053) \
+    && !defined(RTOS_CORE_2_SYSCALL_TABLE_ENTRY_0053)
+    
+# if ETH_SYSCALL_GET_NO_TRANSMISSIONS_COMPLETED != 53
+#  error Inconsistent definition of system call
+# endif
+
+/* The system call is only available only on the very core, which serves the Ethernet
+   interrupts. The others will be redirected to the illegal system call exception. */
+# define RTOS_CORE_0_SYSCALL_TABLE_ENTRY_0053 \
+                            RTOS_SC_TABLE_ENTRY(eth_scSmplHdlr_getNoTransmissionsCompleted, SIMPLE)
+# define RTOS_CORE_1_SYSCALL_TABLE_ENTRY_0053 RTOS_SYSCALL_DUMMY_TABLE_ENTRY
+# define RTOS_CORE_2_SYSCALL_TABLE_ENTRY_0053 RTOS_SYSCALL_DUMMY_TABLE_ENTRY
+
+#else
+# error System call 0053 is ambiguously defined
+
+/* We purposely redefine the table entry and despite of the already reported error; this
+   makes the compiler emit a message with the location of the conflicting previous
+   definition.*/
+# define RTOS_CORE_0_SYSCALL_TABLE_ENTRY_0053   RTOS_SYSCALL_DUMMY_TABLE_ENTRY
+# define RTOS_CORE_1_SYSCALL_TABLE_ENTRY_0053   RTOS_SYSCALL_DUMMY_TABLE_ENTRY
+# define RTOS_CORE_2_SYSCALL_TABLE_ENTRY_0053   RTOS_SYSCALL_DUMMY_TABLE_ENTRY
+#endif
+
 
 /*
  * Global type definitions
@@ -206,17 +310,41 @@ const struct eth_bufferDesc_t *eth_scSmplHdlr_readFrame( uint32_t pidOfCallingTa
                                                        , unsigned int idxRing
                                                        );
 
-/* System call of Ethernet driver function ENET_DRV_SendFrame(). */
+/* System call of Ethernet driver function ENET_DRV_SendFrameFragments(). */
 uintptr_t eth_scSmplHdlr_sendFrame( uint32_t pidOfCallingTask
                                   , unsigned int idxEthDev
                                   , unsigned int idxRing
-                                  , const void * const payloadData
-                                  , unsigned int sizeOfPayloadData
+                                  , const struct eth_bufferDesc_t fragmentAry[]
+                                  , unsigned int noFragments
                                   );
 
 /* System call of Ethernet driver function ENET_DRV_GetTransmitStatus(). */
 bool eth_scSmplHdlr_isTransmissionCompleted(uint32_t pidOfCallingTask, uintptr_t hTxFrame);
 
+/* System call for fetching a batch of received frames. */
+const struct eth_rxFrameBatch_t *eth_scSmplHdlr_readFrames( uint32_t pidOfCallingTask
+                                                          , unsigned int idxEthDev
+                                                          , unsigned int idxRing
+                                                          , unsigned int maxNoFrames
+                                                          );
+
+/* System call for re-enabling the frame Rx interrupt after draining the Rx ring. */
+bool eth_scSmplHdlr_enableRxInterrupt(uint32_t pidOfCallingTask, unsigned int idxEthDev);
+
+/* System call for transmitting a batch of frames. */
+unsigned int eth_scSmplHdlr_sendFrames( uint32_t pidOfCallingTask
+                                      , unsigned int idxEthDev
+                                      , unsigned int idxRing
+                                      , const struct eth_txFrameDesc_t frameDescAry[]
+                                      , unsigned int noFrames
+                                      );
+
+/* System call for releasing all frames of a batch transmission, which have completed. */
+unsigned int eth_scSmplHdlr_getNoTransmissionsCompleted( uint32_t pidOfCallingTask
+                                                       , unsigned int idxEthDev
+                                                       , unsigned int idxRing
+                                                       );
+
 /*
  * Global inline functions
  */
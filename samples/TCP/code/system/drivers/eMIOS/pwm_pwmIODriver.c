@@ -43,7 +43,7 @@
 #include "typ_types.h"
 #include "siu_siuPortDriver.h"
 #include "pwm_modularIOSubsystem.h"
-#include "f2d_float2Double.h"
+#include "f2s_float2String.h"
 #include "pwm_pwmIODriver_defSysCalls.h"
 
 /*
@@ -160,10 +160,19 @@ void pwm_osInitIODriver(void)
     outputCfg.idxPortSource_SSS = SIUL_P_SSS;
     siu_osConfigureOutput(SIUL_idxP, &outputCfg);
 
-    printf( "PWM frequency range for LED DS11: %.3f .. %.3f Hz\r\n"
-          , f2d(pwm_osGetChnMinPWMFrequency(&_hChn0_LED_2_DS10))
-          , f2d(pwm_osGetChnMaxPWMFrequency(&_hChn0_LED_2_DS10))
-          );
+    char fMinStr[F2S_SIZE_OF_BUF_FIXED(3u)]
+       , fMaxStr[F2S_SIZE_OF_BUF_FIXED(3u)];
+    f2s_formatFixed( fMinStr
+                   , sizeof(fMinStr)
+                   , pwm_osGetChnMinPWMFrequency(&_hChn0_LED_2_DS10)
+                   , /* noDecimals */ 3u
+                   );
+    f2s_formatFixed( fMaxStr
+                   , sizeof(fMaxStr)
+                   , pwm_osGetChnMaxPWMFrequency(&_hChn0_LED_2_DS10)
+                   , /* noDecimals */ 3u
+                   );
+    printf("PWM frequency range for LED DS11: %s .. %s Hz\r\n", fMinStr, fMaxStr);
 
 
     /* Initialize channel 1 as (faster, prescale=1) PWM output and channels 2 and 6 and
@@ -202,10 +211,17 @@ void pwm_osInitIODriver(void)
     outputCfg.enableOpenDrain_ODE = false;
     siu_osConfigureOutput(SIUL_idxP, &outputCfg);
 
-    printf( "PWM frequency range for output PA1: %.3f .. %.3f Hz\r\n"
-          , f2d(pwm_osGetChnMinPWMFrequency(&_hChn1_PWM_OUT_PA1_J3_pin1))
-          , f2d(pwm_osGetChnMaxPWMFrequency(&_hChn1_PWM_OUT_PA1_J3_pin1))
-          );
+    f2s_formatFixed( fMinStr
+                   , sizeof(fMinStr)
+                   , pwm_osGetChnMinPWMFrequency(&_hChn1_PWM_OUT_PA1_J3_pin1)
+                   , /* noDecimals */ 3u
+                   );
+    f2s_formatFixed( fMaxStr
+                   , sizeof(fMaxStr)
+                   , pwm_osGetChnMaxPWMFrequency(&_hChn1_PWM_OUT_PA1_J3_pin1)
+                   , /* noDecimals */ 3u
+                   );
+    printf("PWM frequency range for output PA1: %s .. %s Hz\r\n", fMinStr, fMaxStr);
 
     /* Acquire and configure port PA2, our PWM period time input in this sample application. */
     siu_portInCfg_t inputCfg =
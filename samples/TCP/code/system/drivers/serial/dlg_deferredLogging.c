@@ -0,0 +1,485 @@
+/**
+ * @file dlg_deferredLogging.c
+ * Deferred formatting of logging output. The application code writes its messages with
+ * DLG_LOG(), which is used like printf(). Instead of formatting the text on the target,
+ * a short binary record is sent through the serial interface: The ID of the format string
+ * and the raw bytes of the arguments. The format strings are collected by the linker in a
+ * section, which is not loaded into the flash ROM. The build dumps the section into a
+ * dictionary file and the host tool dlg_decodeLog.exe uses it to format the text on the
+ * host. Formatting, in particular of floating point numbers, costs thousands of CPU cycles
+ * per line on the target, and the records are much shorter than the text.\n
+ *   The record has the layout:\n
+ *   - Byte 0: #DLG_RECORD_START\n
+ *   - Byte 1: The number of bytes of the record behind this byte\n
+ *   - Byte 2, 3: The ID of the format string, little endian\n
+ *   - Per argument, as determined by the conversion in the format string: 4 Byte for
+ * integers, pointers and floats (IEEE 754 single precision), 8 Byte for integers with
+ * length modifier ll, all little endian, and a length byte and the characters for %s\n
+ *   Binary records and plain text, which is written with printf() or sio_writeSerial(),
+ * can be mixed in the same serial channel. The decoder passes plain text through.\n
+ *   Supported are the conversions d, i, u, o, x, X, c, p, s, f, F, e, E, g, G, a, A and
+ * %%, with all flags, width and precision, as far as they are not given as argument, *.
+ *   Compile switch #DLG_BINARY_LOGGING selects text output on the target instead. It is
+ * meant for a terminal without the decoder. In this mode, the conversion %f is done with
+ * f2s_formatFixed(); the other floating point conversions still need snprintf().
+ *
+ * Copyright (C) 2026 Peter Vranken (mailto:Peter_Vranken@Yahoo.de)
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+/* Module interface
+ *   dlg_log
+ *   dlg_encodeRecord
+ * Local functions
+ *   writeSerial
+ *   putWord
+ *   putChar
+ *   formatFloat
+ *   formatText
+ */
+
+/*
+ * Include files
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+
+#include "dlg_deferredLogging.h"
+#include "sio_serialIO.h"
+#include "rtos_ivorHandler.h"
+#if DLG_BINARY_LOGGING != 1
+# include "f2s_float2String.h"
+# include "f2d_float2Double.h"
+#endif
+
+
+/*
+ * Defines
+ */
+
+/** The maximum length of a formatted message if #DLG_BINARY_LOGGING is off. Longer
+    messages are truncated. */
+#define DLG_MAX_LEN_TEXT    200u
+
+
+/*
+ * Local type definitions
+ */
+
+
+/*
+ * Local prototypes
+ */
+
+
+/*
+ * Data definitions
+ */
+
+
+/*
+ * Function implementation
+ */
+
+/**
+ * Write bytes into the serial output. The function can be called from user and OS
+ * context.
+ *   @return
+ * Get the number of written bytes. It is less than \a noBytes if the output buffer is
+ * full.
+ *   @param msg
+ * The bytes to write.
+ *   @param noBytes
+ * The number of bytes to write.
+ */
+static unsigned int writeSerial(const void *msg, unsigned int noBytes)
+{
+    /* Like the binding of printf() to the serial output, see nwl_ioSysNewLib.c, we check
+       the core status register to find out if we can use the OS variant of the write
+       function or if we need to do the more expensive system call. */
+    if((rtos_getCoreStatusRegister() & 0x00004000u) == 0)
+        return sio_osWriteSerial((const char*)msg, noBytes);
+    else
+        return sio_writeSerial((const char*)msg, noBytes);
+
+} /* End of writeSerial */
+
+
+#if DLG_BINARY_LOGGING == 1
+/**
+ * Put a word into the record, little endian.
+ *   @return
+ * Get the pointer to the next byte of the record.
+ *   @param pRecord
+ * The pointer to the first byte to write.
+ *   @param word
+ * The word to write.
+ *   @param noBytes
+ * The number of bytes to write, up to 8.
+ */
+static inline uint8_t *putWord(uint8_t *pRecord, uint64_t word, unsigned int noBytes)
+{
+    while(noBytes-- > 0u)
+    {
+        *pRecord++ = (uint8_t)word;
+        word >>= 8;
+    }
+    return pRecord;
+
+} /* End of putWord */
+
+
+/**
+ * Encode a message as binary record. See file header for the layout.
+ *   @return
+ * Get the length of the record in Byte.
+ *   @param record
+ * The record is written into this buffer of #DLG_MAX_LEN_RECORD Byte.
+ *   @param fmt
+ * The format string. It is not read, its address is the ID of the format string. The
+ * address needs to be less than 2^16. This is ensured by the linker control file, which
+ * locates the format strings at address zero.
+ *   @param argTypes
+ * The types of the arguments, see DLG_ARG_TYPES().
+ *   @param ap
+ * The arguments.
+ */
+unsigned int dlg_encodeRecord( uint8_t record[DLG_MAX_LEN_RECORD]
+                             , const char *fmt
+                             , uint32_t argTypes
+                             , va_list ap
+                             )
+{
+    const uintptr_t idFmt = (uintptr_t)fmt;
+    assert(idFmt <= UINT16_MAX);
+
+    uint8_t *pRecord = putWord(&record[2], idFmt, /*noBytes*/ 2u);
+    while(argTypes != DLG_ARG_TYPE_END)
+    {
+        switch(argTypes & ((1u<<DLG_NO_BITS_ARG_TYPE)-1u))
+        {
+        case DLG_ARG_TYPE_INT32:
+            pRecord = putWord(pRecord, va_arg(ap, uint32_t), /*noBytes*/ 4u);
+            break;
+
+        case DLG_ARG_TYPE_INT64:
+            pRecord = putWord(pRecord, va_arg(ap, uint64_t), /*noBytes*/ 8u);
+            break;
+
+        case DLG_ARG_TYPE_FLOAT:
+        {
+            /* float arguments are promoted to double, which is a single precision number
+               on the target, too, see -fshort-double. */
+            const float f = (float)va_arg(ap, double);
+            uint32_t word;
+            memcpy(&word, &f, sizeof(word));
+            pRecord = putWord(pRecord, word, /*noBytes*/ 4u);
+            break;
+        }
+
+        case DLG_ARG_TYPE_STRING:
+        {
+            /* The string is truncated to the space left in the record. This needs to
+               consider the worst case of the remaining arguments, 8 Byte each. */
+            const char * const str = va_arg(ap, const char*);
+            unsigned int noBytesLeft = DLG_MAX_LEN_RECORD - (unsigned)(pRecord - record) - 1u;
+            for(uint32_t at=argTypes>>DLG_NO_BITS_ARG_TYPE; at!=0u; at>>=DLG_NO_BITS_ARG_TYPE)
+                noBytesLeft -= 8u;
+            unsigned int lenStr = str != NULL? strlen(str): 0u;
+            if(lenStr > noBytesLeft)
+                lenStr = noBytesLeft;
+            *pRecord++ = (uint8_t)lenStr;
+            memcpy(pRecord, str, lenStr);
+            pRecord += lenStr;
+            break;
+        }
+
+        default:
+            assert(false);
+        }
+        argTypes >>= DLG_NO_BITS_ARG_TYPE;
+
+    } /* while(All arguments) */
+
+    const unsigned int lenRecord = (unsigned)(pRecord - record);
+    assert(lenRecord <= DLG_MAX_LEN_RECORD);
+    record[0] = DLG_RECORD_START;
+    record[1] = (uint8_t)(lenRecord - 2u);
+    return lenRecord;
+
+} /* End of dlg_encodeRecord */
+
+#else
+
+/**
+ * Put a character into a text buffer, which may be too small.
+ *   @param text
+ * The character is written into this buffer at index * \a pIdx, if at least one more
+ * character still fits behind it.
+ *   @param sizeOfText
+ * The size of \a text in Byte.
+ *   @param pIdx
+ * The index of the character. * \a pIdx is incremented in any case.
+ *   @param c
+ * The character to write.
+ */
+static inline void putChar( char text[]
+                          , unsigned int sizeOfText
+                          , unsigned int * const pIdx
+                          , char c
+                          )
+{
+    if(*pIdx+1u < sizeOfText)
+        text[*pIdx] = c;
+    ++ *pIdx;
+
+} /* End of putChar */
+
+
+/**
+ * Format a float argument with a conversion %f, using f2s_formatFixed() rather than the
+ * much more expensive snprintf(). The flags -, +, space and 0 and the field width are
+ * supported.
+ *   @return
+ * Get the length of the formatted argument, like snprintf() does, or -1 if the
+ * conversion is not supported. The caller needs to use snprintf() in this case.
+ *   @param text
+ * The formatted argument is written into this buffer. It is not zero terminated.
+ *   @param sizeOfText
+ * The size of \a text in Byte. At most \a sizeOfText-1 characters are written.
+ *   @param conversion
+ * The conversion, e.g., "%.3f".
+ *   @param value
+ * The formatted value.
+ */
+static signed int formatFloat( char text[]
+                             , unsigned int sizeOfText
+                             , const char *conversion
+                             , float value
+                             )
+{
+    assert(*conversion == '%');
+    ++ conversion;
+
+    bool leftAlign = false
+       , padWithZeros = false;
+    char signChar = '\0';
+    for(;; ++conversion)
+    {
+        if(*conversion == '-')
+            leftAlign = true;
+        else if(*conversion == '0')
+            padWithZeros = true;
+        else if(*conversion == '+')
+            signChar = '+';
+        else if(*conversion == ' ')
+        {
+            if(signChar == '\0')
+                signChar = ' ';
+        }
+        else
+            break;
+    }
+    unsigned int width = 0u;
+    while(*conversion >= '0'  &&  *conversion <= '9')
+        width = 10u*width + (unsigned)(*conversion++ - '0');
+    unsigned int noDecimals = 6u;
+    if(*conversion == '.')
+    {
+        noDecimals = 0u;
+        ++ conversion;
+        while(*conversion >= '0'  &&  *conversion <= '9'  &&  noDecimals < 100u)
+            noDecimals = 10u*noDecimals + (unsigned)(*conversion++ - '0');
+    }
+    if(conversion[0] != 'f'  ||  conversion[1] != '\0'
+       ||  noDecimals > F2S_MAX_NO_DECIMALS
+      )
+    {
+        return -1;
+    }
+
+    char number[F2S_SIZE_OF_BUF_FIXED(F2S_MAX_NO_DECIMALS)];
+    const unsigned int lenNumber = f2s_formatFixed( number
+                                                  , sizeof(number)
+                                                  , value
+                                                  , noDecimals
+                                                  );
+    const char *pNumber = &number[0];
+    char sign = signChar;
+    if(*pNumber == '-')
+        sign = *pNumber++;
+    const unsigned int lenField = pNumber == &number[0]  &&  sign != '\0'
+                                  ? lenNumber + 1u
+                                  : lenNumber
+                     , noPad = width > lenField? width - lenField: 0u;
+
+    /* Like printf, infinity and NaN are not padded with zeros. */
+    if(leftAlign  ||  number[lenNumber-1u] < '0'  ||  number[lenNumber-1u] > '9')
+        padWithZeros = false;
+
+    unsigned int idx = 0u;
+    if(!leftAlign  &&  !padWithZeros)
+    {
+        for(unsigned int u=0u; u<noPad; ++u)
+            putChar(text, sizeOfText, &idx, ' ');
+    }
+    if(sign != '\0')
+        putChar(text, sizeOfText, &idx, sign);
+    if(padWithZeros)
+    {
+        for(unsigned int u=0u; u<noPad; ++u)
+            putChar(text, sizeOfText, &idx, '0');
+    }
+    while(*pNumber != '\0')
+        putChar(text, sizeOfText, &idx, *pNumber++);
+    if(leftAlign)
+    {
+        for(unsigned int u=0u; u<noPad; ++u)
+            putChar(text, sizeOfText, &idx, ' ');
+    }
+    assert(idx == lenField + noPad);
+
+    return (signed int)idx;
+
+} /* End of formatFloat */
+
+
+/**
+ * Format a message as text on the target. The format string is processed conversion by
+ * conversion with snprintf(), so that float arguments can be passed on as double by
+ * f2d(). The most common float conversion, %f, is done by formatFloat() instead.
+ *   @return
+ * Get the length of the formatted text.
+ *   @param text
+ * The text is written into this buffer of \a sizeOfText characters. It is not zero
+ * terminated.
+ *   @param sizeOfText
+ * The size of \a text in Byte.
+ *   @param fmt
+ * The format string.
+ *   @param argTypes
+ * The types of the arguments, see DLG_ARG_TYPES().
+ *   @param ap
+ * The arguments.
+ */
+static unsigned int formatText( char text[]
+                              , unsigned int sizeOfText
+                              , const char *fmt
+                              , uint32_t argTypes
+                              , va_list ap
+                              )
+{
+    unsigned int lenText = 0u;
+    while(*fmt != '\0'  &&  lenText+1u < sizeOfText)
+    {
+        if(*fmt != '%'  ||  fmt[1] == '%')
+        {
+            text[lenText++] = *fmt;
+            fmt += *fmt == '%'? 2: 1;
+            continue;
+        }
+
+        /* Isolate the conversion and format the next argument with it. */
+        char conversion[16];
+        unsigned int lenConversion = 0u;
+        do
+        {
+            if(lenConversion+1u < sizeof(conversion))
+                conversion[lenConversion++] = *fmt;
+            ++ fmt;
+        }
+        while(*fmt != '\0'  &&  strchr("diouxXcpsfFeEgGaA", *fmt) == NULL);
+        if(*fmt != '\0')
+            conversion[lenConversion++] = *fmt++;
+        conversion[lenConversion] = '\0';
+
+        const unsigned int sizeOfRest = sizeOfText - lenText;
+        signed int noChars;
+        switch(argTypes & ((1u<<DLG_NO_BITS_ARG_TYPE)-1u))
+        {
+        case DLG_ARG_TYPE_INT32:
+            noChars = snprintf(&text[lenText], sizeOfRest, conversion, va_arg(ap, uint32_t));
+            break;
+        case DLG_ARG_TYPE_INT64:
+            noChars = snprintf(&text[lenText], sizeOfRest, conversion, va_arg(ap, uint64_t));
+            break;
+        case DLG_ARG_TYPE_FLOAT:
+        {
+            const float value = (float)va_arg(ap, double);
+            noChars = formatFloat(&text[lenText], sizeOfRest, conversion, value);
+            if(noChars < 0)
+                noChars = snprintf(&text[lenText], sizeOfRest, conversion, f2d(value));
+            break;
+        }
+        case DLG_ARG_TYPE_STRING:
+            noChars = snprintf( &text[lenText], sizeOfRest, conversion
+                              , va_arg(ap, const char*)
+                              );
+            break;
+        default:
+            /* More conversions than arguments. */
+            noChars = 0;
+        }
+        argTypes >>= DLG_NO_BITS_ARG_TYPE;
+
+        if(noChars > 0)
+        {
+            lenText += (unsigned)noChars;
+            if(lenText >= sizeOfText)
+                lenText = sizeOfText - 1u;
+        }
+    } /* while(All characters of the format string) */
+
+    return lenText;
+
+} /* End of formatText */
+#endif
+
+
+/**
+ * Write a formatted message into the serial output. Depending on #DLG_BINARY_LOGGING,
+ * a binary record or the formatted text is written. The function is not called directly
+ * but through macro DLG_LOG().\n
+ *   The function can be called from user and OS context on all cores. It must not be
+ * called before sio_osInitSerialInterface() has completed.
+ *   @param fmt
+ * The format string, see printf().
+ *   @param argTypes
+ * The types of the arguments, see DLG_ARG_TYPES().
+ *   @param ...
+ * The arguments.
+ *   @remark
+ * A record, which doesn't fit into the output buffer, is truncated; see
+ * sio_serialOutNoTruncatedMsgs. The decoder detects most truncated records by comparing
+ * the length byte with the arguments required by the format string and resynchronizes
+ * at the next #DLG_RECORD_START.
+ */
+void dlg_log(const char *fmt, uint32_t argTypes, ...)
+{
+    va_list ap;
+    va_start(ap, argTypes);
+#if DLG_BINARY_LOGGING == 1
+    uint8_t record[DLG_MAX_LEN_RECORD];
+    const unsigned int lenRecord = dlg_encodeRecord(record, fmt, argTypes, ap);
+#else
+    char record[DLG_MAX_LEN_TEXT];
+    const unsigned int lenRecord = formatText(record, sizeof(record), fmt, argTypes, ap);
+#endif
+    va_end(ap);
+
+    writeSerial(record, lenRecord);
+
+} /* End of dlg_log */
@@ -0,0 +1,172 @@
+#ifndef DLG_DEFERREDLOGGING_INCLUDED
+#define DLG_DEFERREDLOGGING_INCLUDED
+/**
+ * @file dlg_deferredLogging.h
+ * Definition of global interface of module dlg_deferredLogging.c
+ *
+ * Copyright (C) 2026 Peter Vranken (mailto:Peter_Vranken@Yahoo.de)
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Include files
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdarg.h>
+
+
+/*
+ * Defines
+ */
+
+/** Binary logging on or off. If on (1), the format strings of DLG_LOG() don't become part
+    of the flash ROM image. The target sends a record with the ID of the format string and
+    the raw values of the arguments and the text is formatted on the host by
+    dlg_decodeLog.exe, see dlg_decodeLog.c_. If off (0), DLG_LOG() prints the text on the
+    target, like printf() does.\n
+      The switch can be set on the compiler command line. */
+#ifndef DLG_BINARY_LOGGING
+# define DLG_BINARY_LOGGING     1
+#endif
+
+/** The name of the linker section, which collects the format strings of DLG_LOG() if
+    #DLG_BINARY_LOGGING is on. The section is not loaded; its contents are dumped from the
+    ELF file into the dictionary of the decoder. The address of a string in the section is
+    its ID. */
+#define DLG_SECTION_FMT_STRINGS ".dlgFmtStrings"
+
+/** The first byte of a binary record. The byte doesn't appear in the ASCII or UTF-8 text,
+    which other code may write into the same serial channel. The decoder can tell records
+    and plain text apart. */
+#define DLG_RECORD_START        0xFFu
+
+/** The maximum length of a binary record in Byte, including start byte, length byte and
+    ID. Longer string arguments are truncated to fit. */
+#define DLG_MAX_LEN_RECORD      128u
+
+/** The maximum number of arguments of DLG_LOG(), besides the format string. */
+#define DLG_MAX_NO_ARGS         8u
+
+/** The type of an argument of DLG_LOG() is encoded in this many bits. */
+#define DLG_NO_BITS_ARG_TYPE    4u
+
+/** Argument type: End of argument list. */
+#define DLG_ARG_TYPE_END        0u
+
+/** Argument type: Integer of up to 32 Bit or a pointer, which is not a string. The
+    argument is sent as 32 Bit word. */
+#define DLG_ARG_TYPE_INT32      1u
+
+/** Argument type: 64 Bit integer. */
+#define DLG_ARG_TYPE_INT64      2u
+
+/** Argument type: float or double. The argument is sent as 32 Bit IEEE 754 single
+    precision number; the target has no other. */
+#define DLG_ARG_TYPE_FLOAT      3u
+
+/** Argument type: Zero terminated string. It is sent as length byte and characters. */
+#define DLG_ARG_TYPE_STRING     4u
+
+/** Get the type of an argument of DLG_LOG() as a compile-time constant. The "+0" applies
+    the usual conversions, so that arrays become pointers and small integers int. */
+#define DLG_ARG_TYPE(arg)                                                                   \
+            _Generic((arg)+0, float: DLG_ARG_TYPE_FLOAT                                     \
+                            , double: DLG_ARG_TYPE_FLOAT                                    \
+                            , char*: DLG_ARG_TYPE_STRING                                    \
+                            , const char*: DLG_ARG_TYPE_STRING                              \
+                            , long long: DLG_ARG_TYPE_INT64                                 \
+                            , unsigned long long: DLG_ARG_TYPE_INT64                        \
+                            , default: DLG_ARG_TYPE_INT32                                   \
+                    )
+
+/* Some helper macros to get the types of all arguments of DLG_LOG() as a single 32 Bit
+   word, four Bit per argument, the first argument in the least significant bits. */
+#define DLG_AT(idx, arg)        ((uint32_t)DLG_ARG_TYPE(arg) << ((idx)*DLG_NO_BITS_ARG_TYPE))
+#define DLG_AT_0()              0u
+#define DLG_AT_1(a)             DLG_AT(0,a)
+#define DLG_AT_2(a,b)           (DLG_AT_1(a) | DLG_AT(1,b))
+#define DLG_AT_3(a,b,c)         (DLG_AT_2(a,b) | DLG_AT(2,c))
+#define DLG_AT_4(a,b,c,d)       (DLG_AT_3(a,b,c) | DLG_AT(3,d))
+#define DLG_AT_5(a,b,c,d,e)     (DLG_AT_4(a,b,c,d) | DLG_AT(4,e))
+#define DLG_AT_6(a,b,c,d,e,f)   (DLG_AT_5(a,b,c,d,e) | DLG_AT(5,f))
+#define DLG_AT_7(a,b,c,d,e,f,g) (DLG_AT_6(a,b,c,d,e,f) | DLG_AT(6,g))
+#define DLG_AT_8(a,b,c,d,e,f,g,h) (DLG_AT_7(a,b,c,d,e,f,g) | DLG_AT(7,h))
+#define DLG_NO_ARGS_(_0,_1,_2,_3,_4,_5,_6,_7,_8,n,...) n
+#define DLG_NO_ARGS(...)        DLG_NO_ARGS_(_0, ##__VA_ARGS__, 8,7,6,5,4,3,2,1,0)
+#define DLG_CAT_(a,b)           a##b
+#define DLG_CAT(a,b)            DLG_CAT_(a,b)
+#define DLG_ARG_TYPES(...)      DLG_CAT(DLG_AT_, DLG_NO_ARGS(__VA_ARGS__))(__VA_ARGS__)
+
+/** The storage class of the format strings of DLG_LOG(). */
+#if DLG_BINARY_LOGGING == 1
+# define DLG_FMT_STRING_STORAGE                                                             \
+            static const char __attribute__((section(DLG_SECTION_FMT_STRINGS), used))
+#else
+# define DLG_FMT_STRING_STORAGE static const char
+#endif
+
+/**
+ * Principal API of the module: Write a formatted message into the serial output. Usage
+ * and format string are the same as for printf() but only a subset of conversions is
+ * supported, see dlg_log(). At most #DLG_MAX_NO_ARGS arguments can be passed.\n
+ *   float arguments are passed as they are, there's no need to wrap them in f2d().\n
+ *   The macro can be used from user and OS code on all cores.
+ *   @param fmt
+ * The format string. It needs to be a string literal.
+ *   @param ...
+ * The arguments as for printf().
+ */
+#define DLG_LOG(fmt, ...)                                                                   \
+            do {                                                                            \
+                DLG_FMT_STRING_STORAGE dlg_fmt_[] = fmt;                                    \
+                dlg_log(dlg_fmt_, DLG_ARG_TYPES(__VA_ARGS__), ##__VA_ARGS__);               \
+            } while(false)
+
+
+/*
+ * Global type definitions
+ */
+
+
+/*
+ * Global data declarations
+ */
+
+
+/*
+ * Global prototypes
+ */
+
+/** Write a formatted message. Don't call directly, use DLG_LOG(). */
+void dlg_log(const char *fmt, uint32_t argTypes, ...)
+                                                __attribute__((format(printf, 1, 3)));
+
+#if DLG_BINARY_LOGGING == 1
+/** Encode a message as binary record. */
+unsigned int dlg_encodeRecord( uint8_t record[DLG_MAX_LEN_RECORD]
+                             , const char *fmt
+                             , uint32_t argTypes
+                             , va_list ap
+                             );
+#endif
+
+/*
+ * Global inline functions
+ */
+
+
+#endif  /* DLG_DEFERREDLOGGING_INCLUDED */
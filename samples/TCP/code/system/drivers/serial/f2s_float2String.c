@@ -0,0 +1,810 @@
+/**
+ * @file f2s_float2String.c
+ * Conversion of single precision floating point numbers into text. The functions are
+ * alternatives to snprintf() with conversions %f and %g.\n
+ *   Formatting floats with printf costs a lot on our target: The code is compiled with
+ * -fshort-double, the float needs to be promoted to a true double by f2d() and the C
+ * library formats the double with its generic, emulated 64 Bit floating point arithmetic.
+ * This module works on the 32 Bit representation of the float and uses integer arithmetic
+ * only, mostly 32 Bit operations.\n
+ *   f2s_formatShortest() produces the shortest decimal number, which is read back as the
+ * original float. The implementation follows the Ryu algorithm of Ulf Adams
+ * (https://github.com/ulfjack/ryu, Apache License 2.0 or Boost Software License 1.0),
+ * specialized for float.\n
+ *   f2s_formatFixed() formats the exact binary value with a given number of decimals and
+ * correct rounding, like printf's %.nf does.\n
+ *   The module doesn't depend on the hardware. It can be compiled and tested on the host,
+ * see test_float2String.c_.
+ *
+ * Copyright (C) 2026 Peter Vranken (mailto:Peter_Vranken@Yahoo.de)
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+/* Module interface
+ *   f2s_formatShortest
+ *   f2s_formatFixed
+ * Local functions
+ *   pow5Bits
+ *   log10Pow2
+ *   log10Pow5
+ *   isMultipleOfPow5
+ *   isMultipleOfPow2
+ *   mulShift
+ *   getShortestDecimal
+ *   writeUInt32Backwards
+ *   writeUInt64Backwards
+ *   writeUInt128Backwards
+ *   writeSpecialValue
+ *   copyResult
+ */
+
+/*
+ * Include files
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <assert.h>
+
+#include "f2s_float2String.h"
+
+
+/*
+ * Defines
+ */
+
+/** The number of explicitly stored bits of the mantissa of a float. */
+#define MANTISSA_BITS       23u
+
+/** The bias of the exponent of a float. */
+#define EXPONENT_BIAS       127
+
+/** The number of significant bits of the table entries of #_pow5InvSplitAry. */
+#define POW5_INV_BITCOUNT   59
+
+/** The number of significant bits of the table entries of #_pow5SplitAry. */
+#define POW5_BITCOUNT       61
+
+/** The range of decimal exponents, which are formatted in positional notation by
+    f2s_formatShortest(). Other values use the scientific notation. */
+#define MIN_EXP_POSITIONAL  (-5)
+#define MAX_EXP_POSITIONAL  8
+
+
+/*
+ * Local type definitions
+ */
+
+
+/*
+ * Local prototypes
+ */
+
+
+/*
+ * Data definitions
+ */
+
+/** The table of 2^k/5^q, rounded up, for q=0..30. k is chosen such that all entries have
+    #POW5_INV_BITCOUNT significant bits. */
+static const uint64_t _pow5InvSplitAry[31] =
+{
+    0x0800000000000001ull, 0x0666666666666667ull, 0x051EB851EB851EB9ull,
+    0x04189374BC6A7EFAull, 0x068DB8BAC710CB2Aull, 0x053E2D6238DA3C22ull,
+    0x0431BDE82D7B634Eull, 0x06B5FCA6AF2BD216ull, 0x055E63B88C230E78ull,
+    0x044B82FA09B5A52Dull, 0x06DF37F675EF6EAEull, 0x057F5FF85E592558ull,
+    0x0465E6604B7A8447ull, 0x0709709A125DA071ull, 0x05A126E1A84AE6C1ull,
+    0x0480EBE7B9D58567ull, 0x0734ACA5F6226F0Bull, 0x05C3BD5191B525A3ull,
+    0x049C97747490EAE9ull, 0x0760F253EDB4AB0Eull, 0x05E72843249088D8ull,
+    0x04B8ED0283A6D3E0ull, 0x078E480405D7B966ull, 0x060B6CD004AC9452ull,
+    0x04D5F0A66A23A9DBull, 0x07BCB43D769F762Bull, 0x063090312BB2C4EFull,
+    0x04F3A68DBC8F03F3ull, 0x07EC3DAF94180651ull, 0x065697BFA9ACD1DAull,
+    0x051212FFBAF0A7E2ull,
+};
+
+/** The table of 5^i for i=0..46, truncated to the #POW5_BITCOUNT most significant
+    bits. */
+static const uint64_t _pow5SplitAry[47] =
+{
+    0x1000000000000000ull, 0x1400000000000000ull, 0x1900000000000000ull,
+    0x1F40000000000000ull, 0x1388000000000000ull, 0x186A000000000000ull,
+    0x1E84800000000000ull, 0x1312D00000000000ull, 0x17D7840000000000ull,
+    0x1DCD650000000000ull, 0x12A05F2000000000ull, 0x174876E800000000ull,
+    0x1D1A94A200000000ull, 0x12309CE540000000ull, 0x16BCC41E90000000ull,
+    0x1C6BF52634000000ull, 0x11C37937E0800000ull, 0x16345785D8A00000ull,
+    0x1BC16D674EC80000ull, 0x1158E460913D0000ull, 0x15AF1D78B58C4000ull,
+    0x1B1AE4D6E2EF5000ull, 0x10F0CF064DD59200ull, 0x152D02C7E14AF680ull,
+    0x1A784379D99DB420ull, 0x108B2A2C28029094ull, 0x14ADF4B7320334B9ull,
+    0x19D971E4FE8401E7ull, 0x1027E72F1F128130ull, 0x1431E0FAE6D7217Cull,
+    0x193E5939A08CE9DBull, 0x1F8DEF8808B02452ull, 0x13B8B5B5056E16B3ull,
+    0x18A6E32246C99C60ull, 0x1ED09BEAD87C0378ull, 0x13426172C74D822Bull,
+    0x1812F9CF7920E2B6ull, 0x1E17B84357691B64ull, 0x12CED32A16A1B11Eull,
+    0x178287F49C4A1D66ull, 0x1D6329F1C35CA4BFull, 0x125DFA371A19E6F7ull,
+    0x16F578C4E0A060B5ull, 0x1CB2D6F618C878E3ull, 0x11EFC659CF7D4B8Dull,
+    0x166BB7F0435C9E71ull, 0x1C06A5EC5433C60Dull,
+};
+
+/** The powers of ten, which fit into 32 Bit. */
+static const uint32_t _pow10Ary[10] =
+{
+    1u, 10u, 100u, 1000u, 10000u, 100000u, 1000000u, 10000000u, 100000000u, 1000000000u,
+};
+
+
+/*
+ * Function implementation
+ */
+
+/**
+ * Get the number of bits of 5^e, or 1 for e=0.
+ *   @return
+ * Get ceil(log2(5^e)) for 1 <= e <= 3528.
+ *   @param e
+ * The exponent.
+ */
+static inline int32_t pow5Bits(int32_t e)
+{
+    assert(e >= 0  &&  e <= 3528);
+    return (int32_t)(((uint32_t)e * 1217359u) >> 19) + 1;
+
+} /* End of pow5Bits */
+
+
+
+
+/**
+ * Get floor(log10(2^e)) for 0 <= e <= 1650.
+ */
+static inline uint32_t log10Pow2(int32_t e)
+{
+    assert(e >= 0  &&  e <= 1650);
+    return ((uint32_t)e * 78913u) >> 18;
+
+} /* End of log10Pow2 */
+
+
+
+
+/**
+ * Get floor(log10(5^e)) for 0 <= e <= 2620.
+ */
+static inline uint32_t log10Pow5(int32_t e)
+{
+    assert(e >= 0  &&  e <= 2620);
+    return ((uint32_t)e * 732923u) >> 20;
+
+} /* End of log10Pow5 */
+
+
+
+
+/**
+ * Check if a number is divisible by 5^p.
+ *   @return
+ * Get \a true if \a value is a multiple of 5^p.
+ *   @param value
+ * The checked number. Must not be zero.
+ *   @param p
+ * The power of five.
+ */
+static bool isMultipleOfPow5(uint32_t value, uint32_t p)
+{
+    assert(value != 0u);
+    uint32_t noFactors = 0u;
+    while(value % 5u == 0u)
+    {
+        value /= 5u;
+        ++ noFactors;
+    }
+    return noFactors >= p;
+
+} /* End of isMultipleOfPow5 */
+
+
+
+
+/**
+ * Check if a number is divisible by 2^p, 0 <= p < 32.
+ */
+static inline bool isMultipleOfPow2(uint32_t value, uint32_t p)
+{
+    assert(p < 32u);
+    return (value & ((1u << p) - 1u)) == 0u;
+
+} /* End of isMultipleOfPow2 */
+
+
+
+
+/**
+ * Multiply a 32 Bit number with a 64 Bit factor and shift the 96 Bit product to the
+ * right.
+ *   @return
+ * Get the 32 Bit result (m * factor) >> shift.
+ *   @param m
+ * The 32 Bit number.
+ *   @param factor
+ * The 64 Bit factor.
+ *   @param shift
+ * The number of bits to shift. Needs to be in the range 32..63.
+ */
+static inline uint32_t mulShift(uint32_t m, uint64_t factor, int32_t shift)
+{
+    assert(shift > 32  &&  shift < 64);
+    const uint64_t bits0 = (uint64_t)m * (uint32_t)factor
+                 , bits1 = (uint64_t)m * (uint32_t)(factor >> 32)
+                 , sum = (bits0 >> 32) + bits1;
+    return (uint32_t)(sum >> (shift - 32));
+
+} /* End of mulShift */
+
+
+
+
+/**
+ * Find the shortest decimal representation of a positive, finite float, which still
+ * identifies the float. Among several candidates with the same number of digits, the one
+ * closest to the binary value is chosen.
+ *   @return
+ * Get the decimal digits as an integer number d, the value is d*10^e10. d has nine or
+ * less decimal digits.
+ *   @param ieeeMantissa
+ * The 23 Bit mantissa field of the float.
+ *   @param ieeeExponent
+ * The 8 Bit exponent field of the float. The value 255 is not permitted. The float must
+ * not be zero.
+ *   @param pE10
+ * The decimal exponent e10 is returned in * \a pE10.
+ */
+static uint32_t getShortestDecimal( uint32_t ieeeMantissa
+                                  , uint32_t ieeeExponent
+                                  , int32_t * const pE10
+                                  )
+{
+    assert(ieeeExponent < 255u  &&  (ieeeExponent != 0u  ||  ieeeMantissa != 0u));
+
+    /* The value is m2 * 2^e2. We subtract two from the exponent, so that we have room to
+       represent the halfway points to the neighbouring floats as integers. */
+    int32_t e2;
+    uint32_t m2;
+    if(ieeeExponent == 0u)
+    {
+        e2 = 1 - EXPONENT_BIAS - (int32_t)MANTISSA_BITS - 2;
+        m2 = ieeeMantissa;
+    }
+    else
+    {
+        e2 = (int32_t)ieeeExponent - EXPONENT_BIAS - (int32_t)MANTISSA_BITS - 2;
+        m2 = (1u << MANTISSA_BITS) | ieeeMantissa;
+    }
+
+    /* The IEEE rounding mode "to nearest even" lets the halfway points belong to the
+       interval of the float if its mantissa is even. */
+    const bool acceptBounds = (m2 & 1u) == 0u;
+
+    /* The value and its rounding interval [mm, mp], all scaled by 4. The lower bound is
+       closer if the mantissa is a power of two (but not for the smallest normal
+       exponent). */
+    const uint32_t mv = 4u * m2
+                 , mp = 4u * m2 + 2u
+                 , mmShift = ieeeMantissa != 0u  ||  ieeeExponent <= 1u? 1u: 0u
+                 , mm = 4u * m2 - 1u - mmShift;
+
+    /* Convert all three to decimal numbers vr, vp and vm with a common exponent e10. The
+       conversion is done with a precision, which safely separates the interval bounds. */
+    uint32_t vr, vp, vm;
+    int32_t e10;
+    bool vmIsTrailingZeros = false
+       , vrIsTrailingZeros = false;
+    uint32_t lastRemovedDigit = 0u;
+    if(e2 >= 0)
+    {
+        const uint32_t q = log10Pow2(e2);
+        e10 = (int32_t)q;
+        const int32_t k = POW5_INV_BITCOUNT + pow5Bits((int32_t)q) - 1
+                    , i = -e2 + (int32_t)q + k;
+        assert(q < sizeof(_pow5InvSplitAry)/sizeof(_pow5InvSplitAry[0]));
+        vr = mulShift(mv, _pow5InvSplitAry[q], i);
+        vp = mulShift(mp, _pow5InvSplitAry[q], i);
+        vm = mulShift(mm, _pow5InvSplitAry[q], i);
+        if(q != 0u  &&  (vp - 1u) / 10u <= vm / 10u)
+        {
+            /* We need to know the one removed digit even if the loop below won't run. */
+            const int32_t l = POW5_INV_BITCOUNT + pow5Bits((int32_t)(q - 1u)) - 1;
+            lastRemovedDigit = mulShift( mv
+                                       , _pow5InvSplitAry[q - 1u]
+                                       , -e2 + (int32_t)q - 1 + l
+                                       )
+                               % 10u;
+        }
+        if(q <= 9u)
+        {
+            /* Only one of mp, mv and mm can be a multiple of 5, if any. */
+            if(mv % 5u == 0u)
+                vrIsTrailingZeros = isMultipleOfPow5(mv, q);
+            else if(acceptBounds)
+                vmIsTrailingZeros = isMultipleOfPow5(mm, q);
+            else if(isMultipleOfPow5(mp, q))
+                -- vp;
+        }
+    }
+    else
+    {
+        const uint32_t q = log10Pow5(-e2);
+        e10 = (int32_t)q + e2;
+        const int32_t i = -e2 - (int32_t)q
+                    , k = pow5Bits(i) - POW5_BITCOUNT;
+        int32_t j = (int32_t)q - k;
+        assert((uint32_t)i < sizeof(_pow5SplitAry)/sizeof(_pow5SplitAry[0]));
+        vr = mulShift(mv, _pow5SplitAry[i], j);
+        vp = mulShift(mp, _pow5SplitAry[i], j);
+        vm = mulShift(mm, _pow5SplitAry[i], j);
+        if(q != 0u  &&  (vp - 1u) / 10u <= vm / 10u)
+        {
+            j = (int32_t)q - 1 - (pow5Bits(i + 1) - POW5_BITCOUNT);
+            lastRemovedDigit = mulShift(mv, _pow5SplitAry[i + 1], j) % 10u;
+        }
+        if(q <= 1u)
+        {
+            /* mv = 4 * m2 has at least two trailing zero bits. */
+            vrIsTrailingZeros = true;
+            if(acceptBounds)
+                vmIsTrailingZeros = mmShift == 1u;
+            else
+                -- vp;
+        }
+        else if(q < 31u)
+            vrIsTrailingZeros = isMultipleOfPow2(mv, q - 1u);
+    }
+
+    /* Remove as many digits as possible, such that the result is still in the rounding
+       interval. */
+    int32_t noRemovedDigits = 0;
+    uint32_t output;
+    if(vmIsTrailingZeros  ||  vrIsTrailingZeros)
+    {
+        /* Rare case: Exact decimal representations need the general loop. */
+        while(vp / 10u > vm / 10u)
+        {
+            vmIsTrailingZeros &= vm % 10u == 0u;
+            vrIsTrailingZeros &= lastRemovedDigit == 0u;
+            lastRemovedDigit = vr % 10u;
+            vr /= 10u;
+            vp /= 10u;
+            vm /= 10u;
+            ++ noRemovedDigits;
+        }
+        if(vmIsTrailingZeros)
+        {
+            while(vm % 10u == 0u)
+            {
+                vrIsTrailingZeros &= lastRemovedDigit == 0u;
+                lastRemovedDigit = vr % 10u;
+                vr /= 10u;
+                vp /= 10u;
+                vm /= 10u;
+                ++ noRemovedDigits;
+            }
+        }
+        if(vrIsTrailingZeros  &&  lastRemovedDigit == 5u  &&  vr % 2u == 0u)
+        {
+            /* Exactly halfway: Round to even. */
+            lastRemovedDigit = 4u;
+        }
+        output = vr;
+        if((vr == vm  &&  (!acceptBounds  ||  !vmIsTrailingZeros))
+           ||  lastRemovedDigit >= 5u
+          )
+        {
+            ++ output;
+        }
+    }
+    else
+    {
+        /* Common case. */
+        while(vp / 10u > vm / 10u)
+        {
+            lastRemovedDigit = vr % 10u;
+            vr /= 10u;
+            vp /= 10u;
+            vm /= 10u;
+            ++ noRemovedDigits;
+        }
+        output = vr;
+        if(vr == vm  ||  lastRemovedDigit >= 5u)
+            ++ output;
+    }
+
+    *pE10 = e10 + noRemovedDigits;
+    return output;
+
+} /* End of getShortestDecimal */
+
+
+
+
+/**
+ * Write the decimal digits of a 32 Bit number into a character buffer. The digits are
+ * written backwards, from the end of the buffer to its beginning.
+ *   @return
+ * Get the pointer to the first, most significant digit.
+ *   @param pEnd
+ * The character behind the last, least significant digit.
+ *   @param u
+ * The number to write.
+ *   @param minNoDigits
+ * The minimum number of digits. The number is padded with leading zeros if required.
+ */
+static char *writeUInt32Backwards(char *pEnd, uint32_t u, unsigned int minNoDigits)
+{
+    unsigned int noDigits = 0u;
+    do
+    {
+        *--pEnd = (char)('0' + u % 10u);
+        u /= 10u;
+        ++ noDigits;
+    }
+    while(u != 0u  ||  noDigits < minNoDigits);
+
+    return pEnd;
+
+} /* End of writeUInt32Backwards */
+
+
+
+
+/**
+ * Write the decimal digits of a 64 Bit number into a character buffer, see
+ * writeUInt32Backwards(). The operations are done with 32 Bit arithmetics as far as
+ * possible.
+ */
+static char *writeUInt64Backwards(char *pEnd, uint64_t u, unsigned int minNoDigits)
+{
+    while(u > UINT32_MAX)
+    {
+        const uint64_t q = u / 1000000000u;
+        pEnd = writeUInt32Backwards(pEnd, (uint32_t)(u - q*1000000000u), 9u);
+        u = q;
+        minNoDigits = minNoDigits > 9u? minNoDigits - 9u: 0u;
+    }
+    return writeUInt32Backwards(pEnd, (uint32_t)u, minNoDigits);
+
+} /* End of writeUInt64Backwards */
+
+
+
+
+/**
+ * Write the decimal digits of a 128 Bit number into a character buffer, see
+ * writeUInt32Backwards().
+ *   @param pEnd
+ * The character behind the last, least significant digit.
+ *   @param limbAry
+ * The number as four 32 Bit words, least significant word first. The contents of the
+ * array are destroyed.
+ */
+static char *writeUInt128Backwards(char *pEnd, uint32_t limbAry[4])
+{
+    unsigned int noLimbs = 4u;
+    while(noLimbs > 2u  &&  limbAry[noLimbs-1u] == 0u)
+        -- noLimbs;
+
+    /* Divide by 10^9 until the rest fits into 64 Bit. */
+    while(noLimbs > 2u)
+    {
+        uint64_t rem = 0u;
+        for(unsigned int idxLimb=noLimbs; idxLimb-- > 0u; )
+        {
+            const uint64_t dividend = (rem << 32) | limbAry[idxLimb];
+            limbAry[idxLimb] = (uint32_t)(dividend / 1000000000u);
+            rem = dividend - (uint64_t)limbAry[idxLimb]*1000000000u;
+        }
+        pEnd = writeUInt32Backwards(pEnd, (uint32_t)rem, 9u);
+        if(limbAry[noLimbs-1u] == 0u)
+            -- noLimbs;
+    }
+    return writeUInt64Backwards(pEnd, ((uint64_t)limbAry[1] << 32) | limbAry[0], 1u);
+
+} /* End of writeUInt128Backwards */
+
+
+
+
+/**
+ * Write the text for infinity or NaN.
+ *   @return
+ * Get the pointer behind the written text.
+ *   @param p
+ * The text is written to this pointer. Four characters need to fit.
+ *   @param ieeeMantissa
+ * The 23 Bit mantissa field of the float, which has the exponent field 255.
+ */
+static char *writeSpecialValue(char *p, uint32_t ieeeMantissa)
+{
+    const char * const text = ieeeMantissa != 0u? "nan": "inf";
+    memcpy(p, text, 3u);
+    return p + 3;
+
+} /* End of writeSpecialValue */
+
+
+
+
+/**
+ * Copy the result of a conversion into the buffer of the caller. The copy is truncated if
+ * required. This yields the behavior of snprintf().
+ *   @return
+ * Get \a lenResult.
+ *   @param buf
+ * The buffer of the caller.
+ *   @param sizeOfBuf
+ * The size of \a buf in Byte.
+ *   @param result
+ * The result of the conversion. It doesn't need to be zero terminated.
+ *   @param lenResult
+ * The number of characters of \a result.
+ */
+static unsigned int copyResult( char buf[]
+                              , unsigned int sizeOfBuf
+                              , const char *result
+                              , unsigned int lenResult
+                              )
+{
+    if(sizeOfBuf > 0u)
+    {
+        const unsigned int noChars = lenResult < sizeOfBuf? lenResult: sizeOfBuf-1u;
+        memcpy(buf, result, noChars);
+        buf[noChars] = '\0';
+    }
+    return lenResult;
+
+} /* End of copyResult */
+
+
+
+
+/**
+ * Format a float with the least number of significant digits, which are required to
+ * read back exactly the same float, e.g., by strtof(). If there are several numbers with
+ * this number of digits then the one closest to the value of the float is taken.\n
+ *   Values with a decimal exponent in the range -5..8 are formatted in positional
+ * notation, e.g., "0.001", "12.5" or "100000000". Other values are formatted in
+ * scientific notation with at least two digits of the exponent, e.g., "1e+10" or
+ * "-1.17549435e-38". The special values are "inf", "-inf" and "nan".
+ *   @return
+ * Get the length of the result, without the terminating zero byte. The function has the
+ * same behavior as snprintf(): If the return value is not less than \a sizeOfBuf then the
+ * result has been truncated.
+ *   @param buf
+ * The zero terminated result is written into this buffer. A buffer of
+ * #F2S_SIZE_OF_BUF_SHORTEST Byte is sufficient for all values.
+ *   @param sizeOfBuf
+ * The size of \a buf in Byte. If it is zero then nothing is written.
+ *   @param value
+ * The formatted value.
+ */
+unsigned int f2s_formatShortest(char buf[], unsigned int sizeOfBuf, float value)
+{
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    const uint32_t ieeeMantissa = bits & ((1u << MANTISSA_BITS) - 1u)
+                 , ieeeExponent = (bits >> MANTISSA_BITS) & 0xFFu;
+
+    char result[F2S_SIZE_OF_BUF_SHORTEST];
+    char *p = &result[0];
+    if((bits & 0x80000000u) != 0u)
+        *p++ = '-';
+
+    if(ieeeExponent == 0xFFu)
+        p = writeSpecialValue(p, ieeeMantissa);
+    else if(ieeeExponent == 0u  &&  ieeeMantissa == 0u)
+        *p++ = '0';
+    else
+    {
+        int32_t e10;
+        const uint32_t output = getShortestDecimal(ieeeMantissa, ieeeExponent, &e10);
+
+        char digitAry[9];
+        const char * const pDigits = writeUInt32Backwards(&digitAry[9], output, 1u);
+        const unsigned int noDigits = (unsigned)(&digitAry[9] - pDigits);
+
+        /* The decimal exponent of the first digit. */
+        const int32_t exp = e10 + (int32_t)noDigits - 1;
+        if(exp >= 0  &&  exp <= MAX_EXP_POSITIONAL)
+        {
+            /* Positional notation, value >= 1. */
+            const unsigned int noDigitsInt = (unsigned)exp + 1u;
+            if(noDigits <= noDigitsInt)
+            {
+                memcpy(p, pDigits, noDigits);
+                p += noDigits;
+                memset(p, '0', noDigitsInt - noDigits);
+                p += noDigitsInt - noDigits;
+            }
+            else
+            {
+                memcpy(p, pDigits, noDigitsInt);
+                p += noDigitsInt;
+                *p++ = '.';
+                memcpy(p, pDigits + noDigitsInt, noDigits - noDigitsInt);
+                p += noDigits - noDigitsInt;
+            }
+        }
+        else if(exp < 0  &&  exp >= MIN_EXP_POSITIONAL)
+        {
+            /* Positional notation, value < 1. */
+            const unsigned int noLeadingZeros = (unsigned)(-exp - 1);
+            *p++ = '0';
+            *p++ = '.';
+            memset(p, '0', noLeadingZeros);
+            p += noLeadingZeros;
+            memcpy(p, pDigits, noDigits);
+            p += noDigits;
+        }
+        else
+        {
+            /* Scientific notation. */
+            *p++ = pDigits[0];
+            if(noDigits > 1u)
+            {
+                *p++ = '.';
+                memcpy(p, pDigits + 1, noDigits - 1u);
+                p += noDigits - 1u;
+            }
+            *p++ = 'e';
+            *p++ = exp < 0? '-': '+';
+            const uint32_t absExp = (uint32_t)(exp < 0? -exp: exp);
+            assert(absExp < 100u);
+            *p++ = (char)('0' + absExp / 10u);
+            *p++ = (char)('0' + absExp % 10u);
+        }
+    }
+
+    const unsigned int lenResult = (unsigned)(p - &result[0]);
+    assert(lenResult < sizeof(result));
+    return copyResult(buf, sizeOfBuf, result, lenResult);
+
+} /* End of f2s_formatShortest */
+
+
+
+
+/**
+ * Format a float in positional notation with a fixed number of decimals. The result is
+ * the same as got from snprintf() with conversion "%.nf", given that the float argument
+ * would properly be passed to snprintf() as double: The exact binary value of the float
+ * is correctly rounded, halfway cases are rounded to even.\n
+ *   The special values are "inf", "-inf" and "nan". Like with printf, negative values,
+ * which are rounded to zero, keep their sign, e.g., "-0.00".
+ *   @return
+ * Get the length of the result, without the terminating zero byte. The function has the
+ * same behavior as snprintf(): If the return value is not less than \a sizeOfBuf then the
+ * result has been truncated.
+ *   @param buf
+ * The zero terminated result is written into this buffer. A buffer of
+ * #F2S_SIZE_OF_BUF_FIXED(\a noDecimals) Byte is sufficient for all values.
+ *   @param sizeOfBuf
+ * The size of \a buf in Byte. If it is zero then nothing is written.
+ *   @param value
+ * The formatted value.
+ *   @param noDecimals
+ * The number of digits behind the decimal point. If zero then no decimal point is
+ * written. The supported range is 0..#F2S_MAX_NO_DECIMALS. Larger values are limited
+ * to the maximum.
+ */
+unsigned int f2s_formatFixed( char buf[]
+                            , unsigned int sizeOfBuf
+                            , float value
+                            , unsigned int noDecimals
+                            )
+{
+    if(noDecimals > F2S_MAX_NO_DECIMALS)
+        noDecimals = F2S_MAX_NO_DECIMALS;
+
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    const uint32_t ieeeMantissa = bits & ((1u << MANTISSA_BITS) - 1u)
+                 , ieeeExponent = (bits >> MANTISSA_BITS) & 0xFFu;
+    const bool isNegative = (bits & 0x80000000u) != 0u;
+
+    /* The result is composed backwards, from the last decimal to the sign. */
+    char result[F2S_SIZE_OF_BUF_FIXED(F2S_MAX_NO_DECIMALS)];
+    char * const pEnd = &result[sizeof(result)];
+    char *p;
+    if(ieeeExponent == 0xFFu)
+    {
+        p = pEnd - 3;
+        writeSpecialValue(p, ieeeMantissa);
+    }
+    else
+    {
+        /* The value is m2 * 2^e2. */
+        int32_t e2;
+        uint32_t m2;
+        if(ieeeExponent == 0u)
+        {
+            e2 = 1 - EXPONENT_BIAS - (int32_t)MANTISSA_BITS;
+            m2 = ieeeMantissa;
+        }
+        else
+        {
+            e2 = (int32_t)ieeeExponent - EXPONENT_BIAS - (int32_t)MANTISSA_BITS;
+            m2 = (1u << MANTISSA_BITS) | ieeeMantissa;
+        }
+
+        p = pEnd;
+        if(e2 >= 0)
+        {
+            /* The value is an integer, up to 128 Bit. All decimals are zero. */
+            p -= noDecimals;
+            memset(p, '0', noDecimals);
+            if(noDecimals > 0u)
+                *--p = '.';
+
+            uint32_t limbAry[4] = {0u, 0u, 0u, 0u};
+            const unsigned int idxLimb = (unsigned)e2 / 32u
+                             , shift = (unsigned)e2 % 32u;
+            assert(idxLimb < 4u);
+            limbAry[idxLimb] = m2 << shift;
+            if(shift > 0u  &&  idxLimb < 3u)
+                limbAry[idxLimb+1u] = m2 >> (32u - shift);
+            p = writeUInt128Backwards(p, limbAry);
+        }
+        else
+        {
+            /* The value scaled by 10^noDecimals is m2 * 10^noDecimals / 2^-e2. The
+               product has less than 54 Bit. We round it to the nearest integer. Shifting
+               60 or more bits to the right always yields less than one half. */
+            const uint64_t m10 = (uint64_t)m2 * _pow10Ary[noDecimals];
+            const unsigned int shift = (unsigned)-e2;
+            uint64_t n = 0u;
+            if(shift < 60u)
+            {
+                n = m10 >> shift;
+                const uint64_t rem = m10 & ((1ull << shift) - 1u)
+                             , half = 1ull << (shift - 1u);
+                if(rem > half  ||  (rem == half  &&  (n & 1u) != 0u))
+                    ++ n;
+            }
+
+            /* Split integer part and decimals. Mostly, 32 Bit operations will do. */
+            uint64_t intPart;
+            uint32_t decimals;
+            if(n <= UINT32_MAX)
+            {
+                intPart = (uint32_t)n / _pow10Ary[noDecimals];
+                decimals = (uint32_t)n - (uint32_t)intPart * _pow10Ary[noDecimals];
+            }
+            else
+            {
+                intPart = n / _pow10Ary[noDecimals];
+                decimals = (uint32_t)(n - intPart * _pow10Ary[noDecimals]);
+            }
+            if(noDecimals > 0u)
+            {
+                p = writeUInt32Backwards(p, decimals, noDecimals);
+                *--p = '.';
+            }
+            p = writeUInt64Backwards(p, intPart, 1u);
+        }
+    }
+
+    if(isNegative)
+        *--p = '-';
+
+    assert(p >= &result[0]);
+    return copyResult(buf, sizeOfBuf, p, (unsigned)(pEnd - p));
+
+} /* End of f2s_formatFixed */
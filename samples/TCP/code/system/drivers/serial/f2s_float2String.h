@@ -0,0 +1,79 @@
+#ifndef F2S_FLOAT2STRING_INCLUDED
+#define F2S_FLOAT2STRING_INCLUDED
+/**
+ * @file f2s_float2String.h
+ * Definition of global interface of module f2s_float2String.c
+ *
+ * Copyright (C) 2026 Peter Vranken (mailto:Peter_Vranken@Yahoo.de)
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Include files
+ */
+
+#include <stdint.h>
+
+
+/*
+ * Defines
+ */
+
+/** The size of a buffer in Byte, which can hold any result of f2s_formatShortest(),
+    including the terminating zero byte. The longest results have 16 characters; these
+    are negative values between 1e-5 and 1e-4, which require nine digits. */
+#define F2S_SIZE_OF_BUF_SHORTEST    17u
+
+/** The maximum number of decimals, which are supported by f2s_formatFixed(). The
+    limitation lets the computation of the decimals get along with 64 Bit integers. */
+#define F2S_MAX_NO_DECIMALS         9u
+
+/** The size of a buffer in Byte, which can hold any result of f2s_formatFixed(),
+    including the terminating zero byte. The longest results are got for -FLT_MAX, which
+    has 39 digits before the decimal point. */
+#define F2S_SIZE_OF_BUF_FIXED(noDecimals)   (1u+39u+1u+(noDecimals)+1u)
+
+
+/*
+ * Global type definitions
+ */
+
+
+/*
+ * Global data declarations
+ */
+
+
+/*
+ * Global prototypes
+ */
+
+/** Format a float with the least number of digits, which still identify the value. */
+unsigned int f2s_formatShortest(char buf[], unsigned int sizeOfBuf, float value);
+
+/** Format a float with a fixed number of decimals, like printf's %.nf. */
+unsigned int f2s_formatFixed( char buf[]
+                            , unsigned int sizeOfBuf
+                            , float value
+                            , unsigned int noDecimals
+                            );
+
+
+/*
+ * Global inline functions
+ */
+
+
+#endif  /* F2S_FLOAT2STRING_INCLUDED */
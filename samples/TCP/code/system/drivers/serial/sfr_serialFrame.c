@@ -0,0 +1,330 @@
+/**
+ * @file sfr_serialFrame.c
+ * Framing of binary data for the serial channel. The payload of a frame is protected by a
+ * CRC and the payload with CRC is COBS encoded (Consistent Overhead Byte Stuffing). The
+ * encoded frame doesn't contain any zero byte and the zero byte is used as delimiter of
+ * frames. The receiver can synchronize with the stream at any time and a corrupted frame
+ * is rejected as a whole.\n
+ *   The layout in the serial stream is:\n
+ *   - #SFR_DELIMITER\n
+ *   - COBS(payload, CRC), the CRC-16/CCITT (polynomial 0x1021, initial value 0xFFFF) of
+ * the payload, most significant byte first\n
+ *   - #SFR_DELIMITER\n
+ *   The leading delimiter ends anything, which may precede the frame in the stream, e.g.,
+ * the rest of an earlier, truncated frame. Because text output doesn't contain zero bytes,
+ * frames and text can be mixed in the same serial channel. A receiver can tell them
+ * apart: A zero byte opens a frame, the next zero byte closes it, unless the frame would be
+ * empty. Then it's the leading delimiter of the next frame.\n
+ *   The payload is gathered from a list of segments, which are encoded in a single pass
+ * directly from the memory of the client code into the ring buffer of the serial output.
+ * There's no intermediate copy of the frame.\n
+ *   The module doesn't depend on the hardware. It can be compiled and tested on the host,
+ * see test_serialFrame.c_.
+ *
+ * Copyright (C) 2026 Peter Vranken (mailto:Peter_Vranken@Yahoo.de)
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+/* Module interface
+ *   sfr_crc16
+ *   sfr_getLenPayload
+ *   sfr_encodeFrame
+ *   sfr_decodeFrame
+ * Local functions
+ *   encodeByte
+ */
+
+/*
+ * Include files
+ */
+
+#include <stdlib.h>
+#include <assert.h>
+
+#include "sfr_serialFrame.h"
+
+
+/*
+ * Defines
+ */
+
+/** The maximum COBS code byte. It stands for 254 non-zero bytes, which are not followed
+    by a zero byte. */
+#define COBS_MAX_CODE       0xFFu
+
+
+/*
+ * Local type definitions
+ */
+
+/** The state of the COBS encoder. */
+typedef struct encoder_t
+{
+    /** The ring buffer to write to. */
+    uint8_t *ringBuf;
+
+    /** The mask of the index bits of the ring buffer. */
+    uint32_t idxMask;
+
+    /** The free running index of the next byte to write. */
+    uint32_t idxWr;
+
+    /** The free running index of the code byte of the current block. */
+    uint32_t idxCode;
+
+    /** The code of the current block, i.e. one more than its number of data bytes. */
+    unsigned int code;
+
+} encoder_t;
+
+
+/*
+ * Local prototypes
+ */
+
+
+/*
+ * Data definitions
+ */
+
+/** The table for a byte-wise computation of the CRC-16/CCITT, polynomial 0x1021. */
+static const uint16_t _crc16Tab[256] =
+    { 0x0000u, 0x1021u, 0x2042u, 0x3063u, 0x4084u, 0x50A5u, 0x60C6u, 0x70E7u,
+      0x8108u, 0x9129u, 0xA14Au, 0xB16Bu, 0xC18Cu, 0xD1ADu, 0xE1CEu, 0xF1EFu,
+      0x1231u, 0x0210u, 0x3273u, 0x2252u, 0x52B5u, 0x4294u, 0x72F7u, 0x62D6u,
+      0x9339u, 0x8318u, 0xB37Bu, 0xA35Au, 0xD3BDu, 0xC39Cu, 0xF3FFu, 0xE3DEu,
+      0x2462u, 0x3443u, 0x0420u, 0x1401u, 0x64E6u, 0x74C7u, 0x44A4u, 0x5485u,
+      0xA56Au, 0xB54Bu, 0x8528u, 0x9509u, 0xE5EEu, 0xF5CFu, 0xC5ACu, 0xD58Du,
+      0x3653u, 0x2672u, 0x1611u, 0x0630u, 0x76D7u, 0x66F6u, 0x5695u, 0x46B4u,
+      0xB75Bu, 0xA77Au, 0x9719u, 0x8738u, 0xF7DFu, 0xE7FEu, 0xD79Du, 0xC7BCu,
+      0x48C4u, 0x58E5u, 0x6886u, 0x78A7u, 0x0840u, 0x1861u, 0x2802u, 0x3823u,
+      0xC9CCu, 0xD9EDu, 0xE98Eu, 0xF9AFu, 0x8948u, 0x9969u, 0xA90Au, 0xB92Bu,
+      0x5AF5u, 0x4AD4u, 0x7AB7u, 0x6A96u, 0x1A71u, 0x0A50u, 0x3A33u, 0x2A12u,
+      0xDBFDu, 0xCBDCu, 0xFBBFu, 0xEB9Eu, 0x9B79u, 0x8B58u, 0xBB3Bu, 0xAB1Au,
+      0x6CA6u, 0x7C87u, 0x4CE4u, 0x5CC5u, 0x2C22u, 0x3C03u, 0x0C60u, 0x1C41u,
+      0xEDAEu, 0xFD8Fu, 0xCDECu, 0xDDCDu, 0xAD2Au, 0xBD0Bu, 0x8D68u, 0x9D49u,
+      0x7E97u, 0x6EB6u, 0x5ED5u, 0x4EF4u, 0x3E13u, 0x2E32u, 0x1E51u, 0x0E70u,
+      0xFF9Fu, 0xEFBEu, 0xDFDDu, 0xCFFCu, 0xBF1Bu, 0xAF3Au, 0x9F59u, 0x8F78u,
+      0x9188u, 0x81A9u, 0xB1CAu, 0xA1EBu, 0xD10Cu, 0xC12Du, 0xF14Eu, 0xE16Fu,
+      0x1080u, 0x00A1u, 0x30C2u, 0x20E3u, 0x5004u, 0x4025u, 0x7046u, 0x6067u,
+      0x83B9u, 0x9398u, 0xA3FBu, 0xB3DAu, 0xC33Du, 0xD31Cu, 0xE37Fu, 0xF35Eu,
+      0x02B1u, 0x1290u, 0x22F3u, 0x32D2u, 0x4235u, 0x5214u, 0x6277u, 0x7256u,
+      0xB5EAu, 0xA5CBu, 0x95A8u, 0x8589u, 0xF56Eu, 0xE54Fu, 0xD52Cu, 0xC50Du,
+      0x34E2u, 0x24C3u, 0x14A0u, 0x0481u, 0x7466u, 0x6447u, 0x5424u, 0x4405u,
+      0xA7DBu, 0xB7FAu, 0x8799u, 0x97B8u, 0xE75Fu, 0xF77Eu, 0xC71Du, 0xD73Cu,
+      0x26D3u, 0x36F2u, 0x0691u, 0x16B0u, 0x6657u, 0x7676u, 0x4615u, 0x5634u,
+      0xD94Cu, 0xC96Du, 0xF90Eu, 0xE92Fu, 0x99C8u, 0x89E9u, 0xB98Au, 0xA9ABu,
+      0x5844u, 0x4865u, 0x7806u, 0x6827u, 0x18C0u, 0x08E1u, 0x3882u, 0x28A3u,
+      0xCB7Du, 0xDB5Cu, 0xEB3Fu, 0xFB1Eu, 0x8BF9u, 0x9BD8u, 0xABBBu, 0xBB9Au,
+      0x4A75u, 0x5A54u, 0x6A37u, 0x7A16u, 0x0AF1u, 0x1AD0u, 0x2AB3u, 0x3A92u,
+      0xFD2Eu, 0xED0Fu, 0xDD6Cu, 0xCD4Du, 0xBDAAu, 0xAD8Bu, 0x9DE8u, 0x8DC9u,
+      0x7C26u, 0x6C07u, 0x5C64u, 0x4C45u, 0x3CA2u, 0x2C83u, 0x1CE0u, 0x0CC1u,
+      0xEF1Fu, 0xFF3Eu, 0xCF5Du, 0xDF7Cu, 0xAF9Bu, 0xBFBAu, 0x8FD9u, 0x9FF8u,
+      0x6E17u, 0x7E36u, 0x4E55u, 0x5E74u, 0x2E93u, 0x3EB2u, 0x0ED1u, 0x1EF0u
+    };
+
+
+/*
+ * Function implementation
+ */
+
+/**
+ * Compute the CRC-16/CCITT (polynomial 0x1021, not reflected, no final XOR) of a byte
+ * sequence.
+ *   @return
+ * Get the CRC.
+ *   @param crc
+ * The CRC of the preceding bytes or #SFR_CRC16_INIT_VALUE for the first call. This
+ * permits computing the CRC of a sequence, which is split into several pieces.
+ *   @param pData
+ * The bytes.
+ *   @param noBytes
+ * The number of bytes.
+ *   @remark
+ * The CRC of a byte sequence, which is followed by its own CRC, most significant byte
+ * first, is zero.
+ */
+uint16_t sfr_crc16(uint16_t crc, const void *pData, unsigned int noBytes)
+{
+    const uint8_t *pB = (const uint8_t*)pData;
+    while(noBytes-- > 0u)
+        crc = (uint16_t)((unsigned)crc << 8) ^ _crc16Tab[(crc >> 8) ^ *pB++];
+    return crc;
+
+} /* End of sfr_crc16 */
+
+
+
+
+/**
+ * Get the total length of the payload of a frame.
+ *   @return
+ * Get the sum of the lengths of all segments in Byte.
+ *   @param segAry
+ * The segments of the payload.
+ *   @param noSegments
+ * The number of entries in \a segAry.
+ */
+unsigned int sfr_getLenPayload(const sfr_segment_t segAry[], unsigned int noSegments)
+{
+    unsigned int lenPayload = 0u;
+    while(noSegments-- > 0u)
+        lenPayload += segAry[noSegments].noBytes;
+    return lenPayload;
+
+} /* End of sfr_getLenPayload */
+
+
+
+
+/**
+ * Put the next byte of the payload or CRC into the COBS encoder.
+ *   @param pEnc
+ * The state of the encoder.
+ *   @param b
+ * The byte to encode.
+ */
+static inline void encodeByte(encoder_t * const pEnc, uint8_t b)
+{
+    if(b != 0u)
+    {
+        pEnc->ringBuf[pEnc->idxWr++ & pEnc->idxMask] = b;
+        if(++pEnc->code < COBS_MAX_CODE)
+            return;
+    }
+
+    /* A zero byte or a full block: The code byte of the block is completed and the next
+       block begins. */
+    pEnc->ringBuf[pEnc->idxCode & pEnc->idxMask] = (uint8_t)pEnc->code;
+    pEnc->idxCode = pEnc->idxWr++;
+    pEnc->code = 1u;
+
+} /* End of encodeByte */
+
+
+
+
+/**
+ * Encode a frame into a ring buffer. See file header for the layout.
+ *   @return
+ * Get the number of bytes written into \a ringBuf. It is no more than
+ * #SFR_MAX_LEN_FRAME(sfr_getLenPayload(segAry, noSegments)).
+ *   @param ringBuf
+ * The frame is written into this ring buffer. Its size is a power of two.
+ *   @param idxMask
+ * The mask of the index bits of \a ringBuf, i.e., its size minus one.
+ *   @param idxWr
+ * The index of the first byte to write. The index is taken modulo the size of the ring
+ * buffer. The caller needs to ensure that the space for the frame is available, see
+ * #SFR_MAX_LEN_FRAME.
+ *   @param segAry
+ * The segments of the payload. The segments are encoded in order of appearance in the
+ * array. Segments of zero length are permitted.
+ *   @param noSegments
+ * The number of entries in \a segAry.
+ */
+unsigned int sfr_encodeFrame( uint8_t ringBuf[]
+                            , uint32_t idxMask
+                            , uint32_t idxWr
+                            , const sfr_segment_t segAry[]
+                            , unsigned int noSegments
+                            )
+{
+    const uint32_t idxBegin = idxWr;
+    ringBuf[idxWr++ & idxMask] = SFR_DELIMITER;
+
+    encoder_t enc = { .ringBuf = ringBuf
+                    , .idxMask = idxMask
+                    , .idxWr = idxWr + 1u
+                    , .idxCode = idxWr
+                    , .code = 1u
+                    };
+    uint16_t crc = SFR_CRC16_INIT_VALUE;
+    for(unsigned int idxSeg=0u; idxSeg<noSegments; ++idxSeg)
+    {
+        const uint8_t *pB = (const uint8_t*)segAry[idxSeg].pData;
+        const unsigned int noBytes = segAry[idxSeg].noBytes;
+        crc = sfr_crc16(crc, pB, noBytes);
+        for(unsigned int u=0u; u<noBytes; ++u)
+            encodeByte(&enc, pB[u]);
+    }
+    encodeByte(&enc, (uint8_t)(crc >> 8));
+    encodeByte(&enc, (uint8_t)crc);
+
+    /* Complete the last block and terminate the frame. */
+    ringBuf[enc.idxCode & idxMask] = (uint8_t)enc.code;
+    ringBuf[enc.idxWr++ & idxMask] = SFR_DELIMITER;
+
+    const unsigned int lenFrame = enc.idxWr - idxBegin;
+    assert(lenFrame <= SFR_MAX_LEN_FRAME(sfr_getLenPayload(segAry, noSegments)));
+    return lenFrame;
+
+} /* End of sfr_encodeFrame */
+
+
+
+
+/**
+ * Decode a received frame.
+ *   @return
+ * Get the length of the payload in Byte or -1 if the frame is corrupted: The COBS
+ * encoding is invalid, the CRC doesn't match or the payload doesn't fit into \a payload.
+ *   @param payload
+ * The decoded payload is written into this buffer. The contents are undefined if the
+ * function returns -1.
+ *   @param sizeOfPayload
+ * The size of \a payload in Byte. The CRC is decoded into the buffer, too; it needs to
+ * have two bytes more than the payload.
+ *   @param frame
+ * The received bytes between two delimiters. The delimiters don't belong to the frame.
+ *   @param lenFrame
+ * The number of bytes in \a frame.
+ */
+signed int sfr_decodeFrame( uint8_t payload[]
+                          , unsigned int sizeOfPayload
+                          , const uint8_t frame[]
+                          , unsigned int lenFrame
+                          )
+{
+    unsigned int idxIn = 0u
+               , lenOut = 0u;
+    while(idxIn < lenFrame)
+    {
+        const unsigned int code = frame[idxIn++];
+        if(code == SFR_DELIMITER  ||  idxIn + code-1u > lenFrame)
+            return -1;
+
+        for(unsigned int u=1u; u<code; ++u)
+        {
+            const uint8_t b = frame[idxIn++];
+            if(b == SFR_DELIMITER  ||  lenOut >= sizeOfPayload)
+                return -1;
+            payload[lenOut++] = b;
+        }
+
+        /* Each block but a full one and the last one is followed by a zero byte. */
+        if(code < COBS_MAX_CODE  &&  idxIn < lenFrame)
+        {
+            if(lenOut >= sizeOfPayload)
+                return -1;
+            payload[lenOut++] = 0u;
+        }
+    } /* while(All blocks of the frame) */
+
+    if(lenOut < SFR_LEN_CRC  ||  sfr_crc16(SFR_CRC16_INIT_VALUE, payload, lenOut) != 0u)
+        return -1;
+
+    return (signed int)(lenOut - SFR_LEN_CRC);
+
+} /* End of sfr_decodeFrame */
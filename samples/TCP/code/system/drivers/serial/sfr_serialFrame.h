@@ -0,0 +1,105 @@
+#ifndef SFR_SERIALFRAME_INCLUDED
+#define SFR_SERIALFRAME_INCLUDED
+/**
+ * @file sfr_serialFrame.h
+ * Definition of global interface of module sfr_serialFrame.c
+ *
+ * Copyright (C) 2026 Peter Vranken (mailto:Peter_Vranken@Yahoo.de)
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Include files
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+
+/*
+ * Defines
+ */
+
+/** The delimiter of frames. COBS encoding ensures that the byte doesn't appear inside a
+    frame. */
+#define SFR_DELIMITER           0x00u
+
+/** The number of bytes of the CRC, which is appended to the payload of a frame. */
+#define SFR_LEN_CRC             2u
+
+/** The initial value of the CRC computation, see sfr_crc16(). */
+#define SFR_CRC16_INIT_VALUE    0xFFFFu
+
+/** The maximum number of bytes, which a frame occupies in the serial stream, given the
+    length of its payload in Byte. This includes the CRC, the COBS overhead and both
+    delimiters. */
+#define SFR_MAX_LEN_FRAME(lenPayload)                                                   \
+            ((lenPayload)+SFR_LEN_CRC + 1u + ((lenPayload)+SFR_LEN_CRC)/254u + 2u)
+
+
+/*
+ * Global type definitions
+ */
+
+/** A segment of the payload of a frame. A frame is gathered from a list of segments; they
+    are encoded directly from the memory of the client code. */
+typedef struct sfr_segment_t
+{
+    /** The first byte of the segment. */
+    const void *pData;
+
+    /** The number of bytes of the segment. */
+    unsigned int noBytes;
+
+} sfr_segment_t;
+
+
+/*
+ * Global data declarations
+ */
+
+
+/*
+ * Global prototypes
+ */
+
+/** Compute the CRC-16/CCITT of a byte sequence. */
+uint16_t sfr_crc16(uint16_t crc, const void *pData, unsigned int noBytes);
+
+/** Get the total length of the payload of a frame. */
+unsigned int sfr_getLenPayload(const sfr_segment_t segAry[], unsigned int noSegments);
+
+/** Encode a frame into a ring buffer. */
+unsigned int sfr_encodeFrame( uint8_t ringBuf[]
+                            , uint32_t idxMask
+                            , uint32_t idxWr
+                            , const sfr_segment_t segAry[]
+                            , unsigned int noSegments
+                            );
+
+/** Decode a received frame. */
+signed int sfr_decodeFrame( uint8_t payload[]
+                          , unsigned int sizeOfPayload
+                          , const uint8_t frame[]
+                          , unsigned int lenFrame
+                          );
+
+
+/*
+ * Global inline functions
+ */
+
+
+#endif  /* SFR_SERIALFRAME_INCLUDED */
@@ -0,0 +1,218 @@
+/**
+ * @file sib_serialInputBuffer.c
+ * Ring buffer for serial input. The buffer is designed for a single producer, which is
+ * as simple as a DMA channel: It writes the received bytes into the ring and publishes
+ * the advanced write index. It doesn't look at the data and it doesn't maintain any
+ * further state. The interpretation of the data, like filtering of unwanted characters
+ * and counting of complete lines of text, is done by the consumer.\n
+ *   The read and write positions are free running 32 Bit indexes. Only the index bits of
+ * the masked values address the buffer. This way, the buffer can be filled entirely and
+ * the number of buffered bytes is just the difference of both indexes.\n
+ *   The module doesn't depend on the hardware. It can be compiled and tested on the host,
+ * see test_serialInputBuffer.c_.
+ *
+ * Copyright (C) 2026 Peter Vranken (mailto:Peter_Vranken@Yahoo.de)
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+/* Module interface
+ *   sib_initBuffer
+ *   sib_getChar
+ *   sib_getLine
+ *   sib_putByte (inline)
+ * Local functions
+ */
+
+/*
+ * Include files
+ */
+
+#include <stdlib.h>
+#include <assert.h>
+
+#include "sib_serialInputBuffer.h"
+
+
+/*
+ * Defines
+ */
+
+
+/*
+ * Local type definitions
+ */
+
+
+/*
+ * Local prototypes
+ */
+
+
+/*
+ * Data definitions
+ */
+
+
+/*
+ * Function implementation
+ */
+
+/**
+ * Initialize a ring buffer to the empty state. The function must not be called while the
+ * producer is active.
+ *   @param pBuf
+ * The ring buffer to initialize.
+ *   @param eol
+ * The end of line character, which is used by sib_getLine().
+ *   @param filteredChar
+ * A character, which is silently dropped from the input stream, e.g., the linefeed if the
+ * terminal sends CR and LF at the end of a line. Pass '\0' if no character should be
+ * filtered.
+ */
+void sib_initBuffer(sib_serialInputBuffer_t * const pBuf, char eol, char filteredChar)
+{
+    pBuf->idxWr =
+    pBuf->idxRd =
+    pBuf->idxNoEOL = 0u;
+    pBuf->eol = eol;
+    pBuf->filteredChar = filteredChar;
+
+} /* End of sib_initBuffer */
+
+
+
+
+/**
+ * Consumer: Read a single character from the buffer.
+ *   @return
+ * The function is non-blocking. If the buffer currently contains no character it returns
+ * EOF (-1). Otherwise it returns the earliest received character, which is still in the
+ * buffer.
+ *   @param pBuf
+ * The ring buffer to read from.
+ */
+signed int sib_getChar(sib_serialInputBuffer_t * const pBuf)
+{
+    const uint32_t idxWr = pBuf->idxWr;
+    uint32_t idxRd = pBuf->idxRd;
+    signed int c = -1;
+    while(idxRd != idxWr)
+    {
+        const char cTmp = (char)pBuf->buf[idxRd & SIB_IDX_MASK];
+        ++ idxRd;
+        if(pBuf->filteredChar == '\0'  ||  cTmp != pBuf->filteredChar)
+        {
+            c = (signed int)(uint8_t)cTmp;
+            break;
+        }
+    }
+
+    /* The search for the next end of line must not begin before the read position. The
+       signed difference is robust against wrapping of the free running indexes. */
+    if((int32_t)(idxRd - pBuf->idxNoEOL) > 0)
+        pBuf->idxNoEOL = idxRd;
+
+    /* Publish the new read position. This is at the same time the indication towards the
+       producer of having the space released. */
+    pBuf->idxRd = idxRd;
+
+    return c;
+
+} /* End of sib_getChar */
+
+
+
+
+/**
+ * Consumer: Read a line of text from the buffer. See sio_osGetLine() for the complete
+ * description.
+ *   @return
+ * Get \a str if a line of text has been read. Get NULL if there's no complete line of
+ * text in the buffer yet or if \a sizeOfStr is zero.\n
+ *   A full buffer without end of line character is returned as a line of text. Otherwise
+ * the input would be stuck.
+ *   @param pBuf
+ * The ring buffer to read from.
+ *   @param str
+ * The line of text is copied into this buffer. The end of line character is not copied
+ * and filtered characters are dropped. The line is always zero terminated. It is the
+ * empty string if the function returns NULL - and given that \a sizeOfStr is greater than
+ * zero.
+ *   @param sizeOfStr
+ * The capacity of \a str in Byte. The maximum line length is one less. The rest of a
+ * longer line is consumed but lost.
+ */
+char *sib_getLine(sib_serialInputBuffer_t * const pBuf, char str[], unsigned int sizeOfStr)
+{
+    if(sizeOfStr == 0u)
+        return NULL;
+
+    /* The producer may add more bytes meanwhile; we consider a snapshot of the write
+       position. */
+    const uint32_t idxWr = pBuf->idxWr
+                 , idxRd = pBuf->idxRd;
+    assert(idxWr - idxRd <= SIB_SIZE_OF_BUFFER);
+
+    /* Look for the next end of line. The bytes before idxNoEOL have already been checked
+       in a previous call. */
+    uint32_t idxEOL = pBuf->idxNoEOL;
+    assert(idxEOL - idxRd <= idxWr - idxRd);
+    while(idxEOL != idxWr  &&  (char)pBuf->buf[idxEOL & SIB_IDX_MASK] != pBuf->eol)
+        ++ idxEOL;
+
+    uint32_t idxNext;
+    if(idxEOL != idxWr)
+    {
+        /* A line of text is available. The end of line character is consumed but not
+           returned. */
+        idxNext = idxEOL + 1u;
+    }
+    else if(idxWr - idxRd == SIB_SIZE_OF_BUFFER)
+    {
+        /* The buffer is full without an end of line. No new character - and in
+           particular no end of line - could ever be received and the application would
+           never again get a line of input. We return the complete buffer contents as a
+           (pseudo-) line of text. */
+        idxNext = idxWr;
+    }
+    else
+    {
+        /* No complete line of text has been received so far. Next time, we don't need to
+           check the same bytes again. */
+        pBuf->idxNoEOL = idxWr;
+        str[0] = '\0';
+        return NULL;
+    }
+
+    /* Copy the line. The zero terminating byte needs to fit. */
+    unsigned int lenStr = 0u;
+    for(uint32_t idx=idxRd; idx!=idxEOL; ++idx)
+    {
+        const char c = (char)pBuf->buf[idx & SIB_IDX_MASK];
+        if((pBuf->filteredChar == '\0'  ||  c != pBuf->filteredChar)
+           &&  lenStr+1u < sizeOfStr
+          )
+        {
+            str[lenStr++] = c;
+        }
+    }
+    str[lenStr] = '\0';
+
+    /* Release the consumed bytes. */
+    pBuf->idxNoEOL = idxNext;
+    pBuf->idxRd = idxNext;
+
+    return str;
+
+} /* End of sib_getLine */
@@ -0,0 +1,138 @@
+#ifndef SIB_SERIALINPUTBUFFER_INCLUDED
+#define SIB_SERIALINPUTBUFFER_INCLUDED
+/**
+ * @file sib_serialInputBuffer.h
+ * Definition of global interface of module sib_serialInputBuffer.c
+ *
+ * Copyright (C) 2026 Peter Vranken (mailto:Peter_Vranken@Yahoo.de)
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Include files
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+
+/*
+ * Defines
+ */
+
+/** The size of the ring buffer as a power of two of bytes. The capacity of the buffer is
+    the same as its size, the free running indexes don't need a spare byte to tell a full
+    from an empty buffer. */
+#ifndef SIB_SIZE_OF_BUFFER_PWR_OF_TWO
+# define SIB_SIZE_OF_BUFFER_PWR_OF_TWO  8
+#endif
+
+/** The size of the ring buffer in Byte. */
+#define SIB_SIZE_OF_BUFFER      (1u<<(SIB_SIZE_OF_BUFFER_PWR_OF_TWO))
+
+/** Used for index arithmetics: A mask for the index bits in a free running index. */
+#define SIB_IDX_MASK            (SIB_SIZE_OF_BUFFER-1u)
+
+
+/*
+ * Global type definitions
+ */
+
+/** The ring buffer for serial input. It is filled by a single producer, an interrupt or a
+    DMA channel, and emptied by a single consumer. The producer only writes the bytes and
+    publishes the new write index; all other work, like filtering characters and looking
+    for the end of line, is done by the consumer. */
+typedef struct sib_serialInputBuffer_t
+{
+    /** The bytes of the ring. */
+    volatile uint8_t buf[SIB_SIZE_OF_BUFFER];
+
+    /** The free running index of the next byte to write. The index is written solely by
+        the producer. */
+    volatile uint32_t idxWr;
+
+    /** The free running index of the next byte to read. The index is written solely by
+        the consumer. The buffer is empty if \a idxWr equals \a idxRd and full if they
+        differ by #SIB_SIZE_OF_BUFFER. */
+    volatile uint32_t idxRd;
+
+    /** The consumer has checked all received bytes before this free running index and
+        found no end of line. This avoids searching the same bytes again on each call of
+        sib_getLine() while a line is still incomplete. */
+    uint32_t idxNoEOL;
+
+    /** The end of line character. */
+    char eol;
+
+    /** A character, which is silently dropped from the input stream, or '\0' if no
+        character is filtered. */
+    char filteredChar;
+
+} sib_serialInputBuffer_t;
+
+
+/*
+ * Global data declarations
+ */
+
+
+/*
+ * Global prototypes
+ */
+
+/** Initialize a ring buffer to the empty state. */
+void sib_initBuffer(sib_serialInputBuffer_t *pBuf, char eol, char filteredChar);
+
+/** Consumer: Read a single character from the buffer. */
+signed int sib_getChar(sib_serialInputBuffer_t *pBuf);
+
+/** Consumer: Read a line of text from the buffer. */
+char *sib_getLine(sib_serialInputBuffer_t *pBuf, char str[], unsigned int sizeOfStr);
+
+
+/*
+ * Global inline functions
+ */
+
+/**
+ * Producer: Put a received byte into the buffer. The function is intended for use from
+ * the interrupt, which serves the receiver of the serial device. It is the counterpart of
+ * a DMA transfer into the buffer: The byte is stored and the write index is advanced;
+ * nothing else.
+ *   @return
+ * Get \a true if the byte could be stored or \a false if the buffer was full. The byte is
+ * lost in the latter case.
+ *   @param pBuf
+ * The ring buffer to write to.
+ *   @param c
+ * The received byte.
+ *   @remark
+ * The producer and the consumer need to run on the same core. Otherwise a memory barrier
+ * would be required between writing the byte and publishing the new write index.
+ */
+static inline bool sib_putByte(sib_serialInputBuffer_t * const pBuf, uint8_t c)
+{
+    const uint32_t idxWr = pBuf->idxWr;
+    if(idxWr - pBuf->idxRd >= SIB_SIZE_OF_BUFFER)
+        return false;
+
+    pBuf->buf[idxWr & SIB_IDX_MASK] = c;
+    pBuf->idxWr = idxWr + 1u;
+    return true;
+
+} /* End of sib_putByte */
+
+
+#endif  /* SIB_SERIALINPUTBUFFER_INCLUDED */
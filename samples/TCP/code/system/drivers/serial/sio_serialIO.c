@@ -7,6 +7,10 @@
  * is by far lower than the output. This is fine for the normal use case, controlling an
  * application by some input commands, but would become a problem if the intention is to
  * download large data amounts, e.g. for a kind of boot loader.\n
+ *   LINFlexD_2 can't request DMA transfers on RX buffer full. The input interrupt
+ * therefore acts as a DMA channel would do: It writes the received byte into the ring
+ * buffer and publishes the new write position, nothing else. Filtering of characters and
+ * looking for the end of line is done on consumption, see sib_serialInputBuffer.c.\n
  *   Note, serial input is possible only from one core. Which core, is a compile time
  * configuration, see #INTC_IRQ_TARGET_CORE. Using the techniques from the implementation
  * of serial output for serial input, too, it would be possible to permit multi-core access
@@ -45,6 +49,9 @@
  *   sio_scSmplHdlr_getLine
  *   sio_writeSerial (inline)
  *   sio_osWriteSerial
+ *   sio_scFlHdlr_writeSerialFrame
+ *   sio_writeSerialFrame (inline)
+ *   sio_osWriteSerialFrame
  *   sio_osGetChar
  *   sio_osGetLine
  * Local functions
@@ -57,6 +64,8 @@
  *   configLINFlex
  *   linFlexRxInterrupt
  *   registerInterrupts
+ *   osBeginWriteSerial
+ *   osEndWriteSerial
  */
 
 /*
@@ -71,6 +80,7 @@
 #include "MPC5748G.h"
 
 #include "sio_serialIO.h"
+#include "sib_serialInputBuffer.h"
 #include "typ_types.h"
 #include "rtos.h"
 #include "dma_dmaDriver.h"
@@ -120,11 +130,6 @@
     symbol ld_noBitsDmaRingBuffer, that is maintained in the linker file. */
 #define SERIAL_OUTPUT_RING_BUFFER_SIZE_PWR_OF_TWO   10
 
-/** The size of the ring buffer for serial input as number of bytes. The maximum capacity
-    is one Byte less than the size. For this buffer, there's no penalty in not using a
-    power-of-two size. */
-#define SERIAL_INPUT_RING_BUFFER_SIZE   257
-
 /** The default behavior of terminal programs is to send a CR at the end of a message. By
     configuration, this can also be a pair of CR and LF. For serial input, this module
     handles this by compile time settings. Each of the two characters can be configured to
@@ -149,6 +154,16 @@
     serial output buffer. */
 #define SERIAL_OUTPUT_RING_BUFFER_IDX_MASK  (SERIAL_OUTPUT_RING_BUFFER_SIZE-1)
 
+/** Note, most buffer addresses or indexes in the code of the serial output are understood
+    as cyclic, i.e. modulo the buffer size. This is indicated by an M as last character of
+    the affected symbols but not mentioned again in the code comments. */
+#define MODULO(bufIdx)    ((bufIdx) & SERIAL_OUTPUT_RING_BUFFER_IDX_MASK)
+
+/** The maximum number of segments of a frame, which is sent by user code with
+    sio_writeSerialFrame(). The segment descriptors are copied onto the stack of the system
+    call handler. */
+#define SIO_MAX_NO_SEGMENTS_USER_FRAME  8u
+
 
 /* The LINFlex device to be used is selected by name depending on the setting of
    #IDX_LINFLEX_D. */
@@ -220,6 +235,15 @@ volatile unsigned long SBSS_OS(sio_serialOutNoTruncatedMsgs) = 0;
     sio_serialOutNoLostMsgBytes. */
 volatile unsigned long SBSS_OS(sio_serialOutNoLostMsgBytes) = 0;
 
+/** The number of frames, which have been queued for sending with sio_osWriteSerialFrame()
+    since power-up. */
+volatile unsigned long SBSS_OS(sio_serialOutNoFrames) = 0;
+
+/** A frame is either queued entirely or not at all. This development support variable
+    counts the number of frames since power-up, which were lost because the ring buffer
+    for serial output was momentarily too full. */
+volatile unsigned long SBSS_OS(sio_serialOutNoLostFrames) = 0;
+
 /** The ring buffer used for the DMA based serial output.
       @remark The size of the buffer is defined here in the C source code but there is a
     strong dependency on the linker control file, too. The log2(sizeOfBuffer) least
@@ -238,29 +262,17 @@ static uint8_t _serialOutRingBuf[SERIAL_OUTPUT_RING_BUFFER_SIZE]
     at the end of the name. */
 static volatile unsigned int SBSS_OS(_serialOutRingBufIdxWrM) = 0;
 
+/** The manipulation of the output buffer and the DMA registers is done inside a critical
+    section, which implements mutual exclusion of all contexts on all cores. So any context
+    on any core can safely write into the serial output. */
+static mtx_intercoreCriticalSection_t DATA_OS(_critSecSerialOut) =
+                                                            MTX_INTERCORE_CRITICAL_SECTION;
+
 /** The ring buffer used for the interrupt based serial input. No particular section is
     required. Due to the low performance requirements we can use any location and do normal
-    address arithmetics. */
-static volatile uint8_t BSS_OS(_serialInRingBuf)[SERIAL_INPUT_RING_BUFFER_SIZE];
-
-/** A pointer to the end of the ring buffer used for serial input. This pointer facilitates
-    the cyclic pointer update.
-      @remark Note, the pointer points to the last byte in the buffer, not to the first
-    address beyond as usually done. */
-static volatile const uint8_t * SDATA_OS(_pEndSerialInRingBuf) =
-                                    &_serialInRingBuf[SERIAL_INPUT_RING_BUFFER_SIZE-1];
-
-/** The pointer to the next write position in the ring buffer used for serial input. */
-static volatile uint8_t * volatile SDATA_OS(_pWrSerialInRingBuf) = &_serialInRingBuf[0];
-
-/** The pointer to the next read position from the ring buffer used for serial input. The
-    buffer is considered empty if \a _pWrSerialInRingBuf equals \a _pRdSerialInRingBuf,
-    i.e. the buffer can contain up to SERIAL_INPUT_RING_BUFFER_SIZE-1 characters. */
-static volatile uint8_t * volatile SDATA_OS(_pRdSerialInRingBuf) = &_serialInRingBuf[0];
-
-/** The number of received but not yet consumed end of line characters. Required for read
-    line API function. */
-static volatile unsigned int SBSS_OS(_serialInNoEOL) = 0;
+    address arithmetics. The size of the buffer is configured by
+    #SIB_SIZE_OF_BUFFER_PWR_OF_TWO. */
+static sib_serialInputBuffer_t BSS_OS(_serialInBuf);
 
 /** The number of lost characters due to overfull input ring buffer. */
 volatile unsigned long SBSS_OS(sio_serialInLostBytes) = 0; 
@@ -724,55 +736,34 @@ static void configLINFlex(unsigned int baudRate)
 /**
  * Interrupt handler for UART RX event. A received character is read from the UART hardware
  * and put into our ring buffer if there's space left. Otherwise the character is counted
- * as lost without further remedial action.
+ * as lost without further remedial action.\n
+ *   The handler does no more than a DMA transfer would do. Filtering of characters and
+ * the search for the end of line are left to the consumer, see sib_serialInputBuffer.c.
+ * This keeps the time spent per received byte short.
  */
 static void linFlexRxInterrupt(void)
 {
     /* Get the received byte. */
     /// @todo Record a buffer overrun bit in case the IRQ handler comes too slow
-    const unsigned char c = (LINFLEX->BDRM & LINFlexD_BDRM_DATA4_MASK)
-                            >> LINFlexD_BDRM_DATA4_SHIFT;
+    const uint8_t c = (uint8_t)((LINFLEX->BDRM & LINFlexD_BDRM_DATA4_MASK)
+                                >> LINFlexD_BDRM_DATA4_SHIFT
+                               );
 #ifdef DEBUG
     ++ sio_serialInNoRxBytes;
 #endif
 
-    /* To support different terminal characteristics, one character can be configured to
-       be silently ignored in the input stream. This shall normally be the linefeed
-       character. */
-#if SERIAL_INPUT_FILTERED_CHAR != 0
-    if(c != SERIAL_INPUT_FILTERED_CHAR)
-#endif
+    /* Put the byte into our buffer if there's enough room. Updating the write position is
+       at the same time the indication of the availability of the new character to the
+       application API functions. */
+    if(!sib_putByte(&_serialInBuf, c))
     {
-        /* Check for buffer full. Compute next write position at the same time. */
-        volatile uint8_t * const pWrTmp = _pWrSerialInRingBuf
-                       , * const pWrNext = pWrTmp < _pEndSerialInRingBuf? pWrTmp+1
-                                                                        : &_serialInRingBuf[0];
+        /* Buffer overrun, count lost character. */
+        ++ sio_serialInLostBytes;
+    }
 
-        /* Put the byte into our buffer if there's enough room. */
-        if(pWrNext != _pRdSerialInRingBuf)
-        {
-            *pWrTmp = c;
-        
-            /* Count the received end of line characters. (The variable is decremented on
-               consumption of such a character.) */
-            if(c == SERIAL_INPUT_EOL)
-                ++ _serialInNoEOL;
-
-            /* Update write position into ring buffer. This is at the same time the indication
-               of the availability of the new character to the application API functions. */
-            _pWrSerialInRingBuf = pWrNext;
-        }
-        else    
-        {
-            /* Buffer overrun, count lost character. */
-            ++ sio_serialInLostBytes;
-        }
-    
-        /* Ensure that all relevant memory changes are visible before we leave the
-           interrupt. */
-        std_fullMemoryBarrier();
-        
-    } /* End if(Character discarded?) */
+    /* Ensure that all relevant memory changes are visible before we leave the
+       interrupt. */
+    std_fullMemoryBarrier();
 
     /* Acknowlege the interrupt by w2c and enable the next one at the same time. */
     assert((LINFLEX->UARTSR & LINFlexD_UARTSR_DRFRFE_MASK) != 0);
@@ -829,6 +820,9 @@ void sio_osInitSerialInterface(unsigned int baudRate)
        with any other LINFlex than 2. */
     configSIULForUseWithOpenSDA();
     
+    /* Empty receive buffer. */
+    sib_initBuffer(&_serialInBuf, SERIAL_INPUT_EOL, SERIAL_INPUT_FILTERED_CHAR);
+
     /* Configure the LINFlex device for serial in- and output. */
     configLINFlex(baudRate);
 
@@ -842,14 +836,95 @@ void sio_osInitSerialInterface(unsigned int baudRate)
     /* Initialize DMA for writing into the UART. */
     configDMA();
 
-    /* Empty receive buffer. */
-    _pWrSerialInRingBuf =
-    _pRdSerialInRingBuf = &_serialInRingBuf[0];
-    
 } /* End of sio_osInitSerialInterface */
 
 
 
+/**
+ * Begin writing into the ring buffer of the serial output: The critical section is entered
+ * and the DMA channel is halted, such that the free space of the buffer doesn't change.
+ * Every call needs to be followed by a call of osEndWriteSerial().
+ *   @return
+ * Get the number of free bytes in the ring buffer. The free space begins at
+ * _serialOutRingBufIdxWrM.
+ *   @param pIdxEndOfFreeSpaceM
+ * The (current) end of the free buffer area is returned in * \a pIdxEndOfFreeSpaceM. It
+ * needs to be passed on to osEndWriteSerial().
+ */
+static unsigned int osBeginWriteSerial(uint32_t * const pIdxEndOfFreeSpaceM)
+{
+    mtx_osEnterIntercoreCriticalSection(&_critSecSerialOut);
+    
+    /* Stop the (possibly) running DMA channel, then check the current status of a possibly
+       pending transfer request from the connected PIT timer device.
+         RM 70.5.8.1: Coherently stop a DMA channel with the ability of resuming it later. */
+    stopDMATrigger();
+    while(dma_osGetDMAChannelPendingTriggerFromIODevice(&_hDMAChannel))
+    {}
+    dma_osEnableDMAChannelTriggerFromIODevice(&_hDMAChannel, /* enable */ false);
+
+    /* The current, i.e. next, transfer address of the DMA is the first (cyclic)
+       address, which we must not touch when filling the buffer. This is the (current)
+       end of the free buffer area. */
+    const dma_dmaTransferCtrlDesc_t * const pTCD =
+                                        dma_getTransferControlDescriptor(&_hDMAChannel);
+    *pIdxEndOfFreeSpaceM = pTCD->SADDR;
+
+    /* Note the -1: Same index values are used as empty-buffer-indication. Therefore
+       it is not possible to entirely fill the buffer. */
+    return MODULO(*pIdxEndOfFreeSpaceM - _serialOutRingBufIdxWrM - 1);
+
+} /* End of osBeginWriteSerial */
+
+
+
+
+/**
+ * End writing into the ring buffer of the serial output: The written bytes are appended
+ * to the pending bytes, the DMA channel is resumed and the critical section is left.
+ *   @param idxEndOfFreeSpaceM
+ * The value, which had been returned by the preceding osBeginWriteSerial().
+ *   @param noBytes
+ * The number of bytes, which had been written into the buffer, beginning at
+ * _serialOutRingBufIdxWrM. May be zero.
+ */
+static void osEndWriteSerial(uint32_t idxEndOfFreeSpaceM, unsigned int noBytes)
+{
+    /* Apply a memory barrier to ensure that all data is in memory before we start the DMA
+       transfer. */
+    std_fullMemoryBarrier();
+
+    _serialOutRingBufIdxWrM = _serialOutRingBufIdxWrM + noBytes;
+
+    /* Start DMA if there's anything to send. Nothing can be pending only if a frame has
+       been rejected while the DMA had completed all earlier bytes. */
+    const uint32_t noBytesPending = MODULO(_serialOutRingBufIdxWrM - idxEndOfFreeSpaceM);
+    if(noBytesPending > 0)
+    {
+        /* Set the number of bytes to transfer to the UART by DMA. */
+        assert((unsigned)noBytesPending <= SERIAL_OUTPUT_RING_BUFFER_SIZE-1);
+        dma_dmaTransferCtrlDesc_t * const pTCD =
+                                        dma_getTransferControlDescriptor(&_hDMAChannel);
+        pTCD->CITER.ELINKNO =
+        pTCD->BITER.ELINKNO = DMA_TCD_CITER_ELINKNO_CITER(noBytesPending)
+                              | DMA_TCD_CITER_ELINKNO_ELINK(0);
+
+        /* Resume the DMA channel. Re-enabling the PIT timer, which requests the bytes from
+           the DMA, ensures that we again see a full timer period before it triggers the DMA
+           for the next character: The LINFlex may easily be still busy serializing the
+           last character from the previous DMA transfer.
+             RM 70.5.8.2: Resume a previously stopped DMA channel. */
+        dma_osEnableDMAChannelTriggerFromIODevice(&_hDMAChannel, /* enable */ true);
+        startDMATrigger();
+        ++ sio_serialOutNoDMATransfers;
+    }
+
+    mtx_osLeaveIntercoreCriticalSection(&_critSecSerialOut);
+
+} /* End of osEndWriteSerial */
+
+
+
 /** 
  * System call handler for entry into data output. A byte string is sent through the serial
  * interface. Actually, the bytes are queued for sending and the function is non-blocking. 
@@ -940,40 +1015,8 @@ unsigned int sio_osWriteSerial(const char *msg, unsigned int noBytes)
     if(noBytes == 0)
         return 0;
 
-    /* The manipulation if the output buffer and the DMA registers is done inside a
-       critical section, which implements mutual exclusion of all contexts on all cores. So
-       any context on any core can safely apply this function. */
-    static mtx_intercoreCriticalSection_t DATA_OS(critSec) = MTX_INTERCORE_CRITICAL_SECTION;
-    mtx_osEnterIntercoreCriticalSection(&critSec);
-    
-    /* Stop the (possibly) running DMA channel, then check the current status of a possibly
-       pending transfer request from the connected PIT timer device.
-         RM 70.5.8.1: Coherently stop a DMA channel with the ability of resuming it later. */
-    stopDMATrigger();
-    while(dma_osGetDMAChannelPendingTriggerFromIODevice(&_hDMAChannel))
-    {}
-    dma_osEnableDMAChannelTriggerFromIODevice(&_hDMAChannel, /* enable */ false);
-
-    /* Note, most buffer addresses or indexes in this section of the code are
-       understood as cyclic, i.e. modulo the buffer size. This is indicated by an M as
-       last character of the affected symbols but not mentioned again in the code
-       comments. */
-#define MODULO(bufIdx)    ((bufIdx) & SERIAL_OUTPUT_RING_BUFFER_IDX_MASK)
-
-    /* Get the pointer to our DMA channel. */
-    dma_dmaTransferCtrlDesc_t * const pTCD = dma_getTransferControlDescriptor(&_hDMAChannel);
-
-    /* The current, i.e. next, transfer address of the DMA is the first (cyclic)
-       address, which we must not touch when filling the buffer. This is the (current)
-       end of the free buffer area. */
-    const uint32_t idxEndOfFreeSpaceM = pTCD->SADDR;
-
-    /* The cyclic character of the buffer can require one or two copy operations to
-       place the message. We compute the concrete index ranges to copy.
-         Note the -1: Same index values are used as empty-buffer-indication. Therefore
-       it is not possible to entirely fill the buffer. */
-    const unsigned int noBytesFree =
-                            MODULO(idxEndOfFreeSpaceM - _serialOutRingBufIdxWrM - 1);
+    uint32_t idxEndOfFreeSpaceM;
+    const unsigned int noBytesFree = osBeginWriteSerial(&idxEndOfFreeSpaceM);
 
     /* Avoid buffer overrun by saturation of the user demand and report the number of
        overrun events and the number of lost message characters. */
@@ -1019,34 +1062,7 @@ unsigned int sio_osWriteSerial(const char *msg, unsigned int noBytes)
         memcpy(&_serialOutRingBuf[0], msg+noBytesAtEnd, noBytes-noBytesAtEnd);
     }           
 
-    /* Apply a memory barrier to ensure that all data is in memory before we start the DMA
-       transfer. */
-    std_fullMemoryBarrier();
-
-    _serialOutRingBufIdxWrM = _serialOutRingBufIdxWrM + noBytes;
-
-    /* Start DMA. We can do this unconditionally because we have filtered the special
-       situation of not writing any new character. */
-   
-    const uint32_t noBytesPending = MODULO(_serialOutRingBufIdxWrM - idxEndOfFreeSpaceM);
-    assert(noBytesPending > 0);
-    
-    /* Set the number of bytes to transfer to the UART by DMA. */
-    assert((unsigned)noBytesPending <= SERIAL_OUTPUT_RING_BUFFER_SIZE-1);
-    pTCD->CITER.ELINKNO =
-    pTCD->BITER.ELINKNO = DMA_TCD_CITER_ELINKNO_CITER(noBytesPending)
-                          | DMA_TCD_CITER_ELINKNO_ELINK(0);
-
-    /* Resume the DMA channel. Re-enabling the PIT timer, which requests the bytes from the
-       DMA, ensures that we again see a full timer period before it triggers the DMA for the
-       next character: The LINFlex may easily be still busy serializing the last character
-       from the previous DMA transfer.
-         RM 70.5.8.2: Resume a previously stopped DMA channel. */
-    dma_osEnableDMAChannelTriggerFromIODevice(&_hDMAChannel, /* enable */ true);
-    startDMATrigger();
-    ++ sio_serialOutNoDMATransfers;
-
-    mtx_osLeaveIntercoreCriticalSection(&critSec);
+    osEndWriteSerial(idxEndOfFreeSpaceM, noBytes);
 
     /* noBytes is saturated to buffer size-1 and can't overflow in conversion to signed. */
     return noBytes;
@@ -1056,6 +1072,116 @@ unsigned int sio_osWriteSerial(const char *msg, unsigned int noBytes)
 
 
 
+/** 
+ * System call handler for entry into framed data output. See sio_osWriteSerialFrame() for
+ * details.
+ *   @return
+ * Get \a true if the frame has been queued for sending or \a false if it is lost.
+ *   @param PID
+ * The process ID of the calling task.
+ *   @param segAry
+ * The segments of the payload of the frame. The array and all payload bytes need to be
+ * readable by the calling process.
+ *   @param noSegments
+ * The number of entries in \a segAry. No more than #SIO_MAX_NO_SEGMENTS_USER_FRAME are
+ * permitted.
+ *   @remark
+ * This function must never be called directly. The function is only made for placing it in
+ * the global system call table.
+ */
+uint32_t sio_scFlHdlr_writeSerialFrame( uint32_t PID ATTRIB_UNUSED
+                                      , const sfr_segment_t segAry[]
+                                      , unsigned int noSegments
+                                      )
+{
+    /* The array of segment descriptors, coming from the untrusted user code, needs to be
+       readable. */
+    if(noSegments > SIO_MAX_NO_SEGMENTS_USER_FRAME
+       ||  !rtos_checkUserCodeReadPtr(segAry, noSegments*sizeof(sfr_segment_t))
+      )
+    {
+        rtos_osSystemCallBadArgument();
+    }
+
+    /* The descriptors are copied before we validate them. Otherwise, user code on another
+       core could alter a descriptor after the check. The payload bytes themselves are only
+       read, a change of them can't do any harm. */
+    sfr_segment_t segAryCopy[SIO_MAX_NO_SEGMENTS_USER_FRAME];
+    for(unsigned int idxSeg=0u; idxSeg<noSegments; ++idxSeg)
+    {
+        segAryCopy[idxSeg] = segAry[idxSeg];
+        if(!rtos_checkUserCodeReadPtr(segAryCopy[idxSeg].pData, segAryCopy[idxSeg].noBytes))
+            rtos_osSystemCallBadArgument();
+    }
+    
+    return (uint32_t)sio_osWriteSerialFrame(segAryCopy, noSegments);
+
+} /* End of sio_scFlHdlr_writeSerialFrame */
+
+
+
+
+/** 
+ * API function for framed binary data output. The payload is gathered from a list of
+ * segments, protected by a CRC, COBS encoded and queued for sending, see
+ * sfr_serialFrame.c for the format. The function is non-blocking.\n
+ *   The frame is encoded in a single pass directly from the segments into the ring buffer
+ * of the serial output, there's no intermediate copy. Frames and text, which is written
+ * with sio_osWriteSerial(), can be mixed in the serial channel; the receiver can tell them
+ * apart.\n
+ *   A frame is never truncated. If it doesn't fit into the ring buffer then it is dropped
+ * as a whole and counted in \a sio_serialOutNoLostFrames.\n
+ *   The function can be called from any context on any core. However, it must not be
+ * called untill function sio_osInitSerialInterface() has completed.
+ *   @return
+ * Get \a true if the frame has been queued for sending or \a false if it is lost.
+ *   @param segAry
+ * The segments of the payload of the frame. Segments of zero length are permitted.
+ *   @param noSegments
+ * The number of entries in \a segAry.
+ *   @remark
+ * This function must be called by trusted code in supervisor mode only. It belongs to the
+ * sphere of trusted code itself.
+ *   @remark
+ * The same remarks about the critical section apply as for sio_osWriteSerial(). The
+ * encoding is done inside the critical section; its duration is of order O(length of
+ * payload).
+ */
+bool sio_osWriteSerialFrame(const sfr_segment_t segAry[], unsigned int noSegments)
+{
+    const unsigned int lenPayload = sfr_getLenPayload(segAry, noSegments);
+
+    uint32_t idxEndOfFreeSpaceM;
+    const unsigned int noBytesFree = osBeginWriteSerial(&idxEndOfFreeSpaceM);
+
+    /* The frame needs to fit entirely. The check uses the worst case length of the COBS
+       encoded frame. */
+    unsigned int lenFrame = 0u;
+    if(lenPayload < SERIAL_OUTPUT_RING_BUFFER_SIZE
+       &&  SFR_MAX_LEN_FRAME(lenPayload) <= noBytesFree
+      )
+    {
+        lenFrame = sfr_encodeFrame( _serialOutRingBuf
+                                  , SERIAL_OUTPUT_RING_BUFFER_IDX_MASK
+                                  , _serialOutRingBufIdxWrM
+                                  , segAry
+                                  , noSegments
+                                  );
+        assert(lenFrame <= noBytesFree);
+        ++ sio_serialOutNoFrames;
+    }
+    else
+        ++ sio_serialOutNoLostFrames;
+
+    osEndWriteSerial(idxEndOfFreeSpaceM, lenFrame);
+
+    return lenFrame > 0u;
+
+} /* End of sio_osWriteSerialFrame */
+
+
+
+
 /**
  * Application API function to read a single character from serial input or EOF if there's
  * no such character received meanwhile.\n
@@ -1076,37 +1202,11 @@ unsigned int sio_osWriteSerial(const char *msg, unsigned int noBytes)
  */
 signed int sio_osGetChar(void)
 {
-    signed int c;
-    
-    /* Reading the ring buffer is done in a critical section to ensure mutual exclusion
-       with the it filling interrupt. */
+    /* The filling interrupt doesn't need to be locked; the ring buffer has a single
+       producer and a single consumer, which are lock-free. The critical section ensures
+       the mutual exclusion of different contexts, which compete in consuming the input. */
     uint32_t msr = rtos_osEnterCriticalSection();
-    {
-        /* Check for buffer empty. */
-        if(_pRdSerialInRingBuf != _pWrSerialInRingBuf)
-        {
-            c = *_pRdSerialInRingBuf;
-
-            /* Keep track of the received but not yet consumed end of line characters. (The
-               variable is incremented on reception of such a character.) */
-            if(c == SERIAL_INPUT_EOL)
-            {
-                assert(_serialInNoEOL > 0);
-                -- _serialInNoEOL;
-            }
-
-            /* Update read position in the ring buffer. This is at the same time the indication
-               towards the interrupt of having the character consumed. */
-            volatile uint8_t * const pRdTmp = _pRdSerialInRingBuf;
-            _pRdSerialInRingBuf = pRdTmp < _pEndSerialInRingBuf ? pRdTmp+1 
-                                                                : &_serialInRingBuf[0];
-        }
-        else    
-        {
-            /* Nothing in buffer, return EOF. */
-            c = -1;
-        }
-    }
+    const signed int c = sib_getChar(&_serialInBuf);
     rtos_osLeaveCriticalSection(msr);
 
     return c;
@@ -1230,134 +1330,9 @@ char *sio_osGetLine(char str[], unsigned int sizeOfStr)
     /* This function is callable only from one dedicated core. */
     assert(rtos_osGetIdxCore() == INTC_IRQ_TARGET_CORE);
     
-    if(sizeOfStr == 0)
-    {
-        return NULL;
-    }
-    else
-    {
-        /* Reserve space for a terminating zero byte. */
-        -- sizeOfStr;
-    }
-        
-    char *result = &str[0]
-       , *pWrApp = result;
-
-    /* Reading the ring buffer is done in a critical section to ensure mutual exclusion
-       with the it filling interrupt. */
+    /* See sio_osGetChar() for the purpose of the critical section. */
     uint32_t msr = rtos_osEnterCriticalSection();
-    {
-        volatile uint8_t * pRd = _pRdSerialInRingBuf;
-
-        /* If no line has been received then we need to double-check that the buffer is not
-           entirely full; if so we were stuck: No new characters (i.e. no newline) could
-           ever be received and the application would never again get a line of input.
-             If we find a full buffer then we consider the entire buffer as a single line
-           of input. */
-        if(_serialInNoEOL == 0)
-        {
-            volatile uint8_t * const pWr = _pWrSerialInRingBuf
-                           , * const pWrNext = pWr == _pEndSerialInRingBuf
-                                               ? &_serialInRingBuf[0]
-                                               : pWr + 1;
-            if(pWrNext == pRd)
-            {
-
-                /* pWr points immediately before pRd: Buffer is currently full. Copy
-                   complete contents as a (pseudo-) line of text. */
-                unsigned int noBytesToCopy = SERIAL_INPUT_RING_BUFFER_SIZE-1;
-                /// @todo Count and report lost characters at least in DEBUG compilation
-                if(noBytesToCopy > sizeOfStr)
-                    noBytesToCopy = sizeOfStr;
-
-                /* Copy the ring buffer (limited to the requested number of characters).
-                   Consider wrapping at the end of the linear area. */
-                const unsigned int noBytesTillEnd = (unsigned int)(_pEndSerialInRingBuf - pRd)
-                                                    + 1;
-                unsigned int noBytesAtEnd;
-                if(noBytesTillEnd >= noBytesToCopy)
-                {
-                    /* The requested number of characters is still found at the end of the
-                       ring buffer. */
-                    noBytesAtEnd = noBytesToCopy;
-                }
-                else
-                {
-                    /* We need to copy a second character sequence from the beginning of
-                       the ring buffer into the destination. */
-                    noBytesAtEnd = noBytesTillEnd;
-                }
-                
-                assert(noBytesAtEnd <= sizeOfStr);
-                memcpy(str, (const uint8_t*)pRd, noBytesAtEnd);
-                if(noBytesAtEnd < noBytesToCopy)
-                {
-                    memcpy( str+noBytesAtEnd
-                          , (const uint8_t*)&_serialInRingBuf[0]
-                          , noBytesToCopy-noBytesAtEnd
-                          );
-                }
-                
-                /* The client code expects a zero terminated C string. */
-                str[sizeOfStr] = '\0';
-
-                /* Adjust read pointer such that it represents the empty buffer. */
-                _pRdSerialInRingBuf = pWr;
-            }
-            else
-            {
-                /* No complete line of text has been read so far. */
-                str[0] = '\0';
-                result = NULL;
-            }
-        }
-        else
-        {
-            /* A line of text is available in the buffer. We copy the bytes in naive
-               loop instead of using memcpy, since we anyway need such a loop to find the
-               next EOL character. */
-            while(true)
-            {
-                /* We can have an empty buffer here, there's at minimum the EOL left. */
-                assert(pRd != _pWrSerialInRingBuf);
-                
-                /* Get next input character. */
-                char c = (char)*pRd;
-                
-                /* Loop termination is the first matching EOL character. */
-                if(c == SERIAL_INPUT_EOL)
-                {
-                    /* Acknowldge consumption of EOL character but do not return the
-                       (redundant) EOL character to the application. */
-                    -- _serialInNoEOL;
-                    
-                    /* Advance read pointer: The EOL is consumed by this call of the
-                       function. */
-                    _pRdSerialInRingBuf = pRd == _pEndSerialInRingBuf? &_serialInRingBuf[0]
-                                                                     : pRd + 1;
-                    
-                    /* End the copy loop. */
-                    break;
-                }
-                
-                /* Copy next character only if destination buffer still has room left. We
-                   continue to consume the rest of the line if this is not the case. */
-                if(sizeOfStr > 0)
-                {
-                    * pWrApp++ = *pRd;
-                    -- sizeOfStr;
-                }
-                /// @todo else Count and report lost characters at least in DEBUG compilation
-                
-                /* Cyclically advance read pointer. */
-                pRd = pRd == _pEndSerialInRingBuf? &_serialInRingBuf[0]: pRd + 1;
-                
-            } /* End while(All characters to consume from ring buffer) */
-            
-            /* Write the terminating zero byte to make the text line a C string. */
-            *pWrApp = '\0';
-        }
-    }
+    char * const result = sib_getLine(&_serialInBuf, str, sizeOfStr);
     rtos_osLeaveCriticalSection(msr);
 
     return result;
@@ -28,6 +28,7 @@
 #include <stdbool.h>
 
 #include "rtos.h"
+#include "sfr_serialFrame.h"
 
 
 /*
@@ -40,6 +41,9 @@
 /** Index of system call for reading from serial output. */
 #define SIO_SYSCALL_GET_LINE        21
 
+/** Index of system call for writing a frame into serial output. */
+#define SIO_SYSCALL_WRITE_SERIAL_FRAME  22
+
 /** A trivial helper for the use of sio_osWriteSerial() with literal strings: The typical
     double use of the string literal in the argument list of the function, once as such,
     once to calculate its length, is encapsulated in a macro. The readability of the source
@@ -92,6 +96,14 @@ extern volatile unsigned long sio_serialOutNoLostMsgBytes;
     sio_serialOutNoLostMsgBytes. */ 
 extern volatile unsigned long sio_serialInLostBytes;
 
+/** The number of frames, which have been queued for sending with sio_osWriteSerialFrame()
+    or sio_writeSerialFrame() since power-up. */
+extern volatile unsigned long sio_serialOutNoFrames;
+
+/** The number of frames since power-up, which were dropped as a whole because the ring
+    buffer for serial output was momentarily too full. Frames are never truncated. */
+extern volatile unsigned long sio_serialOutNoLostFrames;
+
 #ifdef DEBUG
 /** Count all input characters received since last reset. This variable is support in DEBUG
     compilation only. */
@@ -109,6 +121,9 @@ void sio_osInitSerialInterface(unsigned int baudRate);
 /** Write a character string into the serial interface. Can be called from OS context. */
 unsigned int sio_osWriteSerial(const char *msg, unsigned int noBytes);
 
+/** Write a frame of binary data into the serial interface. Can be called from OS code. */
+bool sio_osWriteSerialFrame(const sfr_segment_t segAry[], unsigned int noSegments);
+
 /** Application API function to read a single character from serial input. */
 signed int sio_osGetChar(void);
 
@@ -149,6 +164,32 @@ static inline unsigned int sio_writeSerial(const char *msg, unsigned int noBytes
 
 
 
+/** 
+ * API function for framed binary data output. The payload is gathered from a list of
+ * segments, protected by a CRC, COBS encoded and queued for sending. A frame is either
+ * queued entirely or dropped. See sio_osWriteSerialFrame() for details.
+ *   @return
+ * Get \a true if the frame has been queued for sending or \a false if it is lost.
+ *   @param segAry
+ * The segments of the payload of the frame.\n
+ *   Note, the array and all payload bytes must be entirely inside the used portions of RAM
+ * and ROM. Any attempt to send other data will be punished with task abortion.
+ *   @param noSegments
+ * The number of entries in \a segAry. No more than eight segments are permitted.
+ *   @remark
+ * This function must be called from the user task context only. Any attempt to use it from 
+ * OS code will lead to undefined behavior.
+ */
+static inline bool sio_writeSerialFrame( const sfr_segment_t segAry[]
+                                       , unsigned int noSegments
+                                       )
+{
+    return rtos_systemCall(SIO_SYSCALL_WRITE_SERIAL_FRAME, segAry, noSegments) != 0u;
+
+} /* End of sio_writeSerialFrame */
+
+
+
 /** 
  * Principal API function for data input. A line of input text is read from the internal
  *  buffer.
@@ -90,6 +90,32 @@
 #endif
 
 
+#if !defined(RTOS_CORE_0_SYSCALL_TABLE_ENTRY_0022)    \
+    && !defined(RTOS_CORE_1_SYSCALL_TABLE_ENTRY_0022) \
+    && !defined(RTOS_CORE_2_SYSCALL_TABLE_ENTRY_0022)
+    
+# if SIO_SYSCALL_WRITE_SERIAL_FRAME != 22
+#  error Inconsistent definition of system call
+# endif
+
+/* This system call is not specific to a core; all of them may use the same function. */
+# define RTOS_CORE_0_SYSCALL_TABLE_ENTRY_0022 \
+                                RTOS_SC_TABLE_ENTRY(sio_scFlHdlr_writeSerialFrame, FULL)
+# define RTOS_CORE_1_SYSCALL_TABLE_ENTRY_0022 RTOS_CORE_0_SYSCALL_TABLE_ENTRY_0022
+# define RTOS_CORE_2_SYSCALL_TABLE_ENTRY_0022 RTOS_CORE_0_SYSCALL_TABLE_ENTRY_0022
+
+#else
+# error System call 0022 is ambiguously defined
+
+/* We purposely redefine the table entry and despite of the already reported error; this
+   makes the compiler emit a message with the location of the conflicting previous
+   definition.*/
+# define RTOS_CORE_0_SYSCALL_TABLE_ENTRY_0022   RTOS_SYSCALL_DUMMY_TABLE_ENTRY
+# define RTOS_CORE_1_SYSCALL_TABLE_ENTRY_0022   RTOS_SYSCALL_DUMMY_TABLE_ENTRY
+# define RTOS_CORE_2_SYSCALL_TABLE_ENTRY_0022   RTOS_SYSCALL_DUMMY_TABLE_ENTRY
+#endif
+
+
 /*
  * Global type definitions
  */
@@ -110,6 +136,12 @@ unsigned int sio_scFlHdlr_writeSerial( uint32_t pidOfCallingTask
                                      , unsigned int noBytes
                                      );
 
+/* Preemptable system call implementation to write a frame to the serial interface. */
+uint32_t sio_scFlHdlr_writeSerialFrame( uint32_t pidOfCallingTask
+                                      , const sfr_segment_t segAry[]
+                                      , unsigned int noSegments
+                                      );
+
 /* System call implementation to read a line of input text from the serial interface. */
 uint32_t sio_scSmplHdlr_getLine( uint32_t pidOfCallingTask
                                , char str[]
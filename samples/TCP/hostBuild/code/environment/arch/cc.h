@@ -0,0 +1,160 @@
+/*
+ * Copyright 2017-2020 NXP
+ * All rights reserved.
+ *
+ * This software is owned or controlled by NXP and may only be
+ * used strictly in accordance with the applicable license terms. By expressly
+ * accepting such terms or by downloading, installing, activating and/or otherwise
+ * using the software, you are agreeing that you have read, and that you agree to
+ * comply with and are bound by, such license terms. If you do not agree to be
+ * bound by the applicable license terms, then you may not retain, install,
+ * activate or otherwise use the software. The production use license in
+ * Section 2.3 is expressly granted for this software.
+ *
+ * This file is derived from lwIP contribution example with the following copyright:
+ *
+ * Copyright (c) 2001-2004 Swedish Institute of Computer Science.
+ * All rights reserved.
+ *
+ */
+
+/**
+ * @page misra_violations MISRA-C:2012 violations
+ *
+ * @section [global]
+ * Violates MISRA 2012 Advisory Directive 4.9, A function should be used in preference
+ * to a function-like macro where they are interchangeable.
+ * Function-like macros are used instead of inline functions in order to ensure
+ * that the performance will not be decreased if the functions will not be
+ * inlined by the compiler.
+ *
+ */
+
+/* Host build: This is a copy of code/application/ipStack/integrationLwIP/arch/cc.h with the
+   adaptations for a little endian Linux host with glibc:
+     - BYTE_ORDER is LITTLE_ENDIAN
+     - LWIP_NO_UNISTD_H avoids the clash of unistd.h's write() with static functions of
+       the same name in the applications
+     - The diagnostic output uses printf rather than newlib's iprintf
+     - The definition of BYTE_ORDER made by the host's C library headers doesn't lead
+       to an error */
+
+#ifndef LWIP_ARCH_CC_H
+#define LWIP_ARCH_CC_H
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <assert.h>
+
+#include "lwipcfg.h"
+#include "ics_internetChecksum.h"
+
+#if defined(BYTE_ORDER)                 \
+    || defined(LWIP_NO_STDDEF_H)        \
+    || defined(LWIP_NO_STDINT_H)        \
+    || defined(LWIP_PLATFORM_ASSERT)    \
+    || defined(LWIP_PROVIDE_ERRNO)      \
+    || defined(PACK_STRUCT_FIELD)       \
+    || defined(PACK_STRUCT_STRUCT)      \
+    || defined(PACK_STRUCT_Begin)       \
+    || defined(PACK_STRUCT_END)         \
+    || defined(LWIP_PLATFORM_DIAG)      \
+    || defined(LWIP_RAND)               \
+    || defined(LWIP_CHKSUM)             \
+    || defined(LWIP_CHKSUM_COPY)
+/* glibc's endian.h, which is included by stdlib.h, defines BYTE_ORDER. It is redefined
+   below to the lwIP spelling of the same value. */
+# undef BYTE_ORDER
+#endif
+
+/** Define the byte order of the system.
+ * Needed for conversion of network data to host byte order.
+ * Allowed values: LITTLE_ENDIAN and BIG_ENDIAN
+ */
+#define BYTE_ORDER LITTLE_ENDIAN
+
+/** Define this to 1 in arch/cc.h of your port if you do not want to
+ * include stddef.h header to get size_t. You need to typedef size_t
+ * by yourself in this case.
+ */
+#define LWIP_NO_STDDEF_H    0
+ 
+/** Define this to 1 in arch/cc.h of your port if your compiler does not provide
+ * the stdint.h header. You need to typedef the generic types listed in
+ * lwip/arch.h yourself in this case (u8_t, u16_t...).
+ */
+#define LWIP_NO_STDINT_H    0
+
+/** The host's unistd.h declares write(), which clashes with local functions of the
+    applications. */
+#define LWIP_NO_UNISTD_H    1
+
+/** Platform specific assertion handling.<br>
+ * Note the default implementation in lwip/arch.h pulls in printf, fflush and abort, which
+ * may in turn pull in a lot of standard library code. In resource-constrained systems,
+ * this should be defined to something less resource-consuming.
+ */
+#define LWIP_PLATFORM_ASSERT(x) assert(false)
+
+/** LWIP_PROVIDE_ERRNO==1: Let lwIP provide ERRNO values and the 'errno' variable.
+ * If this is disabled, cc.h must either define 'errno', include <errno.h>,
+ * define LWIP_ERRNO_STDINCLUDE to get <errno.h> included or
+ * define LWIP_ERRNO_INCLUDE to <errno.h> or equivalent.
+ */
+#define LWIP_PROVIDE_ERRNO  1
+
+/** Packed structs support.
+ * Wraps u32_t and u16_t members.<br>
+ * For examples of packed struct declarations, see include/lwip/prot/ subfolder.<br>
+ * A port to GCC/clang is included in lwIP, if you use these compilers there is nothing to do here.
+ */
+#define PACK_STRUCT_FIELD(x) x
+
+/** Packed structs support.
+ * Placed between end of declaration of a packed struct and trailing semicolon.<br>
+ * For examples of packed struct declarations, see include/lwip/prot/ subfolder.<br>
+ * A port to GCC/clang is included in lwIP, if you use these compilers there is nothing to
+ * do here.
+ */
+#define PACK_STRUCT_STRUCT __attribute__((packed))
+
+/** Packed structs support.
+ * Placed BEFORE declaration of a packed struct.<br>
+ * For examples of packed struct declarations, see include/lwip/prot/ subfolder.<br>
+ * A port to GCC/clang is included in lwIP, if you use these compilers there is nothing to
+ * do here.
+ */
+#define PACK_STRUCT_BEGIN
+
+/** Packed structs support.
+ * Placed AFTER declaration of a packed struct.<br>
+ * For examples of packed struct declarations, see include/lwip/prot/ subfolder.<br>
+ * A port to GCC/clang is included in lwIP, if you use these compilers there is nothing to
+ * do here.
+ */
+#define PACK_STRUCT_END
+
+#define LWIP_ERROR(message, expression, handler) do { if (!(expression)) {handler;} } while(0)
+
+/** Platform specific diagnostic output.<br>
+ * Note the default implementation pulls in printf, which may
+ * in turn pull in a lot of standard library code. In resource-constrained
+ * systems, this should be defined to something less resource-consuming.
+ */
+#define LWIP_PLATFORM_DIAG(x)   do {printf x;} while(0)
+
+/** Define random number generator function of your system */
+#define LWIP_RAND() ((u32_t)rand())
+
+/** The Internet checksum routine. lwIP's generic implementation processes 16 Bit at a
+    time; the project's routine is tuned for the big-endian e200z4 and processes aligned
+    32 Bit words. */
+#define LWIP_CHKSUM ics_internetChecksum
+
+/** Copy data and compute the Internet checksum at the same time. Used by lwIP only if
+    #LWIP_CHECKSUM_ON_COPY is set. */
+#define LWIP_CHKSUM_COPY(dst, src, len) ics_internetChecksumCopy((dst), (src), (len))
+
+#define PPP_INCLUDE_SETTINGS_HEADER
+
+#endif /* LWIP_ARCH_CC_H */
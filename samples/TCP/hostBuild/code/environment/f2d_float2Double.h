@@ -0,0 +1,34 @@
+#ifndef F2D_FLOAT2DOUBLE_INCLUDED
+#define F2D_FLOAT2DOUBLE_INCLUDED
+/**
+ * @file f2d_float2Double.h
+ * Host build: Replacement of code/system/drivers/serial/f2d_float2Double.h. On the target,
+ * f2d is an assembler function with faked return type int64_t, which works around
+ * -fshort-double. On the host, the faked type would break the variadic calling convention
+ * of printf; a plain type cast is all, which is required.
+ *
+ * Copyright (C) 2026 Peter Vranken (mailto:Peter_Vranken@Yahoo.de)
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Defines
+ */
+
+/** Convert a float into a double for use as argument of printf. */
+#define f2d(f)  ((double)(f))
+
+
+#endif  /* F2D_FLOAT2DOUBLE_INCLUDED */
@@ -0,0 +1,51 @@
+#ifndef STD_DECORATEDSTORAGE_INCLUDED
+#define STD_DECORATEDSTORAGE_INCLUDED
+/**
+ * @file std_decoratedStorage.h
+ * Host build: Replacement of code/system/drivers/mutex/std_decoratedStorage.h. The
+ * original implements the operations with e200z4 assembler instructions. The host build
+ * of the IP stack runs all tasks in a single thread and only needs the memory barrier.
+ *
+ * Copyright (C) 2026 Peter Vranken (mailto:Peter_Vranken@Yahoo.de)
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+/* Module inline interface
+ *   std_fullMemoryBarrier
+ */
+
+/*
+ * Include files
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <assert.h>
+
+
+/*
+ * Global inline functions
+ */
+
+/**
+ * Full memory barrier, see original function in the target code.
+ */
+static inline void std_fullMemoryBarrier(void)
+{
+    __sync_synchronize();
+
+} /* End of std_fullMemoryBarrier */
+
+
+#endif  /* STD_DECORATEDSTORAGE_INCLUDED */
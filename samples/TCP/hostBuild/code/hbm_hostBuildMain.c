@@ -0,0 +1,448 @@
+/**
+ * @file hbm_hostBuildMain.c
+ * Host build: The main function of the host build of the IP stack. It plays the role of
+ * the RTOS and of the basic software of the target: It clocks the IP task,
+ * lwd_lwIpDemo_main(), on the regular 10ms tick, on the Rx and Tx interrupts of the
+ * emulated Ethernet driver, see hed_hostEthernetDriver.c, and when the task triggers
+ * itself.\n
+ *   The application prints a report line in a configurable interval. It tells the
+ * throughput in both directions, the response latency of the IP stack, the processing
+ * time of the IP task per activation and the pressure on the memory pools: The number of
+ * failed allocations from the lwIP heap and pools and of lost Tx pbufs. At the end of the
+ * run, the lwIP memory statistics and the size suggestions of module
+ * lws_lwIPStatistics.c are printed.\n
+ *   The time base is the real time when running on a TAP interface. A pcap replay runs in
+ * virtual time; the application advances the time to the next event as soon as the IP
+ * task is idle. This makes the replay deterministic and as fast as the host can do, while
+ * all time dependent figures, throughput and latency, relate to the emulated target time.
+ * Only the processing time is measured in real host time.\n
+ *   The exit code is zero if the run succeeded without a memory pressure related error,
+ * two if an allocation failed or a pbuf was lost and one in case of other errors. This
+ * makes the application usable in a CI pipeline.
+ *
+ * Copyright (C) 2026 Peter Vranken (mailto:Peter_Vranken@Yahoo.de)
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+/* Module interface
+ *   main
+ * Local functions
+ *   onSignal
+ *   getRealTimeInNs
+ *   usage
+ *   getNoMemoryErrors
+ *   printReport
+ *   printFinalReport
+ */
+
+/*
+ * Include files
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <signal.h>
+#include <time.h>
+#include <poll.h>
+#include <getopt.h>
+#include <arpa/inet.h>
+#include <assert.h>
+
+#include "typ_types.h"
+#include "hen_hostEnvironment.h"
+#include "hed_hostEthernetDriver.h"
+#include "lwd_lwIpDemo.h"
+#include "lws_lwIPStatistics.h"
+#include "lwip_lwIPMainFunction.h"
+#include "nif_queueTxPBuf.h"
+#include "lwip/stats.h"
+#include "lwip/memp.h"
+
+
+/*
+ * Defines
+ */
+
+/** The time after the end of a pcap replay, which the run is continued by default, in s.
+    It gives the IP stack the chance to complete pending exchanges. */
+#define TI_DRAIN_AFTER_REPLAY_IN_S  2.0
+
+/** The exit code of the application if a memory allocation failed or a pbuf was lost. */
+#define EXIT_MEMORY_PRESSURE        2
+
+
+/*
+ * Local type definitions
+ */
+
+/** The processing time of the IP task. */
+typedef struct processingTime_t
+{
+    /** The number of activations of the IP task. */
+    unsigned long noActivations;
+
+    /** The sum and the maximum of the processing time in ns. */
+    int64_t tiSumInNs, tiMaxInNs;
+
+} processingTime_t;
+
+
+/*
+ * Local prototypes
+ */
+
+
+/*
+ * Data definitions
+ */
+
+/** The application has been asked to terminate. */
+static volatile sig_atomic_t _isTerminate = 0;
+
+
+/*
+ * Function implementation
+ */
+
+/**
+ * Signal handler for Ctrl-C: Terminate the run and print the final report.
+ */
+static void onSignal(int sig ATTRIB_UNUSED)
+{
+    _isTerminate = 1;
+
+} /* onSignal */
+
+
+/**
+ * Get the real time of the host. Used to measure processing time.
+ *   @return
+ * Get the time in ns.
+ */
+static int64_t getRealTimeInNs(void)
+{
+    struct timespec ti;
+    clock_gettime(CLOCK_MONOTONIC, &ti);
+    return (int64_t)ti.tv_sec * 1000000000ll + (int64_t)ti.tv_nsec;
+
+} /* getRealTimeInNs */
+
+
+/**
+ * Print the command line usage.
+ */
+static void usage(void)
+{
+    printf( "usage: hostBuild.exe (-i <tapIf> | -r <file.pcap> [-x <speed>])"
+            " [-w <out.pcap>] [-t <s>] [-s <s>] [-b <Mbps>] [-p <ipAddr>]\n"
+            "  -i  Connect to existing TAP interface, e.g. tap0. Real time\n"
+            "  -r  Replay the frames of a pcap file. Virtual time\n"
+            "  -x  Replay speed relative to recording, 0: as fast as possible."
+            " Default: 1\n"
+            "  -w  Record all sent frames in a pcap file\n"
+            "  -t  Duration of the run in s. Default: Until Ctrl-C or %.0f s after end"
+            " of replay\n"
+            "  -s  Interval of status report in s. Default: 1\n"
+            "  -b  Emulated link rate in Mbit/s. Default: %u\n"
+            "  -p  Enable the lwIP ping application with the given target address\n"
+            "The board has the IP address 192.168.1.200/24.\n"
+          , TI_DRAIN_AFTER_REPLAY_IN_S
+          , HED_DEFAULT_LINK_RATE
+          );
+} /* usage */
+
+
+/**
+ * Get the number of memory pressure related errors: The failed allocations from the lwIP
+ * heap and pools and the pbufs, which were lost in the Tx queue of the network interface.
+ *   @return
+ * Get the total number of errors since startup.
+ */
+static unsigned long getNoMemoryErrors(void)
+{
+    /* The lwIP statistics are reset on user demand. This doesn't happen in the host build,
+       the error counts are the counts since startup. */
+    unsigned long noErrs = lwip_stats.mem.err;
+    for(unsigned int idxPool=0u; idxPool<(unsigned)MEMP_MAX; ++idxPool)
+        noErrs += lwip_stats.memp[idxPool]->err;
+
+#if NIF_SUPPORT_BUFFER_USAGE_STATISTICS == 1
+    struct nif_queueTxPBufStatistics_t statQ;
+    nif_queueTxPBuf_getStatistics(&statQ, /* reset */ false);
+    noErrs += statQ.noElemsLost;
+#endif
+    return noErrs;
+
+} /* getNoMemoryErrors */
+
+
+/**
+ * Print the regular status line.
+ *   @param tiIntervalInNs
+ * The time since the previous status line. The rates relate to this time.
+ *   @param pProcTime
+ * The processing time of the IP task since the previous status line. The object is reset.
+ */
+static void printReport(int64_t tiIntervalInNs, processingTime_t *pProcTime)
+{
+    struct hed_statistics_t stat;
+    hed_getStatistics(&stat, /* reset */ true);
+
+    const double tiInS = (double)tiIntervalInNs / 1e9;
+    printf( "%8.2f s: Rx %6.0f fr/s %7.3f Mbit/s, Tx %6.0f fr/s %7.3f Mbit/s"
+            ", lost/filtered/rejected %llu/%llu/%llu"
+          , (double)hen_getTimeInNs() / 1e9
+          , (double)stat.noRxFrames / tiInS
+          , (double)stat.noRxBytes * 8e-6 / tiInS
+          , (double)stat.noTxFrames / tiInS
+          , (double)stat.noTxBytes * 8e-6 / tiInS
+          , (unsigned long long)stat.noRxFramesLost
+          , (unsigned long long)stat.noRxFramesFiltered
+          , (unsigned long long)stat.noTxFramesRejected
+          );
+    if(stat.noLatencySamples > 0u)
+    {
+        printf( ", latency %.3f/%.3f/%.3f ms"
+              , (double)stat.tiLatencyMinInNs / 1e6
+              , (double)stat.tiLatencySumInNs / (double)stat.noLatencySamples / 1e6
+              , (double)stat.tiLatencyMaxInNs / 1e6
+              );
+    }
+    if(pProcTime->noActivations > 0u)
+    {
+        printf( ", task %lu act. %.1f/%.1f us"
+              , pProcTime->noActivations
+              , (double)pProcTime->tiSumInNs / (double)pProcTime->noActivations / 1e3
+              , (double)pProcTime->tiMaxInNs / 1e3
+              );
+    }
+    printf( ", heap %u/%u Byte, mem. errors %lu\n"
+          , (unsigned)lwip_stats.mem.used
+          , (unsigned)lwip_stats.mem.max
+          , getNoMemoryErrors()
+          );
+
+    memset(pProcTime, 0, sizeof(*pProcTime));
+
+} /* printReport */
+
+
+/**
+ * Print the lwIP memory statistics and the size suggestions at the end of the run. The
+ * reports of module lws_lwIPStatistics.c are requested and printed as the console task of
+ * the target would do.
+ */
+static void printFinalReport(void)
+{
+    const lws_kindOfReport_t kindOfReportAry[] = { lws_kindOfRpt_statistics
+                                                 , lws_kindOfRpt_suggestion
+                                                 };
+    for(unsigned int idxRpt=0u; idxRpt<sizeOfAry(kindOfReportAry); ++idxRpt)
+    {
+        const bool success ATTRIB_DBG_ONLY = lws_requestReport(kindOfReportAry[idxRpt]);
+        assert(success);
+        do
+        {
+            /* The snapshot is taken in the IP task context. In the host build, it's the
+               same thread. */
+            lws_mainFunction();
+        }
+        while(lws_printReport());
+    }
+
+    printf( "Ethernet Rx: %u polls, %u frames, max. %u frames per poll, %u times"
+            " budget exhausted, %u times skipped for Tx congestion\n"
+          , lwip_noEthRxPolls
+          , lwip_noEthRxFrames
+          , lwip_maxNoEthRxFramesPerPoll
+          , lwip_noEthRxBudgetExhausted
+          , lwip_noEthRxTxCongested
+          );
+    printf("CAN frames sent by the IP applications: %lu\n", hen_getNoCanTxFrames());
+
+} /* printFinalReport */
+
+
+/**
+ * Entry point into the host build of the IP stack.
+ *   @return
+ * Get the exit code: 0 on success, 2 on memory pressure related errors and 1 on other
+ * errors.
+ *   @param argc
+ * The number of command line arguments.
+ *   @param argv
+ * The command line arguments, see usage().
+ */
+int main(int argc, char *argv[])
+{
+    const char *tapIf = NULL
+             , *replayFile = NULL
+             , *outputFile = NULL;
+    double speedFactor = 1.0
+         , tiDurationInS = -1.0
+         , tiReportIntervalInS = 1.0;
+    unsigned int linkRateInMbps = HED_DEFAULT_LINK_RATE;
+    uint32_t pingAddr = 0u;
+
+    int opt;
+    while((opt = getopt(argc, argv, "i:r:w:x:t:s:b:p:h")) != -1)
+    {
+        switch(opt)
+        {
+        case 'i': tapIf = optarg; break;
+        case 'r': replayFile = optarg; break;
+        case 'w': outputFile = optarg; break;
+        case 'x': speedFactor = atof(optarg); break;
+        case 't': tiDurationInS = atof(optarg); break;
+        case 's': tiReportIntervalInS = atof(optarg); break;
+        case 'b': linkRateInMbps = (unsigned)atoi(optarg); break;
+        case 'p':
+        {
+            struct in_addr addr;
+            if(inet_pton(AF_INET, optarg, &addr) != 1)
+            {
+                fprintf(stderr, "Bad IPv4 address %s\n", optarg);
+                return EXIT_FAILURE;
+            }
+            pingAddr = addr.s_addr;
+            break;
+        }
+        default:
+            usage();
+            return opt == 'h'? EXIT_SUCCESS: EXIT_FAILURE;
+        }
+    }
+    if((tapIf == NULL) == (replayFile == NULL)
+       ||  speedFactor < 0.0
+       ||  tiReportIntervalInS <= 0.0
+       ||  linkRateInMbps < 1u  ||  linkRateInMbps > 10000u
+       ||  optind != argc
+      )
+    {
+        usage();
+        return EXIT_FAILURE;
+    }
+
+    const bool isVirtualTime = replayFile != NULL;
+    if(isVirtualTime)
+        hen_setVirtualTime(0);
+    hed_setLinkRate(linkRateInMbps);
+    if((tapIf != NULL  &&  !hed_openTap(tapIf))
+       ||  (replayFile != NULL  &&  !hed_openPcapReplay(replayFile, speedFactor))
+       ||  (outputFile != NULL  &&  !hed_openPcapOutput(outputFile))
+      )
+    {
+        hed_close();
+        return EXIT_FAILURE;
+    }
+    hen_setPingTargetAddress(pingAddr);
+
+    signal(SIGINT, onSignal);
+    signal(SIGTERM, onSignal);
+
+    /* Initialize lwIP and the IP applications, like the user init task of the target. */
+    lwd_lwIpDemo_init();
+
+    const int64_t tiReportIntervalInNs = (int64_t)(tiReportIntervalInS * 1e9);
+    int64_t tiEnd = tiDurationInS >= 0.0? (int64_t)(tiDurationInS * 1e9): INT64_MAX
+          , tiNextTick = 0
+          , tiNextReport = tiReportIntervalInNs
+          , tiLastReport = 0;
+    processingTime_t procTime = {.noActivations = 0u,};
+    while(!_isTerminate)
+    {
+        const int64_t tiNow = hen_getTimeInNs();
+        if(tiNow >= tiEnd)
+            break;
+
+        /* Collect the events, which activate the IP task. The target's RTOS would combine
+           all events into a single task activation, too, if the task is busy. */
+        unsigned int noNotificationsRx = 0u
+                   , noNotificationsTx = 0u
+                   , noNotificationsTimer = 0u;
+        hed_processEvents(&noNotificationsRx, &noNotificationsTx);
+        if(tiNow >= tiNextTick)
+        {
+            /* The RTOS counts a missed timer event as lost. The IP task sees only one. */
+            noNotificationsTimer = 1u;
+            do
+                tiNextTick += HEN_TI_TICK_IN_NS;
+            while(tiNextTick <= tiNow);
+        }
+
+        /* The IP task may have triggered itself to continue fetching Rx frames. */
+        const bool isRetriggered = hen_isEthernetTaskRetriggered();
+        if(noNotificationsRx + noNotificationsTx + noNotificationsTimer > 0u
+           ||  isRetriggered
+          )
+        {
+            const int64_t tiStart = getRealTimeInNs();
+            lwd_lwIpDemo_main(noNotificationsRx, noNotificationsTx, noNotificationsTimer);
+            const int64_t tiProc = getRealTimeInNs() - tiStart;
+            ++ procTime.noActivations;
+            procTime.tiSumInNs += tiProc;
+            if(tiProc > procTime.tiMaxInNs)
+                procTime.tiMaxInNs = tiProc;
+
+            if(noNotificationsTimer > 0u)
+            {
+                hen_onTimerTick();
+
+                /* The statistics module is designed for the console task. */
+                lws_printReport();
+
+                if(tiNow >= tiNextReport)
+                {
+                    printReport(tiNow - tiLastReport, &procTime);
+                    tiLastReport = tiNow;
+                    tiNextReport += tiReportIntervalInNs;
+                }
+
+                /* The replay ends a while after the last frame, if no duration is given. */
+                if(tiEnd == INT64_MAX  &&  replayFile != NULL  &&  hed_isEndOfReplay())
+                    tiEnd = tiNow + (int64_t)(TI_DRAIN_AFTER_REPLAY_IN_S * 1e9);
+            }
+        }
+        else
+        {
+            /* The IP task is idle. Wait for the next event. */
+            int64_t tiNext = hed_getTiNextEvent();
+            if(tiNextTick < tiNext)
+                tiNext = tiNextTick;
+            assert(tiNext > tiNow);
+
+            if(isVirtualTime)
+                hen_setVirtualTime(tiNext);
+            else
+            {
+                struct pollfd pfd = {.fd = hed_getFileDescriptor(), .events = POLLIN,};
+                const int64_t tiTimeoutInMs = (tiNext - tiNow + 999999) / 1000000;
+                poll(&pfd, 1u, (int)tiTimeoutInMs);
+            }
+        }
+    } /* while(Run not terminated) */
+
+    printFinalReport();
+    hed_close();
+
+    const unsigned long noMemErrs = getNoMemoryErrors();
+    if(noMemErrs > 0u)
+    {
+        printf("%lu memory allocation errors or lost pbufs\n", noMemErrs);
+        return EXIT_MEMORY_PRESSURE;
+    }
+    return EXIT_SUCCESS;
+
+} /* main */
@@ -0,0 +1,1284 @@
+/**
+ * @file hed_hostEthernetDriver.c
+ * Host build: Emulation of the Ethernet driver of the target, eth_ethernet.c, at its
+ * system call interface. The lwIP integration and the IP applications run unchanged on
+ * top of it.\n
+ *   The emulation models those properties of the ENET, which matter for the sizing and
+ * the timing of the IP stack:
+ *   - The Rx ring has #ETH_ENET0_RING0_NO_RXBD buffers. A buffer is owned by the client
+ * code from fetching the frame until it is returned with eth_releaseRxFramePayloadBuffer().
+ * A frame is lost if no buffer is free on reception
+ *   - The Tx ring has #ETH_ENET0_RING0_NO_TXBD buffer descriptors. A frame occupies one
+ * per fragment. The descriptors are used in ring order; they become free when the client
+ * code has seen the completion of the frame with eth_isTransmissionCompleted() or
+ * eth_getNoTransmissionsCompleted(). A send request is rejected if too few descriptors
+ * are free
+ *   - A frame completes transmission after the time it occupies the link at the
+ * configured link rate, see hed_setLinkRate(). Each completed frame raises a Tx
+ * notification
+ *   - The Rx interrupt mitigation, see #ETH_RX_INTERRUPT_MITIGATION
+ *   - The Tx accelerator of the ENET inserts the IPv4 header checksum and the TCP, UDP and
+ * ICMP checksums, lwIP is configured not to compute them in software
+ *   - The MAC filter passes unicast frames to the own MAC address, broadcast frames and
+ * multicast frames, which have been enabled by eth_setMulticastForward()
+ *
+ *   The frames are exchanged with a TAP interface of the Linux host or they are read from
+ * a pcap file, which is replayed. Optionally, all sent frames are recorded in another
+ * pcap file.\n
+ *   The driver measures the response latency: It is the time from fetching a frame from
+ * the Rx ring, which was received while no other fetched frame was pending for response,
+ * until the next frame is submitted for sending. For request/response protocols like ping,
+ * ARP or a TCP exchange, this is the latency of the IP stack.
+ *
+ * Copyright (C) 2026 Peter Vranken (mailto:Peter_Vranken@Yahoo.de)
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+/* Module interface
+ *   hed_openTap
+ *   hed_openPcapReplay
+ *   hed_openPcapOutput
+ *   hed_setLinkRate
+ *   hed_getFileDescriptor
+ *   hed_getTiNextEvent
+ *   hed_isEndOfReplay
+ *   hed_processEvents
+ *   hed_systemCall
+ *   hed_getStatistics
+ *   hed_close
+ * Local functions
+ *   badSystemCall
+ *   rd16
+ *   rd32
+ *   onesComplementSum
+ *   foldChecksum
+ *   insertChecksums
+ *   isAcceptedByMacFilter
+ *   receiveFrame
+ *   fetchFrame
+ *   readNextPcapRecord
+ *   writePcapRecord
+ *   scSetMulticastForward
+ *   scProvideRxBuff
+ *   scReadFrame
+ *   scReadFrames
+ *   scSendFrame
+ *   scIsTransmissionCompleted
+ *   scEnableRxInterrupt
+ */
+
+/*
+ * Include files
+ */
+
+#include "hed_hostEthernetDriver.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <assert.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <net/if.h>
+#include <linux/if_tun.h>
+
+#include "eth_ethernet.h"
+#include "hen_hostEnvironment.h"
+
+
+/*
+ * Defines
+ */
+
+/** The maximum number of multicast MAC addresses, which can be enabled at a time. */
+#define MAX_NO_MULTICAST_ADDRS  32u
+
+/** The maximum size of a record in a pcap file, which can be read. */
+#define MAX_SIZE_OF_PCAP_RECORD 65535u
+
+/** The overhead of a frame on the link in Byte: Preamble, SFD, CRC and inter-frame gap. */
+#define LINK_OVERHEAD_PER_FRAME (7u + 1u + 4u + 12u)
+
+/** The minimum length of a frame on the link without CRC. Shorter frames are padded. */
+#define MIN_FRAME_LEN           60u
+
+
+/*
+ * Local type definitions
+ */
+
+/** The states of an Rx buffer. */
+typedef enum rxBufferState_t
+{
+    rxBuf_free,     /** Owned by the driver, waiting for a frame. */
+    rxBuf_filled,   /** Owned by the driver, holding a received frame. */
+    rxBuf_client,   /** Owned by the client code. */
+
+} rxBufferState_t;
+
+/** An Rx buffer. */
+typedef struct rxBuffer_t
+{
+    /** The frame contents. */
+    uint8_t frame[HED_MAX_FRAME_LEN];
+
+    /** The length of the received frame in Byte. */
+    unsigned int length;
+
+    /** The time of reception of the frame. */
+    int64_t tiRx;
+
+    /** The state of the buffer. */
+    rxBufferState_t state;
+
+} rxBuffer_t;
+
+/** A frame in the Tx ring. */
+typedef struct txFrame_t
+{
+    /** The handle of the frame as returned to the client code. */
+    uint32_t hFrame;
+
+    /** The number of buffer descriptors occupied by the frame. */
+    unsigned int noFragments;
+
+    /** The time, when the frame has been sent. */
+    int64_t tiCompletion;
+
+    /** The frame has been sent but the client code has not seen it yet. */
+    bool isCompleted;
+
+    /** The client code has seen the completion. The buffer descriptors are released as
+        soon as all preceding frames are released, too. */
+    bool isReleased;
+
+    /** The length of the frame in Byte. */
+    unsigned int length;
+
+    /** The frame contents. */
+    uint8_t frame[HED_MAX_FRAME_LEN];
+
+} txFrame_t;
+
+
+/*
+ * Local prototypes
+ */
+
+
+/*
+ * Data definitions
+ */
+
+/** The own MAC address, which passes the MAC filter. */
+static const uint8_t _macAddr[6] = ETH_ENET0_MAC_ADDR;
+
+/** The enabled multicast MAC addresses. */
+static uint8_t _multicastAddrAry[MAX_NO_MULTICAST_ADDRS][6];
+
+/** The number of enabled multicast MAC addresses. */
+static unsigned int _noMulticastAddrs = 0u;
+
+/** The Rx buffers. */
+static rxBuffer_t _rxBufferAry[ETH_ENET0_RING0_NO_RXBD];
+
+/** The filled Rx buffers in order of reception. A FIFO with read and write index. */
+static unsigned int _rxFifo[ETH_ENET0_RING0_NO_RXBD];
+static unsigned int _idxRxFifoRd = 0u
+                  , _idxRxFifoWr = 0u;
+
+/** The descriptors of a single fetched frame, returned by system call
+    #ETH_SYSCALL_READ_FRAME. */
+static struct eth_bufferDesc_t _rxFrameDesc;
+
+/** The descriptors of a batch of fetched frames, returned by system call
+    #ETH_SYSCALL_READ_FRAMES. */
+static struct eth_rxFrameBatch_t _rxFrameBatch;
+
+/** The Rx interrupt is enabled. */
+static bool _isRxInterruptEnabled = true;
+
+/** The frames in the Tx ring. A FIFO with read and write index. Each frame occupies at
+    least one buffer descriptor, the FIFO can't hold more frames than there are
+    descriptors. */
+static txFrame_t _txFifo[ETH_ENET0_RING0_NO_TXBD];
+static unsigned int _idxTxFifoRd = 0u
+                  , _idxTxFifoWr = 0u;
+
+/** The number of buffer descriptors occupied by the frames in \a _txFifo. */
+static unsigned int _noTxBDInUse = 0u;
+
+/** The handle of the most recently submitted Tx frame. */
+static uint32_t _hTxFrameLast = 0u;
+
+/** The handles of the frames, which have been submitted with #ETH_SYSCALL_SEND_FRAMES
+    and which have not been reported completed yet. A FIFO in order of submission. */
+static uint32_t _hTxPendingFrameAry[ETH_ENET0_RING0_NO_TXBD];
+static unsigned int _idxTxPendingFrameRd = 0u
+                  , _idxTxPendingFrameWr = 0u;
+
+/** The time, when the link will be free for the next frame. */
+static int64_t _tiLinkFree = 0;
+
+/** The emulated link rate in Mbit/s. */
+static unsigned int _linkRateInMbps = HED_DEFAULT_LINK_RATE;
+
+/** The time of fetching the earliest frame, which has not been answered yet, or -1 if
+    there's no such frame. */
+static int64_t _tiRxUnanswered = -1;
+
+/** The file descriptor of the TAP interface or -1 if not in use. */
+static int _fdTap = -1;
+
+/** The pcap file, which is replayed, or NULL if not in use. */
+static FILE *_hPcapReplay = NULL;
+
+/** The replayed file has byte-swapped headers. */
+static bool _isPcapReplaySwapped = false;
+
+/** The sub-second field of the replayed file is in ns rather than in us. */
+static bool _isPcapReplayNs = false;
+
+/** The replay speed relative to the recording. Zero means as fast as the Rx ring accepts
+    the frames. */
+static double _replaySpeedFactor = 1.0;
+
+/** The next record of the replayed file. Valid if \a _isPcapRecordPending. */
+static uint8_t _pcapRecord[MAX_SIZE_OF_PCAP_RECORD];
+static unsigned int _sizeOfPcapRecord = 0u;
+static bool _isPcapRecordPending = false;
+
+/** The time of reception of the next record of the replayed file. */
+static int64_t _tiPcapRecord = 0;
+
+/** The timestamp of the first record of the replayed file in ns. */
+static int64_t _tiPcapRecordFirst = -1;
+
+/** The pcap file, which records the sent frames, or NULL if not in use. */
+static FILE *_hPcapOutput = NULL;
+
+/** The statistics. */
+static struct hed_statistics_t _statistics;
+
+
+/*
+ * Function implementation
+ */
+
+/**
+ * Handle a bad argument of a system call like the RTOS does: The calling task is aborted,
+ * which is the entire process in the host build.
+ *   @param msg
+ * A description of the error.
+ */
+static _Noreturn void badSystemCall(const char *msg)
+{
+    fprintf(stderr, "hed_systemCall: Bad argument: %s\n", msg);
+    abort();
+
+} /* badSystemCall */
+
+
+/**
+ * Read a 16 Bit number in network byte order.
+ */
+static inline unsigned int rd16(const uint8_t *p)
+{
+    return ((unsigned int)p[0] << 8) | p[1];
+}
+
+
+/**
+ * Read a 32 Bit number from a pcap header, considering the byte order of the file.
+ */
+static inline uint32_t rd32(const uint8_t *p)
+{
+    uint32_t u;
+    memcpy(&u, p, sizeof(u));
+    return _isPcapReplaySwapped? __builtin_bswap32(u): u;
+}
+
+
+/**
+ * Add the 16 Bit words of a byte sequence in ones' complement arithmetic. An odd trailing
+ * byte is padded with zero.
+ *   @return
+ * Get the unfolded sum.
+ *   @param sum
+ * The sum of preceding data.
+ *   @param p
+ * The data.
+ *   @param len
+ * The number of bytes.
+ */
+static uint32_t onesComplementSum(uint32_t sum, const uint8_t *p, unsigned int len)
+{
+    while(len >= 2u)
+    {
+        sum += rd16(p);
+        p += 2;
+        len -= 2u;
+    }
+    if(len > 0u)
+        sum += (uint32_t)p[0] << 8;
+    return sum;
+
+} /* onesComplementSum */
+
+
+/**
+ * Fold a ones' complement sum into the 16 Bit checksum.
+ */
+static unsigned int foldChecksum(uint32_t sum)
+{
+    while(sum > 0xFFFFu)
+        sum = (sum & 0xFFFFu) + (sum >> 16);
+    return ~sum & 0xFFFFu;
+
+} /* foldChecksum */
+
+
+/**
+ * Emulation of the Tx accelerator of the ENET: The IPv4 header checksum and the TCP, UDP
+ * and ICMP checksums are computed and inserted into the frame. lwIP leaves the checksum
+ * fields zero, see CHECKSUM_GEN_* in lwipopts.h. Fragmented IP packets get no protocol
+ * checksum; ICMPv6 is not touched, lwIP computes its checksum in software.
+ *   @param frame
+ * The frame, which is modified in place.
+ *   @param len
+ * The length of the frame.
+ */
+static void insertChecksums(uint8_t *frame, unsigned int len)
+{
+    unsigned int idxL3 = 14u;
+    if(len < idxL3)
+        return;
+    unsigned int etherType = rd16(&frame[12]);
+    if(etherType == 0x8100u  &&  len >= 18u)
+    {
+        etherType = rd16(&frame[16]);
+        idxL3 = 18u;
+    }
+
+    uint8_t *pL3 = &frame[idxL3];
+    uint8_t *pL4;
+    unsigned int protocol, lenL4;
+    uint32_t sumPseudoHdr;
+    if(etherType == 0x0800u  &&  len >= idxL3 + 20u)
+    {
+        const unsigned int lenHdr = (pL3[0] & 0x0Fu) * 4u
+                         , lenTotal = rd16(&pL3[2]);
+        if(lenHdr < 20u  ||  lenTotal < lenHdr  ||  idxL3 + lenTotal > len)
+            return;
+
+        pL3[10] = pL3[11] = 0u;
+        const unsigned int chkSumIp = foldChecksum(onesComplementSum(0u, pL3, lenHdr));
+        pL3[10] = (uint8_t)(chkSumIp >> 8);
+        pL3[11] = (uint8_t)chkSumIp;
+
+        /* No protocol checksum for fragments. */
+        if((rd16(&pL3[6]) & 0x3FFFu) != 0u)
+            return;
+
+        protocol = pL3[9];
+        pL4 = pL3 + lenHdr;
+        lenL4 = lenTotal - lenHdr;
+        sumPseudoHdr = onesComplementSum(0u, &pL3[12], 8u) + protocol + lenL4;
+    }
+    else if(etherType == 0x86DDu  &&  len >= idxL3 + 40u)
+    {
+        protocol = pL3[6];
+        pL4 = pL3 + 40;
+        lenL4 = rd16(&pL3[4]);
+        if(idxL3 + 40u + lenL4 > len)
+            return;
+        sumPseudoHdr = onesComplementSum(0u, &pL3[8], 32u) + protocol + lenL4;
+
+        /* ICMPv6 is done in software and extension headers are not supported. */
+        if(protocol != 6u  &&  protocol != 17u)
+            return;
+    }
+    else
+        return;
+
+    unsigned int idxChkSum;
+    if(protocol == 6u  &&  lenL4 >= 20u)
+        idxChkSum = 16u;
+    else if(protocol == 17u  &&  lenL4 >= 8u)
+        idxChkSum = 6u;
+    else if(protocol == 1u  &&  lenL4 >= 4u  &&  etherType == 0x0800u)
+    {
+        idxChkSum = 2u;
+        sumPseudoHdr = 0u;
+    }
+    else
+        return;
+
+    pL4[idxChkSum] = pL4[idxChkSum+1u] = 0u;
+    unsigned int chkSum = foldChecksum(onesComplementSum(sumPseudoHdr, pL4, lenL4));
+    if(chkSum == 0u  &&  protocol == 17u)
+        chkSum = 0xFFFFu;
+    pL4[idxChkSum] = (uint8_t)(chkSum >> 8);
+    pL4[idxChkSum+1u] = (uint8_t)chkSum;
+
+} /* insertChecksums */
+
+
+/**
+ * Emulation of the MAC address filter.
+ *   @return
+ * Get \a true if the frame is accepted.
+ *   @param frame
+ * The received frame. It is at least 6 Byte long.
+ */
+static bool isAcceptedByMacFilter(const uint8_t *frame)
+{
+    static const uint8_t macBroadcast[6] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+    if(memcmp(frame, _macAddr, 6u) == 0  ||  memcmp(frame, macBroadcast, 6u) == 0)
+        return true;
+
+    if((frame[0] & 0x01u) != 0u)
+    {
+        for(unsigned int idx=0u; idx<_noMulticastAddrs; ++idx)
+            if(memcmp(frame, _multicastAddrAry[idx], 6u) == 0)
+                return true;
+    }
+    return false;
+
+} /* isAcceptedByMacFilter */
+
+
+/**
+ * A frame arrives at the MAC. It is put into a free Rx buffer if it passes the MAC
+ * filter.
+ *   @return
+ * Get \a true if the Rx interrupt is raised.
+ *   @param frame
+ * The frame contents without CRC.
+ *   @param len
+ * The length of the frame.
+ */
+static bool receiveFrame(const uint8_t *frame, unsigned int len)
+{
+    if(len < 14u  ||  len > HED_MAX_FRAME_LEN  ||  !isAcceptedByMacFilter(frame))
+    {
+        ++ _statistics.noRxFramesFiltered;
+        return false;
+    }
+
+    unsigned int idxBuf;
+    for(idxBuf=0u; idxBuf<ETH_ENET0_RING0_NO_RXBD; ++idxBuf)
+        if(_rxBufferAry[idxBuf].state == rxBuf_free)
+            break;
+    if(idxBuf >= ETH_ENET0_RING0_NO_RXBD)
+    {
+        ++ _statistics.noRxFramesLost;
+        return false;
+    }
+
+    /* The Rx accelerator of the ENET removes the padding but lwIP handles padded frames
+       as well; the frame is taken as it is. */
+    rxBuffer_t * const pBuf = &_rxBufferAry[idxBuf];
+    memcpy(pBuf->frame, frame, len);
+    pBuf->length = len;
+    pBuf->tiRx = hen_getTimeInNs();
+    pBuf->state = rxBuf_filled;
+    _rxFifo[_idxRxFifoWr % ETH_ENET0_RING0_NO_RXBD] = idxBuf;
+    ++ _idxRxFifoWr;
+
+    ++ _statistics.noRxFrames;
+    _statistics.noRxBytes += len;
+
+    if(_isRxInterruptEnabled)
+    {
+#if ETH_RX_INTERRUPT_MITIGATION == 1
+        _isRxInterruptEnabled = false;
+#endif
+        return true;
+    }
+    else
+        return false;
+
+} /* receiveFrame */
+
+
+/**
+ * Read the next record from the replayed pcap file and compute its time of reception.
+ * Records, which are too long, are skipped.
+ *   @return
+ * Get \a true if a record is pending for reception, or \a false at the end of the file.
+ */
+static bool readNextPcapRecord(void)
+{
+    _isPcapRecordPending = false;
+    if(_hPcapReplay == NULL)
+        return false;
+
+    uint8_t hdr[16];
+    while(fread(hdr, sizeof(hdr), 1u, _hPcapReplay) == 1u)
+    {
+        const uint32_t tiSec = rd32(&hdr[0])
+                     , tiSubSec = rd32(&hdr[4])
+                     , inclLen = rd32(&hdr[8]);
+        if(inclLen > MAX_SIZE_OF_PCAP_RECORD
+           ||  fread(_pcapRecord, 1u, inclLen, _hPcapReplay) != inclLen
+          )
+        {
+            fprintf(stderr, "hed_openPcapReplay: Bad or truncated record in pcap file\n");
+            break;
+        }
+
+        const int64_t tiRecord = (int64_t)tiSec * 1000000000ll
+                                 + (int64_t)tiSubSec * (_isPcapReplayNs? 1: 1000);
+        if(_tiPcapRecordFirst < 0)
+            _tiPcapRecordFirst = tiRecord;
+
+        if(_replaySpeedFactor > 0.0)
+        {
+            int64_t tiDelta = (int64_t)((double)(tiRecord - _tiPcapRecordFirst)
+                                        / _replaySpeedFactor
+                                       );
+            _tiPcapRecord = tiDelta > _tiPcapRecord? tiDelta: _tiPcapRecord;
+        }
+
+        _sizeOfPcapRecord = inclLen;
+        _isPcapRecordPending = true;
+        return true;
+    }
+    return false;
+
+} /* readNextPcapRecord */
+
+
+/**
+ * Append a sent frame to the pcap output file.
+ *   @param pFrame
+ * The frame.
+ */
+static void writePcapRecord(const txFrame_t *pFrame)
+{
+    const uint32_t hdr[4] = { [0] = (uint32_t)(pFrame->tiCompletion / 1000000000ll),
+                              [1] = (uint32_t)(pFrame->tiCompletion % 1000000000ll / 1000),
+                              [2] = pFrame->length,
+                              [3] = pFrame->length,
+                            };
+    fwrite(hdr, sizeof(hdr), 1u, _hPcapOutput);
+    fwrite(pFrame->frame, pFrame->length, 1u, _hPcapOutput);
+
+} /* writePcapRecord */
+
+
+/**
+ * System call #ETH_SYSCALL_SET_MULTICAST_FORWARD.
+ */
+static void scSetMulticastForward( unsigned int idxEthDev
+                                 , const uint8_t *macAddr
+                                 , bool enable
+                                 )
+{
+    if(idxEthDev != 0u  ||  macAddr == NULL)
+        badSystemCall("setMulticastForward");
+
+    unsigned int idx;
+    for(idx=0u; idx<_noMulticastAddrs; ++idx)
+        if(memcmp(_multicastAddrAry[idx], macAddr, 6u) == 0)
+            break;
+
+    if(enable  &&  idx == _noMulticastAddrs  &&  _noMulticastAddrs < MAX_NO_MULTICAST_ADDRS)
+        memcpy(_multicastAddrAry[_noMulticastAddrs++], macAddr, 6u);
+    else if(!enable  &&  idx < _noMulticastAddrs)
+    {
+        -- _noMulticastAddrs;
+        memcpy(_multicastAddrAry[idx], _multicastAddrAry[_noMulticastAddrs], 6u);
+    }
+} /* scSetMulticastForward */
+
+
+/**
+ * System call #ETH_SYSCALL_PROVIDE_RX_BUFF.
+ */
+static void scProvideRxBuff(unsigned int idxEthDev, unsigned int idxRing, void *pBufferMem)
+{
+    if(idxEthDev != 0u  ||  idxRing != ETH_ENET0_IDX_RING_IN_USE)
+        badSystemCall("releaseRxFramePayloadBuffer");
+
+    for(unsigned int idxBuf=0u; idxBuf<ETH_ENET0_RING0_NO_RXBD; ++idxBuf)
+    {
+        if(pBufferMem == _rxBufferAry[idxBuf].frame)
+        {
+            if(_rxBufferAry[idxBuf].state != rxBuf_client)
+                badSystemCall("Rx buffer is not owned by the client");
+            _rxBufferAry[idxBuf].state = rxBuf_free;
+            return;
+        }
+    }
+    badSystemCall("Rx buffer address");
+
+} /* scProvideRxBuff */
+
+
+/**
+ * Fetch the next filled Rx buffer.
+ *   @return
+ * Get \a true if a frame was returned in * \a pFrameDesc.
+ *   @param pFrameDesc
+ * The frame is returned by reference.
+ */
+static bool fetchFrame(struct eth_bufferDesc_t *pFrameDesc)
+{
+    if(_idxRxFifoRd == _idxRxFifoWr)
+        return false;
+
+    rxBuffer_t * const pBuf = &_rxBufferAry[_rxFifo[_idxRxFifoRd % ETH_ENET0_RING0_NO_RXBD]];
+    ++ _idxRxFifoRd;
+    assert(pBuf->state == rxBuf_filled);
+    pBuf->state = rxBuf_client;
+    pFrameDesc->data = pBuf->frame;
+    pFrameDesc->length = (uint16_t)pBuf->length;
+
+    if(_tiRxUnanswered < 0)
+        _tiRxUnanswered = pBuf->tiRx;
+
+    return true;
+
+} /* fetchFrame */
+
+
+/**
+ * System call #ETH_SYSCALL_READ_FRAME.
+ */
+static const struct eth_bufferDesc_t *scReadFrame(unsigned int idxEthDev, unsigned int idxRing)
+{
+    if(idxEthDev != 0u  ||  idxRing != ETH_ENET0_IDX_RING_IN_USE)
+        badSystemCall("readFrame");
+
+    return fetchFrame(&_rxFrameDesc)? &_rxFrameDesc: NULL;
+
+} /* scReadFrame */
+
+
+/**
+ * System call #ETH_SYSCALL_READ_FRAMES.
+ */
+static const struct eth_rxFrameBatch_t *scReadFrames( unsigned int idxEthDev
+                                                    , unsigned int idxRing
+                                                    , unsigned int maxNoFrames
+                                                    )
+{
+    if(idxEthDev != 0u  ||  idxRing != ETH_ENET0_IDX_RING_IN_USE
+       ||  maxNoFrames < 1u  ||  maxNoFrames > ETH_MAX_NO_RX_FRAMES_PER_READ
+      )
+    {
+        badSystemCall("readFrames");
+    }
+
+    _rxFrameBatch.noFrames = 0u;
+    while(_rxFrameBatch.noFrames < maxNoFrames
+          &&  fetchFrame(&_rxFrameBatch.frameDescAry[_rxFrameBatch.noFrames])
+         )
+    {
+        ++ _rxFrameBatch.noFrames;
+    }
+    return &_rxFrameBatch;
+
+} /* scReadFrames */
+
+
+/**
+ * System call #ETH_SYSCALL_SEND_FRAME.
+ */
+static uint32_t scSendFrame( unsigned int idxEthDev
+                           , unsigned int idxRing
+                           , const struct eth_bufferDesc_t fragmentAry[]
+                           , unsigned int noFragments
+                           )
+{
+    if(idxEthDev != 0u  ||  idxRing != ETH_ENET0_IDX_RING_IN_USE  ||  fragmentAry == NULL
+       ||  noFragments < 1u  ||  noFragments > ETH_MAX_NO_TX_FRAGMENTS
+      )
+    {
+        badSystemCall("sendFrameFragments");
+    }
+
+    if(_noTxBDInUse + noFragments > ETH_ENET0_RING0_NO_TXBD)
+    {
+        ++ _statistics.noTxFramesRejected;
+        return 0u;
+    }
+    assert(_idxTxFifoWr - _idxTxFifoRd < ETH_ENET0_RING0_NO_TXBD);
+
+    /* The DMA of the ENET reads the fragments later but the data must not change
+       meanwhile. Copying them now is equivalent. */
+    txFrame_t * const pFrame = &_txFifo[_idxTxFifoWr % ETH_ENET0_RING0_NO_TXBD];
+    unsigned int len = 0u;
+    for(unsigned int idxFrag=0u; idxFrag<noFragments; ++idxFrag)
+    {
+        const struct eth_bufferDesc_t * const pFrag = &fragmentAry[idxFrag];
+        if(pFrag->data == NULL  ||  len + pFrag->length > HED_MAX_FRAME_LEN)
+            badSystemCall("Tx fragment");
+        memcpy(&pFrame->frame[len], pFrag->data, pFrag->length);
+        len += pFrag->length;
+    }
+    insertChecksums(pFrame->frame, len);
+
+    /* The frame starts when the link is free and it occupies the link according to its
+       length, including padding and the overhead. */
+    const int64_t tiNow = hen_getTimeInNs();
+    const unsigned int noBytesOnLink = (len < MIN_FRAME_LEN? MIN_FRAME_LEN: len)
+                                       + LINK_OVERHEAD_PER_FRAME;
+    const int64_t tiStart = _tiLinkFree > tiNow? _tiLinkFree: tiNow;
+    _tiLinkFree = tiStart + (int64_t)noBytesOnLink * 8000 / _linkRateInMbps;
+
+    if(++_hTxFrameLast == 0u)
+        _hTxFrameLast = 1u;
+    pFrame->hFrame = _hTxFrameLast;
+    pFrame->noFragments = noFragments;
+    pFrame->tiCompletion = _tiLinkFree;
+    pFrame->isCompleted = false;
+    pFrame->isReleased = false;
+    pFrame->length = len;
+    ++ _idxTxFifoWr;
+    _noTxBDInUse += noFragments;
+
+    if(_tiRxUnanswered >= 0)
+    {
+        const int64_t tiLatency = tiNow - _tiRxUnanswered;
+        if(_statistics.noLatencySamples == 0u
+           ||  tiLatency < _statistics.tiLatencyMinInNs
+          )
+        {
+            _statistics.tiLatencyMinInNs = tiLatency;
+        }
+        if(tiLatency > _statistics.tiLatencyMaxInNs)
+            _statistics.tiLatencyMaxInNs = tiLatency;
+        _statistics.tiLatencySumInNs += tiLatency;
+        ++ _statistics.noLatencySamples;
+        _tiRxUnanswered = -1;
+    }
+
+    return pFrame->hFrame;
+
+} /* scSendFrame */
+
+
+/**
+ * System call #ETH_SYSCALL_IS_TRANSMISSION_COMPLETED.
+ */
+static bool scIsTransmissionCompleted(uintptr_t hTxFrame)
+{
+    if(hTxFrame == 0u  ||  hTxFrame > UINT32_MAX)
+        badSystemCall("isTransmissionCompleted");
+
+    for(unsigned int idx=_idxTxFifoRd; idx!=_idxTxFifoWr; ++idx)
+    {
+        txFrame_t * const pFrame = &_txFifo[idx % ETH_ENET0_RING0_NO_TXBD];
+        if(pFrame->hFrame == hTxFrame)
+        {
+            if(!pFrame->isCompleted)
+                return false;
+            pFrame->isReleased = true;
+
+            /* The descriptors are used in ring order. They become free in this order,
+               too. */
+            while(_idxTxFifoRd != _idxTxFifoWr
+                  &&  _txFifo[_idxTxFifoRd % ETH_ENET0_RING0_NO_TXBD].isReleased
+                 )
+            {
+                _noTxBDInUse -= _txFifo[_idxTxFifoRd % ETH_ENET0_RING0_NO_TXBD].noFragments;
+                ++ _idxTxFifoRd;
+            }
+            return true;
+        }
+    }
+
+    /* The frame has been released before. Its descriptors have been reused or are empty,
+       the ENET driver reports them as completed. */
+    return true;
+
+} /* scIsTransmissionCompleted */
+
+
+/**
+ * System call #ETH_SYSCALL_SEND_FRAMES.
+ */
+static unsigned int scSendFrames( unsigned int idxEthDev
+                                , unsigned int idxRing
+                                , const struct eth_txFrameDesc_t frameDescAry[]
+                                , unsigned int noFrames
+                                )
+{
+    if(frameDescAry == NULL  ||  noFrames < 1u  ||  noFrames > ETH_MAX_NO_TX_FRAMES_PER_SEND)
+        badSystemCall("sendFrames");
+
+    unsigned int noFramesSent;
+    for(noFramesSent=0u; noFramesSent<noFrames; ++noFramesSent)
+    {
+        const struct eth_txFrameDesc_t * const pFrameDesc = &frameDescAry[noFramesSent];
+        const uint32_t hTxFrame = scSendFrame( idxEthDev
+                                             , idxRing
+                                             , pFrameDesc->fragmentAry
+                                             , pFrameDesc->noFragments
+                                             );
+        if(hTxFrame == 0u)
+            break;
+
+        assert(_idxTxPendingFrameWr - _idxTxPendingFrameRd < ETH_ENET0_RING0_NO_TXBD);
+        _hTxPendingFrameAry[_idxTxPendingFrameWr++ % ETH_ENET0_RING0_NO_TXBD] = hTxFrame;
+    }
+    return noFramesSent;
+
+} /* scSendFrames */
+
+
+/**
+ * System call #ETH_SYSCALL_GET_NO_TRANSMISSIONS_COMPLETED.
+ */
+static unsigned int scGetNoTransmissionsCompleted(unsigned int idxEthDev, unsigned int idxRing)
+{
+    if(idxEthDev != 0u  ||  idxRing != ETH_ENET0_IDX_RING_IN_USE)
+        badSystemCall("getNoTransmissionsCompleted");
+
+    unsigned int noFramesCompleted = 0u;
+    while(_idxTxPendingFrameRd != _idxTxPendingFrameWr
+          &&  scIsTransmissionCompleted
+                    (_hTxPendingFrameAry[_idxTxPendingFrameRd % ETH_ENET0_RING0_NO_TXBD])
+         )
+    {
+        ++ _idxTxPendingFrameRd;
+        ++ noFramesCompleted;
+    }
+    return noFramesCompleted;
+
+} /* scGetNoTransmissionsCompleted */
+
+
+/**
+ * System call #ETH_SYSCALL_ENABLE_RX_INTERRUPT.
+ */
+static bool scEnableRxInterrupt(unsigned int idxEthDev)
+{
+    if(idxEthDev != 0u)
+        badSystemCall("enableRxInterrupt");
+
+    if(_idxRxFifoRd != _idxRxFifoWr)
+        return false;
+    _isRxInterruptEnabled = true;
+    return true;
+
+} /* scEnableRxInterrupt */
+
+
+/**
+ * Open an existing TAP interface of the host as Ethernet link. The interface needs to be
+ * created and configured beforehand, see readMe.adoc.
+ *   @return
+ * Get \a true if the interface could be opened. An error message has been printed
+ * otherwise.
+ *   @param ifName
+ * The name of the TAP interface, e.g., "tap0".
+ */
+bool hed_openTap(const char *ifName)
+{
+    _fdTap = open("/dev/net/tun", O_RDWR | O_NONBLOCK);
+    if(_fdTap < 0)
+    {
+        fprintf(stderr, "hed_openTap: Can't open /dev/net/tun: %s\n", strerror(errno));
+        return false;
+    }
+
+    struct ifreq ifr;
+    memset(&ifr, 0, sizeof(ifr));
+    ifr.ifr_flags = IFF_TAP | IFF_NO_PI;
+    strncpy(ifr.ifr_name, ifName, IFNAMSIZ-1u);
+    if(ioctl(_fdTap, TUNSETIFF, &ifr) < 0)
+    {
+        fprintf(stderr, "hed_openTap: Can't attach to %s: %s\n", ifName, strerror(errno));
+        close(_fdTap);
+        _fdTap = -1;
+        return false;
+    }
+    return true;
+
+} /* hed_openTap */
+
+
+/**
+ * Open a pcap file, whose frames are received one after another. Only files with
+ * link-layer type Ethernet are supported. The frames need to be recorded without CRC.
+ *   @return
+ * Get \a true if the file could be opened. An error message has been printed otherwise.
+ *   @param fileName
+ * The name of the pcap file.
+ *   @param speedFactor
+ * The time between two frames is the time between the timestamps of their records,
+ * divided by \a speedFactor. Zero means to receive the frames as fast as possible; a frame
+ * is received as soon as the Rx ring has a free buffer.
+ */
+bool hed_openPcapReplay(const char *fileName, double speedFactor)
+{
+    _hPcapReplay = fopen(fileName, "rb");
+    if(_hPcapReplay == NULL)
+    {
+        fprintf( stderr
+               , "hed_openPcapReplay: Can't open %s: %s\n"
+               , fileName
+               , strerror(errno)
+               );
+        return false;
+    }
+
+    uint8_t hdr[24];
+    bool success = fread(hdr, sizeof(hdr), 1u, _hPcapReplay) == 1u;
+    if(success)
+    {
+        uint32_t magic;
+        memcpy(&magic, hdr, sizeof(magic));
+        _isPcapReplaySwapped = magic == 0xD4C3B2A1u  ||  magic == 0x4D3CB2A1u;
+        magic = rd32(&hdr[0]);
+        _isPcapReplayNs = magic == 0xA1B23C4Du;
+        success = (magic == 0xA1B2C3D4u  ||  magic == 0xA1B23C4Du)
+                  &&  (rd32(&hdr[20]) & 0xFFFFu) == 1u /* LINKTYPE_ETHERNET */;
+    }
+    if(!success)
+    {
+        fprintf(stderr, "hed_openPcapReplay: %s is no Ethernet pcap file\n", fileName);
+        fclose(_hPcapReplay);
+        _hPcapReplay = NULL;
+        return false;
+    }
+
+    _replaySpeedFactor = speedFactor;
+    readNextPcapRecord();
+    return true;
+
+} /* hed_openPcapReplay */
+
+
+/**
+ * Open a pcap file, which records all sent frames.
+ *   @return
+ * Get \a true if the file could be created. An error message has been printed otherwise.
+ *   @param fileName
+ * The name of the pcap file.
+ */
+bool hed_openPcapOutput(const char *fileName)
+{
+    _hPcapOutput = fopen(fileName, "wb");
+    if(_hPcapOutput == NULL)
+    {
+        fprintf( stderr
+               , "hed_openPcapOutput: Can't create %s: %s\n"
+               , fileName
+               , strerror(errno)
+               );
+        return false;
+    }
+
+    const uint32_t magic = 0xA1B2C3D4u, snapLen = 65535u, linkType = 1u;
+    const uint16_t versionMajor = 2u, versionMinor = 4u;
+    const int32_t thisZone = 0;
+    const uint32_t sigFigs = 0u;
+    fwrite(&magic, sizeof(magic), 1u, _hPcapOutput);
+    fwrite(&versionMajor, sizeof(versionMajor), 1u, _hPcapOutput);
+    fwrite(&versionMinor, sizeof(versionMinor), 1u, _hPcapOutput);
+    fwrite(&thisZone, sizeof(thisZone), 1u, _hPcapOutput);
+    fwrite(&sigFigs, sizeof(sigFigs), 1u, _hPcapOutput);
+    fwrite(&snapLen, sizeof(snapLen), 1u, _hPcapOutput);
+    fwrite(&linkType, sizeof(linkType), 1u, _hPcapOutput);
+    return true;
+
+} /* hed_openPcapOutput */
+
+
+/**
+ * Set the emulated link rate. The rate determines the time a frame needs for
+ * transmission.
+ *   @param linkRateInMbps
+ * The link rate in Mbit/s. Range is 1..10000.
+ */
+void hed_setLinkRate(unsigned int linkRateInMbps)
+{
+    assert(linkRateInMbps >= 1u  &&  linkRateInMbps <= 10000u);
+    _linkRateInMbps = linkRateInMbps;
+
+} /* hed_setLinkRate */
+
+
+/**
+ * Get the file descriptor, which becomes readable on frame reception.
+ *   @return
+ * Get the file descriptor of the TAP interface or -1 if it is not in use.
+ */
+int hed_getFileDescriptor(void)
+{
+    return _fdTap;
+
+} /* hed_getFileDescriptor */
+
+
+/**
+ * Get the time of the next event, which the driver emulation will notify, without
+ * considering frame reception from the TAP interface. These are the completion of a Tx
+ * frame and the reception of the next frame of the pcap replay.
+ *   @return
+ * Get the time of the next event or INT64_MAX if no such event is pending.
+ */
+int64_t hed_getTiNextEvent(void)
+{
+    int64_t tiNext = INT64_MAX;
+    for(unsigned int idx=_idxTxFifoRd; idx!=_idxTxFifoWr; ++idx)
+    {
+        const txFrame_t * const pFrame = &_txFifo[idx % ETH_ENET0_RING0_NO_TXBD];
+        if(!pFrame->isCompleted)
+        {
+            tiNext = pFrame->tiCompletion;
+            break;
+        }
+    }
+
+    /* In the as-fast-as-possible replay, the next frame is due as soon as a buffer is
+       free. The time of the last reception is kept for it. */
+    if(_isPcapRecordPending)
+    {
+        bool isDue = true;
+        if(_replaySpeedFactor <= 0.0)
+        {
+            isDue = false;
+            for(unsigned int idxBuf=0u; idxBuf<ETH_ENET0_RING0_NO_RXBD; ++idxBuf)
+                if(_rxBufferAry[idxBuf].state == rxBuf_free)
+                    isDue = true;
+        }
+        if(isDue  &&  _tiPcapRecord < tiNext)
+            tiNext = _tiPcapRecord;
+    }
+    return tiNext;
+
+} /* hed_getTiNextEvent */
+
+
+/**
+ * Query if all frames of the pcap replay have been received.
+ *   @return
+ * Get \a true if the replay is done or if no pcap file is replayed.
+ */
+bool hed_isEndOfReplay(void)
+{
+    return !_isPcapRecordPending;
+
+} /* hed_isEndOfReplay */
+
+
+/**
+ * Do the frame reception and transmission, which is due at the current time, see
+ * hen_getTimeInNs(), and count the interrupts. The counts are the notifications, which
+ * the target's basic software would pass to the IP task.
+ *   @param pNoNotificationsRx
+ * The number of Rx interrupts is added to * \a pNoNotificationsRx.
+ *   @param pNoNotificationsTx
+ * The number of Tx interrupts is added to * \a pNoNotificationsTx.
+ */
+void hed_processEvents(unsigned int *pNoNotificationsRx, unsigned int *pNoNotificationsTx)
+{
+    const int64_t tiNow = hen_getTimeInNs();
+
+    /* Frames, which have completed transmission, are passed on to the link and raise the
+       Tx interrupt. */
+    for(unsigned int idx=_idxTxFifoRd; idx!=_idxTxFifoWr; ++idx)
+    {
+        txFrame_t * const pFrame = &_txFifo[idx % ETH_ENET0_RING0_NO_TXBD];
+        if(pFrame->isCompleted)
+            continue;
+        else if(pFrame->tiCompletion > tiNow)
+            break;
+
+        pFrame->isCompleted = true;
+        ++ _statistics.noTxFrames;
+        _statistics.noTxBytes += pFrame->length;
+        ++ *pNoNotificationsTx;
+
+        if(_fdTap >= 0)
+        {
+            /* A frame is lost if the host can't take it, like on a congested link. EIO
+               means that the TAP interface is down, like a cable, which is not plugged. */
+            if(write(_fdTap, pFrame->frame, pFrame->length) < 0
+               &&  errno != EAGAIN  &&  errno != EIO
+              )
+            {
+                fprintf(stderr, "hed_processEvents: Can't send frame: %s\n", strerror(errno));
+            }
+        }
+        if(_hPcapOutput != NULL)
+            writePcapRecord(pFrame);
+    }
+
+    /* Frames from the TAP interface are received immediately. The MAC drops those, which
+       don't find a free buffer. */
+    if(_fdTap >= 0)
+    {
+        uint8_t frame[HED_MAX_FRAME_LEN + 100u];
+        ssize_t len;
+        while((len = read(_fdTap, frame, sizeof(frame))) > 0)
+        {
+            if(receiveFrame(frame, (unsigned int)len))
+                ++ *pNoNotificationsRx;
+        }
+    }
+
+    /* Frames from the replay are received when due. In the as-fast-as-possible mode,
+       they wait for a free buffer. */
+    while(_isPcapRecordPending  &&  _tiPcapRecord <= tiNow)
+    {
+        if(_replaySpeedFactor <= 0.0)
+        {
+            bool isBufferFree = false;
+            for(unsigned int idxBuf=0u; idxBuf<ETH_ENET0_RING0_NO_RXBD; ++idxBuf)
+                if(_rxBufferAry[idxBuf].state == rxBuf_free)
+                    isBufferFree = true;
+            if(!isBufferFree)
+            {
+                /* The next frame is due at the time a buffer becomes free. */
+                _tiPcapRecord = tiNow;
+                break;
+            }
+        }
+
+        if(receiveFrame(_pcapRecord, _sizeOfPcapRecord))
+            ++ *pNoNotificationsRx;
+        readNextPcapRecord();
+    }
+} /* hed_processEvents */
+
+
+/**
+ * The system calls of the Ethernet driver. The function is called from rtos_systemCall().
+ *   @return
+ * Get the result of the system call.
+ *   @param idxSysCall
+ * The index of the system call, #ETH_SYSCALL_SET_MULTICAST_FORWARD ...
+ * #ETH_SYSCALL_GET_NO_TRANSMISSIONS_COMPLETED.
+ *   @param ap
+ * The arguments of the system call, see the inline API functions in eth_ethernet.h.
+ */
+uint32_t hed_systemCall(uint32_t idxSysCall, va_list ap)
+{
+    /* Pointers are returned as 32 Bit integer. The makefile links the executable without
+       position independence such that the static data objects have small addresses. */
+    _Static_assert(ETH_ENET0_IDX_RING_IN_USE == 0u, "Unexpected driver configuration");
+    assert((uintptr_t)&_rxFrameBatch <= UINT32_MAX  &&  (uintptr_t)&_rxFrameDesc <= UINT32_MAX);
+
+    switch(idxSysCall)
+    {
+    case ETH_SYSCALL_SET_MULTICAST_FORWARD:
+    {
+        const unsigned int idxEthDev = va_arg(ap, unsigned int);
+        const uint8_t * const macAddr = va_arg(ap, const uint8_t *);
+        const bool enable = (bool)va_arg(ap, int);
+        scSetMulticastForward(idxEthDev, macAddr, enable);
+        return 0u;
+    }
+    case ETH_SYSCALL_PROVIDE_RX_BUFF:
+    {
+        const unsigned int idxEthDev = va_arg(ap, unsigned int)
+                         , idxRing = va_arg(ap, unsigned int);
+        void * const pBufferMem = va_arg(ap, void *);
+        scProvideRxBuff(idxEthDev, idxRing, pBufferMem);
+        return 0u;
+    }
+    case ETH_SYSCALL_READ_FRAME:
+    {
+        const unsigned int idxEthDev = va_arg(ap, unsigned int)
+                         , idxRing = va_arg(ap, unsigned int);
+        return (uint32_t)(uintptr_t)scReadFrame(idxEthDev, idxRing);
+    }
+    case ETH_SYSCALL_SEND_FRAME:
+    {
+        const unsigned int idxEthDev = va_arg(ap, unsigned int)
+                         , idxRing = va_arg(ap, unsigned int);
+        const struct eth_bufferDesc_t * const fragmentAry =
+                                                va_arg(ap, const struct eth_bufferDesc_t *);
+        const unsigned int noFragments = va_arg(ap, unsigned int);
+        return scSendFrame(idxEthDev, idxRing, fragmentAry, noFragments);
+    }
+    case ETH_SYSCALL_IS_TRANSMISSION_COMPLETED:
+        return (uint32_t)scIsTransmissionCompleted(va_arg(ap, uintptr_t));
+    case ETH_SYSCALL_READ_FRAMES:
+    {
+        const unsigned int idxEthDev = va_arg(ap, unsigned int)
+                         , idxRing = va_arg(ap, unsigned int)
+                         , maxNoFrames = va_arg(ap, unsigned int);
+        return (uint32_t)(uintptr_t)scReadFrames(idxEthDev, idxRing, maxNoFrames);
+    }
+    case ETH_SYSCALL_ENABLE_RX_INTERRUPT:
+        return (uint32_t)scEnableRxInterrupt(va_arg(ap, unsigned int));
+    case ETH_SYSCALL_SEND_FRAMES:
+    {
+        const unsigned int idxEthDev = va_arg(ap, unsigned int)
+                         , idxRing = va_arg(ap, unsigned int);
+        const struct eth_txFrameDesc_t * const frameDescAry =
+                                            va_arg(ap, const struct eth_txFrameDesc_t *);
+        const unsigned int noFrames = va_arg(ap, unsigned int);
+        return scSendFrames(idxEthDev, idxRing, frameDescAry, noFrames);
+    }
+    case ETH_SYSCALL_GET_NO_TRANSMISSIONS_COMPLETED:
+    {
+        const unsigned int idxEthDev = va_arg(ap, unsigned int)
+                         , idxRing = va_arg(ap, unsigned int);
+        return scGetNoTransmissionsCompleted(idxEthDev, idxRing);
+    }
+    default:
+        badSystemCall("Unknown Ethernet system call");
+    }
+} /* hed_systemCall */
+
+
+/**
+ * Get the statistics of the driver emulation.
+ *   @param pStatistics
+ * The statistics are returned by reference.
+ *   @param reset
+ * If \a true then the statistics are reset after reading.
+ */
+void hed_getStatistics(struct hed_statistics_t *pStatistics, bool reset)
+{
+    *pStatistics = _statistics;
+    if(reset)
+        memset(&_statistics, 0, sizeof(_statistics));
+
+} /* hed_getStatistics */
+
+
+/**
+ * Close all files of the driver emulation.
+ */
+void hed_close(void)
+{
+    if(_fdTap >= 0)
+    {
+        close(_fdTap);
+        _fdTap = -1;
+    }
+    if(_hPcapReplay != NULL)
+    {
+        fclose(_hPcapReplay);
+        _hPcapReplay = NULL;
+        _isPcapRecordPending = false;
+    }
+    if(_hPcapOutput != NULL)
+    {
+        fclose(_hPcapOutput);
+        _hPcapOutput = NULL;
+    }
+} /* hed_close */
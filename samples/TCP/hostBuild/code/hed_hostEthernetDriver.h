@@ -0,0 +1,123 @@
+#ifndef HED_HOSTETHERNETDRIVER_INCLUDED
+#define HED_HOSTETHERNETDRIVER_INCLUDED
+/**
+ * @file hed_hostEthernetDriver.h
+ * Definition of global interface of module hed_hostEthernetDriver.c
+ *
+ * Copyright (C) 2026 Peter Vranken (mailto:Peter_Vranken@Yahoo.de)
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Include files
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdarg.h>
+
+
+/*
+ * Defines
+ */
+
+/** The maximum length of a frame, without CRC. It's the same as configured for the ENET
+    of the target. Longer frames are discarded on reception. */
+#define HED_MAX_FRAME_LEN           1518u
+
+/** The default emulated link rate in Mbit/s. The DEVKIT-MPC5748G has a 100 Mbit/s PHY. */
+#define HED_DEFAULT_LINK_RATE       100u
+
+
+/*
+ * Global type definitions
+ */
+
+/** The statistics of the emulated Ethernet driver. */
+struct hed_statistics_t
+{
+    /** The number of frames and bytes, which have been put into the Rx ring. */
+    uint64_t noRxFrames, noRxBytes;
+
+    /** The number of frames, which have been lost since the Rx ring was full. */
+    uint64_t noRxFramesLost;
+
+    /** The number of frames, which have been discarded by the MAC address filter. */
+    uint64_t noRxFramesFiltered;
+
+    /** The number of frames and bytes, which have been sent. */
+    uint64_t noTxFrames, noTxBytes;
+
+    /** The number of send requests, which have been rejected since too few Tx buffer
+        descriptors were free. */
+    uint64_t noTxFramesRejected;
+
+    /** The number of response latency samples, see hed_hostEthernetDriver.c. */
+    uint64_t noLatencySamples;
+
+    /** The sum, minimum and maximum of the response latency samples in ns. */
+    int64_t tiLatencySumInNs, tiLatencyMinInNs, tiLatencyMaxInNs;
+};
+
+
+/*
+ * Global data declarations
+ */
+
+
+/*
+ * Global prototypes
+ */
+
+/** Open an existing TAP interface of the host as Ethernet link. */
+bool hed_openTap(const char *ifName);
+
+/** Open a pcap file, whose frames are received one after another. */
+bool hed_openPcapReplay(const char *fileName, double speedFactor);
+
+/** Open a pcap file, which records all sent frames. */
+bool hed_openPcapOutput(const char *fileName);
+
+/** Set the emulated link rate. */
+void hed_setLinkRate(unsigned int linkRateInMbps);
+
+/** Get the file descriptor, which becomes readable on frame reception. */
+int hed_getFileDescriptor(void);
+
+/** Get the time of the next event, which the driver emulation will notify. */
+int64_t hed_getTiNextEvent(void);
+
+/** Query if all frames of the pcap replay have been received. */
+bool hed_isEndOfReplay(void);
+
+/** Do the frame reception and transmission, which is due, and count the interrupts. */
+void hed_processEvents(unsigned int *pNoNotificationsRx, unsigned int *pNoNotificationsTx);
+
+/** The system calls of the Ethernet driver. */
+uint32_t hed_systemCall(uint32_t idxSysCall, va_list ap);
+
+/** Get the statistics of the driver emulation. */
+void hed_getStatistics(struct hed_statistics_t *pStatistics, bool reset);
+
+/** Close all files of the driver emulation. */
+void hed_close(void);
+
+
+/*
+ * Global inline functions
+ */
+
+
+#endif  /* HED_HOSTETHERNETDRIVER_INCLUDED */
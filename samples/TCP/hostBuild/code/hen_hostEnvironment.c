@@ -0,0 +1,451 @@
+/**
+ * @file hen_hostEnvironment.c
+ * Host build: Replacement of those services of the target's basic software, system
+ * drivers, C library and console task, which the IP stack and its applications depend
+ * on. The services are the time bases, the newlib extensions of the C library, the system
+ * call entry and the few functions of the application task, which are called by the IP
+ * applications.\n
+ *   The system time is either the real time of the host or a virtual time, which is
+ * advanced by the caller, see hen_setVirtualTime(). The virtual time makes a replay of
+ * recorded traffic deterministic and independent of the host's speed.\n
+ *   The system calls of the Ethernet driver are delegated to the Ethernet driver
+ * emulation, see hed_hostEthernetDriver.c. The only other system calls made by the IP
+ * applications are the queued sending of CAN frames by the CAN-over-UDP gateway, these
+ * frames are just counted, and the IP task triggering itself, see
+ * hen_isEthernetTaskRetriggered().
+ *
+ * Copyright (C) 2026 Peter Vranken (mailto:Peter_Vranken@Yahoo.de)
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+/* Module interface
+ *   iprintf
+ *   dlg_log
+ *   atoff
+ *   hen_getTimeInNs
+ *   hen_setVirtualTime
+ *   hen_getNoCanTxFrames
+ *   hen_setPingTargetAddress
+ *   hen_onTimerTick
+ *   hen_isEthernetTaskRetriggered
+ *   rtos_systemCall
+ *   sys_init
+ *   sys_now
+ *   sys_jiffies
+ *   stm_getSystemTime
+ *   apt_setCurrentTime
+ *   apt_printCurrTime
+ *   apt_enableRegularTimeDisplay
+ *   apt_isEnabledRegularTimeDisplay
+ *   apt_getPingTargetAddress
+ * Local functions
+ */
+
+/*
+ * Include files
+ */
+
+#include "hen_hostEnvironment.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <time.h>
+#include <assert.h>
+
+#include "rtos.h"
+#include "bsw_taskEthernet.h"
+#include "cdr_canDriverAPI.h"
+#include "eth_ethernet.h"
+#include "hed_hostEthernetDriver.h"
+#include "lwip/sys.h"
+#include "stm_systemTimer.h"
+#include "apt_applicationTask.h"
+#include "dlg_deferredLogging.h"
+
+
+/*
+ * Defines
+ */
+
+
+/*
+ * Local type definitions
+ */
+
+
+/*
+ * Local prototypes
+ */
+
+
+/*
+ * Data definitions
+ */
+
+/** The virtual time in ns or -1 if the real time of the host is used. */
+static int64_t _tiVirtualInNs = -1;
+
+/** The number of CAN frames, which have been sent by the IP applications. */
+static unsigned long _noCanTxFrames = 0u;
+
+/** The SW maintained time of lwIP in ms. It is advanced in the 10ms tick of the IP task,
+    like bsw_tiLwIP on the target. */
+static uint32_t _tiLwIPInMs = 0u;
+
+/** The time of day in s, which corresponds to the lwIP time zero. */
+static signed int _offsetInS = 0;
+
+/** The cycle time of the regular time display in units of the 10ms tick, or zero if the
+    display is disabled. */
+static unsigned int _tiCycleTimeDisplay = 0u;
+
+/** The counter of the regular time display. */
+static unsigned int _cntTimeDisplay = 0u;
+
+/** The target address of the lwIP ping application, or zero if ping is disabled. */
+static uint32_t _pingAddr = 0u;
+
+/** The IP task has triggered itself, see bsw_retriggerEthernetTask(). */
+static bool _isEthernetTaskRetriggered = false;
+
+
+/*
+ * Function implementation
+ */
+
+/**
+ * newlib's printf without floating point support is mapped onto printf.
+ */
+int iprintf(const char *format, ...)
+{
+    va_list ap;
+    va_start(ap, format);
+    const int noChars = vprintf(format, ap);
+    va_end(ap);
+    return noChars;
+
+} /* iprintf */
+
+
+/**
+ * The deferred logging prints the text on the host. The argument types are not needed,
+ * the arguments are passed as to printf().
+ */
+void dlg_log(const char *fmt, uint32_t argTypes, ...)
+{
+    va_list ap;
+    va_start(ap, argTypes);
+    vprintf(fmt, ap);
+    va_end(ap);
+
+} /* dlg_log */
+
+
+/**
+ * newlib's float variant of atof.
+ */
+float atoff(const char *s)
+{
+    return strtof(s, NULL);
+
+} /* atoff */
+
+
+/**
+ * Get the emulated system time.
+ *   @return
+ * Get the time in ns since process start. The value is taken from the monotonic clock of
+ * the host unless the virtual time has been enabled by hen_setVirtualTime().
+ */
+int64_t hen_getTimeInNs(void)
+{
+    if(_tiVirtualInNs >= 0)
+        return _tiVirtualInNs;
+
+    struct timespec ti;
+    clock_gettime(CLOCK_MONOTONIC, &ti);
+    const int64_t tiNowInNs = (int64_t)ti.tv_sec * 1000000000ll + (int64_t)ti.tv_nsec;
+
+    static int64_t tiStartInNs_ = -1;
+    if(tiStartInNs_ < 0)
+        tiStartInNs_ = tiNowInNs;
+    return tiNowInNs - tiStartInNs_;
+
+} /* hen_getTimeInNs */
+
+
+/**
+ * Switch the system time from the real time of the host to a virtual time and set this
+ * time. From now on, the time only advances by calls of this function.
+ *   @param tiNowInNs
+ * The new virtual time. The time must not go backwards.
+ */
+void hen_setVirtualTime(int64_t tiNowInNs)
+{
+    assert(tiNowInNs >= _tiVirtualInNs);
+    _tiVirtualInNs = tiNowInNs;
+
+} /* hen_setVirtualTime */
+
+
+/**
+ * Get the number of CAN frames sent by the IP applications.
+ *   @return
+ * Get the number of frames.
+ */
+unsigned long hen_getNoCanTxFrames(void)
+{
+    return _noCanTxFrames;
+
+} /* hen_getNoCanTxFrames */
+
+
+/**
+ * Set the target address of the lwIP ping application.
+ *   @param ipAddr
+ * The IPv4 address in network byte order, or zero to disable ping.
+ */
+void hen_setPingTargetAddress(uint32_t ipAddr)
+{
+    _pingAddr = ipAddr;
+
+} /* hen_setPingTargetAddress */
+
+
+/**
+ * Advance the SW maintained lwIP time by one tick of the IP task and print the time of
+ * day if regularly requested, see apt_enableRegularTimeDisplay(). To be called after each
+ * 10ms tick of the IP task; this is the order of operations of the target, too.
+ */
+void hen_onTimerTick(void)
+{
+    _tiLwIPInMs += (uint32_t)(HEN_TI_TICK_IN_NS / 1000000ll);
+
+    if(_tiCycleTimeDisplay > 0u  &&  --_cntTimeDisplay == 0u)
+    {
+        char msgTime[9];
+        apt_printCurrTime(msgTime, sizeof(msgTime));
+        iprintf("Current time is %s\r\n", msgTime);
+        _cntTimeDisplay = _tiCycleTimeDisplay;
+    }
+} /* hen_onTimerTick */
+
+
+/**
+ * Query and acknowledge the self-trigger of the IP task. On the target, the RTOS activates
+ * the task once more, if it has sent the event with bsw_retriggerEthernetTask().
+ *   @return
+ * Get \a true if the IP task needs to be activated again.
+ */
+bool hen_isEthernetTaskRetriggered(void)
+{
+    const bool isRetriggered = _isEthernetTaskRetriggered;
+    _isEthernetTaskRetriggered = false;
+    return isRetriggered;
+
+} /* hen_isEthernetTaskRetriggered */
+
+
+/**
+ * The system call entry of the RTOS. The calls of the Ethernet driver are delegated to
+ * its emulation. The queued sending of CAN frames is acknowledged and counted. Any other
+ * system call is not expected from the IP stack and its applications; it's handled like
+ * the RTOS handles a bad system call: the calling task is aborted, which is the entire
+ * process in the host build.
+ *   @return
+ * Get the result of the system call. The meaning depends on the system call.
+ *   @param idxSysCall
+ * The index of the system call.
+ */
+uint32_t rtos_systemCall(uint32_t idxSysCall, ...)
+{
+    va_list ap;
+    va_start(ap, idxSysCall);
+
+    uint32_t result;
+    if(idxSysCall >= ETH_SYSCALL_SET_MULTICAST_FORWARD
+       &&  idxSysCall <= ETH_SYSCALL_GET_NO_TRANSMISSIONS_COMPLETED
+      )
+    {
+        result = hed_systemCall(idxSysCall, ap);
+    }
+    else if(idxSysCall == CDR_SYSCALL_SEND_MESSAGE_QUEUED)
+    {
+        ++ _noCanTxFrames;
+        result = (uint32_t)cdr_errApi_noError;
+    }
+    else if(idxSysCall == RTOS_IDX_SC_SEND_EVENT)
+    {
+        /* Only the countable self-trigger of the IP task is expected. */
+        const unsigned int idEventProc = va_arg(ap, unsigned int)
+                         , noCountableTriggers = va_arg(ap, unsigned int);
+        const uint32_t evMask = va_arg(ap, uint32_t);
+        if(idEventProc != BSW_ID_EV_TRIG_INTERNET_PROTOCOL_TASK
+           ||  noCountableTriggers != 1u
+           ||  evMask != BSW_EV_RETRIGGER_ETH_TASK
+          )
+        {
+            fprintf(stderr, "rtos_systemCall: Unexpected event %u sent\n", idEventProc);
+            abort();
+        }
+        /* A countable event is always accepted; several triggers are not queued here as
+           the IP task rechecks the pending Rx frames on each activation. */
+        _isEthernetTaskRetriggered = true;
+        result = (uint32_t)true;
+    }
+    else
+    {
+        fprintf(stderr, "rtos_systemCall: Unexpected system call %u\n", idxSysCall);
+        abort();
+    }
+
+    va_end(ap);
+    return result;
+
+} /* rtos_systemCall */
+
+
+/**
+ * lwIP: Initialization of the system abstraction. Nothing to do.
+ */
+void sys_init(void)
+{}
+
+
+/**
+ * lwIP: The current time in ms, see sys_arch.c of the target.
+ */
+u32_t sys_now(void)
+{
+    return _tiLwIPInMs;
+
+} /* sys_now */
+
+
+/**
+ * lwIP: The current time in "jiffies", see sys_arch.c of the target.
+ */
+u32_t sys_jiffies(void)
+{
+    return sys_now();
+
+} /* sys_jiffies */
+
+
+/**
+ * Emulation of the three free running STM timers of the target. The units are the same
+ * as on the target.
+ *   @return
+ * Get the current counter value.
+ *   @param idxStmTimer
+ * The index of the STM system timer counter to read. The value is in the range 0..2.
+ */
+uint32_t stm_getSystemTime(unsigned int idxStmTimer)
+{
+    const int64_t tiNowInNs = hen_getTimeInNs();
+    switch(idxStmTimer)
+    {
+    case 0u:
+        return (uint32_t)(tiNowInNs * 2 / 25);
+    case 1u:
+        return (uint32_t)(tiNowInNs / STM_TIMER_1_PERIOD_IN_NS);
+    case 2u:
+        return (uint32_t)(tiNowInNs / STM_TIMER_2_PERIOD_IN_NS);
+    default:
+        assert(false);
+        return 0u;
+    }
+} /* stm_getSystemTime */
+
+
+/**
+ * Set the time of day, see target implementation in apt_applicationTask.c.
+ */
+void apt_setCurrentTime(signed int hour, signed int min, signed int sec)
+{
+    if(hour < 0)
+        hour = 0;
+    else if(hour >= 24)
+        hour = 23;
+    if(min < 0)
+        min = 0;
+    else if(min >= 60)
+        min = 59;
+    if(sec < 0)
+        sec = 0;
+    else if(sec >= 60)
+        sec = 59;
+
+    /* Consider current system time, which we don't want to reset. */
+    _offsetInS = hour*3600 + min*60 + sec - (signed int)(_tiLwIPInMs / 1000u);
+
+} /* apt_setCurrentTime */
+
+
+/**
+ * Print the time of day into a string, see target implementation in
+ * apt_applicationTask.c.
+ */
+void apt_printCurrTime(char msgTime[], unsigned int sizeOfMsgTime)
+{
+    signed int noSec = ((signed int)(_tiLwIPInMs / 1000u) + _offsetInS) % 86400;
+    if(noSec < 0)
+        noSec += 86400;
+
+    snprintf( msgTime
+            , sizeOfMsgTime
+            , "%02d:%02d:%02d"
+            , noSec / 3600
+            , noSec / 60 % 60
+            , noSec % 60
+            );
+} /* apt_printCurrTime */
+
+
+/**
+ * Enable or disable the regular display of the time of day, see target implementation in
+ * apt_applicationTask.c.
+ */
+void apt_enableRegularTimeDisplay(bool enable, unsigned int tiCycleInS)
+{
+    if(!enable)
+        tiCycleInS = 0u;
+    else if(tiCycleInS == 0u)
+        tiCycleInS = 1u;
+
+    _tiCycleTimeDisplay = 100u * tiCycleInS;
+    _cntTimeDisplay = enable? 1u: 0u;
+
+} /* apt_enableRegularTimeDisplay */
+
+
+/**
+ * Query the regular display of the time of day.
+ */
+bool apt_isEnabledRegularTimeDisplay(void)
+{
+    return _tiCycleTimeDisplay > 0u;
+
+} /* apt_isEnabledRegularTimeDisplay */
+
+
+/**
+ * Get the target address of the lwIP ping application, see hen_setPingTargetAddress().
+ */
+uint32_t apt_getPingTargetAddress(void)
+{
+    return _pingAddr;
+
+} /* apt_getPingTargetAddress */
@@ -0,0 +1,86 @@
+#ifndef HEN_HOSTENVIRONMENT_INCLUDED
+#define HEN_HOSTENVIRONMENT_INCLUDED
+/**
+ * @file hen_hostEnvironment.h
+ * Definition of global interface of module hen_hostEnvironment.c\n
+ *   Host build: The header is force-included into all compilation units by the makefile;
+ * it declares the newlib functions, which are used by the target code but which are not
+ * available in glibc.
+ *
+ * Copyright (C) 2026 Peter Vranken (mailto:Peter_Vranken@Yahoo.de)
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Include files
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+
+/*
+ * Defines
+ */
+
+/** The clock tick of the IP task in the target, which is emulated by the host build. */
+#define HEN_TI_TICK_IN_NS   10000000ll
+
+
+/*
+ * Global type definitions
+ */
+
+
+/*
+ * Global data declarations
+ */
+
+
+/*
+ * Global prototypes
+ */
+
+/** newlib: printf without support of floating point formats. */
+int iprintf(const char *format, ...);
+
+/** newlib: Conversion of a string into a float. */
+float atoff(const char *s);
+
+/** Get the emulated system time in ns. */
+int64_t hen_getTimeInNs(void);
+
+/** Switch to virtual time and advance it. */
+void hen_setVirtualTime(int64_t tiNowInNs);
+
+/** Get the number of CAN frames sent by the IP applications. */
+unsigned long hen_getNoCanTxFrames(void);
+
+/** Set the target address of the lwIP ping application. */
+void hen_setPingTargetAddress(uint32_t ipAddr);
+
+/** Advance the SW maintained lwIP time by one tick of the IP task. */
+void hen_onTimerTick(void);
+
+/** Query and acknowledge the self-trigger of the IP task. */
+bool hen_isEthernetTaskRetriggered(void);
+
+
+/*
+ * Global inline functions
+ */
+
+
+#endif  /* HEN_HOSTENVIRONMENT_INCLUDED */
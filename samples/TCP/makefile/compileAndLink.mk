@@ -299,10 +299,14 @@ $(targetDir)$(target).elf: $(if $(patchWindowsBug),$(targetDir)obj/listOfObjFile
 	$(info Linking project. Mapfile is $(targetDir)$(target).map)
 	$(gcc) $(lFlags) -o $@ $(if $(patchWindowsBug),@$<,$(objFileList)) -lm
     
-# Create hex file from linker output.
+# Create hex file from linker output. The dictionary of the format strings of the deferred
+# logging is dumped for the host side decoder, see dlg_decodeLog.c_.
 $(targetDir)$(target).s19: $(targetDir)$(target).elf
 	$(objcopy) -O ihex $< $(patsubst %.elf,%.hex,$<)
 	$(objcopy) -O symbolsrec $< $(patsubst %.elf,%.s19,$<)
+	$(objcopy) -O binary --only-section=.dlgFmtStrings                                     \
+               --set-section-flags .dlgFmtStrings=alloc,load,contents                       \
+               $< $(patsubst %.elf,%.dlgDict,$<)
 
 # Delete all dependency files ignoring (-) the return code from Windows because of non
 # existing files.